@@ -139,10 +139,44 @@ enum class EntryPoint
 {{
 {entry_points_list}
 }};
+
+const char *GetEntryPointName(EntryPoint ep);
 }}  // namespace gl
 #endif  // LIBGLESV2_ENTRY_POINTS_ENUM_AUTOGEN_H_
 """
 
+template_entry_points_enum_source = """// GENERATED FILE - DO NOT EDIT.
+// Generated by {script_name} using data from {data_source_name}.
+//
+// Copyright {year} The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// entry_points_enum_autogen.cpp:
+//   Helper methods for the GLES entry points enumeration.
+
+#include "libANGLE/entry_points_enum_autogen.h"
+
+#include "common/debug.h"
+
+namespace gl
+{{
+const char *GetEntryPointName(EntryPoint ep)
+{{
+    switch (ep)
+    {{
+{entry_point_name_cases}
+        default:
+            UNREACHABLE();
+            return "Invalid";
+    }}
+}}
+}}  // namespace gl
+"""
+
+template_entry_point_name_case = """        case EntryPoint::{name}:
+            return "{gl_name}";"""
+
 template_libgles_entry_point_source = """// GENERATED FILE - DO NOT EDIT.
 // Generated by {script_name} using data from {data_source_name}.
 //
@@ -175,13 +209,16 @@ template_entry_point_def = """{return_type}GL_APIENTRY {name}({params})
 {{
     {event_comment}EVENT("({format_params})"{comma_if_needed}{pass_params});
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = {context_getter}();
     if (context)
-    {{{packed_gl_enum_conversions}
+    {{
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::{name});{packed_gl_enum_conversions}
         context->gatherParams<EntryPoint::{name}>({internal_params});
 
         if (context->skipValidation() || Validate{name}({validate_params}))
         {{
+            ANGLE_CALL_PROFILE_EXECUTE();
             {return_if_needed}context->{name_lower_no_suffix}({internal_params});
         }}
     }}
@@ -706,6 +743,22 @@ with open(entry_points_enum_header_path, "w") as out:
     out.write(entry_points_enum)
     out.close()
 
+entry_point_name_cases = [
+    template_entry_point_name_case.format(
+        name = cmd,
+        gl_name = "Invalid" if cmd == "Invalid" else "gl" + cmd) for cmd in sorted_cmd_names]
+
+entry_points_enum_source = template_entry_points_enum_source.format(
+    script_name = os.path.basename(sys.argv[0]),
+    data_source_name = "gl.xml and gl_angle_ext.xml",
+    year = date.today().year,
+    entry_point_name_cases = "\n".join(entry_point_name_cases))
+
+entry_points_enum_source_path = path_to("libANGLE", "entry_points_enum_autogen.cpp")
+with open(entry_points_enum_source_path, "w") as out:
+    out.write(entry_points_enum_source)
+    out.close()
+
 source_includes = """
 #include "angle_gl.h"
 
@@ -22,6 +22,7 @@
 
 #include "common/angleutils.h"
 #include "common/Optional.h"
+#include "common/trace_recorder.h"
 
 namespace gl
 {
@@ -97,7 +98,25 @@ void UninitializeDebugAnnotations()
 }
 
 ScopedPerfEventHelper::ScopedPerfEventHelper(const char *format, ...)
+    : mRecordedFunctionName(nullptr)
 {
+#if defined(ANGLE_ENABLE_TRACE_RECORDER)
+    constexpr bool kRecordEntryPoints =
+        angle::IsTraceCategoryCompiledIn(angle::kEntryPointTraceCategory);
+    angle::TraceRecorder *recorder = angle::TraceRecorder::Get();
+    if (kRecordEntryPoints && recorder->isEnabled())
+    {
+        // EVENT() passes "%s" and the function name ahead of the message. The event is named
+        // after the function, and the rest is formatted when the trace is exported.
+        va_list recordedArgs;
+        va_start(recordedArgs, format);
+        mRecordedFunctionName = va_arg(recordedArgs, const char *);
+        recorder->addFormattedEvent('B', angle::kEntryPointTraceCategory, mRecordedFunctionName,
+                                    format + 2, recordedArgs);
+        va_end(recordedArgs);
+    }
+#endif  // defined(ANGLE_ENABLE_TRACE_RECORDER)
+
 #if !defined(ANGLE_ENABLE_DEBUG_TRACE)
     if (!DebugAnnotationsActive())
     {
@@ -115,6 +134,14 @@ ScopedPerfEventHelper::ScopedPerfEventHelper(const char *format, ...)
 
 ScopedPerfEventHelper::~ScopedPerfEventHelper()
 {
+#if defined(ANGLE_ENABLE_TRACE_RECORDER)
+    if (mRecordedFunctionName != nullptr)
+    {
+        angle::TraceRecorder::Get()->addEvent('E', angle::kEntryPointTraceCategory,
+                                              mRecordedFunctionName);
+    }
+#endif  // defined(ANGLE_ENABLE_TRACE_RECORDER)
+
     if (DebugAnnotationsActive())
     {
         g_debugAnnotator->endEvent();
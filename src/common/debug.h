@@ -33,6 +33,10 @@ class ScopedPerfEventHelper : angle::NonCopyable
   public:
     ScopedPerfEventHelper(const char* format, ...);
     ~ScopedPerfEventHelper();
+
+  private:
+    // Set when the begin event went to the built-in trace recorder.
+    const char *mRecordedFunctionName;
 };
 
 using LogSeverity = int;
@@ -210,7 +214,7 @@ std::ostream &FmtHexInt(std::ostream &os, T value)
 #define ERR() ANGLE_LOG(ERR)
 
 // A macro to log a performance event around a scope.
-#if defined(ANGLE_TRACE_ENABLED)
+#if defined(ANGLE_TRACE_ENABLED) || defined(ANGLE_ENABLE_TRACE_RECORDER)
 #if defined(_MSC_VER)
 #define EVENT(message, ...) gl::ScopedPerfEventHelper scopedPerfEventHelper ## __LINE__("%s" message "\n", __FUNCTION__, __VA_ARGS__);
 #else
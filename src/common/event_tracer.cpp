@@ -5,6 +5,7 @@
 #include "common/event_tracer.h"
 
 #include "common/debug.h"
+#include "common/trace_recorder.h"
 
 namespace angle
 {
@@ -21,8 +22,13 @@ const unsigned char *GetTraceCategoryEnabledFlag(const char *name)
         return categoryEnabledFlag;
     }
 
+#if defined(ANGLE_ENABLE_TRACE_RECORDER)
+    // Without a tracer in the platform, record into the built-in one.
+    return TraceRecorder::Get()->getCategoryEnabledFlag(name);
+#else
     static unsigned char disabled = 0;
     return &disabled;
+#endif  // defined(ANGLE_ENABLE_TRACE_RECORDER)
 }
 
 angle::TraceEventHandle AddTraceEvent(char phase,
@@ -35,6 +41,16 @@ angle::TraceEventHandle AddTraceEvent(char phase,
                                       const unsigned long long *argValues,
                                       unsigned char flags)
 {
+#if defined(ANGLE_ENABLE_TRACE_RECORDER)
+    TraceRecorder *recorder = TraceRecorder::Get();
+    if (recorder->ownsCategoryEnabledFlag(categoryGroupEnabled))
+    {
+        recorder->addTraceEvent(phase, categoryGroupEnabled, name, id, numArgs, argNames, argTypes,
+                                argValues, flags);
+        return static_cast<angle::TraceEventHandle>(0);
+    }
+#endif  // defined(ANGLE_ENABLE_TRACE_RECORDER)
+
     auto *platform = ANGLEPlatformCurrent();
     ASSERT(platform);
 
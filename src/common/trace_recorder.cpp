@@ -0,0 +1,654 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// trace_recorder.cpp: Implements the built-in trace event recorder.
+
+#include "common/trace_recorder.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+
+#include "common/debug.h"
+#include "common/system_utils.h"
+
+namespace angle
+{
+namespace
+{
+// The TRACE_VALUE_TYPE_* values of trace_event.h.
+constexpr unsigned char kTraceValueTypeBool       = 1;
+constexpr unsigned char kTraceValueTypeUInt       = 2;
+constexpr unsigned char kTraceValueTypeInt        = 3;
+constexpr unsigned char kTraceValueTypeDouble     = 4;
+constexpr unsigned char kTraceValueTypePointer    = 5;
+constexpr unsigned char kTraceValueTypeString     = 6;
+constexpr unsigned char kTraceValueTypeCopyString = 7;
+
+// TRACE_EVENT_FLAG_COPY and TRACE_EVENT_FLAG_HAS_ID of trace_event.h.
+constexpr unsigned char kTraceEventFlagCopy  = 1 << 0;
+constexpr unsigned char kTraceEventFlagHasID = 1 << 1;
+
+enum class Conversion
+{
+    Percent,
+    Int,
+    Long,
+    LongLong,
+    Double,
+    Pointer,
+    String,
+    Unsupported,
+};
+
+// Parses the printf conversion at |format|, which starts with '%'. Returns the length of the
+// conversion specification.
+size_t ParseConversion(const char *format, Conversion *conversionOut)
+{
+    size_t length = 1;
+    while (format[length] != '\0' && strchr("-+ #0123456789.", format[length]) != nullptr)
+    {
+        length++;
+    }
+
+    int longCount = 0;
+    while (format[length] == 'l' || format[length] == 'h')
+    {
+        longCount += (format[length] == 'l') ? 1 : 0;
+        length++;
+    }
+
+    char specifier = format[length];
+    if (specifier == '\0')
+    {
+        *conversionOut = Conversion::Unsupported;
+        return length;
+    }
+    length++;
+
+    if (strchr("diouxXc", specifier) != nullptr)
+    {
+        *conversionOut = (longCount == 0) ? Conversion::Int
+                                          : (longCount == 1 ? Conversion::Long
+                                                            : Conversion::LongLong);
+    }
+    else if (strchr("fFeEgGaA", specifier) != nullptr)
+    {
+        *conversionOut = Conversion::Double;
+    }
+    else if (specifier == 'p')
+    {
+        *conversionOut = Conversion::Pointer;
+    }
+    else if (specifier == 's')
+    {
+        *conversionOut = Conversion::String;
+    }
+    else if (specifier == '%')
+    {
+        *conversionOut = Conversion::Percent;
+    }
+    else
+    {
+        *conversionOut = Conversion::Unsupported;
+    }
+    return length;
+}
+
+uint64_t GetTimestampNanoseconds()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+}
+
+void CopyString(char *dest, const char *source)
+{
+    if (source == nullptr)
+    {
+        dest[0] = '\0';
+        return;
+    }
+    strncpy(dest, source, TraceRecorder::kMaxCopiedStringLength);
+    dest[TraceRecorder::kMaxCopiedStringLength] = '\0';
+}
+
+void WriteJSONString(std::ostringstream &json, const char *str)
+{
+    json << '"';
+    for (const char *c = str; c != nullptr && *c != '\0'; ++c)
+    {
+        switch (*c)
+        {
+            case '"':
+                json << "\\\"";
+                break;
+            case '\\':
+                json << "\\\\";
+                break;
+            case '\n':
+                json << "\\n";
+                break;
+            default:
+                if (static_cast<unsigned char>(*c) < 0x20)
+                {
+                    char escaped[8];
+                    snprintf(escaped, sizeof(escaped), "\\u%04x", *c);
+                    json << escaped;
+                }
+                else
+                {
+                    json << *c;
+                }
+                break;
+        }
+    }
+    json << '"';
+}
+
+double ToDouble(uint64_t bits)
+{
+    double value = 0.0;
+    memcpy(&value, &bits, sizeof(double));
+    return value;
+}
+
+void WriteJSONNumber(std::ostringstream &json, double value)
+{
+    // JSON has no representation of infinities and NaNs.
+    if (std::isfinite(value))
+    {
+        json << value;
+    }
+    else
+    {
+        json << "\"" << value << "\"";
+    }
+}
+
+std::string FormatPointer(uint64_t value)
+{
+    char formatted[32];
+    snprintf(formatted, sizeof(formatted), "0x%llx", static_cast<unsigned long long>(value));
+    return formatted;
+}
+
+const char *GetEnvironmentOutFile()
+{
+    static const std::string outFile = angle::GetEnvironmentVar("ANGLE_TRACE_OUT_FILE");
+    return outFile.c_str();
+}
+
+void WriteGlobalRecording()
+{
+    TraceRecorder *recorder = TraceRecorder::Get();
+    recorder->setEnabled(false);
+    if (!recorder->writeJSON(GetEnvironmentOutFile()))
+    {
+        WARN() << "Failed to write the trace to " << GetEnvironmentOutFile() << ".";
+    }
+}
+
+TraceRecorder *CreateGlobalRecorder()
+{
+    // Leaked, so that events recorded while other globals are destroyed don't touch a destroyed
+    // recorder.
+    TraceRecorder *recorder = new TraceRecorder(TraceRecorder::kDefaultEventsPerThread);
+    if (GetEnvironmentOutFile()[0] != '\0')
+    {
+        recorder->setEnabled(true);
+        atexit(WriteGlobalRecording);
+    }
+    return recorder;
+}
+}  // anonymous namespace
+
+constexpr size_t TraceRecorder::kDefaultEventsPerThread;
+constexpr size_t TraceRecorder::kMaxCategories;
+constexpr size_t TraceRecorder::kMaxArgs;
+constexpr size_t TraceRecorder::kMaxCopiedStringLength;
+
+TraceRecorder::ThreadBuffer::ThreadBuffer(size_t capacity, uint32_t threadIndex)
+    : events(capacity), writeCount(0), threadIndex(threadIndex)
+{
+}
+
+TraceRecorder::TraceRecorder(size_t eventsPerThread)
+    : mEventsPerThread(eventsPerThread),
+      mEnabled(false),
+      mThreadBufferIndex(CreateTLSIndex()),
+      mCategoryCount(0)
+{
+    ASSERT(mEventsPerThread > 0);
+}
+
+TraceRecorder::~TraceRecorder()
+{
+    DestroyTLSIndex(mThreadBufferIndex);
+}
+
+// static
+TraceRecorder *TraceRecorder::Get()
+{
+    static TraceRecorder *recorder = CreateGlobalRecorder();
+    return recorder;
+}
+
+void TraceRecorder::setEnabled(bool enabled)
+{
+    std::lock_guard<std::mutex> lock(mCategoryMutex);
+    mEnabled.store(enabled, std::memory_order_relaxed);
+    for (size_t index = 0; index < mCategoryCount; ++index)
+    {
+        mCategories[index].enabled = enabled ? 1 : 0;
+    }
+}
+
+const unsigned char *TraceRecorder::getCategoryEnabledFlag(const char *category)
+{
+    std::lock_guard<std::mutex> lock(mCategoryMutex);
+    for (size_t index = 0; index < mCategoryCount; ++index)
+    {
+        if (strcmp(mCategories[index].name, category) == 0)
+        {
+            return &mCategories[index].enabled;
+        }
+    }
+
+    if (mCategoryCount == kMaxCategories)
+    {
+        static unsigned char disabled = 0;
+        return &disabled;
+    }
+
+    Category &newCategory = mCategories[mCategoryCount++];
+    newCategory.enabled   = isEnabled() ? 1 : 0;
+    newCategory.name      = category;
+    return &newCategory.enabled;
+}
+
+bool TraceRecorder::ownsCategoryEnabledFlag(const unsigned char *categoryEnabled) const
+{
+    uintptr_t flag  = reinterpret_cast<uintptr_t>(categoryEnabled);
+    uintptr_t begin = reinterpret_cast<uintptr_t>(mCategories.data());
+    uintptr_t end   = reinterpret_cast<uintptr_t>(mCategories.data() + mCategories.size());
+    return flag >= begin && flag < end;
+}
+
+TraceRecorder::ThreadBuffer *TraceRecorder::getThreadBuffer()
+{
+    ThreadBuffer *buffer = static_cast<ThreadBuffer *>(GetTLSValue(mThreadBufferIndex));
+    if (buffer != nullptr)
+    {
+        return buffer;
+    }
+
+    // Buffers outlive their threads, so that the events of finished threads are exported too.
+    std::lock_guard<std::mutex> lock(mThreadBufferMutex);
+    mThreadBuffers.emplace_back(
+        new ThreadBuffer(mEventsPerThread, static_cast<uint32_t>(mThreadBuffers.size())));
+    buffer = mThreadBuffers.back().get();
+    SetTLSValue(mThreadBufferIndex, buffer);
+    return buffer;
+}
+
+TraceRecorder::Event *TraceRecorder::beginEvent(ThreadBuffer *buffer,
+                                                char phase,
+                                                const char *category,
+                                                const char *name)
+{
+    // Only this thread writes to the buffer.
+    uint64_t writeCount = buffer->writeCount.load(std::memory_order_relaxed);
+    Event *event        = &buffer->events[writeCount % buffer->events.size()];
+
+    event->timestamp       = GetTimestampNanoseconds();
+    event->category        = category;
+    event->name            = name;
+    event->id              = 0;
+    event->format          = nullptr;
+    event->phase           = phase;
+    event->flags           = 0;
+    event->numArgs         = 0;
+    event->copiedString[0] = '\0';
+    return event;
+}
+
+void TraceRecorder::endEvent(ThreadBuffer *buffer)
+{
+    buffer->writeCount.store(buffer->writeCount.load(std::memory_order_relaxed) + 1,
+                             std::memory_order_release);
+}
+
+void TraceRecorder::addTraceEvent(char phase,
+                                  const unsigned char *categoryEnabled,
+                                  const char *name,
+                                  unsigned long long id,
+                                  int numArgs,
+                                  const char **argNames,
+                                  const unsigned char *argTypes,
+                                  const unsigned long long *argValues,
+                                  unsigned char flags)
+{
+    ASSERT(ownsCategoryEnabledFlag(categoryEnabled));
+    const Category *category = reinterpret_cast<const Category *>(categoryEnabled);
+
+    ThreadBuffer *buffer = getThreadBuffer();
+    Event *event         = beginEvent(buffer, phase, category->name, name);
+    event->id            = id;
+    event->flags         = flags;
+    if ((flags & kTraceEventFlagCopy) != 0)
+    {
+        CopyString(event->copiedName, name);
+        event->name = nullptr;
+    }
+
+    bool stringCopied = false;
+    for (int argIndex = 0; argIndex < numArgs && argIndex < 2; ++argIndex)
+    {
+        event->argNames[argIndex]  = argNames[argIndex];
+        event->argValues[argIndex] = argValues[argIndex];
+
+        ArgType &type = event->argTypes[argIndex];
+        switch (argTypes[argIndex])
+        {
+            case kTraceValueTypeBool:
+                type = ArgType::Bool;
+                break;
+            case kTraceValueTypeUInt:
+                type = ArgType::UInt;
+                break;
+            case kTraceValueTypeInt:
+                type = ArgType::Int;
+                break;
+            case kTraceValueTypeDouble:
+                type = ArgType::Double;
+                break;
+            case kTraceValueTypeString:
+                type = ArgType::String;
+                break;
+            case kTraceValueTypeCopyString:
+                type = ArgType::CopiedString;
+                // Only the first copied string is kept.
+                if (!stringCopied)
+                {
+                    const char *str = nullptr;
+                    memcpy(&str, &argValues[argIndex], sizeof(str));
+                    CopyString(event->copiedString, str);
+                    stringCopied = true;
+                }
+                break;
+            case kTraceValueTypePointer:
+            default:
+                type = ArgType::Pointer;
+                break;
+        }
+        event->numArgs++;
+    }
+
+    endEvent(buffer);
+}
+
+void TraceRecorder::addEvent(char phase, const char *category, const char *name)
+{
+    ThreadBuffer *buffer = getThreadBuffer();
+    beginEvent(buffer, phase, category, name);
+    endEvent(buffer);
+}
+
+void TraceRecorder::addFormattedEvent(char phase,
+                                      const char *category,
+                                      const char *name,
+                                      const char *format,
+                                      va_list args)
+{
+    ThreadBuffer *buffer = getThreadBuffer();
+    Event *event         = beginEvent(buffer, phase, category, name);
+    event->format        = format;
+
+    // Save the raw values of the arguments. Formatting them waits until the export.
+    bool stringCopied = false;
+    for (const char *c = format; *c != '\0' && event->numArgs < kMaxArgs; ++c)
+    {
+        if (*c != '%')
+        {
+            continue;
+        }
+
+        Conversion conversion = Conversion::Unsupported;
+        c += ParseConversion(c, &conversion) - 1;
+
+        ArgType &type   = event->argTypes[event->numArgs];
+        uint64_t &value = event->argValues[event->numArgs];
+        switch (conversion)
+        {
+            case Conversion::Percent:
+                continue;
+            case Conversion::Int:
+                type  = ArgType::FormatInt;
+                value = static_cast<uint64_t>(va_arg(args, int));
+                break;
+            case Conversion::Long:
+                type  = ArgType::FormatLong;
+                value = static_cast<uint64_t>(va_arg(args, long));
+                break;
+            case Conversion::LongLong:
+                type  = ArgType::FormatLongLong;
+                value = static_cast<uint64_t>(va_arg(args, long long));
+                break;
+            case Conversion::Double:
+            {
+                type          = ArgType::FormatDouble;
+                double number = va_arg(args, double);
+                memcpy(&value, &number, sizeof(double));
+                break;
+            }
+            case Conversion::Pointer:
+                type  = ArgType::FormatPointer;
+                value = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(va_arg(args, void *)));
+                break;
+            case Conversion::String:
+            {
+                // Strings aren't guaranteed to outlive the call. Only the first one is kept.
+                type            = ArgType::FormatString;
+                const char *str = va_arg(args, const char *);
+                value           = stringCopied ? 0 : 1;
+                if (!stringCopied)
+                {
+                    CopyString(event->copiedString, str);
+                    stringCopied = true;
+                }
+                break;
+            }
+            default:
+                // The types of the remaining arguments can't be known.
+                endEvent(buffer);
+                return;
+        }
+        event->numArgs++;
+    }
+
+    endEvent(buffer);
+}
+
+void TraceRecorder::writeEvent(std::ostringstream &json,
+                               const Event &event,
+                               uint32_t threadIndex) const
+{
+    json << "{\"name\": ";
+    WriteJSONString(json, event.name != nullptr ? event.name : event.copiedName);
+    json << ", \"cat\": ";
+    WriteJSONString(json, event.category);
+    json << ", \"ph\": \"" << event.phase << "\", \"ts\": " << event.timestamp / 1000 << "."
+         << std::setw(3) << std::setfill('0') << event.timestamp % 1000 << std::setfill(' ')
+         << ", \"pid\": 1, \"tid\": " << threadIndex;
+
+    if ((event.flags & kTraceEventFlagHasID) != 0)
+    {
+        json << ", \"id\": \"" << FormatPointer(event.id) << "\"";
+    }
+
+    if (event.format != nullptr)
+    {
+        std::string params;
+        size_t argIndex = 0;
+        for (const char *c = event.format; *c != '\0'; ++c)
+        {
+            if (*c != '%')
+            {
+                if (*c != '\n')
+                {
+                    params.push_back(*c);
+                }
+                continue;
+            }
+
+            Conversion conversion = Conversion::Unsupported;
+            size_t length         = ParseConversion(c, &conversion);
+            if (conversion == Conversion::Percent)
+            {
+                params.push_back('%');
+                c += length - 1;
+                continue;
+            }
+            if (argIndex == event.numArgs)
+            {
+                params += "...";
+                break;
+            }
+
+            std::string spec(c, length);
+            uint64_t value = event.argValues[argIndex];
+            char formatted[64];
+            switch (event.argTypes[argIndex])
+            {
+                case ArgType::FormatInt:
+                    snprintf(formatted, sizeof(formatted), spec.c_str(), static_cast<int>(value));
+                    break;
+                case ArgType::FormatLong:
+                    snprintf(formatted, sizeof(formatted), spec.c_str(), static_cast<long>(value));
+                    break;
+                case ArgType::FormatLongLong:
+                    snprintf(formatted, sizeof(formatted), spec.c_str(),
+                             static_cast<long long>(value));
+                    break;
+                case ArgType::FormatDouble:
+                    snprintf(formatted, sizeof(formatted), spec.c_str(), ToDouble(value));
+                    break;
+                case ArgType::FormatPointer:
+                    snprintf(formatted, sizeof(formatted), spec.c_str(),
+                             reinterpret_cast<void *>(static_cast<uintptr_t>(value)));
+                    break;
+                case ArgType::FormatString:
+                    snprintf(formatted, sizeof(formatted), spec.c_str(),
+                             value != 0 ? event.copiedString : "");
+                    break;
+                default:
+                    UNREACHABLE();
+                    formatted[0] = '\0';
+                    break;
+            }
+            params += formatted;
+            argIndex++;
+            c += length - 1;
+        }
+
+        json << ", \"args\": {\"params\": ";
+        WriteJSONString(json, params.c_str());
+        json << "}";
+    }
+    else if (event.numArgs > 0)
+    {
+        json << ", \"args\": {";
+        for (size_t argIndex = 0; argIndex < event.numArgs; ++argIndex)
+        {
+            json << (argIndex > 0 ? ", " : "");
+            WriteJSONString(json, event.argNames[argIndex]);
+            json << ": ";
+
+            uint64_t value = event.argValues[argIndex];
+            switch (event.argTypes[argIndex])
+            {
+                case ArgType::Bool:
+                    json << (value != 0 ? "true" : "false");
+                    break;
+                case ArgType::UInt:
+                    json << value;
+                    break;
+                case ArgType::Int:
+                    json << static_cast<int64_t>(value);
+                    break;
+                case ArgType::Double:
+                    WriteJSONNumber(json, ToDouble(value));
+                    break;
+                case ArgType::String:
+                {
+                    const char *str = nullptr;
+                    memcpy(&str, &value, sizeof(str));
+                    WriteJSONString(json, str);
+                    break;
+                }
+                case ArgType::CopiedString:
+                    WriteJSONString(json, event.copiedString);
+                    break;
+                case ArgType::Pointer:
+                default:
+                    json << "\"" << FormatPointer(value) << "\"";
+                    break;
+            }
+        }
+        json << "}";
+    }
+
+    json << "}";
+}
+
+std::string TraceRecorder::exportJSON() const
+{
+    std::ostringstream json;
+    json << "{\"traceEvents\": [";
+
+    bool firstEvent = true;
+    std::lock_guard<std::mutex> lock(mThreadBufferMutex);
+    for (const std::unique_ptr<ThreadBuffer> &buffer : mThreadBuffers)
+    {
+        uint64_t writeCount = buffer->writeCount.load(std::memory_order_acquire);
+        uint64_t capacity   = buffer->events.size();
+        uint64_t first      = writeCount > capacity ? writeCount - capacity : 0;
+
+        for (uint64_t index = first; index < writeCount; ++index)
+        {
+            json << (firstEvent ? "\n" : ",\n");
+            firstEvent = false;
+            writeEvent(json, buffer->events[index % capacity], buffer->threadIndex);
+        }
+    }
+
+    json << "\n], \"displayTimeUnit\": \"ns\"}\n";
+    return json.str();
+}
+
+bool TraceRecorder::writeJSON(const std::string &fileName) const
+{
+    std::ofstream file(fileName, std::ios::out);
+    file << exportJSON();
+    return static_cast<bool>(file);
+}
+
+void TraceRecorder::clear()
+{
+    std::lock_guard<std::mutex> lock(mThreadBufferMutex);
+    for (const std::unique_ptr<ThreadBuffer> &buffer : mThreadBuffers)
+    {
+        buffer->writeCount.store(0, std::memory_order_relaxed);
+    }
+}
+
+}  // namespace angle
@@ -0,0 +1,201 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// trace_recorder.h: A built-in recorder for trace events, used when the platform doesn't provide
+// one. Each thread appends to its own ring buffer without locking, and argument formatting is
+// deferred until the recording is exported in the Chrome JSON trace format, which chrome://tracing
+// and the Perfetto UI both load.
+
+#ifndef COMMON_TRACE_RECORDER_H_
+#define COMMON_TRACE_RECORDER_H_
+
+#include <stdarg.h>
+#include <stdint.h>
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common/angleutils.h"
+#include "common/tls.h"
+
+// Categories that trace events are compiled in for, separated by commas. Events in other
+// categories compile to nothing. "*" keeps every category.
+#if !defined(ANGLE_TRACE_EVENT_CATEGORIES)
+#define ANGLE_TRACE_EVENT_CATEGORIES "*"
+#endif
+
+namespace angle
+{
+namespace priv
+{
+constexpr bool MatchesTraceCategoryEntry(const char *entry, const char *category)
+{
+    return (*entry == ',' || *entry == '\0')
+               ? *category == '\0'
+               : (*entry == *category && MatchesTraceCategoryEntry(entry + 1, category + 1));
+}
+
+constexpr const char *NextTraceCategoryEntry(const char *entry)
+{
+    return *entry == '\0' ? entry
+                          : (*entry == ',' ? entry + 1 : NextTraceCategoryEntry(entry + 1));
+}
+
+constexpr bool IsTraceCategoryInList(const char *list, const char *category)
+{
+    return *list != '\0' && ((list[0] == '*' && (list[1] == ',' || list[1] == '\0')) ||
+                             MatchesTraceCategoryEntry(list, category) ||
+                             IsTraceCategoryInList(NextTraceCategoryEntry(list), category));
+}
+}  // namespace priv
+
+constexpr bool IsTraceCategoryCompiledIn(const char *category)
+{
+    return priv::IsTraceCategoryInList(ANGLE_TRACE_EVENT_CATEGORIES, category);
+}
+
+// The category of the events recorded by EVENT() in the entry points.
+constexpr char kEntryPointTraceCategory[] = "gpu.angle.entry_points";
+
+class TraceRecorder final : angle::NonCopyable
+{
+  public:
+    // Events kept per thread. Older events are overwritten.
+    static constexpr size_t kDefaultEventsPerThread = 4096;
+    static constexpr size_t kMaxCategories          = 64;
+    static constexpr size_t kMaxArgs                = 16;
+    static constexpr size_t kMaxCopiedStringLength  = 31;
+
+    explicit TraceRecorder(size_t eventsPerThread);
+    ~TraceRecorder();
+
+    // The recorder used by the trace event macros and EVENT(). It starts recording if the
+    // ANGLE_TRACE_OUT_FILE environment variable is set, and writes the trace there at exit.
+    static TraceRecorder *Get();
+
+    void setEnabled(bool enabled);
+    bool isEnabled() const { return mEnabled.load(std::memory_order_relaxed); }
+
+    // Returns a flag that is non-zero while the recorder is enabled. The pointer stays valid for
+    // the lifetime of the recorder.
+    const unsigned char *getCategoryEnabledFlag(const char *category);
+    bool ownsCategoryEnabledFlag(const unsigned char *categoryEnabled) const;
+
+    // Records an event with the arguments of the trace event macros. See addTraceEvent in
+    // platform/Platform.h.
+    void addTraceEvent(char phase,
+                       const unsigned char *categoryEnabled,
+                       const char *name,
+                       unsigned long long id,
+                       int numArgs,
+                       const char **argNames,
+                       const unsigned char *argTypes,
+                       const unsigned long long *argValues,
+                       unsigned char flags);
+
+    // Records an event without arguments.
+    void addEvent(char phase, const char *category, const char *name);
+
+    // Records an event whose "args" are |format| applied to |args|. Only the argument values are
+    // saved; the string is formatted on export. |format| must outlive the recorder.
+    void addFormattedEvent(char phase,
+                           const char *category,
+                           const char *name,
+                           const char *format,
+                           va_list args);
+
+    // Returns the events recorded so far as a Chrome JSON trace. Threads shouldn't record while
+    // the trace is exported, since their oldest events may be overwritten meanwhile.
+    std::string exportJSON() const;
+    bool writeJSON(const std::string &fileName) const;
+
+    // Drops the recorded events. Like the export, it shouldn't race with recording threads.
+    void clear();
+
+  private:
+    struct Category
+    {
+        // The flag must be the first member, so that the flag pointers handed out can be turned
+        // back into categories.
+        unsigned char enabled;
+        const char *name;
+    };
+
+    enum class ArgType : uint8_t
+    {
+        Bool,
+        UInt,
+        Int,
+        Double,
+        Pointer,
+        String,
+        CopiedString,
+
+        // The types of printf conversions in formatted events.
+        FormatInt,
+        FormatLong,
+        FormatLongLong,
+        FormatDouble,
+        FormatPointer,
+        FormatString,
+    };
+
+    struct Event
+    {
+        uint64_t timestamp;
+        const char *category;
+        const char *name;
+        unsigned long long id;
+        // Set for formatted events.
+        const char *format;
+        char phase;
+        uint8_t flags;
+        uint8_t numArgs;
+        std::array<const char *, 2> argNames;
+        std::array<ArgType, kMaxArgs> argTypes;
+        std::array<uint64_t, kMaxArgs> argValues;
+        // Names of events with TRACE_EVENT_FLAG_COPY, and the first string argument that has to
+        // be copied, are kept here. Longer strings are truncated.
+        char copiedName[kMaxCopiedStringLength + 1];
+        char copiedString[kMaxCopiedStringLength + 1];
+    };
+
+    struct ThreadBuffer
+    {
+        ThreadBuffer(size_t capacity, uint32_t threadIndex);
+
+        std::vector<Event> events;
+        std::atomic<uint64_t> writeCount;
+        uint32_t threadIndex;
+    };
+
+    ThreadBuffer *getThreadBuffer();
+    Event *beginEvent(ThreadBuffer *buffer, char phase, const char *category, const char *name);
+    void endEvent(ThreadBuffer *buffer);
+    void writeEvent(std::ostringstream &json, const Event &event, uint32_t threadIndex) const;
+
+    size_t mEventsPerThread;
+    std::atomic<bool> mEnabled;
+    TLSIndex mThreadBufferIndex;
+
+    // Categories are added once per call site, so they are guarded by a lock. Their flags are read
+    // without it.
+    mutable std::mutex mCategoryMutex;
+    std::array<Category, kMaxCategories> mCategories;
+    size_t mCategoryCount;
+
+    mutable std::mutex mThreadBufferMutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> mThreadBuffers;
+};
+
+}  // namespace angle
+
+#endif  // COMMON_TRACE_RECORDER_H_
@@ -0,0 +1,181 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// trace_recorder_unittest.cpp: Unit tests for the built-in trace event recorder.
+
+#include "common/trace_recorder.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace angle
+{
+namespace
+{
+// The TRACE_VALUE_TYPE_* values of trace_event.h.
+constexpr unsigned char kTypeUInt       = 2;
+constexpr unsigned char kTypeDouble     = 4;
+constexpr unsigned char kTypeCopyString = 7;
+
+void AddFormattedEvent(TraceRecorder *recorder, const char *name, const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    recorder->addFormattedEvent('B', "test", name, format, args);
+    va_end(args);
+}
+
+size_t CountOccurrences(const std::string &str, const std::string &pattern)
+{
+    size_t count = 0;
+    for (size_t pos = str.find(pattern); pos != std::string::npos;
+         pos = str.find(pattern, pos + 1))
+    {
+        count++;
+    }
+    return count;
+}
+
+// Test the parsing of the list of compiled in categories.
+TEST(TraceRecorderTest, CategoryList)
+{
+    static_assert(priv::IsTraceCategoryInList("*", "gpu.angle"), "");
+    static_assert(priv::IsTraceCategoryInList("gpu.angle", "gpu.angle"), "");
+    static_assert(priv::IsTraceCategoryInList("ipc,gpu.angle", "gpu.angle"), "");
+    static_assert(priv::IsTraceCategoryInList("gpu.angle,*", "ipc"), "");
+    static_assert(!priv::IsTraceCategoryInList("", "gpu.angle"), "");
+    static_assert(!priv::IsTraceCategoryInList("gpu", "gpu.angle"), "");
+    static_assert(!priv::IsTraceCategoryInList("gpu.angle.entry_points", "gpu.angle"), "");
+    static_assert(!priv::IsTraceCategoryInList("*x", "gpu.angle"), "");
+}
+
+// Test that nothing is recorded until the categories are enabled.
+TEST(TraceRecorderTest, EnabledFlag)
+{
+    TraceRecorder recorder(16);
+    const unsigned char *flag = recorder.getCategoryEnabledFlag("test");
+    EXPECT_TRUE(recorder.ownsCategoryEnabledFlag(flag));
+    EXPECT_EQ(flag, recorder.getCategoryEnabledFlag("test"));
+    EXPECT_EQ(0u, *flag);
+
+    recorder.setEnabled(true);
+    EXPECT_NE(0u, *flag);
+    EXPECT_NE(0u, *recorder.getCategoryEnabledFlag("other"));
+
+    recorder.setEnabled(false);
+    EXPECT_EQ(0u, *flag);
+}
+
+// Test that trace events are exported with their arguments.
+TEST(TraceRecorderTest, TraceEventArgs)
+{
+    TraceRecorder recorder(16);
+    recorder.setEnabled(true);
+    const unsigned char *flag = recorder.getCategoryEnabledFlag("test");
+
+    std::string temporary    = "copied \"string\"";
+    const char *argNames[]   = {"count", "name"};
+    unsigned char argTypes[] = {kTypeUInt, kTypeCopyString};
+    unsigned long long argValues[2];
+    argValues[0] = 42;
+    const char *str = temporary.c_str();
+    memcpy(&argValues[1], &str, sizeof(str));
+
+    recorder.addTraceEvent('B', flag, "Scope", 0, 2, argNames, argTypes, argValues, 0);
+    temporary.assign(temporary.size(), 'x');
+
+    unsigned char doubleType = kTypeDouble;
+    double half              = 0.5;
+    unsigned long long doubleValue;
+    memcpy(&doubleValue, &half, sizeof(double));
+    recorder.addTraceEvent('E', flag, "Scope", 0, 1, argNames, &doubleType, &doubleValue, 0);
+
+    std::string json = recorder.exportJSON();
+    EXPECT_NE(std::string::npos,
+              json.find("\"name\": \"Scope\", \"cat\": \"test\", \"ph\": \"B\""));
+    EXPECT_NE(std::string::npos,
+              json.find("\"args\": {\"count\": 42, \"name\": \"copied \\\"string\\\"\"}"));
+    EXPECT_NE(std::string::npos, json.find("\"args\": {\"count\": 0.5}"));
+}
+
+// Test that formatted events keep the argument values and format them on export.
+TEST(TraceRecorderTest, FormattedEvent)
+{
+    TraceRecorder recorder(16);
+    recorder.setEnabled(true);
+
+    char procName[] = "glDrawArrays";
+    AddFormattedEvent(&recorder, "glFoo",
+                      "(GLenum mode = 0x%X, GLint first = %d, GLfloat x = %f, GLuint64 t = %llu, "
+                      "const char *name = \"%s\", 100%%)\n",
+                      0x4u, -3, 0.25, 1ull << 40, procName);
+    procName[0] = 'x';
+
+    std::string json = recorder.exportJSON();
+    EXPECT_NE(std::string::npos, json.find("\"name\": \"glFoo\""));
+    EXPECT_NE(std::string::npos,
+              json.find("\"params\": \"(GLenum mode = 0x4, GLint first = -3, GLfloat x = 0.250000, "
+                        "GLuint64 t = 1099511627776, const char *name = \\\"glDrawArrays\\\", "
+                        "100%)\""));
+}
+
+// Test that the oldest events are overwritten when a thread's buffer is full.
+TEST(TraceRecorderTest, RingBuffer)
+{
+    TraceRecorder recorder(4);
+    recorder.setEnabled(true);
+    const char *names[] = {"e0", "e1", "e2", "e3", "e4", "e5"};
+    for (const char *name : names)
+    {
+        recorder.addEvent('I', "test", name);
+    }
+
+    std::string json = recorder.exportJSON();
+    EXPECT_EQ(4u, CountOccurrences(json, "\"ph\": \"I\""));
+    EXPECT_EQ(std::string::npos, json.find("\"e1\""));
+    EXPECT_NE(std::string::npos, json.find("\"e2\""));
+    EXPECT_NE(std::string::npos, json.find("\"e5\""));
+
+    recorder.clear();
+    EXPECT_EQ(0u, CountOccurrences(recorder.exportJSON(), "\"ph\""));
+}
+
+// Test that each thread records into its own buffer, and that the events of finished threads
+// are kept.
+TEST(TraceRecorderTest, Threads)
+{
+    constexpr size_t kThreadCount     = 4;
+    constexpr size_t kEventsPerThread = 100;
+
+    TraceRecorder recorder(kEventsPerThread);
+    recorder.setEnabled(true);
+
+    std::vector<std::thread> threads;
+    for (size_t threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        threads.emplace_back([&recorder]() {
+            for (size_t eventIndex = 0; eventIndex < kEventsPerThread; ++eventIndex)
+            {
+                recorder.addEvent('I', "test", "event");
+            }
+        });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    std::string json = recorder.exportJSON();
+    EXPECT_EQ(kThreadCount * kEventsPerThread, CountOccurrences(json, "\"ph\": \"I\""));
+    for (size_t threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        EXPECT_EQ(kEventsPerThread,
+                  CountOccurrences(json, "\"tid\": " + std::to_string(threadIndex) + "}"));
+    }
+}
+
+}  // anonymous namespace
+}  // namespace angle
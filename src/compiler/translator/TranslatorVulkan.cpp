@@ -231,7 +231,11 @@ void TranslatorVulkan::translate(TIntermBlock *root,
 
     if (defaultUniformCount > 0)
     {
+        // The back-end either binds the block to a uniform buffer or places it in push constants.
+        // In the latter case the padding marker is used to move the block past the push constant
+        // bytes used by the other shader stages.
         sink << "\nlayout(@@ DEFAULT-UNIFORMS-SET-BINDING @@) uniform defaultUniforms\n{\n";
+        sink << "@@ DEFAULT-UNIFORMS-PADDING @@\n";
 
         DeclareDefaultUniformsTraverser defaultTraverser(&sink, getHashFunction(), &getNameMap());
         root->traverse(&defaultTraverser);
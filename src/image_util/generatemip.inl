@@ -7,10 +7,20 @@
 // generatemip.inl: Defines the GenerateMip function, templated on the format
 // type of the image for which mip levels are being generated.
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+
 #include "common/mathutil.h"
+#include "common/platform.h"
 
 #include "image_util/imageformats.h"
 
+// SSE2 is part of the x86-64 baseline, so it needs no runtime check there.
+#if defined(ANGLE_USE_SSE) && (defined(_M_X64) || defined(__x86_64__))
+#define ANGLE_GENERATEMIP_USE_SSE2
+#endif
+
 namespace angle
 {
 
@@ -101,19 +111,18 @@ static void GenerateMip_XY(size_t sourceWidth, size_t sourceHeight, size_t sourc
 
     for (size_t y = 0; y < destHeight; y++)
     {
+        const T *srcRow0 = GetPixel<T>(sourceData, 0, y * 2, 0, sourceRowPitch, sourceDepthPitch);
+        const T *srcRow1 =
+            GetPixel<T>(sourceData, 0, y * 2 + 1, 0, sourceRowPitch, sourceDepthPitch);
+        T *dstRow = GetPixel<T>(destData, 0, y, 0, destRowPitch, destDepthPitch);
+
         for (size_t x = 0; x < destWidth; x++)
         {
-            const T *src0 = GetPixel<T>(sourceData, x * 2, y * 2, 0, sourceRowPitch, sourceDepthPitch);
-            const T *src1 = GetPixel<T>(sourceData, x * 2, y * 2 + 1, 0, sourceRowPitch, sourceDepthPitch);
-            const T *src2 = GetPixel<T>(sourceData, x * 2 + 1, y * 2, 0, sourceRowPitch, sourceDepthPitch);
-            const T *src3 = GetPixel<T>(sourceData, x * 2 + 1, y * 2 + 1, 0, sourceRowPitch, sourceDepthPitch);
-            T *dst = GetPixel<T>(destData, x, y, 0, destRowPitch, destDepthPitch);
-
             T tmp0, tmp1;
 
-            T::average(&tmp0, src0, src1);
-            T::average(&tmp1, src2, src3);
-            T::average(dst, &tmp0, &tmp1);
+            T::average(&tmp0, &srcRow0[x * 2], &srcRow1[x * 2]);
+            T::average(&tmp1, &srcRow0[x * 2 + 1], &srcRow1[x * 2 + 1]);
+            T::average(&dstRow[x], &tmp0, &tmp1);
         }
     }
 }
@@ -218,6 +227,352 @@ static void GenerateMip_XYZ(size_t sourceWidth, size_t sourceHeight, size_t sour
     }
 }
 
+// Row based fast paths of GenerateMip_XY for the most common formats, used to generate full mip
+// chains of 2D textures on the CPU. The normalized and 32-bit float ones give the same results
+// as T::average. The half float and sRGB ones filter the four source texels in one step instead
+// of rounding the intermediate averages. The specializations are inline so that translation units
+// which include this file without generating mipmaps don't warn about unused functions.
+
+// Averages the bytes of two rows pairwise, then the bytes of neighbouring pixels, rounding down
+// like the byte-wise T::average of the 8-bit normalized formats.
+template <size_t PixelBytes>
+inline void GenerateMipRow_UNorm8(const uint8_t *srcRow0,
+                                  const uint8_t *srcRow1,
+                                  uint8_t *dstRow,
+                                  size_t destWidth)
+{
+    size_t x = 0;
+
+#if defined(ANGLE_GENERATEMIP_USE_SSE2)
+    // Each iteration reads 32 bytes from both rows and writes 16 bytes.
+    constexpr size_t kPixelsPerIteration = 16 / PixelBytes;
+    const __m128i lowBitMask             = _mm_set1_epi8(1);
+    auto averageFloor                    = [lowBitMask](__m128i a, __m128i b) {
+        // _mm_avg_epu8 rounds up, remove the rounding bit to round down instead.
+        return _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), lowBitMask));
+    };
+
+    for (; x + kPixelsPerIteration <= destWidth; x += kPixelsPerIteration)
+    {
+        const uint8_t *src0 = srcRow0 + x * 2 * PixelBytes;
+        const uint8_t *src1 = srcRow1 + x * 2 * PixelBytes;
+
+        __m128i vertical0 = averageFloor(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src0)),
+                                         _mm_loadu_si128(reinterpret_cast<const __m128i *>(src1)));
+        __m128i vertical1 =
+            averageFloor(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src0 + 16)),
+                         _mm_loadu_si128(reinterpret_cast<const __m128i *>(src1 + 16)));
+
+        // Split the even and the odd pixels.
+        __m128i even;
+        __m128i odd;
+        switch (PixelBytes)
+        {
+            case 4:
+            {
+                __m128 vertical0f = _mm_castsi128_ps(vertical0);
+                __m128 vertical1f = _mm_castsi128_ps(vertical1);
+                even              = _mm_castps_si128(
+                    _mm_shuffle_ps(vertical0f, vertical1f, _MM_SHUFFLE(2, 0, 2, 0)));
+                odd = _mm_castps_si128(
+                    _mm_shuffle_ps(vertical0f, vertical1f, _MM_SHUFFLE(3, 1, 3, 1)));
+                break;
+            }
+            case 2:
+            {
+                // Sign extend the 16-bit halves so that the signed pack keeps their bits.
+                even = _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(vertical0, 16), 16),
+                                       _mm_srai_epi32(_mm_slli_epi32(vertical1, 16), 16));
+                odd =
+                    _mm_packs_epi32(_mm_srai_epi32(vertical0, 16), _mm_srai_epi32(vertical1, 16));
+                break;
+            }
+            case 1:
+            {
+                const __m128i lowByteMask = _mm_set1_epi16(0xFF);
+                even = _mm_packus_epi16(_mm_and_si128(vertical0, lowByteMask),
+                                        _mm_and_si128(vertical1, lowByteMask));
+                odd  = _mm_packus_epi16(_mm_srli_epi16(vertical0, 8), _mm_srli_epi16(vertical1, 8));
+                break;
+            }
+            default:
+                UNREACHABLE();
+                return;
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dstRow + x * PixelBytes),
+                         averageFloor(even, odd));
+    }
+#endif  // defined(ANGLE_GENERATEMIP_USE_SSE2)
+
+    for (; x < destWidth; x++)
+    {
+        for (size_t byte = 0; byte < PixelBytes; byte++)
+        {
+            size_t left  = x * 2 * PixelBytes + byte;
+            size_t right = left + PixelBytes;
+            dstRow[x * PixelBytes + byte] =
+                gl::average(gl::average(srcRow0[left], srcRow1[left]),
+                            gl::average(srcRow0[right], srcRow1[right]));
+        }
+    }
+}
+
+template <size_t PixelBytes>
+inline void GenerateMip_XY_UNorm8(size_t destWidth,
+                                  size_t destHeight,
+                                  const uint8_t *sourceData,
+                                  size_t sourceRowPitch,
+                                  uint8_t *destData,
+                                  size_t destRowPitch)
+{
+    for (size_t y = 0; y < destHeight; y++)
+    {
+        GenerateMipRow_UNorm8<PixelBytes>(sourceData + y * 2 * sourceRowPitch,
+                                          sourceData + (y * 2 + 1) * sourceRowPitch,
+                                          destData + y * destRowPitch, destWidth);
+    }
+}
+
+template <>
+inline void GenerateMip_XY<R8>(size_t sourceWidth,
+                               size_t sourceHeight,
+                               size_t sourceDepth,
+                               const uint8_t *sourceData,
+                               size_t sourceRowPitch,
+                               size_t sourceDepthPitch,
+                               size_t destWidth,
+                               size_t destHeight,
+                               size_t destDepth,
+                               uint8_t *destData,
+                               size_t destRowPitch,
+                               size_t destDepthPitch)
+{
+    GenerateMip_XY_UNorm8<1>(destWidth, destHeight, sourceData, sourceRowPitch, destData,
+                             destRowPitch);
+}
+
+template <>
+inline void GenerateMip_XY<R8G8>(size_t sourceWidth,
+                                 size_t sourceHeight,
+                                 size_t sourceDepth,
+                                 const uint8_t *sourceData,
+                                 size_t sourceRowPitch,
+                                 size_t sourceDepthPitch,
+                                 size_t destWidth,
+                                 size_t destHeight,
+                                 size_t destDepth,
+                                 uint8_t *destData,
+                                 size_t destRowPitch,
+                                 size_t destDepthPitch)
+{
+    GenerateMip_XY_UNorm8<2>(destWidth, destHeight, sourceData, sourceRowPitch, destData,
+                             destRowPitch);
+}
+
+template <>
+inline void GenerateMip_XY<R8G8B8A8>(size_t sourceWidth,
+                                     size_t sourceHeight,
+                                     size_t sourceDepth,
+                                     const uint8_t *sourceData,
+                                     size_t sourceRowPitch,
+                                     size_t sourceDepthPitch,
+                                     size_t destWidth,
+                                     size_t destHeight,
+                                     size_t destDepth,
+                                     uint8_t *destData,
+                                     size_t destRowPitch,
+                                     size_t destDepthPitch)
+{
+    GenerateMip_XY_UNorm8<4>(destWidth, destHeight, sourceData, sourceRowPitch, destData,
+                             destRowPitch);
+}
+
+template <>
+inline void GenerateMip_XY<B8G8R8A8>(size_t sourceWidth,
+                                     size_t sourceHeight,
+                                     size_t sourceDepth,
+                                     const uint8_t *sourceData,
+                                     size_t sourceRowPitch,
+                                     size_t sourceDepthPitch,
+                                     size_t destWidth,
+                                     size_t destHeight,
+                                     size_t destDepth,
+                                     uint8_t *destData,
+                                     size_t destRowPitch,
+                                     size_t destDepthPitch)
+{
+    GenerateMip_XY_UNorm8<4>(destWidth, destHeight, sourceData, sourceRowPitch, destData,
+                             destRowPitch);
+}
+
+template <>
+inline void GenerateMip_XY<R32G32B32A32F>(size_t sourceWidth,
+                                          size_t sourceHeight,
+                                          size_t sourceDepth,
+                                          const uint8_t *sourceData,
+                                          size_t sourceRowPitch,
+                                          size_t sourceDepthPitch,
+                                          size_t destWidth,
+                                          size_t destHeight,
+                                          size_t destDepth,
+                                          uint8_t *destData,
+                                          size_t destRowPitch,
+                                          size_t destDepthPitch)
+{
+    for (size_t y = 0; y < destHeight; y++)
+    {
+        const float *srcRow0 =
+            reinterpret_cast<const float *>(sourceData + y * 2 * sourceRowPitch);
+        const float *srcRow1 =
+            reinterpret_cast<const float *>(sourceData + (y * 2 + 1) * sourceRowPitch);
+        float *dstRow = reinterpret_cast<float *>(destData + y * destRowPitch);
+
+        size_t x = 0;
+
+#if defined(ANGLE_GENERATEMIP_USE_SSE2)
+        // One pixel is one vector. The operations are the same as the scalar ones.
+        const __m128 half = _mm_set1_ps(0.5f);
+        for (; x < destWidth; x++)
+        {
+            __m128 left  = _mm_mul_ps(
+                _mm_add_ps(_mm_loadu_ps(&srcRow0[x * 8]), _mm_loadu_ps(&srcRow1[x * 8])), half);
+            __m128 right = _mm_mul_ps(
+                _mm_add_ps(_mm_loadu_ps(&srcRow0[x * 8 + 4]), _mm_loadu_ps(&srcRow1[x * 8 + 4])),
+                half);
+            _mm_storeu_ps(&dstRow[x * 4], _mm_mul_ps(_mm_add_ps(left, right), half));
+        }
+#endif  // defined(ANGLE_GENERATEMIP_USE_SSE2)
+
+        for (; x < destWidth; x++)
+        {
+            for (size_t channel = 0; channel < 4; channel++)
+            {
+                float left = gl::average(srcRow0[x * 8 + channel], srcRow1[x * 8 + channel]);
+                float right =
+                    gl::average(srcRow0[x * 8 + 4 + channel], srcRow1[x * 8 + 4 + channel]);
+                dstRow[x * 4 + channel] = gl::average(left, right);
+            }
+        }
+    }
+}
+
+template <>
+inline void GenerateMip_XY<R16G16B16A16F>(size_t sourceWidth,
+                                          size_t sourceHeight,
+                                          size_t sourceDepth,
+                                          const uint8_t *sourceData,
+                                          size_t sourceRowPitch,
+                                          size_t sourceDepthPitch,
+                                          size_t destWidth,
+                                          size_t destHeight,
+                                          size_t destDepth,
+                                          uint8_t *destData,
+                                          size_t destRowPitch,
+                                          size_t destDepthPitch)
+{
+    for (size_t y = 0; y < destHeight; y++)
+    {
+        const uint16_t *srcRow0 =
+            reinterpret_cast<const uint16_t *>(sourceData + y * 2 * sourceRowPitch);
+        const uint16_t *srcRow1 =
+            reinterpret_cast<const uint16_t *>(sourceData + (y * 2 + 1) * sourceRowPitch);
+        uint16_t *dstRow = reinterpret_cast<uint16_t *>(destData + y * destRowPitch);
+
+        for (size_t x = 0; x < destWidth; x++)
+        {
+            for (size_t channel = 0; channel < 4; channel++)
+            {
+                size_t left  = x * 8 + channel;
+                size_t right = left + 4;
+                float sum =
+                    (gl::float16ToFloat32(srcRow0[left]) + gl::float16ToFloat32(srcRow1[left])) +
+                    (gl::float16ToFloat32(srcRow0[right]) + gl::float16ToFloat32(srcRow1[right]));
+                dstRow[x * 4 + channel] = gl::float32ToFloat16(sum * 0.25f);
+            }
+        }
+    }
+}
+
+// The linear value of each sRGB encoded byte.
+inline const std::array<float, 256> &GetSRGBToLinearTable()
+{
+    static const std::array<float, 256> table = []() {
+        std::array<float, 256> values;
+        for (size_t index = 0; index < values.size(); index++)
+        {
+            float value   = static_cast<float>(index) / 255.0f;
+            values[index] = (value <= 0.04045f) ? value / 12.92f
+                                                : std::pow((value + 0.055f) / 1.055f, 2.4f);
+        }
+        return values;
+    }();
+    return table;
+}
+
+// The linear values halfway between neighbouring sRGB encoded bytes, used to round linear values
+// to the nearest encoding.
+inline const std::array<float, 255> &GetLinearToSRGBThresholds()
+{
+    static const std::array<float, 255> thresholds = []() {
+        std::array<float, 255> values;
+        for (size_t index = 0; index < values.size(); index++)
+        {
+            float value   = (static_cast<float>(index) + 0.5f) / 255.0f;
+            values[index] = (value <= 0.04045f) ? value / 12.92f
+                                                : std::pow((value + 0.055f) / 1.055f, 2.4f);
+        }
+        return values;
+    }();
+    return thresholds;
+}
+
+inline uint8_t LinearToSRGB8(float linearValue)
+{
+    const std::array<float, 255> &thresholds = GetLinearToSRGBThresholds();
+    return static_cast<uint8_t>(
+        std::upper_bound(thresholds.begin(), thresholds.end(), linearValue) - thresholds.begin());
+}
+
+// Filters the color channels in linear space. Alpha isn't encoded and is averaged like RGBA8.
+template <>
+inline void GenerateMip_XY<R8G8B8A8SRGB>(size_t sourceWidth,
+                                         size_t sourceHeight,
+                                         size_t sourceDepth,
+                                         const uint8_t *sourceData,
+                                         size_t sourceRowPitch,
+                                         size_t sourceDepthPitch,
+                                         size_t destWidth,
+                                         size_t destHeight,
+                                         size_t destDepth,
+                                         uint8_t *destData,
+                                         size_t destRowPitch,
+                                         size_t destDepthPitch)
+{
+    const std::array<float, 256> &toLinear = GetSRGBToLinearTable();
+
+    for (size_t y = 0; y < destHeight; y++)
+    {
+        const uint8_t *srcRow0 = sourceData + y * 2 * sourceRowPitch;
+        const uint8_t *srcRow1 = sourceData + (y * 2 + 1) * sourceRowPitch;
+        uint8_t *dstRow        = destData + y * destRowPitch;
+
+        for (size_t x = 0; x < destWidth; x++)
+        {
+            size_t left  = x * 8;
+            size_t right = left + 4;
+            for (size_t channel = 0; channel < 3; channel++)
+            {
+                float sum =
+                    (toLinear[srcRow0[left + channel]] + toLinear[srcRow1[left + channel]]) +
+                    (toLinear[srcRow0[right + channel]] + toLinear[srcRow1[right + channel]]);
+                dstRow[x * 4 + channel] = LinearToSRGB8(sum * 0.25f);
+            }
+            dstRow[x * 4 + 3] = gl::average(gl::average(srcRow0[left + 3], srcRow1[left + 3]),
+                                            gl::average(srcRow0[right + 3], srcRow1[right + 3]));
+        }
+    }
+}
 
 typedef void (*MipGenerationFunction)(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
                                       const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
@@ -0,0 +1,216 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// generatemip_unittest.cpp: Tests that the fast paths of GenerateMip match the per pixel
+// reference filter.
+
+#include "image_util/generatemip.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+using namespace angle;
+
+// Widths that exercise both the vectorized loops and their scalar tails.
+constexpr size_t kSourceWidths[] = {2, 6, 16, 34, 66};
+constexpr size_t kSourceHeight   = 6;
+
+template <typename T>
+std::vector<uint8_t> MakeSource(size_t width, size_t height, size_t rowPitch)
+{
+    std::mt19937 generator(static_cast<unsigned int>(width));
+    std::uniform_int_distribution<int> distribution(0, 255);
+
+    std::vector<uint8_t> source(rowPitch * height);
+    for (uint8_t &byte : source)
+    {
+        byte = static_cast<uint8_t>(distribution(generator));
+    }
+    return source;
+}
+
+// Filters like the generic GenerateMip_XY, rounding after each average.
+template <typename T>
+void ReferenceMip(size_t destWidth,
+                  size_t destHeight,
+                  const uint8_t *source,
+                  size_t sourceRowPitch,
+                  uint8_t *dest,
+                  size_t destRowPitch)
+{
+    for (size_t y = 0; y < destHeight; y++)
+    {
+        const T *srcRow0 = reinterpret_cast<const T *>(source + y * 2 * sourceRowPitch);
+        const T *srcRow1 = reinterpret_cast<const T *>(source + (y * 2 + 1) * sourceRowPitch);
+        T *dstRow        = reinterpret_cast<T *>(dest + y * destRowPitch);
+        for (size_t x = 0; x < destWidth; x++)
+        {
+            T tmp0, tmp1;
+            T::average(&tmp0, &srcRow0[x * 2], &srcRow1[x * 2]);
+            T::average(&tmp1, &srcRow0[x * 2 + 1], &srcRow1[x * 2 + 1]);
+            T::average(&dstRow[x], &tmp0, &tmp1);
+        }
+    }
+}
+
+template <typename T>
+void RunMip(size_t sourceWidth,
+            std::vector<uint8_t> *sourceOut,
+            std::vector<uint8_t> *destOut,
+            size_t *destRowPitchOut)
+{
+    // Pad the rows to check that the pitches are respected.
+    size_t sourceRowPitch = sourceWidth * sizeof(T) + 8;
+    size_t destRowPitch   = sourceWidth / 2 * sizeof(T) + 4;
+
+    *sourceOut = MakeSource<T>(sourceWidth, kSourceHeight, sourceRowPitch);
+    destOut->assign(destRowPitch * kSourceHeight / 2, 0);
+    *destRowPitchOut = destRowPitch;
+
+    GenerateMip<T>(sourceWidth, kSourceHeight, 1, sourceOut->data(), sourceRowPitch,
+                   sourceRowPitch * kSourceHeight, destOut->data(), destRowPitch,
+                   destRowPitch * kSourceHeight / 2);
+}
+
+template <typename T>
+class GenerateMipExactTest : public testing::Test
+{
+};
+
+using ExactFormats = testing::Types<R8, R8G8, R8G8B8A8, B8G8R8A8, R32G32B32A32F>;
+TYPED_TEST_CASE(GenerateMipExactTest, ExactFormats);
+
+// Test that the normalized and 32-bit float formats give the same results as the reference.
+TYPED_TEST(GenerateMipExactTest, MatchesReference)
+{
+    for (size_t sourceWidth : kSourceWidths)
+    {
+        std::vector<uint8_t> source;
+        std::vector<uint8_t> dest;
+        size_t destRowPitch = 0;
+        RunMip<TypeParam>(sourceWidth, &source, &dest, &destRowPitch);
+
+        // Keep the float inputs finite so that they compare equal.
+        if (std::is_same<TypeParam, R32G32B32A32F>::value)
+        {
+            size_t sourceRowPitch = source.size() / kSourceHeight;
+            float *values         = reinterpret_cast<float *>(source.data());
+            for (size_t index = 0; index < source.size() / sizeof(float); index++)
+            {
+                values[index] = static_cast<float>(index % 97) / 7.0f;
+            }
+            GenerateMip<TypeParam>(sourceWidth, kSourceHeight, 1, source.data(), sourceRowPitch,
+                                   source.size(), dest.data(), destRowPitch, dest.size());
+        }
+
+        std::vector<uint8_t> expected(dest.size(), 0);
+        ReferenceMip<TypeParam>(sourceWidth / 2, kSourceHeight / 2, source.data(),
+                                source.size() / kSourceHeight, expected.data(), destRowPitch);
+
+        for (size_t y = 0; y < kSourceHeight / 2; y++)
+        {
+            size_t rowStart = y * destRowPitch;
+            size_t rowEnd   = rowStart + sourceWidth / 2 * sizeof(TypeParam);
+            EXPECT_TRUE(std::equal(dest.begin() + rowStart, dest.begin() + rowEnd,
+                                   expected.begin() + rowStart))
+                << "width " << sourceWidth << " row " << y;
+        }
+    }
+}
+
+double SRGBToLinear(uint8_t value)
+{
+    double normalized = value / 255.0;
+    return normalized <= 0.04045 ? normalized / 12.92 : std::pow((normalized + 0.055) / 1.055, 2.4);
+}
+
+double LinearToSRGB(double value)
+{
+    double encoded = value <= 0.0031308 ? value * 12.92 : 1.055 * std::pow(value, 1.0 / 2.4) - 0.055;
+    return encoded * 255.0;
+}
+
+// Test that sRGB mips average the linear colors of the four source texels.
+TEST(GenerateMipTest, SRGBFiltersInLinearSpace)
+{
+    for (size_t sourceWidth : kSourceWidths)
+    {
+        std::vector<uint8_t> source;
+        std::vector<uint8_t> dest;
+        size_t destRowPitch = 0;
+        RunMip<R8G8B8A8SRGB>(sourceWidth, &source, &dest, &destRowPitch);
+        size_t sourceRowPitch = source.size() / kSourceHeight;
+
+        for (size_t y = 0; y < kSourceHeight / 2; y++)
+        {
+            for (size_t x = 0; x < sourceWidth / 2; x++)
+            {
+                const uint8_t *texels[] = {
+                    &source[y * 2 * sourceRowPitch + x * 8],
+                    &source[y * 2 * sourceRowPitch + x * 8 + 4],
+                    &source[(y * 2 + 1) * sourceRowPitch + x * 8],
+                    &source[(y * 2 + 1) * sourceRowPitch + x * 8 + 4],
+                };
+                const uint8_t *result = &dest[y * destRowPitch + x * 4];
+
+                for (size_t channel = 0; channel < 3; channel++)
+                {
+                    double linear = 0.0;
+                    for (const uint8_t *texel : texels)
+                    {
+                        linear += SRGBToLinear(texel[channel]) / 4.0;
+                    }
+                    EXPECT_NEAR(LinearToSRGB(linear), result[channel], 0.5 + 1e-3);
+                }
+            }
+        }
+    }
+}
+
+// Test that half float mips are within rounding of the exact average.
+TEST(GenerateMipTest, HalfFloatAverage)
+{
+    for (size_t sourceWidth : kSourceWidths)
+    {
+        std::vector<uint8_t> source(sourceWidth * sizeof(R16G16B16A16F) * kSourceHeight);
+        uint16_t *values = reinterpret_cast<uint16_t *>(source.data());
+        for (size_t index = 0; index < source.size() / sizeof(uint16_t); index++)
+        {
+            values[index] = gl::float32ToFloat16(static_cast<float>(index % 113) / 3.0f);
+        }
+
+        size_t sourceRowPitch = sourceWidth * sizeof(R16G16B16A16F);
+        size_t destRowPitch   = sourceRowPitch / 2;
+        std::vector<uint8_t> dest(destRowPitch * kSourceHeight / 2);
+        GenerateMip<R16G16B16A16F>(sourceWidth, kSourceHeight, 1, source.data(), sourceRowPitch,
+                                   source.size(), dest.data(), destRowPitch, dest.size());
+
+        const uint16_t *results = reinterpret_cast<const uint16_t *>(dest.data());
+        for (size_t y = 0; y < kSourceHeight / 2; y++)
+        {
+            for (size_t x = 0; x < sourceWidth / 2 * 4; x++)
+            {
+                size_t channel = x % 4;
+                size_t left    = y * 2 * sourceRowPitch / 2 + (x / 4) * 8 + channel;
+                size_t below   = sourceRowPitch / 2;
+                float expected = (gl::float16ToFloat32(values[left]) +
+                                  gl::float16ToFloat32(values[left + 4]) +
+                                  gl::float16ToFloat32(values[left + below]) +
+                                  gl::float16ToFloat32(values[left + below + 4])) /
+                                 4.0f;
+                float result = gl::float16ToFloat32(results[y * destRowPitch / 2 + x]);
+                // Half floats have 11 bits of precision.
+                EXPECT_NEAR(expected, result, std::abs(expected) / 1024.0f);
+            }
+        }
+    }
+}
+
+}  // anonymous namespace
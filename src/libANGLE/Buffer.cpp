@@ -28,7 +28,8 @@ BufferState::BufferState()
       mMapOffset(0),
       mMapLength(0),
       mBindingCount(0),
-      mTransformFeedbackBindingCount(0)
+      mTransformFeedbackBindingCount(0),
+      mWebGLType(WebGLBufferType::Undefined)
 {
 }
 
@@ -247,6 +248,11 @@ void Buffer::onBindingChanged(const Context *context, bool bound, BufferBinding
 {
     ASSERT(bound || mState.mBindingCount > 0);
     mState.mBindingCount += bound ? 1 : -1;
+    if (bound && mState.mWebGLType == WebGLBufferType::Undefined)
+    {
+        mState.mWebGLType = (target == BufferBinding::ElementArray) ? WebGLBufferType::ElementArray
+                                                                    : WebGLBufferType::OtherData;
+    }
     if (target == BufferBinding::TransformFeedback)
     {
         ASSERT(bound || mState.mTransformFeedbackBindingCount > 0);
@@ -29,6 +29,15 @@ namespace gl
 class Buffer;
 class Context;
 
+// WebGL assigns a type to buffers when they are first bound. Buffers holding indices can't be bound
+// to other data targets and vice versa, so index data always lives in buffers of its own.
+enum class WebGLBufferType
+{
+    Undefined,
+    ElementArray,
+    OtherData,
+};
+
 class BufferState final : angle::NonCopyable
 {
   public:
@@ -45,6 +54,7 @@ class BufferState final : angle::NonCopyable
     GLint64 getMapOffset() const { return mMapOffset; }
     GLint64 getMapLength() const { return mMapLength; }
     GLint64 getSize() const { return mSize; }
+    WebGLBufferType getWebGLType() const { return mWebGLType; }
 
   private:
     friend class Buffer;
@@ -61,6 +71,7 @@ class BufferState final : angle::NonCopyable
     GLint64 mMapLength;
     int mBindingCount;
     int mTransformFeedbackBindingCount;
+    WebGLBufferType mWebGLType;
 };
 
 class Buffer final : public RefCountObject, public LabeledObject
@@ -111,6 +122,7 @@ class Buffer final : public RefCountObject, public LabeledObject
     GLint64 getMapOffset() const { return mState.mMapOffset; }
     GLint64 getMapLength() const { return mState.mMapLength; }
     GLint64 getSize() const { return mState.mSize; }
+    WebGLBufferType getWebGLType() const { return mState.mWebGLType; }
 
     rx::BufferImpl *getImplementation() const { return mImpl; }
 
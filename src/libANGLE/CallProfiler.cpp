@@ -0,0 +1,236 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CallProfiler.cpp:
+//   Implements the per entry point CPU time profile.
+//
+
+#include "libANGLE/CallProfiler.h"
+
+#include <chrono>
+#include <fstream>
+#include <sstream>
+
+#include "common/debug.h"
+#include "common/system_utils.h"
+
+namespace angle
+{
+namespace
+{
+uint64_t GetNanoseconds()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+}
+
+size_t GetHistogramBucket(uint64_t nanoseconds)
+{
+    size_t bucket = 0;
+    while (nanoseconds > 1 && bucket + 1 < CallProfiler::kHistogramBucketCount)
+    {
+        nanoseconds >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+const char *GetCallPhaseName(CallPhase phase)
+{
+    switch (phase)
+    {
+        case CallPhase::Validation:
+            return "validation";
+        case CallPhase::StateSync:
+            return "stateSync";
+        case CallPhase::Execution:
+            return "execution";
+        default:
+            UNREACHABLE();
+            return "invalid";
+    }
+}
+}  // anonymous namespace
+
+constexpr size_t CallProfiler::kHistogramBucketCount;
+
+CallProfiler::PhaseStats::PhaseStats() : totalNanoseconds(0)
+{
+    histogram.fill(0);
+}
+
+CallProfiler::EntryPointStats::EntryPointStats() : callCount(0)
+{
+}
+
+CallProfiler::CallProfiler()
+    : mCallDepth(0),
+      mEntryPoint(gl::EntryPoint::Invalid),
+      mCallStart(0),
+      mExecutionStart(0),
+      mStateSyncDepth(0),
+      mStateSyncStart(0),
+      mStateSyncTotal(0)
+{
+}
+
+CallProfiler::~CallProfiler()
+{
+}
+
+void CallProfiler::beginCall(gl::EntryPoint entryPoint)
+{
+    if (mCallDepth++ > 0)
+    {
+        return;
+    }
+
+    mEntryPoint     = entryPoint;
+    mExecutionStart = 0;
+    mStateSyncTotal = 0;
+    mCallStart      = GetNanoseconds();
+}
+
+void CallProfiler::beginExecution()
+{
+    if (mCallDepth == 1)
+    {
+        mExecutionStart = GetNanoseconds();
+    }
+}
+
+void CallProfiler::endCall()
+{
+    ASSERT(mCallDepth > 0);
+    if (--mCallDepth > 0)
+    {
+        return;
+    }
+
+    uint64_t end = GetNanoseconds();
+
+    size_t index = static_cast<size_t>(mEntryPoint);
+    if (index >= mStats.size())
+    {
+        mStats.resize(index + 1);
+    }
+    mStats[index].callCount++;
+
+    // Calls that failed validation never reach the execution phase.
+    if (mExecutionStart == 0)
+    {
+        record(CallPhase::Validation, end - mCallStart);
+        return;
+    }
+
+    record(CallPhase::Validation, mExecutionStart - mCallStart);
+    record(CallPhase::StateSync, mStateSyncTotal);
+    record(CallPhase::Execution, end - mExecutionStart - mStateSyncTotal);
+}
+
+void CallProfiler::beginStateSync()
+{
+    if (mStateSyncDepth++ == 0)
+    {
+        mStateSyncStart = GetNanoseconds();
+    }
+}
+
+void CallProfiler::endStateSync()
+{
+    ASSERT(mStateSyncDepth > 0);
+    if (--mStateSyncDepth == 0)
+    {
+        mStateSyncTotal += GetNanoseconds() - mStateSyncStart;
+    }
+}
+
+void CallProfiler::record(CallPhase phase, uint64_t nanoseconds)
+{
+    PhaseStats &stats = mStats[static_cast<size_t>(mEntryPoint)].phases[phase];
+    stats.totalNanoseconds += nanoseconds;
+    stats.histogram[GetHistogramBucket(nanoseconds)]++;
+}
+
+const CallProfiler::EntryPointStats *CallProfiler::getStats(gl::EntryPoint entryPoint) const
+{
+    size_t index = static_cast<size_t>(entryPoint);
+    if (index >= mStats.size() || mStats[index].callCount == 0)
+    {
+        return nullptr;
+    }
+    return &mStats[index];
+}
+
+std::string CallProfiler::toJSON() const
+{
+    std::ostringstream json;
+    json << "{\"histogramBucketUnit\": \"log2(ns)\", \"entryPoints\": [";
+
+    bool firstEntryPoint = true;
+    for (size_t index = 0; index < mStats.size(); ++index)
+    {
+        const EntryPointStats &stats = mStats[index];
+        if (stats.callCount == 0)
+        {
+            continue;
+        }
+
+        json << (firstEntryPoint ? "\n" : ",\n");
+        firstEntryPoint = false;
+
+        json << "  {\"name\": \"" << gl::GetEntryPointName(static_cast<gl::EntryPoint>(index))
+             << "\", \"calls\": " << stats.callCount;
+
+        for (CallPhase phase : AllEnums<CallPhase>())
+        {
+            const PhaseStats &phaseStats = stats.phases[phase];
+
+            // Leave out the empty buckets at the end of the histogram.
+            size_t bucketCount = kHistogramBucketCount;
+            while (bucketCount > 0 && phaseStats.histogram[bucketCount - 1] == 0)
+            {
+                bucketCount--;
+            }
+
+            json << ", \"" << GetCallPhaseName(phase)
+                 << "\": {\"totalNs\": " << phaseStats.totalNanoseconds << ", \"histogram\": [";
+            for (size_t bucket = 0; bucket < bucketCount; ++bucket)
+            {
+                json << (bucket > 0 ? ", " : "") << phaseStats.histogram[bucket];
+            }
+            json << "]}";
+        }
+
+        json << "}";
+    }
+
+    json << "\n]}\n";
+    return json.str();
+}
+
+void CallProfiler::dump(uintptr_t contextID) const
+{
+    std::string outDirectory = angle::GetEnvironmentVar("ANGLE_CALL_PROFILE_OUT_DIR");
+    if (outDirectory.empty())
+    {
+        WARN() << "Entry point profile of context 0x" << std::hex << contextID << ":\n"
+               << toJSON();
+        return;
+    }
+
+    std::ostringstream fileName;
+    fileName << outDirectory << "/angle_call_profile_" << std::hex << contextID << ".json";
+
+    std::ofstream file(fileName.str(), std::ios::out);
+    file << toJSON();
+    if (!file)
+    {
+        WARN() << "Failed to write the entry point profile to " << fileName.str() << ".";
+    }
+}
+
+}  // namespace angle
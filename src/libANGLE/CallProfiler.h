@@ -0,0 +1,136 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CallProfiler.h:
+//   Measures the CPU time spent in each entry point, split into validation, state syncing and
+//   execution. Only compiled in when ANGLE_CALL_PROFILING_ENABLED is set. Combined with the NULL
+//   back-end, it shows where the frontend's CPU time goes.
+//
+
+#ifndef LIBANGLE_CALL_PROFILER_H_
+#define LIBANGLE_CALL_PROFILER_H_
+
+#include <stdint.h>
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include "common/angleutils.h"
+#include "libANGLE/PackedEnums.h"
+#include "libANGLE/entry_points_enum_autogen.h"
+#include "libANGLE/features.h"
+
+namespace angle
+{
+enum class CallPhase
+{
+    Validation,
+    StateSync,
+    Execution,
+
+    InvalidEnum,
+    EnumCount = InvalidEnum,
+};
+
+// A context is only used by one thread at a time, so each context keeps its own profile without
+// any synchronization.
+class CallProfiler final : angle::NonCopyable
+{
+  public:
+    // Bucket i counts the calls that took [2^i, 2^(i+1)) nanoseconds in a phase.
+    static constexpr size_t kHistogramBucketCount = 32;
+
+    struct PhaseStats
+    {
+        PhaseStats();
+
+        uint64_t totalNanoseconds;
+        std::array<uint32_t, kHistogramBucketCount> histogram;
+    };
+
+    struct EntryPointStats
+    {
+        EntryPointStats();
+
+        uint64_t callCount;
+        PackedEnumMap<CallPhase, PhaseStats> phases;
+    };
+
+    CallProfiler();
+    ~CallProfiler();
+
+    void beginCall(gl::EntryPoint entryPoint);
+    void beginExecution();
+    void endCall();
+
+    void beginStateSync();
+    void endStateSync();
+
+    const EntryPointStats *getStats(gl::EntryPoint entryPoint) const;
+
+    std::string toJSON() const;
+
+    // Writes the profile to ANGLE_CALL_PROFILE_OUT_DIR if it is set, or logs it otherwise.
+    void dump(uintptr_t contextID) const;
+
+  private:
+    void record(CallPhase phase, uint64_t nanoseconds);
+
+    std::vector<EntryPointStats> mStats;
+
+    // Calls made from inside another entry point, such as debug callbacks, are part of the
+    // outermost call.
+    unsigned int mCallDepth;
+    gl::EntryPoint mEntryPoint;
+    uint64_t mCallStart;
+    uint64_t mExecutionStart;
+    unsigned int mStateSyncDepth;
+    uint64_t mStateSyncStart;
+    uint64_t mStateSyncTotal;
+};
+
+class ScopedCallProfile final : angle::NonCopyable
+{
+  public:
+    ScopedCallProfile(CallProfiler *profiler, gl::EntryPoint entryPoint) : mProfiler(profiler)
+    {
+        mProfiler->beginCall(entryPoint);
+    }
+    ~ScopedCallProfile() { mProfiler->endCall(); }
+
+    void onExecute() { mProfiler->beginExecution(); }
+
+  private:
+    CallProfiler *mProfiler;
+};
+
+class ScopedStateSyncProfile final : angle::NonCopyable
+{
+  public:
+    ScopedStateSyncProfile(CallProfiler *profiler) : mProfiler(profiler)
+    {
+        mProfiler->beginStateSync();
+    }
+    ~ScopedStateSyncProfile() { mProfiler->endStateSync(); }
+
+  private:
+    CallProfiler *mProfiler;
+};
+}  // namespace angle
+
+#if ANGLE_CALL_PROFILING_ENABLED
+#define ANGLE_SCOPED_CALL_PROFILE(context, entryPoint) \
+    angle::ScopedCallProfile callProfile((context)->getCallProfiler(), entryPoint)
+#define ANGLE_CALL_PROFILE_EXECUTE() callProfile.onExecute()
+#define ANGLE_SCOPED_STATE_SYNC_PROFILE(context) \
+    angle::ScopedStateSyncProfile stateSyncProfile((context)->getCallProfiler())
+#else
+#define ANGLE_SCOPED_CALL_PROFILE(context, entryPoint)
+#define ANGLE_CALL_PROFILE_EXECUTE()
+#define ANGLE_SCOPED_STATE_SYNC_PROFILE(context)
+#endif  // ANGLE_CALL_PROFILING_ENABLED
+
+#endif  // LIBANGLE_CALL_PROFILER_H_
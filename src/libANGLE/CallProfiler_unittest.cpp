@@ -0,0 +1,87 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CallProfiler_unittest.cpp: Unit tests for the entry point profiler.
+
+#include "libANGLE/CallProfiler.h"
+
+#include <gtest/gtest.h>
+
+namespace angle
+{
+namespace
+{
+uint32_t GetHistogramCount(const CallProfiler::PhaseStats &stats)
+{
+    uint32_t count = 0;
+    for (uint32_t bucketCount : stats.histogram)
+    {
+        count += bucketCount;
+    }
+    return count;
+}
+}  // anonymous namespace
+
+// Test that executed calls are recorded in every phase and rejected calls only in validation.
+TEST(CallProfilerTest, Phases)
+{
+    CallProfiler profiler;
+
+    {
+        ScopedCallProfile callProfile(&profiler, gl::EntryPoint::DrawArrays);
+        callProfile.onExecute();
+        ScopedStateSyncProfile stateSyncProfile(&profiler);
+    }
+    {
+        ScopedCallProfile callProfile(&profiler, gl::EntryPoint::DrawArrays);
+    }
+
+    const CallProfiler::EntryPointStats *stats = profiler.getStats(gl::EntryPoint::DrawArrays);
+    ASSERT_NE(nullptr, stats);
+    EXPECT_EQ(2u, stats->callCount);
+    EXPECT_EQ(2u, GetHistogramCount(stats->phases[CallPhase::Validation]));
+    EXPECT_EQ(1u, GetHistogramCount(stats->phases[CallPhase::StateSync]));
+    EXPECT_EQ(1u, GetHistogramCount(stats->phases[CallPhase::Execution]));
+
+    EXPECT_EQ(nullptr, profiler.getStats(gl::EntryPoint::Clear));
+}
+
+// Test that calls made from inside another entry point are counted as part of the outer call.
+TEST(CallProfilerTest, NestedCalls)
+{
+    CallProfiler profiler;
+
+    {
+        ScopedCallProfile outer(&profiler, gl::EntryPoint::DrawArrays);
+        outer.onExecute();
+        {
+            ScopedCallProfile inner(&profiler, gl::EntryPoint::GetError);
+            inner.onExecute();
+        }
+    }
+
+    const CallProfiler::EntryPointStats *stats = profiler.getStats(gl::EntryPoint::DrawArrays);
+    ASSERT_NE(nullptr, stats);
+    EXPECT_EQ(1u, stats->callCount);
+    EXPECT_EQ(nullptr, profiler.getStats(gl::EntryPoint::GetError));
+}
+
+// Test that the JSON output names the profiled entry points.
+TEST(CallProfilerTest, JSON)
+{
+    CallProfiler profiler;
+
+    {
+        ScopedCallProfile callProfile(&profiler, gl::EntryPoint::Clear);
+        callProfile.onExecute();
+    }
+
+    std::string json = profiler.toJSON();
+    EXPECT_NE(std::string::npos, json.find("\"name\": \"glClear\", \"calls\": 1"));
+    EXPECT_NE(std::string::npos, json.find("\"execution\""));
+    EXPECT_EQ(std::string::npos, json.find("glDrawArrays"));
+}
+
+}  // namespace angle
@@ -20,9 +20,16 @@ namespace
 {
 
 // Global count of active shader compiler handles. Needed to know when to call sh::Initialize and
-// sh::Finalize.
+// sh::Finalize. Compilers of different displays can be created and destroyed concurrently, so the
+// count is guarded by a mutex.
 size_t activeCompilerHandles = 0;
 
+std::mutex &GetActiveCompilerHandlesMutex()
+{
+    static std::mutex activeCompilerHandlesMutex;
+    return activeCompilerHandlesMutex;
+}
+
 ShShaderSpec SelectShaderSpec(GLint majorVersion, GLint minorVersion, bool isWebGL)
 {
     if (majorVersion >= 3)
@@ -154,22 +161,25 @@ Compiler::Compiler(rx::GLImplFactory *implFactory, const ContextState &state)
 
 Compiler::~Compiler()
 {
-    for (ShaderType shaderType : AllShaderTypes())
     {
-        ShHandle compilerHandle = mShaderCompilers[shaderType];
-        if (compilerHandle)
+        std::lock_guard<std::mutex> lock(GetActiveCompilerHandlesMutex());
+        for (ShaderType shaderType : AllShaderTypes())
         {
-            sh::Destruct(compilerHandle);
-            mShaderCompilers[shaderType] = nullptr;
-
-            ASSERT(activeCompilerHandles > 0);
-            activeCompilerHandles--;
+            ShHandle compilerHandle = mShaderCompilers[shaderType];
+            if (compilerHandle)
+            {
+                sh::Destruct(compilerHandle);
+                mShaderCompilers[shaderType] = nullptr;
+
+                ASSERT(activeCompilerHandles > 0);
+                activeCompilerHandles--;
+            }
         }
-    }
 
-    if (activeCompilerHandles == 0)
-    {
-        sh::Finalize();
+        if (activeCompilerHandles == 0)
+        {
+            sh::Finalize();
+        }
     }
 
     ANGLE_SWALLOW_ERR(mImplementation->release());
@@ -182,6 +192,7 @@ ShHandle Compiler::getCompilerHandle(ShaderType type)
 
     if (!(*compiler))
     {
+        std::lock_guard<std::mutex> lock(GetActiveCompilerHandlesMutex());
         if (activeCompilerHandles == 0)
         {
             sh::Initialize();
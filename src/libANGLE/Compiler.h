@@ -10,6 +10,8 @@
 #ifndef LIBANGLE_COMPILER_H_
 #define LIBANGLE_COMPILER_H_
 
+#include <mutex>
+
 #include "GLSLANG/ShaderLang.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/PackedEnums.h"
@@ -31,6 +33,13 @@ class Compiler final : public RefCountObjectNoID
     Compiler(rx::GLImplFactory *implFactory, const ContextState &data);
 
     ShHandle getCompilerHandle(ShaderType shaderType);
+
+    // Must be held while a shader is translated with the compiler handle of its type, since
+    // translations can run on worker threads.
+    std::mutex &getCompilerMutex(ShaderType shaderType)
+    {
+        return mShaderCompilerMutexes[shaderType];
+    }
     ShShaderOutput getShaderOutputType() const { return mOutputType; }
     const std::string &getBuiltinResourcesString(ShaderType type);
 
@@ -42,6 +51,7 @@ class Compiler final : public RefCountObjectNoID
     ShBuiltInResources mResources;
 
     ShaderMap<ShHandle> mShaderCompilers;
+    ShaderMap<std::mutex> mShaderCompilerMutexes;
 };
 
 }  // namespace gl
@@ -10,8 +10,10 @@
 #include "libANGLE/Context.h"
 
 #include <string.h>
+#include <chrono>
 #include <iterator>
 #include <sstream>
+#include <thread>
 #include <vector>
 
 #include "common/matrix_utils.h"
@@ -295,7 +297,8 @@ Context::Context(rx::EGLImplFactory *implFactory,
       mExtensionsEnabled(GetExtensionsEnabled(attribs, mWebGLContext)),
       mMemoryProgramCache(memoryProgramCache),
       mScratchBuffer(1000u),
-      mZeroFilledBuffer(1000u)
+      mZeroFilledBuffer(1000u),
+      mWorkerThreadPool(4)
 {
     // Needed to solve a Clang warning of unused variables.
     ANGLE_UNUSED_VARIABLE(mSavedArgsType);
@@ -303,6 +306,14 @@ Context::Context(rx::EGLImplFactory *implFactory,
 
     mImplementation->setMemoryProgramCache(memoryProgramCache);
 
+#if ANGLE_CAPTURE_ENABLED
+    mFrameCapture.reset(new angle::FrameCapture());
+#endif  // ANGLE_CAPTURE_ENABLED
+
+#if ANGLE_CALL_PROFILING_ENABLED
+    mCallProfiler.reset(new angle::CallProfiler());
+#endif  // ANGLE_CALL_PROFILING_ENABLED
+
     bool robustResourceInit = GetRobustResourceInit(attribs);
     initCaps(displayExtensions, robustResourceInit);
     initWorkarounds();
@@ -438,6 +449,10 @@ Context::Context(rx::EGLImplFactory *implFactory,
 
 egl::Error Context::onDestroy(const egl::Display *display)
 {
+#if ANGLE_CALL_PROFILING_ENABLED
+    mCallProfiler->dump(reinterpret_cast<uintptr_t>(this));
+#endif  // ANGLE_CALL_PROFILING_ENABLED
+
     if (mGLES1Renderer)
     {
         mGLES1Renderer->onDestroy(this, &mGLState);
@@ -485,6 +500,12 @@ egl::Error Context::onDestroy(const egl::Display *display)
     }
     mTransformFeedbackMap.clear();
 
+    for (Sync *swapSync : mSwapSyncs)
+    {
+        swapSync->release(this);
+    }
+    mSwapSyncs.clear();
+
     for (BindingPointer<Texture> &zeroTexture : mZeroTextures)
     {
         if (zeroTexture.get() != nullptr)
@@ -541,8 +562,6 @@ egl::Error Context::makeCurrent(egl::Display *display, egl::Surface *surface)
         mHasBeenCurrent = true;
     }
 
-    // TODO(jmadill): Rework this when we support ContextImpl
-    mGLState.setAllDirtyBits();
     mGLState.setAllDirtyObjects();
 
     ANGLE_TRY(releaseSurface(display));
@@ -580,6 +599,7 @@ egl::Error Context::makeCurrent(egl::Display *display, egl::Surface *surface)
 
     // Notify the renderer of a context switch
     mImplementation->onMakeCurrent(this);
+    mGLState.setDirtyBits(mImplementation->getDirtyBitsOnMakeCurrent());
     return egl::NoError();
 }
 
@@ -2153,9 +2173,130 @@ void Context::flush()
 
 void Context::finish()
 {
+    // Fence syncs are only guaranteed to be supported by the back-end with ES 3.0. Wait for them
+    // with the display unlocked first, so that the back-end finish has nothing left to wait for.
+    if (getClientMajorVersion() >= 3)
+    {
+        Error error = waitForGPUWithDisplayUnlocked();
+        if (error.isError())
+        {
+            handleError(error);
+            return;
+        }
+    }
+
     handleError(mImplementation->finish(this));
 }
 
+void Context::throttleSwap()
+{
+    if (getClientMajorVersion() < 3)
+    {
+        return;
+    }
+
+    if (mSwapSyncs.size() >= kMaxQueuedSwaps)
+    {
+        Sync *oldestSync = mSwapSyncs.front();
+        mSwapSyncs.pop_front();
+
+        GLenum result = GL_WAIT_FAILED;
+        Error error   = clientWaitWithDisplayUnlocked(oldestSync, GL_SYNC_FLUSH_COMMANDS_BIT,
+                                                    GL_TIMEOUT_IGNORED, &result);
+        oldestSync->release(this);
+        if (error.isError())
+        {
+            handleError(error);
+            return;
+        }
+    }
+
+    Sync *sync  = nullptr;
+    Error error = createInternalFenceSync(&sync);
+    if (error.isError())
+    {
+        handleError(error);
+        return;
+    }
+    mSwapSyncs.push_back(sync);
+}
+
+Error Context::createInternalFenceSync(Sync **outSync)
+{
+    Sync *sync = new Sync(mImplementation->createSync(), 0);
+    sync->addRef();
+
+    Error error = sync->set(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    if (error.isError())
+    {
+        sync->release(this);
+        return error;
+    }
+
+    *outSync = sync;
+    return NoError();
+}
+
+Error Context::waitForGPUWithDisplayUnlocked()
+{
+    Sync *sync = nullptr;
+    ANGLE_TRY(createInternalFenceSync(&sync));
+
+    GLenum result = GL_WAIT_FAILED;
+    Error error =
+        clientWaitWithDisplayUnlocked(sync, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED, &result);
+    sync->release(this);
+    return error;
+}
+
+Error Context::clientWaitWithDisplayUnlocked(Sync *sync,
+                                             GLbitfield flags,
+                                             GLuint64 timeout,
+                                             GLenum *outResult)
+{
+    egl::DisplayMutex *displayMutex = mCurrentDisplay ? mCurrentDisplay->getMutex() : nullptr;
+    const auto start                = std::chrono::steady_clock::now();
+
+    // Keep the sync alive if another thread deletes it while this one is out of the display.
+    sync->addRef();
+
+    Error error = NoError();
+    for (bool firstPoll = true;; firstPoll = false)
+    {
+        error = sync->clientWait(flags, 0, outResult);
+        if (error.isError())
+        {
+            break;
+        }
+
+        if (*outResult != GL_TIMEOUT_EXPIRED)
+        {
+            // The sync wasn't signaled when the wait started.
+            if (!firstPoll && *outResult == GL_ALREADY_SIGNALED)
+            {
+                *outResult = GL_CONDITION_SATISFIED;
+            }
+            break;
+        }
+
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start);
+        if (static_cast<GLuint64>(elapsed.count()) >= timeout)
+        {
+            break;
+        }
+
+        // Only the first poll flushes.
+        flags &= ~GL_SYNC_FLUSH_COMMANDS_BIT;
+
+        egl::ScopedDisplayUnlock displayUnlock(displayMutex);
+        std::this_thread::yield();
+    }
+
+    sync->release(this);
+    return error;
+}
+
 void Context::insertEventMarker(GLsizei length, const char *marker)
 {
     ASSERT(mImplementation);
@@ -3331,6 +3472,7 @@ Error Context::syncState(const State::DirtyBits &bitMask, const State::DirtyObje
 
 Error Context::syncDirtyBits()
 {
+    ANGLE_SCOPED_STATE_SYNC_PROFILE(this);
     const State::DirtyBits &dirtyBits = mGLState.getDirtyBits();
     mImplementation->syncState(this, dirtyBits);
     mGLState.clearDirtyBits();
@@ -3339,6 +3481,7 @@ Error Context::syncDirtyBits()
 
 Error Context::syncDirtyBits(const State::DirtyBits &bitMask)
 {
+    ANGLE_SCOPED_STATE_SYNC_PROFILE(this);
     const State::DirtyBits &dirtyBits = (mGLState.getDirtyBits() & bitMask);
     mImplementation->syncState(this, dirtyBits);
     mGLState.clearDirtyBits(dirtyBits);
@@ -3347,11 +3490,13 @@ Error Context::syncDirtyBits(const State::DirtyBits &bitMask)
 
 Error Context::syncDirtyObjects()
 {
+    ANGLE_SCOPED_STATE_SYNC_PROFILE(this);
     return mGLState.syncDirtyObjects(this);
 }
 
 Error Context::syncDirtyObjects(const State::DirtyObjects &objectMask)
 {
+    ANGLE_SCOPED_STATE_SYNC_PROFILE(this);
     return mGLState.syncDirtyObjects(this, objectMask);
 }
 
@@ -6031,7 +6176,7 @@ GLenum Context::clientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
     Sync *syncObject = getSync(sync);
 
     GLenum result = GL_WAIT_FAILED;
-    handleError(syncObject->clientWait(flags, timeout, &result));
+    handleError(clientWaitWithDisplayUnlocked(syncObject, flags, timeout, &result));
     return result;
 }
 
@@ -6398,6 +6543,13 @@ void Context::onTextureChange(const Texture *texture)
     mGLState.setObjectDirty(GL_TEXTURE);
 }
 
+void Context::onPostSwap() const
+{
+#if ANGLE_CAPTURE_ENABLED
+    mFrameCapture->onEndFrame();
+#endif  // ANGLE_CAPTURE_ENABLED
+}
+
 bool Context::isCurrentTransformFeedback(const TransformFeedback *tf) const
 {
     return mGLState.isCurrentTransformFeedback(tf);
@@ -10,24 +10,29 @@
 #ifndef LIBANGLE_CONTEXT_H_
 #define LIBANGLE_CONTEXT_H_
 
+#include <deque>
 #include <set>
 #include <string>
 
 #include "angle_gl.h"
 #include "common/MemoryBuffer.h"
 #include "common/angleutils.h"
+#include "libANGLE/CallProfiler.h"
 #include "libANGLE/Caps.h"
 #include "libANGLE/Constants.h"
 #include "libANGLE/ContextState.h"
 #include "libANGLE/Context_gles_1_0_autogen.h"
 #include "libANGLE/Error.h"
+#include "libANGLE/FrameCapture.h"
 #include "libANGLE/HandleAllocator.h"
 #include "libANGLE/PackedEnums.h"
 #include "libANGLE/RefCountObject.h"
 #include "libANGLE/ResourceMap.h"
 #include "libANGLE/VertexAttribute.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/Workarounds.h"
 #include "libANGLE/angletypes.h"
+#include "libANGLE/features.h"
 
 namespace rx
 {
@@ -80,6 +85,11 @@ class Context final : angle::NonCopyable
     egl::Error makeCurrent(egl::Display *display, egl::Surface *surface);
     egl::Error releaseSurface(const egl::Display *display);
 
+    // Called by the EGL entry points before a surface of this context is presented. Waits until
+    // the GPU is at most kMaxQueuedSwaps swaps behind, with the display unlocked, so that the
+    // present doesn't block the other threads using the display while the GPU catches up.
+    void throttleSwap();
+
     // These create  and destroy methods are merely pass-throughs to
     // ResourceManager, which owns these object types
     GLuint createBuffer();
@@ -1404,6 +1414,8 @@ class Context final : angle::NonCopyable
     Error prepareForDispatch();
 
     MemoryProgramCache *getMemoryProgramCache() const { return mMemoryProgramCache; }
+    angle::WorkerThreadPool *getWorkerThreadPool() const { return &mWorkerThreadPool; }
+    angle::CallProfiler *getCallProfiler() const { return mCallProfiler.get(); }
 
     template <EntryPoint EP, typename... ParamsT>
     void gatherParams(ParamsT &&... params);
@@ -1411,6 +1423,9 @@ class Context final : angle::NonCopyable
     // Notification for a state change in a Texture.
     void onTextureChange(const Texture *texture);
 
+    // Called after the draw surface was presented.
+    void onPostSwap() const;
+
     egl::Display *getCurrentDisplay() const { return mCurrentDisplay; }
     egl::Surface *getCurrentDrawSurface() const { return mCurrentSurface; }
     egl::Surface *getCurrentReadSurface() const { return mCurrentSurface; }
@@ -1501,6 +1516,16 @@ class Context final : angle::NonCopyable
     LabeledObject *getLabeledObject(GLenum identifier, GLuint name) const;
     LabeledObject *getLabeledObjectFromPtr(const void *ptr) const;
 
+    // Fence syncs used internally, which aren't visible to the application.
+    Error createInternalFenceSync(Sync **outSync);
+    Error waitForGPUWithDisplayUnlocked();
+    // Polls |sync| until it is signaled or |timeout| expires, leaving the display between polls so
+    // that other threads can use it while this one waits for the GPU.
+    Error clientWaitWithDisplayUnlocked(Sync *sync,
+                                        GLbitfield flags,
+                                        GLuint64 timeout,
+                                        GLenum *outResult);
+
     ContextState mState;
     bool mSkipValidation;
     bool mDisplayTextureShareGroup;
@@ -1576,6 +1601,9 @@ class Context final : angle::NonCopyable
     bool mExtensionsEnabled;
     MemoryProgramCache *mMemoryProgramCache;
 
+    static constexpr size_t kMaxQueuedSwaps = 2;
+    std::deque<Sync *> mSwapSyncs;
+
     State::DirtyBits mTexImageDirtyBits;
     State::DirtyObjects mTexImageDirtyObjects;
     State::DirtyBits mReadPixelsDirtyBits;
@@ -1592,6 +1620,15 @@ class Context final : angle::NonCopyable
     // Not really a property of context state. The size and contexts change per-api-call.
     mutable angle::ScratchBuffer mScratchBuffer;
     mutable angle::ScratchBuffer mZeroFilledBuffer;
+
+    // Runs frontend work, such as shader translation, that can overlap with the application.
+    mutable angle::WorkerThreadPool mWorkerThreadPool;
+
+    // Only allocated when ANGLE_CAPTURE_ENABLED is set.
+    mutable std::unique_ptr<angle::FrameCapture> mFrameCapture;
+
+    // Only allocated when ANGLE_CALL_PROFILING_ENABLED is set.
+    mutable std::unique_ptr<angle::CallProfiler> mCallProfiler;
 };
 
 template <typename T>
@@ -1608,6 +1645,10 @@ ANGLE_INLINE void Context::gatherParams(ArgsT &&... args)
     static_assert(sizeof(EntryPointParamType<EP>) <= kParamsBufferSize,
                   "Params struct too large, please increase kParamsBufferSize.");
 
+#if ANGLE_CAPTURE_ENABLED
+    mFrameCapture->captureCall(EP, args...);
+#endif  // ANGLE_CAPTURE_ENABLED
+
     mSavedArgsType = &EntryPointParamType<EP>::TypeInfo;
 
     // Skip doing any work for ParamsBase/Invalid type.
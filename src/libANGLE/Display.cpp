@@ -13,6 +13,7 @@
 #include <algorithm>
 #include <iterator>
 #include <map>
+#include <mutex>
 #include <sstream>
 #include <vector>
 
@@ -77,6 +78,13 @@ namespace egl
 namespace
 {
 
+// Guards the maps below, which are shared by the displays used on every thread.
+std::mutex &GetDisplayMapsMutex()
+{
+    static std::mutex displayMapsMutex;
+    return displayMapsMutex;
+}
+
 typedef std::map<EGLNativeWindowType, Surface*> WindowSurfaceMap;
 // Get a map of all EGL window surfaces to validate that no window has more than one EGL surface
 // associated with it.
@@ -287,26 +295,31 @@ Display *Display::GetDisplayFromNativeDisplay(EGLNativeDisplayType nativeDisplay
 {
     Display *display = nullptr;
 
-    ANGLEPlatformDisplayMap *displays = GetANGLEPlatformDisplayMap();
-    const auto &iter                  = displays->find(nativeDisplay);
-    if (iter != displays->end())
     {
-        display = iter->second;
-    }
+        std::lock_guard<std::mutex> mapsLock(GetDisplayMapsMutex());
 
-    if (display == nullptr)
-    {
-        // Validate the native display
-        if (!Display::isValidNativeDisplay(nativeDisplay))
+        ANGLEPlatformDisplayMap *displays = GetANGLEPlatformDisplayMap();
+        const auto &iter                  = displays->find(nativeDisplay);
+        if (iter != displays->end())
         {
-            return nullptr;
+            display = iter->second;
         }
 
-        display = new Display(EGL_PLATFORM_ANGLE_ANGLE, nativeDisplay, nullptr);
-        displays->insert(std::make_pair(nativeDisplay, display));
+        if (display == nullptr)
+        {
+            // Validate the native display
+            if (!Display::isValidNativeDisplay(nativeDisplay))
+            {
+                return nullptr;
+            }
+
+            display = new Display(EGL_PLATFORM_ANGLE_ANGLE, nativeDisplay, nullptr);
+            displays->insert(std::make_pair(nativeDisplay, display));
+        }
     }
 
     // Apply new attributes if the display is not initialized yet.
+    ScopedDisplayLock displayLock(display->getMutex());
     if (!display->isInitialized())
     {
         rx::DisplayImpl *impl = CreateDisplayFromAttribs(attribMap, display->getState());
@@ -329,37 +342,42 @@ Display *Display::GetDisplayFromDevice(Device *device, const AttributeMap &attri
 
     ASSERT(Device::IsValidDevice(device));
 
-    ANGLEPlatformDisplayMap *anglePlatformDisplays   = GetANGLEPlatformDisplayMap();
-    DevicePlatformDisplayMap *devicePlatformDisplays = GetDevicePlatformDisplayMap();
-
-    // First see if this eglDevice is in use by a Display created using ANGLE platform
-    for (auto &displayMapEntry : *anglePlatformDisplays)
     {
-        egl::Display *iterDisplay = displayMapEntry.second;
-        if (iterDisplay->getDevice() == device)
+        std::lock_guard<std::mutex> mapsLock(GetDisplayMapsMutex());
+
+        ANGLEPlatformDisplayMap *anglePlatformDisplays   = GetANGLEPlatformDisplayMap();
+        DevicePlatformDisplayMap *devicePlatformDisplays = GetDevicePlatformDisplayMap();
+
+        // First see if this eglDevice is in use by a Display created using ANGLE platform
+        for (auto &displayMapEntry : *anglePlatformDisplays)
         {
-            display = iterDisplay;
+            egl::Display *iterDisplay = displayMapEntry.second;
+            if (iterDisplay->getDevice() == device)
+            {
+                display = iterDisplay;
+            }
         }
-    }
 
-    if (display == nullptr)
-    {
-        // See if the eglDevice is in use by a Display created using the DEVICE platform
-        const auto &iter = devicePlatformDisplays->find(device);
-        if (iter != devicePlatformDisplays->end())
+        if (display == nullptr)
         {
-            display = iter->second;
+            // See if the eglDevice is in use by a Display created using the DEVICE platform
+            const auto &iter = devicePlatformDisplays->find(device);
+            if (iter != devicePlatformDisplays->end())
+            {
+                display = iter->second;
+            }
         }
-    }
 
-    if (display == nullptr)
-    {
-        // Otherwise create a new Display
-        display = new Display(EGL_PLATFORM_DEVICE_EXT, 0, device);
-        devicePlatformDisplays->insert(std::make_pair(device, display));
+        if (display == nullptr)
+        {
+            // Otherwise create a new Display
+            display = new Display(EGL_PLATFORM_DEVICE_EXT, 0, device);
+            devicePlatformDisplays->insert(std::make_pair(device, display));
+        }
     }
 
     // Apply new attributes if the display is not initialized yet.
+    ScopedDisplayLock displayLock(display->getMutex());
     if (!display->isInitialized())
     {
         rx::DisplayImpl *impl = CreateDisplayFromDevice(device, display->getState());
@@ -396,6 +414,7 @@ Display::~Display()
     // TODO(jmadill): When is this called?
     // terminate();
 
+    std::lock_guard<std::mutex> mapsLock(GetDisplayMapsMutex());
     if (mPlatform == EGL_PLATFORM_ANGLE_ANGLE)
     {
         ANGLEPlatformDisplayMap *displays      = GetANGLEPlatformDisplayMap();
@@ -602,6 +621,7 @@ Error Display::createWindowSurface(const Config *configuration,
     *outSurface = surface.release();
     mState.surfaceSet.insert(*outSurface);
 
+    std::lock_guard<std::mutex> mapsLock(GetDisplayMapsMutex());
     WindowSurfaceMap *windowSurfaces = GetWindowSurfaces();
     ASSERT(windowSurfaces && windowSurfaces->find(window) == windowSurfaces->end());
     windowSurfaces->insert(std::make_pair(window, *outSurface));
@@ -824,6 +844,7 @@ Error Display::destroySurface(Surface *surface)
 {
     if (surface->getType() == EGL_WINDOW_BIT)
     {
+        std::lock_guard<std::mutex> mapsLock(GetDisplayMapsMutex());
         WindowSurfaceMap *windowSurfaces = GetWindowSurfaces();
         ASSERT(windowSurfaces);
 
@@ -961,6 +982,7 @@ bool Display::isValidStream(const Stream *stream) const
 
 bool Display::hasExistingWindowSurface(EGLNativeWindowType window)
 {
+    std::lock_guard<std::mutex> mapsLock(GetDisplayMapsMutex());
     WindowSurfaceMap *windowSurfaces = GetWindowSurfaces();
     ASSERT(windowSurfaces);
 
@@ -1071,6 +1093,7 @@ Error Display::validateClientBuffer(const Config *configuration,
 
 bool Display::isValidDisplay(const egl::Display *display)
 {
+    std::lock_guard<std::mutex> mapsLock(GetDisplayMapsMutex());
     const ANGLEPlatformDisplayMap *anglePlatformDisplayMap = GetANGLEPlatformDisplayMap();
     for (const auto &displayPair : *anglePlatformDisplayMap)
     {
@@ -17,6 +17,7 @@
 #include "libANGLE/AttributeMap.h"
 #include "libANGLE/Caps.h"
 #include "libANGLE/Config.h"
+#include "libANGLE/DisplayMutex.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/LoggingAnnotator.h"
 #include "libANGLE/MemoryProgramCache.h"
@@ -163,6 +164,9 @@ class Display final : angle::NonCopyable
 
     gl::Context *getProxyContext() const { return mProxyContext.get(); }
 
+    // Held by the GL and EGL entry points for the duration of every call on the display.
+    DisplayMutex *getMutex() { return &mMutex; }
+
   private:
     Display(EGLenum platform, EGLNativeDisplayType displayId, Device *eglDevice);
 
@@ -176,6 +180,8 @@ class Display final : angle::NonCopyable
     DisplayState mState;
     rx::DisplayImpl *mImplementation;
 
+    DisplayMutex mMutex;
+
     EGLNativeDisplayType mDisplayId;
     AttributeMap mAttributeMap;
 
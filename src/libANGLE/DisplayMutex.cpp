@@ -0,0 +1,216 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DisplayMutex:
+//   Serializes the GL and EGL calls made on the contexts and objects of a display.
+//
+
+#include "libANGLE/DisplayMutex.h"
+
+#include <functional>
+#include <utility>
+
+#include "common/debug.h"
+
+namespace egl
+{
+
+DisplayMutex::DisplayMutex()
+    : mOwner(std::thread::id()),
+      mOwnerInside(false),
+      mShared(false),
+      mOwnerDepth(0),
+      mHolder(std::thread::id()),
+      mHolderDepth(0)
+{
+}
+
+DisplayMutex::~DisplayMutex()
+{
+    ASSERT(mOwnerDepth == 0 && mHolderDepth == 0);
+}
+
+void DisplayMutex::lock()
+{
+    const std::thread::id self = std::this_thread::get_id();
+
+    // Only the owner can see its own id here, so no other thread reads mOwnerDepth.
+    if (mOwner.load(std::memory_order_relaxed) == self && mOwnerDepth > 0)
+    {
+        mOwnerDepth++;
+        return;
+    }
+
+    if (!mShared.load() && tryEnterAsOwner())
+    {
+        return;
+    }
+
+    lockShared(self);
+}
+
+void DisplayMutex::unlock()
+{
+    const std::thread::id self = std::this_thread::get_id();
+
+    if (mOwner.load(std::memory_order_relaxed) == self && mOwnerDepth > 0)
+    {
+        if (--mOwnerDepth == 0)
+        {
+            mOwnerInside.store(false);
+        }
+        return;
+    }
+
+    ASSERT(mHolder.load(std::memory_order_relaxed) == self && mHolderDepth > 0);
+    if (--mHolderDepth == 0)
+    {
+        mHolder.store(std::thread::id(), std::memory_order_relaxed);
+        mMutex.unlock();
+    }
+}
+
+bool DisplayMutex::unlockForWait()
+{
+    const std::thread::id self = std::this_thread::get_id();
+
+    if (mOwner.load(std::memory_order_relaxed) == self && mOwnerDepth > 0)
+    {
+        if (mOwnerDepth > 1)
+        {
+            return false;
+        }
+
+        mOwnerDepth = 0;
+        mOwnerInside.store(false);
+        return true;
+    }
+
+    if (mHolder.load(std::memory_order_relaxed) == self)
+    {
+        if (mHolderDepth > 1)
+        {
+            return false;
+        }
+
+        mHolderDepth = 0;
+        mHolder.store(std::thread::id(), std::memory_order_relaxed);
+        mMutex.unlock();
+        return true;
+    }
+
+    return false;
+}
+
+bool DisplayMutex::tryEnterAsOwner()
+{
+    const std::thread::id self = std::this_thread::get_id();
+
+    std::thread::id owner = mOwner.load(std::memory_order_relaxed);
+    if (owner == std::thread::id() && mOwner.compare_exchange_strong(owner, self))
+    {
+        owner = self;
+    }
+
+    if (owner != self)
+    {
+        return false;
+    }
+
+    // Announce the owner before checking for other threads. lockShared sets mShared before it
+    // checks mOwnerInside, so either the owner sees mShared here or the other thread waits for the
+    // owner to leave.
+    mOwnerInside.store(true);
+    if (mShared.load())
+    {
+        mOwnerInside.store(false);
+        return false;
+    }
+
+    mOwnerDepth = 1;
+    return true;
+}
+
+void DisplayMutex::lockShared(std::thread::id self)
+{
+    // Only the holder can see its own id here, so no other thread reads mHolderDepth.
+    if (mHolder.load(std::memory_order_relaxed) == self)
+    {
+        mHolderDepth++;
+        return;
+    }
+
+    mMutex.lock();
+
+    if (!mShared.load())
+    {
+        // A second thread is using the display. Wait for the owner to leave, after which it locks
+        // the mutex like every other thread.
+        mShared.store(true);
+        while (mOwnerInside.load())
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    mHolder.store(self, std::memory_order_relaxed);
+    mHolderDepth = 1;
+}
+
+ScopedDisplayLock::ScopedDisplayLock(DisplayMutex *mutex) : ScopedDisplayLock(mutex, nullptr)
+{
+}
+
+ScopedDisplayLock::ScopedDisplayLock(DisplayMutex *mutex, DisplayMutex *otherMutex)
+    : mMutex(mutex), mOtherMutex(otherMutex)
+{
+    if (mOtherMutex == mMutex)
+    {
+        mOtherMutex = nullptr;
+    }
+
+    // Always lock the mutex with the lower address first.
+    if (mMutex == nullptr ||
+        (mOtherMutex != nullptr && std::less<DisplayMutex *>()(mOtherMutex, mMutex)))
+    {
+        std::swap(mMutex, mOtherMutex);
+    }
+
+    if (mMutex)
+    {
+        mMutex->lock();
+    }
+    if (mOtherMutex)
+    {
+        mOtherMutex->lock();
+    }
+}
+
+ScopedDisplayLock::~ScopedDisplayLock()
+{
+    if (mOtherMutex)
+    {
+        mOtherMutex->unlock();
+    }
+    if (mMutex)
+    {
+        mMutex->unlock();
+    }
+}
+
+ScopedDisplayUnlock::ScopedDisplayUnlock(DisplayMutex *mutex)
+    : mMutex(mutex), mUnlocked(mutex != nullptr && mutex->unlockForWait())
+{
+}
+
+ScopedDisplayUnlock::~ScopedDisplayUnlock()
+{
+    if (mUnlocked)
+    {
+        mMutex->lock();
+    }
+}
+
+}  // namespace egl
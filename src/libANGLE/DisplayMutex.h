@@ -0,0 +1,91 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DisplayMutex:
+//   Serializes the GL and EGL calls made on the contexts and objects of a display. Every context of
+//   a display shares the display's renderer, so calls made on different contexts of one display
+//   can't run concurrently even when the contexts don't share any objects. Calls on different
+//   displays don't contend with each other.
+//
+
+#ifndef LIBANGLE_DISPLAYMUTEX_H_
+#define LIBANGLE_DISPLAYMUTEX_H_
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include "common/angleutils.h"
+
+namespace egl
+{
+
+// A recursive mutex that is only locked once more than one thread uses the display. The first
+// thread to lock it owns it and enters without locking. When another thread locks it for the first
+// time, it waits for the owner to leave, and from then on every thread locks the mutex.
+class DisplayMutex final : angle::NonCopyable
+{
+  public:
+    DisplayMutex();
+    ~DisplayMutex();
+
+    void lock();
+    void unlock();
+
+    // Leaves the display while the calling thread blocks, for example on the GPU, so that other
+    // threads can use it in the meantime. Returns false and stays in the display when the calling
+    // thread isn't in it, or has entered it more than once and can't leave it safely.
+    bool unlockForWait();
+
+    bool isSharedForTesting() const { return mShared.load(); }
+
+  private:
+    bool tryEnterAsOwner();
+    void lockShared(std::thread::id self);
+
+    // The thread allowed to enter without locking while the display isn't shared.
+    std::atomic<std::thread::id> mOwner;
+    // Set while the owner is in the display without having locked the mutex.
+    std::atomic<bool> mOwnerInside;
+    // Set for good once a second thread has entered the display.
+    std::atomic<bool> mShared;
+    // Only accessed by the owner.
+    unsigned int mOwnerDepth;
+
+    std::mutex mMutex;
+    std::atomic<std::thread::id> mHolder;
+    // Only accessed by the thread holding the mutex.
+    unsigned int mHolderDepth;
+};
+
+// Holds a display mutex for the lifetime of the object. A null mutex isn't locked.
+class ScopedDisplayLock final : angle::NonCopyable
+{
+  public:
+    explicit ScopedDisplayLock(DisplayMutex *mutex);
+    // Locks the mutexes of two displays in an order that can't deadlock. Either can be null.
+    ScopedDisplayLock(DisplayMutex *mutex, DisplayMutex *otherMutex);
+    ~ScopedDisplayLock();
+
+  private:
+    DisplayMutex *mMutex;
+    DisplayMutex *mOtherMutex;
+};
+
+// Leaves a display for the lifetime of the object, if the calling thread can.
+class ScopedDisplayUnlock final : angle::NonCopyable
+{
+  public:
+    explicit ScopedDisplayUnlock(DisplayMutex *mutex);
+    ~ScopedDisplayUnlock();
+
+  private:
+    DisplayMutex *mMutex;
+    bool mUnlocked;
+};
+
+}  // namespace egl
+
+#endif  // LIBANGLE_DISPLAYMUTEX_H_
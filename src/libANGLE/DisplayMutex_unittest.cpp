@@ -0,0 +1,159 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DisplayMutex_unittest:
+//   Tests of the mutex that serializes the calls made on a display.
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "libANGLE/DisplayMutex.h"
+
+using namespace egl;
+
+namespace
+{
+
+// A display used from a single thread never locks the mutex, including when calls nest.
+TEST(DisplayMutexTest, SingleThreadDoesNotShare)
+{
+    DisplayMutex mutex;
+    for (int iteration = 0; iteration < 4; ++iteration)
+    {
+        ScopedDisplayLock lock(&mutex);
+        ScopedDisplayLock nestedLock(&mutex);
+    }
+    EXPECT_FALSE(mutex.isSharedForTesting());
+}
+
+// A second thread can't enter while the owner is in the display, and it makes every later call
+// lock the mutex.
+TEST(DisplayMutexTest, SecondThreadWaitsForOwner)
+{
+    DisplayMutex mutex;
+    std::atomic<bool> entered(false);
+
+    mutex.lock();
+    std::thread other([&]() {
+        ScopedDisplayLock lock(&mutex);
+        entered = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(entered);
+    mutex.unlock();
+
+    other.join();
+    EXPECT_TRUE(entered);
+    EXPECT_TRUE(mutex.isSharedForTesting());
+}
+
+// A thread that leaves the display to wait lets other threads in, and enters it again afterwards.
+TEST(DisplayMutexTest, UnlockForWaitLetsOtherThreadsIn)
+{
+    DisplayMutex mutex;
+    int value = 0;
+
+    ScopedDisplayLock lock(&mutex);
+    {
+        ScopedDisplayLock nestedLock(&mutex);
+        EXPECT_FALSE(mutex.unlockForWait());
+    }
+
+    for (int iteration = 0; iteration < 2; ++iteration)
+    {
+        // Once as the owner, then while holding the mutex after the display became shared.
+        ScopedDisplayUnlock unlock(&mutex);
+        std::thread other([&]() {
+            ScopedDisplayLock otherLock(&mutex);
+            value++;
+        });
+        other.join();
+    }
+
+    EXPECT_EQ(2, value);
+    EXPECT_TRUE(mutex.isSharedForTesting());
+}
+
+// Many threads, including the owner, increment an unprotected counter through the mutex.
+TEST(DisplayMutexTest, Stress)
+{
+    constexpr size_t kThreadCount         = 8;
+    constexpr size_t kIterationsPerThread = 2000;
+
+    DisplayMutex mutex;
+    size_t counter = 0;
+
+    auto increment = [&]() {
+        for (size_t iteration = 0; iteration < kIterationsPerThread; ++iteration)
+        {
+            ScopedDisplayLock lock(&mutex);
+            if (iteration % 2 == 0)
+            {
+                ScopedDisplayLock nestedLock(&mutex);
+                counter++;
+            }
+            else
+            {
+                ScopedDisplayUnlock unlock(&mutex);
+                std::this_thread::yield();
+            }
+        }
+    };
+
+    // Make this thread the owner before starting the other threads.
+    {
+        ScopedDisplayLock lock(&mutex);
+    }
+
+    std::array<std::thread, kThreadCount> threads;
+    for (std::thread &thread : threads)
+    {
+        thread = std::thread(increment);
+    }
+    increment();
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ((kThreadCount + 1) * kIterationsPerThread / 2, counter);
+}
+
+// Locking the mutexes of two displays in either order can't deadlock.
+TEST(DisplayMutexTest, TwoDisplaysInEitherOrder)
+{
+    constexpr size_t kIterationsPerThread = 2000;
+
+    DisplayMutex first;
+    DisplayMutex second;
+    size_t counter = 0;
+
+    std::thread forward([&]() {
+        for (size_t iteration = 0; iteration < kIterationsPerThread; ++iteration)
+        {
+            ScopedDisplayLock lock(&first, &second);
+            counter++;
+        }
+    });
+    std::thread backward([&]() {
+        for (size_t iteration = 0; iteration < kIterationsPerThread; ++iteration)
+        {
+            ScopedDisplayLock lock(&second, &first);
+            counter++;
+        }
+    });
+
+    forward.join();
+    backward.join();
+    EXPECT_EQ(2 * kIterationsPerThread, counter);
+}
+
+}  // anonymous namespace
@@ -19,6 +19,9 @@ namespace gl
 ERRMSG(BlitDimensionsOutOfRange, "BlitFramebuffer dimensions out of 32-bit integer range.");
 ERRMSG(BufferBoundForTransformFeedback, "Buffer is bound for transform feedback.");
 ERRMSG(BufferNotBound, "A buffer must be bound.");
+ERRMSG(BufferWebGLTypeMismatch,
+       "Buffers bound to GL_ELEMENT_ARRAY_BUFFER can't be bound to other data targets, and vice "
+       "versa.");
 ERRMSG(CompressedTextureDimensionsMustMatchData,
        "Compressed texture dimensions must exactly match the dimensions of the data passed in.");
 ERRMSG(CompressedTexturesNotAttachable, "Compressed textures cannot be attached to a framebuffer.");
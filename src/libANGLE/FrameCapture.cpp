@@ -0,0 +1,142 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FrameCapture.cpp:
+//   ANGLE Frame capture implementation.
+//
+
+#include "libANGLE/FrameCapture.h"
+
+#include <fstream>
+#include <sstream>
+
+#include "common/system_utils.h"
+
+namespace angle
+{
+namespace
+{
+constexpr size_t kHeaderSize = sizeof(kFrameCaptureMagic) + 3 * sizeof(uint32_t);
+
+class CaptureReader final : angle::NonCopyable
+{
+  public:
+    CaptureReader(const std::vector<uint8_t> &data) : mData(data), mOffset(0) {}
+
+    template <typename T>
+    bool read(T *valueOut)
+    {
+        if (mData.size() - mOffset < sizeof(T))
+        {
+            return false;
+        }
+        memcpy(valueOut, mData.data() + mOffset, sizeof(T));
+        mOffset += sizeof(T);
+        return true;
+    }
+
+    bool isAtEnd() const { return mOffset == mData.size(); }
+
+  private:
+    const std::vector<uint8_t> &mData;
+    size_t mOffset;
+};
+}  // anonymous namespace
+
+bool ParseFrameCapture(const std::vector<uint8_t> &data,
+                       uint32_t *frameIndexOut,
+                       std::vector<CapturedCall> *callsOut)
+{
+    CaptureReader reader(data);
+
+    char magic[sizeof(kFrameCaptureMagic)];
+    uint32_t version   = 0;
+    uint32_t callCount = 0;
+    if (!reader.read(&magic) || memcmp(magic, kFrameCaptureMagic, sizeof(magic)) != 0 ||
+        !reader.read(&version) || version != kFrameCaptureVersion || !reader.read(frameIndexOut) ||
+        !reader.read(&callCount))
+    {
+        return false;
+    }
+
+    callsOut->clear();
+    for (uint32_t callIndex = 0; callIndex < callCount; ++callIndex)
+    {
+        uint16_t entryPoint = 0;
+        uint8_t paramCount  = 0;
+        if (!reader.read(&entryPoint) || !reader.read(&paramCount))
+        {
+            return false;
+        }
+
+        CapturedCall call;
+        call.entryPoint = static_cast<gl::EntryPoint>(entryPoint);
+        call.params.resize(paramCount);
+        for (CapturedParam &param : call.params)
+        {
+            uint8_t type = 0;
+            if (!reader.read(&type) || type > static_cast<uint8_t>(CapturedParamType::Pointer) ||
+                !reader.read(&param.value))
+            {
+                return false;
+            }
+            param.type = static_cast<CapturedParamType>(type);
+        }
+
+        callsOut->push_back(std::move(call));
+    }
+
+    return reader.isAtEnd();
+}
+
+FrameCapture::FrameCapture()
+    : mOutDirectory(angle::GetEnvironmentVar("ANGLE_CAPTURE_OUT_DIR")),
+      mFrameIndex(0),
+      mFrameCallCount(0)
+{
+    resetFrame();
+}
+
+FrameCapture::~FrameCapture()
+{
+}
+
+void FrameCapture::onEndFrame()
+{
+    // Patch the call count into the header now that the frame is complete.
+    memcpy(mFrameData.data() + kHeaderSize - sizeof(uint32_t), &mFrameCallCount,
+           sizeof(uint32_t));
+
+    if (!mOutDirectory.empty())
+    {
+        std::stringstream fileName;
+        fileName << mOutDirectory << "/angle_capture_frame" << mFrameIndex << ".angledata";
+
+        std::ofstream file(fileName.str(), std::ios::out | std::ios::binary);
+        file.write(reinterpret_cast<const char *>(mFrameData.data()), mFrameData.size());
+        if (!file)
+        {
+            WARN() << "Failed to write the frame capture to " << fileName.str() << ".";
+        }
+    }
+
+    mFrameIndex++;
+    resetFrame();
+}
+
+void FrameCapture::resetFrame()
+{
+    mFrameData.clear();
+    mFrameCallCount = 0;
+
+    mFrameData.insert(mFrameData.end(), kFrameCaptureMagic,
+                      kFrameCaptureMagic + sizeof(kFrameCaptureMagic));
+    writeValue(kFrameCaptureVersion);
+    writeValue(mFrameIndex);
+    writeValue(mFrameCallCount);
+    ASSERT(mFrameData.size() == kHeaderSize);
+}
+
+}  // namespace angle
@@ -0,0 +1,168 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FrameCapture.h:
+//   ANGLE Frame capture interface. Records the GLES calls made through the entry points into a
+//   compact binary trace, one file per frame.
+//
+//   The trace is a call log for inspection and can't be replayed. Pointer parameters are recorded
+//   as raw addresses only: the client memory they point to, such as vertex data, pixels and shader
+//   sources, isn't captured, and there is no replay tool.
+//
+
+#ifndef LIBANGLE_FRAME_CAPTURE_H_
+#define LIBANGLE_FRAME_CAPTURE_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "common/angleutils.h"
+#include "common/debug.h"
+#include "libANGLE/entry_points_enum_autogen.h"
+
+namespace angle
+{
+enum class CapturedParamType : uint8_t
+{
+    Int,
+    UInt,
+    Float,
+    Enum,
+    Pointer,
+};
+
+struct CapturedParam
+{
+    CapturedParamType type;
+    uint64_t value;
+};
+
+struct CapturedCall
+{
+    gl::EntryPoint entryPoint;
+    std::vector<CapturedParam> params;
+};
+
+// The trace starts with a header:
+//   char[8]  magic ("ANGLECAP")
+//   uint32_t format version
+//   uint32_t frame index
+//   uint32_t call count
+// followed by each call:
+//   uint16_t entry point
+//   uint8_t  param count
+//   {uint8_t type, uint64_t value} for each param
+// Floats are stored as the bits of a double. Pointers are stored as addresses; the memory they
+// point to isn't captured.
+constexpr char kFrameCaptureMagic[8]    = {'A', 'N', 'G', 'L', 'E', 'C', 'A', 'P'};
+constexpr uint32_t kFrameCaptureVersion = 1;
+
+// Parses a trace written by FrameCapture. Returns false if the data is malformed.
+bool ParseFrameCapture(const std::vector<uint8_t> &data,
+                       uint32_t *frameIndexOut,
+                       std::vector<CapturedCall> *callsOut);
+
+namespace priv
+{
+template <typename T>
+typename std::enable_if<std::is_pointer<T>::value, CapturedParam>::type EncodeParam(T param)
+{
+    return {CapturedParamType::Pointer, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(param))};
+}
+
+template <typename T>
+typename std::enable_if<std::is_enum<T>::value, CapturedParam>::type EncodeParam(T param)
+{
+    return {CapturedParamType::Enum, static_cast<uint64_t>(param)};
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, CapturedParam>::type EncodeParam(T param)
+{
+    double number  = static_cast<double>(param);
+    uint64_t value = 0;
+    memcpy(&value, &number, sizeof(double));
+    return {CapturedParamType::Float, value};
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, CapturedParam>::type EncodeParam(T param)
+{
+    if (std::is_signed<T>::value)
+    {
+        return {CapturedParamType::Int, static_cast<uint64_t>(static_cast<int64_t>(param))};
+    }
+    return {CapturedParamType::UInt, static_cast<uint64_t>(param)};
+}
+}  // namespace priv
+
+class FrameCapture final : angle::NonCopyable
+{
+  public:
+    FrameCapture();
+    ~FrameCapture();
+
+    template <typename... ArgsT>
+    void captureCall(gl::EntryPoint entryPoint, const ArgsT &... args);
+
+    // Writes the calls captured since the previous frame. Does nothing unless the
+    // ANGLE_CAPTURE_OUT_DIR environment variable names the output directory.
+    void onEndFrame();
+
+    const std::vector<uint8_t> &getFrameData() const { return mFrameData; }
+    uint32_t getFrameCallCount() const { return mFrameCallCount; }
+
+  private:
+    template <typename T>
+    void writeValue(T value);
+
+    template <typename T>
+    void captureParam(const T &param);
+
+    void resetFrame();
+
+    std::string mOutDirectory;
+    uint32_t mFrameIndex;
+    uint32_t mFrameCallCount;
+    std::vector<uint8_t> mFrameData;
+};
+
+template <typename T>
+void FrameCapture::writeValue(T value)
+{
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&value);
+    mFrameData.insert(mFrameData.end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+void FrameCapture::captureParam(const T &param)
+{
+    CapturedParam captured = priv::EncodeParam(param);
+    writeValue(static_cast<uint8_t>(captured.type));
+    writeValue(captured.value);
+}
+
+template <typename... ArgsT>
+void FrameCapture::captureCall(gl::EntryPoint entryPoint, const ArgsT &... args)
+{
+    static_assert(sizeof...(ArgsT) <= 0xFF, "Too many parameters for the capture format.");
+
+    writeValue(static_cast<uint16_t>(entryPoint));
+    writeValue(static_cast<uint8_t>(sizeof...(ArgsT)));
+
+    // Expands to one captureParam call per argument, in order.
+    int expander[] = {0, (captureParam(args), 0)...};
+    ANGLE_UNUSED_VARIABLE(expander);
+
+    mFrameCallCount++;
+}
+
+}  // namespace angle
+
+#endif  // LIBANGLE_FRAME_CAPTURE_H_
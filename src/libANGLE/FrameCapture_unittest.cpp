@@ -0,0 +1,105 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FrameCapture_unittest.cpp: Unit tests for the frame capture trace format.
+
+#include "libANGLE/FrameCapture.h"
+
+#include <gtest/gtest.h>
+
+#include "angle_gl.h"
+#include "libANGLE/PackedGLEnums_autogen.h"
+
+namespace angle
+{
+
+// Test that captured calls can be parsed back with all their parameters.
+TEST(FrameCaptureTest, RoundTrip)
+{
+    FrameCapture frameCapture;
+
+    const void *indices = reinterpret_cast<const void *>(static_cast<uintptr_t>(64));
+
+    frameCapture.captureCall(gl::EntryPoint::ClearColor, 0.25f, 0.5f, 0.75f, 1.0f);
+    frameCapture.captureCall(gl::EntryPoint::BindBuffer, gl::BufferBinding::ElementArray, 3u);
+    frameCapture.captureCall(gl::EntryPoint::DrawElements, static_cast<GLenum>(GL_TRIANGLES),
+                             static_cast<GLsizei>(-6), static_cast<GLenum>(GL_UNSIGNED_SHORT),
+                             indices);
+    frameCapture.captureCall(gl::EntryPoint::Flush);
+    EXPECT_EQ(4u, frameCapture.getFrameCallCount());
+
+    // The call count is only written to the header at the end of the frame.
+    std::vector<CapturedCall> calls;
+    uint32_t frameIndex = 0;
+    EXPECT_FALSE(ParseFrameCapture(frameCapture.getFrameData(), &frameIndex, &calls));
+
+    std::vector<uint8_t> frameData = frameCapture.getFrameData();
+    uint32_t callCount             = frameCapture.getFrameCallCount();
+    memcpy(frameData.data() + sizeof(kFrameCaptureMagic) + 2 * sizeof(uint32_t), &callCount,
+           sizeof(uint32_t));
+
+    ASSERT_TRUE(ParseFrameCapture(frameData, &frameIndex, &calls));
+    EXPECT_EQ(0u, frameIndex);
+    ASSERT_EQ(4u, calls.size());
+
+    EXPECT_EQ(gl::EntryPoint::ClearColor, calls[0].entryPoint);
+    ASSERT_EQ(4u, calls[0].params.size());
+    EXPECT_EQ(CapturedParamType::Float, calls[0].params[1].type);
+    double green = 0.0;
+    memcpy(&green, &calls[0].params[1].value, sizeof(double));
+    EXPECT_EQ(0.5, green);
+
+    EXPECT_EQ(gl::EntryPoint::BindBuffer, calls[1].entryPoint);
+    ASSERT_EQ(2u, calls[1].params.size());
+    EXPECT_EQ(CapturedParamType::Enum, calls[1].params[0].type);
+    EXPECT_EQ(static_cast<uint64_t>(gl::BufferBinding::ElementArray), calls[1].params[0].value);
+    EXPECT_EQ(CapturedParamType::UInt, calls[1].params[1].type);
+    EXPECT_EQ(3u, calls[1].params[1].value);
+
+    EXPECT_EQ(gl::EntryPoint::DrawElements, calls[2].entryPoint);
+    ASSERT_EQ(4u, calls[2].params.size());
+    EXPECT_EQ(CapturedParamType::Int, calls[2].params[1].type);
+    EXPECT_EQ(-6, static_cast<int64_t>(calls[2].params[1].value));
+    EXPECT_EQ(CapturedParamType::Pointer, calls[2].params[3].type);
+    EXPECT_EQ(64u, calls[2].params[3].value);
+
+    EXPECT_EQ(gl::EntryPoint::Flush, calls[3].entryPoint);
+    EXPECT_TRUE(calls[3].params.empty());
+}
+
+// Test that a new frame starts empty with the next frame index.
+TEST(FrameCaptureTest, EndFrame)
+{
+    FrameCapture frameCapture;
+    frameCapture.captureCall(gl::EntryPoint::Flush);
+    frameCapture.onEndFrame();
+
+    EXPECT_EQ(0u, frameCapture.getFrameCallCount());
+
+    std::vector<CapturedCall> calls;
+    uint32_t frameIndex = 0;
+    ASSERT_TRUE(ParseFrameCapture(frameCapture.getFrameData(), &frameIndex, &calls));
+    EXPECT_EQ(1u, frameIndex);
+    EXPECT_TRUE(calls.empty());
+}
+
+// Test that truncated traces are rejected.
+TEST(FrameCaptureTest, Truncated)
+{
+    FrameCapture frameCapture;
+    frameCapture.captureCall(gl::EntryPoint::ActiveTexture, static_cast<GLenum>(GL_TEXTURE0));
+    frameCapture.onEndFrame();
+
+    std::vector<uint8_t> frameData = frameCapture.getFrameData();
+    uint32_t callCount             = 1;
+    memcpy(frameData.data() + sizeof(kFrameCaptureMagic) + 2 * sizeof(uint32_t), &callCount,
+           sizeof(uint32_t));
+
+    std::vector<CapturedCall> calls;
+    uint32_t frameIndex = 0;
+    EXPECT_FALSE(ParseFrameCapture(frameData, &frameIndex, &calls));
+}
+
+}  // namespace angle
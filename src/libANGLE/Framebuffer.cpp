@@ -213,6 +213,18 @@ Error InitAttachment(const Context *context, FramebufferAttachment *attachment)
     return NoError();
 }
 
+bool ScissorCoversAttachment(const Rectangle &scissor, const FramebufferAttachment &attachment)
+{
+    if (!attachment.isAttached())
+    {
+        return true;
+    }
+
+    const Extents &size = attachment.getSize();
+    return scissor.x <= 0 && scissor.y <= 0 && scissor.x + scissor.width >= size.width &&
+           scissor.y + scissor.height >= size.height;
+}
+
 bool IsColorMaskedOut(const BlendState &blend)
 {
     return (!blend.colorMaskRed && !blend.colorMaskGreen && !blend.colorMaskBlue &&
@@ -1241,11 +1253,23 @@ bool Framebuffer::partialClearNeedsInit(const Context *context,
         return false;
     }
 
-    // Scissors can affect clearing.
-    // TODO(jmadill): Check for complete scissor overlap.
+    // Scissors can affect clearing. A scissor covering every attachment clears them completely,
+    // which also initializes them.
     if (glState.isScissorTestEnabled())
     {
-        return true;
+        const Rectangle &scissor = glState.getScissor();
+        for (const FramebufferAttachment &colorAttachment : mState.mColorAttachments)
+        {
+            if (!ScissorCoversAttachment(scissor, colorAttachment))
+            {
+                return true;
+            }
+        }
+        if (!ScissorCoversAttachment(scissor, mState.mDepthAttachment) ||
+            !ScissorCoversAttachment(scissor, mState.mStencilAttachment))
+        {
+            return true;
+        }
     }
 
     // If colors masked, we must clear before we clear. Do a simple check.
@@ -208,7 +208,7 @@ class FramebufferAttachmentObject
                                     const ImageIndex &imageIndex,
                                     rx::FramebufferAttachmentRenderTarget **rtOut) const;
 
-    Error initializeContents(const Context *context, const ImageIndex &imageIndex);
+    virtual Error initializeContents(const Context *context, const ImageIndex &imageIndex);
 
     void onStorageChange(const gl::Context *context) const;
     angle::Subject *getSubject() const;
@@ -28,7 +28,12 @@ namespace
 namespace gl
 {
 
-GLES1Renderer::GLES1Renderer() : mRendererProgramInitialized(false)
+GLES1Renderer::GLES1Renderer()
+    : mRendererProgramInitialized(false),
+      mShaderPrograms(nullptr),
+      mVertexShader(0),
+      mMatricesSerial(0),
+      mCurrentProgramState(nullptr)
 {
 }
 
@@ -38,7 +43,14 @@ void GLES1Renderer::onDestroy(Context *context, State *state)
     {
         state->setProgram(context, 0);
 
-        mShaderPrograms->deleteProgram(context, mProgramState.program);
+        for (const auto &variant : mProgramVariants)
+        {
+            mShaderPrograms->deleteProgram(context, variant.second.program);
+        }
+        mProgramVariants.clear();
+        mCurrentProgramState = nullptr;
+
+        mShaderPrograms->deleteShader(context, mVertexShader);
         mShaderPrograms->release(context);
         mShaderPrograms             = nullptr;
         mRendererProgramInitialized = false;
@@ -49,133 +61,140 @@ GLES1Renderer::~GLES1Renderer() = default;
 
 Error GLES1Renderer::prepareForDraw(Context *context, State *glState)
 {
-    ANGLE_TRY(initializeRendererProgram(context, glState));
-
-    const GLES1State &gles1State = glState->gles1();
-
-    Program *programObject = getProgram(mProgramState.program);
-
-    GLES1UniformBuffers &uniformBuffers = mUniformBuffers;
-
-    if (!gles1State.isClientStateEnabled(ClientVertexArrayType::Normal))
-    {
-        const angle::Vector3 normal = gles1State.getCurrentNormal();
-        context->vertexAttrib3f(kNormalAttribIndex, normal.x(), normal.y(), normal.z());
-    }
-
-    if (!gles1State.isClientStateEnabled(ClientVertexArrayType::Color))
-    {
-        const ColorF color = gles1State.getCurrentColor();
-        context->vertexAttrib4f(kColorAttribIndex, color.red, color.green, color.blue, color.alpha);
-    }
+    ANGLE_TRY(initializeRenderer(context));
 
-    if (!gles1State.isClientStateEnabled(ClientVertexArrayType::PointSize))
-    {
-        GLfloat pointSize = gles1State.mPointParameters.pointSize;
-        context->vertexAttrib1f(kPointSizeAttribIndex, pointSize);
-    }
+    GLES1State &gles1State                 = glState->gles1();
+    const GLES1State::DirtyBits &dirtyBits = gles1State.getDirtyBits();
 
-    for (int i = 0; i < kTexUnitCount; i++)
+    // Only the renderer writes the current values of the attributes, so they keep the values
+    // set for the previous draw.
+    if (dirtyBits.test(GLES1State::DIRTY_GLES1_CURRENT_VECTOR) ||
+        dirtyBits.test(GLES1State::DIRTY_GLES1_CLIENT_STATE_ENABLE))
     {
-        if (!gles1State.mTexCoordArrayEnabled[i])
+        if (!gles1State.isClientStateEnabled(ClientVertexArrayType::Normal))
         {
-            const TextureCoordF texcoord = gles1State.getCurrentTextureCoords(i);
-            context->vertexAttrib4f(kTextureCoordAttribIndexBase + i, texcoord.s, texcoord.t,
-                                    texcoord.r, texcoord.q);
+            const angle::Vector3 normal = gles1State.getCurrentNormal();
+            context->vertexAttrib3f(kNormalAttribIndex, normal.x(), normal.y(), normal.z());
         }
-    }
 
-    {
-        angle::Mat4 proj = gles1State.mProjectionMatrices.back();
-        if (mProgramState.projMatrixLoc != -1)
+        if (!gles1State.isClientStateEnabled(ClientVertexArrayType::Color))
         {
-            programObject->setUniformMatrix4fv(mProgramState.projMatrixLoc, 1, GL_FALSE,
-                                               proj.data());
+            const ColorF color = gles1State.getCurrentColor();
+            context->vertexAttrib4f(kColorAttribIndex, color.red, color.green, color.blue,
+                                    color.alpha);
         }
 
-        angle::Mat4 modelview = gles1State.mModelviewMatrices.back();
-        if (mProgramState.modelviewMatrixLoc != -1)
+        if (!gles1State.isClientStateEnabled(ClientVertexArrayType::PointSize))
         {
-            programObject->setUniformMatrix4fv(mProgramState.modelviewMatrixLoc, 1, GL_FALSE,
-                                               modelview.data());
+            GLfloat pointSize = gles1State.mPointParameters.pointSize;
+            context->vertexAttrib1f(kPointSizeAttribIndex, pointSize);
         }
 
-        angle::Mat4 modelviewInvTr = modelview.transpose().inverse();
-        if (mProgramState.modelviewInvTrLoc != -1)
-        {
-            programObject->setUniformMatrix4fv(mProgramState.modelviewInvTrLoc, 1, GL_FALSE,
-                                               modelviewInvTr.data());
-        }
-
-        Mat4Uniform *textureMatrixBuffer = uniformBuffers.textureMatrices.data();
-
         for (int i = 0; i < kTexUnitCount; i++)
         {
-            angle::Mat4 textureMatrix = gles1State.mTextureMatrices[i].back();
-            memcpy(textureMatrixBuffer + i, textureMatrix.data(), sizeof(Mat4Uniform));
+            if (!gles1State.mTexCoordArrayEnabled[i])
+            {
+                const TextureCoordF texcoord = gles1State.getCurrentTextureCoords(i);
+                context->vertexAttrib4f(kTextureCoordAttribIndexBase + i, texcoord.s, texcoord.t,
+                                        texcoord.r, texcoord.q);
+            }
         }
+    }
 
-        if (mProgramState.textureMatrixLoc != -1)
-        {
-            programObject->setUniformMatrix4fv(mProgramState.textureMatrixLoc, 4, GL_FALSE,
-                                               (float *)uniformBuffers.textureMatrices.data());
-        }
+    if (mCurrentProgramState == nullptr ||
+        dirtyBits.test(GLES1State::DIRTY_GLES1_TEXTURE_UNIT_ENABLE) ||
+        dirtyBits.test(GLES1State::DIRTY_GLES1_SHADE_MODEL))
+    {
+        ANGLE_TRY(getProgramVariant(context, glState, GetProgramVariantKey(gles1State),
+                                    &mCurrentProgramState));
     }
 
+    Program *programObject = getProgram(mCurrentProgramState->program);
+    glState->setProgram(context, programObject);
+
+    if (dirtyBits.test(GLES1State::DIRTY_GLES1_MATRICES))
     {
-        std::array<GLint, kTexUnitCount> &tex2DEnables   = uniformBuffers.tex2DEnables;
-        std::array<GLint, kTexUnitCount> &texCubeEnables = uniformBuffers.texCubeEnables;
+        std::array<Mat4Uniform, kMatrixCount> &matrices = mUniformBuffers.matrices;
 
-        for (int i = 0; i < kTexUnitCount; i++)
-        {
-            // GL_OES_cube_map allows only one of TEXTURE_2D / TEXTURE_CUBE_MAP
-            // to be enabled per unit, thankfully. From the extension text:
-            //
-            //  --  Section 3.8.10 "Texture Application"
-            //
-            //      Replace the beginning sentences of the first paragraph (page 138)
-            //      with:
-            //
-            //      "Texturing is enabled or disabled using the generic Enable
-            //      and Disable commands, respectively, with the symbolic constants
-            //      TEXTURE_2D or TEXTURE_CUBE_MAP_OES to enable the two-dimensional or cube
-            //      map texturing respectively.  If the cube map texture and the two-
-            //      dimensional texture are enabled, then cube map texturing is used.  If
-            //      texturing is disabled, a rasterized fragment is passed on unaltered to the
-            //      next stage of the GL (although its texture coordinates may be discarded).
-            //      Otherwise, a texture value is found according to the parameter values of
-            //      the currently bound texture image of the appropriate dimensionality.
-
-            texCubeEnables[i] = gles1State.isTextureTargetEnabled(i, TextureType::CubeMap);
-            tex2DEnables[i] =
-                !texCubeEnables[i] && (gles1State.isTextureTargetEnabled(i, TextureType::_2D));
-        }
+        angle::Mat4 proj           = gles1State.mProjectionMatrices.back();
+        angle::Mat4 modelview      = gles1State.mModelviewMatrices.back();
+        angle::Mat4 modelviewInvTr = modelview.transpose().inverse();
 
-        if (mProgramState.enableTexture2DLoc != -1)
-        {
-            programObject->setUniform1iv(mProgramState.enableTexture2DLoc, kTexUnitCount,
-                                         tex2DEnables.data());
-        }
-        if (mProgramState.enableTextureCubeMapLoc != -1)
+        memcpy(matrices[kProjectionMatrixIndex], proj.data(), sizeof(Mat4Uniform));
+        memcpy(matrices[kModelviewMatrixIndex], modelview.data(), sizeof(Mat4Uniform));
+        memcpy(matrices[kModelviewInvTrMatrixIndex], modelviewInvTr.data(), sizeof(Mat4Uniform));
+
+        for (int i = 0; i < kTexUnitCount; i++)
         {
-            programObject->setUniform1iv(mProgramState.enableTextureCubeMapLoc, kTexUnitCount,
-                                         texCubeEnables.data());
+            angle::Mat4 textureMatrix = gles1State.mTextureMatrices[i].back();
+            memcpy(matrices[kTextureMatrixIndexBase + i], textureMatrix.data(),
+                   sizeof(Mat4Uniform));
         }
 
-        GLint flatShading = gles1State.mShadeModel == ShadingModel::Flat;
+        mMatricesSerial++;
+    }
 
-        if (mProgramState.shadeModelFlatLoc != -1)
+    // Each variant has its own copy of the uniforms, so a variant that was switched to may be
+    // behind even if the matrices didn't change.
+    if (mCurrentProgramState->matricesSerial != mMatricesSerial)
+    {
+        if (mCurrentProgramState->matricesLoc != -1)
         {
-            programObject->setUniform1iv(mProgramState.shadeModelFlatLoc, 1, &flatShading);
+            programObject->setUniformMatrix4fv(mCurrentProgramState->matricesLoc, kMatrixCount,
+                                               GL_FALSE, &mUniformBuffers.matrices[0][0]);
         }
+        mCurrentProgramState->matricesSerial = mMatricesSerial;
     }
 
+    gles1State.clearDirty();
+
     // None of those are changes in sampler, so there is no need to set the GL_PROGRAM dirty.
     // Otherwise, put the dirtying here.
 
     return NoError();
 }
 
+// static
+GLES1Renderer::ProgramVariantKey GLES1Renderer::GetProgramVariantKey(const GLES1State &gles1State)
+{
+    ProgramVariantKey key = 0;
+
+    for (int i = 0; i < kTexUnitCount; i++)
+    {
+        // GL_OES_cube_map allows only one of TEXTURE_2D / TEXTURE_CUBE_MAP
+        // to be enabled per unit, thankfully. From the extension text:
+        //
+        //  --  Section 3.8.10 "Texture Application"
+        //
+        //      Replace the beginning sentences of the first paragraph (page 138)
+        //      with:
+        //
+        //      "Texturing is enabled or disabled using the generic Enable
+        //      and Disable commands, respectively, with the symbolic constants
+        //      TEXTURE_2D or TEXTURE_CUBE_MAP_OES to enable the two-dimensional or cube
+        //      map texturing respectively.  If the cube map texture and the two-
+        //      dimensional texture are enabled, then cube map texturing is used.  If
+        //      texturing is disabled, a rasterized fragment is passed on unaltered to the
+        //      next stage of the GL (although its texture coordinates may be discarded).
+        //      Otherwise, a texture value is found according to the parameter values of
+        //      the currently bound texture image of the appropriate dimensionality.
+
+        bool texCubeEnabled = gles1State.isTextureTargetEnabled(i, TextureType::CubeMap);
+        bool tex2DEnabled =
+            !texCubeEnabled && gles1State.isTextureTargetEnabled(i, TextureType::_2D);
+
+        key |= (tex2DEnabled ? 1u : 0u) << (2 * i);
+        key |= (texCubeEnabled ? 1u : 0u) << (2 * i + 1);
+    }
+
+    if (gles1State.mShadeModel == ShadingModel::Flat)
+    {
+        key |= 1u << (2 * kTexUnitCount);
+    }
+
+    return key;
+}
+
 int GLES1Renderer::vertexArrayIndex(ClientVertexArrayType type, const State *glState) const
 {
     switch (type)
@@ -314,7 +333,7 @@ Error GLES1Renderer::linkProgram(Context *context,
     return NoError();
 }
 
-Error GLES1Renderer::initializeRendererProgram(Context *context, State *glState)
+Error GLES1Renderer::initializeRenderer(Context *context)
 {
     if (mRendererProgramInitialized)
     {
@@ -323,14 +342,46 @@ Error GLES1Renderer::initializeRendererProgram(Context *context, State *glState)
 
     mShaderPrograms = new ShaderProgramManager();
 
-    GLuint vertexShader;
-    GLuint fragmentShader;
+    ANGLE_TRY(compileShader(context, ShaderType::Vertex, kGLES1DrawVShader, &mVertexShader));
 
-    ANGLE_TRY(compileShader(context, ShaderType::Vertex, kGLES1DrawVShader, &vertexShader));
+    mRendererProgramInitialized = true;
+    return NoError();
+}
+
+Error GLES1Renderer::getProgramVariant(Context *context,
+                                       State *glState,
+                                       ProgramVariantKey key,
+                                       GLES1ProgramState **programStateOut)
+{
+    auto iter = mProgramVariants.find(key);
+    if (iter != mProgramVariants.end())
+    {
+        *programStateOut = &iter->second;
+        return NoError();
+    }
+
+    GLuint fragmentShader;
 
     std::stringstream fragmentStream;
     fragmentStream << kGLES1DrawFShaderHeader;
     fragmentStream << kGLES1DrawFShaderUniformDefs;
+
+    // The variant's state is constant, so the shader's branches on it can be folded away.
+    std::stringstream tex2DEnables;
+    std::stringstream texCubeEnables;
+    for (int i = 0; i < kTexUnitCount; i++)
+    {
+        const char *separator = (i > 0) ? ", " : "";
+        tex2DEnables << separator << ((key >> (2 * i)) & 1u ? "true" : "false");
+        texCubeEnables << separator << ((key >> (2 * i + 1)) & 1u ? "true" : "false");
+    }
+    fragmentStream << "\nconst bool enable_texture_2d[kMaxTexUnits] = bool[kMaxTexUnits]("
+                   << tex2DEnables.str() << ");\n";
+    fragmentStream << "const bool enable_texture_cube_map[kMaxTexUnits] = bool[kMaxTexUnits]("
+                   << texCubeEnables.str() << ");\n";
+    fragmentStream << "const bool shade_model_flat = "
+                   << ((key >> (2 * kTexUnitCount)) & 1u ? "true" : "false") << ";\n";
+
     fragmentStream << kGLES1DrawFShaderFunctions;
     fragmentStream << kGLES1DrawFShaderMain;
 
@@ -351,18 +402,16 @@ Error GLES1Renderer::initializeRendererProgram(Context *context, State *glState)
         attribLocs[kTextureCoordAttribIndexBase + i] = ss.str();
     }
 
-    ANGLE_TRY(linkProgram(context, glState, vertexShader, fragmentShader, attribLocs,
-                          &mProgramState.program));
+    GLES1ProgramState programState;
+    ANGLE_TRY(linkProgram(context, glState, mVertexShader, fragmentShader, attribLocs,
+                          &programState.program));
 
-    mShaderPrograms->deleteShader(context, vertexShader);
     mShaderPrograms->deleteShader(context, fragmentShader);
 
-    Program *programObject = getProgram(mProgramState.program);
+    Program *programObject = getProgram(programState.program);
 
-    mProgramState.projMatrixLoc      = programObject->getUniformLocation("projection");
-    mProgramState.modelviewMatrixLoc = programObject->getUniformLocation("modelview");
-    mProgramState.textureMatrixLoc   = programObject->getUniformLocation("texture_matrix");
-    mProgramState.modelviewInvTrLoc  = programObject->getUniformLocation("modelview_invtr");
+    programState.matricesLoc    = programObject->getUniformLocation("matrices");
+    programState.matricesSerial = mMatricesSerial - 1;
 
     for (int i = 0; i < kTexUnitCount; i++)
     {
@@ -372,38 +421,25 @@ Error GLES1Renderer::initializeRendererProgram(Context *context, State *glState)
         ss2d << "tex_sampler" << i;
         sscube << "tex_cube_sampler" << i;
 
-        mProgramState.tex2DSamplerLocs[i] = programObject->getUniformLocation(ss2d.str().c_str());
-        mProgramState.texCubeSamplerLocs[i] =
-            programObject->getUniformLocation(sscube.str().c_str());
-    }
-
-    mProgramState.shadeModelFlatLoc = programObject->getUniformLocation("shade_model_flat");
-
-    mProgramState.enableTexture2DLoc = programObject->getUniformLocation("enable_texture_2d");
-    mProgramState.enableTextureCubeMapLoc =
-        programObject->getUniformLocation("enable_texture_cube_map");
-
-    glState->setProgram(context, programObject);
+        GLint tex2DSamplerLoc   = programObject->getUniformLocation(ss2d.str().c_str());
+        GLint texCubeSamplerLoc = programObject->getUniformLocation(sscube.str().c_str());
 
-    for (int i = 0; i < kTexUnitCount; i++)
-    {
-
-        if (mProgramState.tex2DSamplerLocs[i] != -1)
+        if (tex2DSamplerLoc != -1)
         {
             GLint val = i;
-            programObject->setUniform1iv(mProgramState.tex2DSamplerLocs[i], 1, &val);
+            programObject->setUniform1iv(tex2DSamplerLoc, 1, &val);
         }
 
-        if (mProgramState.texCubeSamplerLocs[i] != -1)
+        if (texCubeSamplerLoc != -1)
         {
             GLint val = i + kTexUnitCount;
-            programObject->setUniform1iv(mProgramState.texCubeSamplerLocs[i], 1, &val);
+            programObject->setUniform1iv(texCubeSamplerLoc, 1, &val);
         }
     }
 
     glState->setObjectDirty(GL_PROGRAM);
 
-    mRendererProgramInitialized = true;
+    *programStateOut = &(mProgramVariants[key] = programState);
     return NoError();
 }
 
@@ -22,6 +22,7 @@ namespace gl
 {
 
 class Context;
+class GLES1State;
 class Program;
 class State;
 class Shader;
@@ -44,6 +45,14 @@ class GLES1Renderer final : angle::NonCopyable
   private:
     using Mat4Uniform = float[16];
 
+    // The fixed-function state that is compiled into the program variants instead of being
+    // branched on at runtime. Two bits per texture unit for the enabled target, then the shade
+    // model.
+    using ProgramVariantKey = uint32_t;
+    static ProgramVariantKey GetProgramVariantKey(const GLES1State &gles1State);
+
+    struct GLES1ProgramState;
+
     Shader *getShader(GLuint handle) const;
     Program *getProgram(GLuint handle) const;
 
@@ -57,7 +66,11 @@ class GLES1Renderer final : angle::NonCopyable
                       GLuint fshader,
                       const std::unordered_map<GLint, std::string> &attribLocs,
                       GLuint *programOut);
-    Error initializeRendererProgram(Context *context, State *glState);
+    Error initializeRenderer(Context *context);
+    Error getProgramVariant(Context *context,
+                            State *glState,
+                            ProgramVariantKey key,
+                            GLES1ProgramState **programStateOut);
 
     static constexpr int kTexUnitCount = 4;
 
@@ -67,36 +80,39 @@ class GLES1Renderer final : angle::NonCopyable
     static constexpr int kPointSizeAttribIndex        = 3;
     static constexpr int kTextureCoordAttribIndexBase = 4;
 
+    // The layout of the "matrices" uniform of the vertex shader.
+    static constexpr int kProjectionMatrixIndex     = 0;
+    static constexpr int kModelviewMatrixIndex      = 1;
+    static constexpr int kModelviewInvTrMatrixIndex = 2;
+    static constexpr int kTextureMatrixIndexBase    = 3;
+    static constexpr int kMatrixCount               = kTextureMatrixIndexBase + kTexUnitCount;
+
     bool mRendererProgramInitialized;
     ShaderProgramManager *mShaderPrograms;
 
+    // Shared by all the program variants.
+    GLuint mVertexShader;
+
     struct GLES1ProgramState
     {
         GLuint program;
 
-        GLint projMatrixLoc;
-        GLint modelviewMatrixLoc;
-        GLint textureMatrixLoc;
-        GLint modelviewInvTrLoc;
+        GLint matricesLoc;
 
-        std::array<GLint, kTexUnitCount> tex2DSamplerLocs;
-        std::array<GLint, kTexUnitCount> texCubeSamplerLocs;
-
-        GLint shadeModelFlatLoc;
-
-        GLint enableTexture2DLoc;
-        GLint enableTextureCubeMapLoc;
+        // The value of mMatricesSerial when the matrices were last uploaded to this program.
+        unsigned int matricesSerial;
     };
 
     struct GLES1UniformBuffers
     {
-        std::array<Mat4Uniform, kTexUnitCount> textureMatrices;
-        std::array<GLint, kTexUnitCount> tex2DEnables;
-        std::array<GLint, kTexUnitCount> texCubeEnables;
+        std::array<Mat4Uniform, kMatrixCount> matrices;
     };
 
     GLES1UniformBuffers mUniformBuffers;
-    GLES1ProgramState mProgramState;
+    unsigned int mMatricesSerial;
+
+    std::unordered_map<ProgramVariantKey, GLES1ProgramState> mProgramVariants;
+    GLES1ProgramState *mCurrentProgramState;
 };
 
 }  // namespace gl
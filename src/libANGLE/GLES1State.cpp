@@ -63,6 +63,7 @@ GLES1State::~GLES1State() = default;
 void GLES1State::initialize(const Context *context, const State *state)
 {
     mGLState = state;
+    setAllDirty();
 
     const Caps &caps = context->getCaps();
 
@@ -174,6 +175,7 @@ unsigned int GLES1State::getClientTextureUnit() const
 
 void GLES1State::setCurrentColor(const ColorF &color)
 {
+    setDirty(DIRTY_GLES1_CURRENT_VECTOR);
     mCurrentColor = color;
 }
 
@@ -184,6 +186,7 @@ const ColorF &GLES1State::getCurrentColor() const
 
 void GLES1State::setCurrentNormal(const angle::Vector3 &normal)
 {
+    setDirty(DIRTY_GLES1_CURRENT_VECTOR);
     mCurrentNormal = normal;
 }
 
@@ -194,6 +197,7 @@ const angle::Vector3 &GLES1State::getCurrentNormal() const
 
 void GLES1State::setCurrentTextureCoords(unsigned int unit, const TextureCoordF &coords)
 {
+    setDirty(DIRTY_GLES1_CURRENT_VECTOR);
     mCurrentTextureCoords[unit] = coords;
 }
 
@@ -220,6 +224,7 @@ void GLES1State::pushMatrix()
 
 void GLES1State::popMatrix()
 {
+    setDirty(DIRTY_GLES1_MATRICES);
     auto &stack = currentMatrixStack();
     stack.pop_back();
 }
@@ -258,17 +263,20 @@ const GLES1State::MatrixStack &GLES1State::currentMatrixStack() const
 
 void GLES1State::loadMatrix(const angle::Mat4 &m)
 {
+    setDirty(DIRTY_GLES1_MATRICES);
     currentMatrixStack().back() = m;
 }
 
 void GLES1State::multMatrix(const angle::Mat4 &m)
 {
+    setDirty(DIRTY_GLES1_MATRICES);
     angle::Mat4 currentMatrix   = currentMatrixStack().back();
     currentMatrixStack().back() = currentMatrix.product(m);
 }
 
 void GLES1State::setClientStateEnabled(ClientVertexArrayType clientState, bool enable)
 {
+    setDirty(DIRTY_GLES1_CLIENT_STATE_ENABLE);
     switch (clientState)
     {
         case ClientVertexArrayType::Vertex:
@@ -14,6 +14,7 @@
 
 #include "common/FixedVector.h"
 #include "common/angleutils.h"
+#include "common/bitset_utils.h"
 #include "common/matrix_utils.h"
 #include "common/vector_utils.h"
 #include "libANGLE/Caps.h"
@@ -157,6 +158,24 @@ class GLES1State final : angle::NonCopyable
     bool isTexCoordArrayEnabled(unsigned int unit) const;
     bool isTextureTargetEnabled(unsigned int unit, const TextureType type) const;
 
+    // Lets GLES1Renderer skip the emulation work for state that didn't change since the
+    // previous draw.
+    enum DirtyGles1Type
+    {
+        DIRTY_GLES1_TEXTURE_UNIT_ENABLE = 0,
+        DIRTY_GLES1_CLIENT_STATE_ENABLE,
+        DIRTY_GLES1_CURRENT_VECTOR,
+        DIRTY_GLES1_MATRICES,
+        DIRTY_GLES1_SHADE_MODEL,
+        DIRTY_GLES1_MAX,
+    };
+    using DirtyBits = angle::BitSet<DIRTY_GLES1_MAX>;
+
+    void setDirty(DirtyGles1Type type) { mDirtyBits.set(type); }
+    void setAllDirty() { mDirtyBits.set(); }
+    const DirtyBits &getDirtyBits() const { return mDirtyBits; }
+    void clearDirty() { mDirtyBits.reset(); }
+
   private:
     friend class State;
     friend class GLES1Renderer;
@@ -164,6 +183,8 @@ class GLES1State final : angle::NonCopyable
     // Back pointer for reading from State.
     const State *mGLState;
 
+    DirtyBits mDirtyBits;
+
     // All initial state values come from the
     // OpenGL ES 1.1 spec.
     std::vector<angle::PackedEnumBitSet<TextureType>> mTexUnitEnables;
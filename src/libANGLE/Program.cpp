@@ -1312,6 +1312,9 @@ void Program::unlink()
     mState.mGeometryShaderInvocations         = 1;
     mState.mGeometryShaderMaxVertices         = 0;
 
+    // The back-end values are reset by the link, so the values last set can't be trusted anymore.
+    mUniformShadows.clear();
+
     mValidated = false;
 
     mLinked = false;
@@ -1774,28 +1777,40 @@ void Program::setUniform1fv(GLint location, GLsizei count, const GLfloat *v)
 {
     const VariableLocation &locationInfo = mState.mUniformLocations[location];
     GLsizei clampedCount                 = clampUniformCount(locationInfo, count, 1, v);
-    mProgram->setUniform1fv(location, clampedCount, v);
+    if (filterUniformUpload(&location, &clampedCount, 1, UniformShadowType::Float, &v))
+    {
+        mProgram->setUniform1fv(location, clampedCount, v);
+    }
 }
 
 void Program::setUniform2fv(GLint location, GLsizei count, const GLfloat *v)
 {
     const VariableLocation &locationInfo = mState.mUniformLocations[location];
     GLsizei clampedCount                 = clampUniformCount(locationInfo, count, 2, v);
-    mProgram->setUniform2fv(location, clampedCount, v);
+    if (filterUniformUpload(&location, &clampedCount, 2, UniformShadowType::Float, &v))
+    {
+        mProgram->setUniform2fv(location, clampedCount, v);
+    }
 }
 
 void Program::setUniform3fv(GLint location, GLsizei count, const GLfloat *v)
 {
     const VariableLocation &locationInfo = mState.mUniformLocations[location];
     GLsizei clampedCount                 = clampUniformCount(locationInfo, count, 3, v);
-    mProgram->setUniform3fv(location, clampedCount, v);
+    if (filterUniformUpload(&location, &clampedCount, 3, UniformShadowType::Float, &v))
+    {
+        mProgram->setUniform3fv(location, clampedCount, v);
+    }
 }
 
 void Program::setUniform4fv(GLint location, GLsizei count, const GLfloat *v)
 {
     const VariableLocation &locationInfo = mState.mUniformLocations[location];
     GLsizei clampedCount                 = clampUniformCount(locationInfo, count, 4, v);
-    mProgram->setUniform4fv(location, clampedCount, v);
+    if (filterUniformUpload(&location, &clampedCount, 4, UniformShadowType::Float, &v))
+    {
+        mProgram->setUniform4fv(location, clampedCount, v);
+    }
 }
 
 Program::SetUniformResult Program::setUniform1iv(GLint location, GLsizei count, const GLint *v)
@@ -1803,11 +1818,16 @@ Program::SetUniformResult Program::setUniform1iv(GLint location, GLsizei count,
     const VariableLocation &locationInfo = mState.mUniformLocations[location];
     GLsizei clampedCount                 = clampUniformCount(locationInfo, count, 1, v);
 
+    if (!filterUniformUpload(&location, &clampedCount, 1, UniformShadowType::Int, &v))
+    {
+        return SetUniformResult::NoSamplerChange;
+    }
+
     mProgram->setUniform1iv(location, clampedCount, v);
 
     if (mState.isSamplerUniformIndex(locationInfo.index))
     {
-        updateSamplerUniform(locationInfo, clampedCount, v);
+        updateSamplerUniform(mState.mUniformLocations[location], clampedCount, v);
         return SetUniformResult::SamplerChanged;
     }
 
@@ -1818,103 +1838,178 @@ void Program::setUniform2iv(GLint location, GLsizei count, const GLint *v)
 {
     const VariableLocation &locationInfo = mState.mUniformLocations[location];
     GLsizei clampedCount                 = clampUniformCount(locationInfo, count, 2, v);
-    mProgram->setUniform2iv(location, clampedCount, v);
+    if (filterUniformUpload(&location, &clampedCount, 2, UniformShadowType::Int, &v))
+    {
+        mProgram->setUniform2iv(location, clampedCount, v);
+    }
 }
 
 void Program::setUniform3iv(GLint location, GLsizei count, const GLint *v)
 {
     const VariableLocation &locationInfo = mState.mUniformLocations[location];
     GLsizei clampedCount                 = clampUniformCount(locationInfo, count, 3, v);
-    mProgram->setUniform3iv(location, clampedCount, v);
+    if (filterUniformUpload(&location, &clampedCount, 3, UniformShadowType::Int, &v))
+    {
+        mProgram->setUniform3iv(location, clampedCount, v);
+    }
 }
 
 void Program::setUniform4iv(GLint location, GLsizei count, const GLint *v)
 {
     const VariableLocation &locationInfo = mState.mUniformLocations[location];
     GLsizei clampedCount                 = clampUniformCount(locationInfo, count, 4, v);
-    mProgram->setUniform4iv(location, clampedCount, v);
+    if (filterUniformUpload(&location, &clampedCount, 4, UniformShadowType::Int, &v))
+    {
+        mProgram->setUniform4iv(location, clampedCount, v);
+    }
 }
 
 void Program::setUniform1uiv(GLint location, GLsizei count, const GLuint *v)
 {
     const VariableLocation &locationInfo = mState.mUniformLocations[location];
     GLsizei clampedCount                 = clampUniformCount(locationInfo, count, 1, v);
-    mProgram->setUniform1uiv(location, clampedCount, v);
+    if (filterUniformUpload(&location, &clampedCount, 1, UniformShadowType::UInt, &v))
+    {
+        mProgram->setUniform1uiv(location, clampedCount, v);
+    }
 }
 
 void Program::setUniform2uiv(GLint location, GLsizei count, const GLuint *v)
 {
     const VariableLocation &locationInfo = mState.mUniformLocations[location];
     GLsizei clampedCount                 = clampUniformCount(locationInfo, count, 2, v);
-    mProgram->setUniform2uiv(location, clampedCount, v);
+    if (filterUniformUpload(&location, &clampedCount, 2, UniformShadowType::UInt, &v))
+    {
+        mProgram->setUniform2uiv(location, clampedCount, v);
+    }
 }
 
 void Program::setUniform3uiv(GLint location, GLsizei count, const GLuint *v)
 {
     const VariableLocation &locationInfo = mState.mUniformLocations[location];
     GLsizei clampedCount                 = clampUniformCount(locationInfo, count, 3, v);
-    mProgram->setUniform3uiv(location, clampedCount, v);
+    if (filterUniformUpload(&location, &clampedCount, 3, UniformShadowType::UInt, &v))
+    {
+        mProgram->setUniform3uiv(location, clampedCount, v);
+    }
 }
 
 void Program::setUniform4uiv(GLint location, GLsizei count, const GLuint *v)
 {
     const VariableLocation &locationInfo = mState.mUniformLocations[location];
     GLsizei clampedCount                 = clampUniformCount(locationInfo, count, 4, v);
-    mProgram->setUniform4uiv(location, clampedCount, v);
+    if (filterUniformUpload(&location, &clampedCount, 4, UniformShadowType::UInt, &v))
+    {
+        mProgram->setUniform4uiv(location, clampedCount, v);
+    }
 }
 
 void Program::setUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *v)
 {
     GLsizei clampedCount = clampMatrixUniformCount<2, 2>(location, count, transpose, v);
-    mProgram->setUniformMatrix2fv(location, clampedCount, transpose, v);
+    if (filterUniformUpload(&location, &clampedCount, 4,
+                            transpose ? UniformShadowType::TransposedMatrix
+                                      : UniformShadowType::Matrix,
+                            &v))
+    {
+        mProgram->setUniformMatrix2fv(location, clampedCount, transpose, v);
+    }
 }
 
 void Program::setUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *v)
 {
     GLsizei clampedCount = clampMatrixUniformCount<3, 3>(location, count, transpose, v);
-    mProgram->setUniformMatrix3fv(location, clampedCount, transpose, v);
+    if (filterUniformUpload(&location, &clampedCount, 9,
+                            transpose ? UniformShadowType::TransposedMatrix
+                                      : UniformShadowType::Matrix,
+                            &v))
+    {
+        mProgram->setUniformMatrix3fv(location, clampedCount, transpose, v);
+    }
 }
 
 void Program::setUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *v)
 {
     GLsizei clampedCount = clampMatrixUniformCount<4, 4>(location, count, transpose, v);
-    mProgram->setUniformMatrix4fv(location, clampedCount, transpose, v);
+    if (filterUniformUpload(&location, &clampedCount, 16,
+                            transpose ? UniformShadowType::TransposedMatrix
+                                      : UniformShadowType::Matrix,
+                            &v))
+    {
+        mProgram->setUniformMatrix4fv(location, clampedCount, transpose, v);
+    }
 }
 
 void Program::setUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *v)
 {
     GLsizei clampedCount = clampMatrixUniformCount<2, 3>(location, count, transpose, v);
-    mProgram->setUniformMatrix2x3fv(location, clampedCount, transpose, v);
+    if (filterUniformUpload(&location, &clampedCount, 6,
+                            transpose ? UniformShadowType::TransposedMatrix
+                                      : UniformShadowType::Matrix,
+                            &v))
+    {
+        mProgram->setUniformMatrix2x3fv(location, clampedCount, transpose, v);
+    }
 }
 
 void Program::setUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *v)
 {
     GLsizei clampedCount = clampMatrixUniformCount<2, 4>(location, count, transpose, v);
-    mProgram->setUniformMatrix2x4fv(location, clampedCount, transpose, v);
+    if (filterUniformUpload(&location, &clampedCount, 8,
+                            transpose ? UniformShadowType::TransposedMatrix
+                                      : UniformShadowType::Matrix,
+                            &v))
+    {
+        mProgram->setUniformMatrix2x4fv(location, clampedCount, transpose, v);
+    }
 }
 
 void Program::setUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *v)
 {
     GLsizei clampedCount = clampMatrixUniformCount<3, 2>(location, count, transpose, v);
-    mProgram->setUniformMatrix3x2fv(location, clampedCount, transpose, v);
+    if (filterUniformUpload(&location, &clampedCount, 6,
+                            transpose ? UniformShadowType::TransposedMatrix
+                                      : UniformShadowType::Matrix,
+                            &v))
+    {
+        mProgram->setUniformMatrix3x2fv(location, clampedCount, transpose, v);
+    }
 }
 
 void Program::setUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *v)
 {
     GLsizei clampedCount = clampMatrixUniformCount<3, 4>(location, count, transpose, v);
-    mProgram->setUniformMatrix3x4fv(location, clampedCount, transpose, v);
+    if (filterUniformUpload(&location, &clampedCount, 12,
+                            transpose ? UniformShadowType::TransposedMatrix
+                                      : UniformShadowType::Matrix,
+                            &v))
+    {
+        mProgram->setUniformMatrix3x4fv(location, clampedCount, transpose, v);
+    }
 }
 
 void Program::setUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *v)
 {
     GLsizei clampedCount = clampMatrixUniformCount<4, 2>(location, count, transpose, v);
-    mProgram->setUniformMatrix4x2fv(location, clampedCount, transpose, v);
+    if (filterUniformUpload(&location, &clampedCount, 8,
+                            transpose ? UniformShadowType::TransposedMatrix
+                                      : UniformShadowType::Matrix,
+                            &v))
+    {
+        mProgram->setUniformMatrix4x2fv(location, clampedCount, transpose, v);
+    }
 }
 
 void Program::setUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *v)
 {
     GLsizei clampedCount = clampMatrixUniformCount<4, 3>(location, count, transpose, v);
-    mProgram->setUniformMatrix4x3fv(location, clampedCount, transpose, v);
+    if (filterUniformUpload(&location, &clampedCount, 12,
+                            transpose ? UniformShadowType::TransposedMatrix
+                                      : UniformShadowType::Matrix,
+                            &v))
+    {
+        mProgram->setUniformMatrix4x3fv(location, clampedCount, transpose, v);
+    }
 }
 
 void Program::getUniformfv(const Context *context, GLint location, GLfloat *v) const
@@ -3478,6 +3573,91 @@ GLsizei Program::clampMatrixUniformCount(GLint location,
     return std::min(count, static_cast<GLsizei>(remainingElements));
 }
 
+template <typename T>
+bool Program::filterUniformUpload(GLint *location,
+                                  GLsizei *count,
+                                  int vectorSize,
+                                  UniformShadowType type,
+                                  const T **v)
+{
+    static_assert(sizeof(T) == 4, "Uniform components are expected to be 32 bits.");
+
+    const VariableLocation &locationInfo = mState.mUniformLocations[*location];
+    if (!locationInfo.used() || locationInfo.ignored || *count <= 0)
+    {
+        return true;
+    }
+
+    const LinkedUniform &linkedUniform = mState.mUniforms[locationInfo.index];
+    size_t elementSize                 = vectorSize * sizeof(T);
+    size_t elementCount                = linkedUniform.getBasicTypeElementCount();
+    if (elementSize != linkedUniform.getElementComponents() * sizeof(T) ||
+        locationInfo.arrayIndex + static_cast<size_t>(*count) > elementCount)
+    {
+        return true;
+    }
+
+    if (mUniformShadows.size() != mState.mUniforms.size())
+    {
+        mUniformShadows.resize(mState.mUniforms.size());
+    }
+
+    UniformShadow &shadow = mUniformShadows[locationInfo.index];
+    if (shadow.elementTypes.empty())
+    {
+        shadow.elementTypes.resize(elementCount, UniformShadowType::Unknown);
+        shadow.data.resize(elementCount * elementSize);
+    }
+
+    // Find the range of elements that this update changes. The same bits set through another
+    // entry point can have a different meaning, so that counts as a change too.
+    const uint8_t *source = reinterpret_cast<const uint8_t *>(*v);
+    GLsizei firstChanged  = *count;
+    GLsizei lastChanged   = -1;
+    for (GLsizei element = 0; element < *count; ++element)
+    {
+        size_t shadowIndex         = locationInfo.arrayIndex + element;
+        uint8_t *shadowData        = shadow.data.data() + shadowIndex * elementSize;
+        const uint8_t *elementData = source + element * elementSize;
+
+        if (shadow.elementTypes[shadowIndex] != type ||
+            memcmp(shadowData, elementData, elementSize) != 0)
+        {
+            firstChanged = std::min(firstChanged, element);
+            lastChanged  = element;
+
+            shadow.elementTypes[shadowIndex] = type;
+            memcpy(shadowData, elementData, elementSize);
+        }
+    }
+
+    if (lastChanged < 0)
+    {
+        return false;
+    }
+
+    // Only send the changed elements, if their locations are contiguous with the first one.
+    if (firstChanged > 0 || lastChanged < *count - 1)
+    {
+        size_t firstChangedLocation = static_cast<size_t>(*location + firstChanged);
+        if (firstChangedLocation < mState.mUniformLocations.size())
+        {
+            const VariableLocation &firstChangedInfo =
+                mState.mUniformLocations[firstChangedLocation];
+            if (firstChangedInfo.index == locationInfo.index &&
+                firstChangedInfo.arrayIndex == locationInfo.arrayIndex + firstChanged &&
+                !firstChangedInfo.ignored)
+            {
+                *location += firstChanged;
+                *count = lastChanged - firstChanged + 1;
+                *v += firstChanged * vectorSize;
+            }
+        }
+    }
+
+    return true;
+}
+
 // Driver differences mean that doing the uniform value cast ourselves gives consistent results.
 // EG: on NVIDIA drivers, it was observed that getUniformi for MAX_INT+1 returned MIN_INT.
 template <typename DestT>
@@ -774,6 +774,34 @@ class Program final : angle::NonCopyable, public LabeledObject
                               GLsizei clampedCount,
                               const GLint *v);
 
+    // The entry point a uniform element was last set with. The same bits mean different values
+    // depending on it.
+    enum class UniformShadowType : uint8_t
+    {
+        Unknown,
+        Float,
+        Int,
+        UInt,
+        Matrix,
+        TransposedMatrix,
+    };
+
+    struct UniformShadow
+    {
+        std::vector<uint8_t> data;
+        std::vector<UniformShadowType> elementTypes;
+    };
+
+    // Compares an update of a clamped count of elements with the values last set. Returns false
+    // if it changes nothing. Otherwise records the new values, and may narrow the update to the
+    // elements that changed.
+    template <typename T>
+    bool filterUniformUpload(GLint *location,
+                             GLsizei *count,
+                             int vectorSize,
+                             UniformShadowType type,
+                             const T **v);
+
     template <typename DestT>
     void getUniformInternal(const Context *context,
                             DestT *dataOut,
@@ -818,6 +846,11 @@ class Program final : angle::NonCopyable, public LabeledObject
     // Cache for sampler validation
     Optional<bool> mCachedValidateSamplersResult;
     std::vector<TextureType> mTextureUnitTypesCache;
+
+    // The values last set to each uniform, so that updates that don't change them never reach the
+    // back-end, and array updates only send the elements that changed. Indexed by uniform. Sized
+    // when the uniforms are first set after a link.
+    std::vector<UniformShadow> mUniformShadows;
 };
 }  // namespace gl
 
@@ -52,6 +52,32 @@ const std::vector<VarT> &GetShaderVariables(const std::vector<VarT> *variableLis
 
 }  // anonymous namespace
 
+class Shader::TranslateTask final : public angle::Closure
+{
+  public:
+    TranslateTask(Shader *shader, ShHandle compilerHandle, std::mutex *compilerMutex)
+        : mShader(shader),
+          mCompilerHandle(compilerHandle),
+          mCompilerMutex(compilerMutex),
+          mResult(false)
+    {
+    }
+
+    void operator()() override
+    {
+        std::lock_guard<std::mutex> lock(*mCompilerMutex);
+        mResult = mShader->translate(mCompilerHandle);
+    }
+
+    bool getResult() const { return mResult; }
+
+  private:
+    Shader *mShader;
+    ShHandle mCompilerHandle;
+    std::mutex *mCompilerMutex;
+    bool mResult;
+};
+
 // true if varying x has a higher priority in packing than y
 bool CompareShaderVar(const sh::ShaderVariable &x, const sh::ShaderVariable &y)
 {
@@ -123,6 +149,8 @@ Shader::Shader(ShaderProgramManager *manager,
       mType(type),
       mRefCount(0),
       mDeleteStatus(false),
+      mDeferredCompileStatusChecked(false),
+      mTranslateTaskPosted(false),
       mResourceManager(manager)
 {
     ASSERT(mImplementation);
@@ -130,6 +158,7 @@ Shader::Shader(ShaderProgramManager *manager,
 
 void Shader::onDestroy(const gl::Context *context)
 {
+    waitForTranslateTask();
     mImplementation->destroy(context);
     mBoundCompiler.set(context, nullptr);
     mImplementation.reset(nullptr);
@@ -177,7 +206,7 @@ void Shader::setSource(GLsizei count, const char *const *string, const GLint *le
 
 int Shader::getInfoLogLength(const Context *context)
 {
-    resolveCompile(context);
+    resolveDeferredCompileStatus(context);
     if (mInfoLog.empty())
     {
         return 0;
@@ -188,7 +217,7 @@ int Shader::getInfoLogLength(const Context *context)
 
 void Shader::getInfoLog(const Context *context, GLsizei bufSize, GLsizei *length, char *infoLog)
 {
-    resolveCompile(context);
+    resolveDeferredCompileStatus(context);
 
     int index = 0;
 
@@ -289,8 +318,12 @@ void Shader::getTranslatedSourceWithDebugInfo(const Context *context,
 
 void Shader::compile(const Context *context)
 {
+    // A translation of the previous source may still be writing the shader state.
+    waitForTranslateTask();
+
     mState.mTranslatedSource.clear();
     mInfoLog.clear();
+    mDeferredCompileStatusChecked = false;
     mState.mShaderVersion = 100;
     mState.mInputVaryings.clear();
     mState.mOutputVaryings.clear();
@@ -334,6 +367,28 @@ void Shader::compile(const Context *context)
     {
         mLastCompileOptions |= SH_VALIDATE_LOOP_INDEXING;
     }
+
+    // Get the compiler handle now, so it isn't lazily created by two threads at once.
+    Compiler *compiler      = mBoundCompiler.get();
+    ShHandle compilerHandle = compiler->getCompilerHandle(mState.mShaderType);
+    mTranslateTask.reset(
+        new TranslateTask(this, compilerHandle, &compiler->getCompilerMutex(mState.mShaderType)));
+
+    // Otherwise the translation runs when the compile is resolved.
+    if (mImplementation->canTranslateOnWorkerThread())
+    {
+        mTranslateEvent = context->getWorkerThreadPool()->postWorkerTask(mTranslateTask.get());
+        mTranslateTaskPosted = true;
+    }
+}
+
+void Shader::waitForTranslateTask()
+{
+    if (mTranslateTaskPosted)
+    {
+        mTranslateEvent.wait();
+        mTranslateTaskPosted = false;
+    }
 }
 
 void Shader::resolveCompile(const Context *context)
@@ -343,28 +398,26 @@ void Shader::resolveCompile(const Context *context)
         return;
     }
 
-    ASSERT(mBoundCompiler.get());
-    ShHandle compilerHandle = mBoundCompiler->getCompilerHandle(mState.mShaderType);
-
-    std::vector<const char *> srcStrings;
-
-    if (!mLastCompiledSourcePath.empty())
+    ASSERT(mTranslateTask);
+    if (!mTranslateTaskPosted)
     {
-        srcStrings.push_back(mLastCompiledSourcePath.c_str());
+        (*mTranslateTask)();
     }
+    else
+    {
+        // The result is written by the worker thread, so it can only be read once it is done.
+        waitForTranslateTask();
+    }
+    bool translated = mTranslateTask->getResult();
+    mTranslateTask.reset();
 
-    srcStrings.push_back(mLastCompiledSource.c_str());
-
-    if (!sh::Compile(compilerHandle, &srcStrings[0], srcStrings.size(), mLastCompileOptions))
+    if (!translated)
     {
-        mInfoLog = sh::GetInfoLog(compilerHandle);
         WARN() << std::endl << mInfoLog;
         mState.mCompileStatus = CompileStatus::NOT_COMPILED;
         return;
     }
 
-    mState.mTranslatedSource = sh::GetObjectCode(compilerHandle);
-
 #if !defined(NDEBUG)
     // Prefix translated shader with commented out un-translated shader.
     // Useful in diagnostics tools which capture the shader source.
@@ -386,6 +439,49 @@ void Shader::resolveCompile(const Context *context)
     mState.mTranslatedSource = shaderStream.str();
 #endif  // !defined(NDEBUG)
 
+    ASSERT(!mState.mTranslatedSource.empty());
+
+    bool success = mImplementation->postTranslateCompile(context, mBoundCompiler.get(), &mInfoLog);
+    mState.mCompileStatus = success ? CompileStatus::COMPILED : CompileStatus::NOT_COMPILED;
+}
+
+void Shader::resolveDeferredCompileStatus(const Context *context)
+{
+    resolveCompile(context);
+
+    // Only queries from the application wait for the deferred work, so that links and cache hits
+    // don't have to.
+    if (mState.mCompileStatus != CompileStatus::COMPILED || mDeferredCompileStatusChecked)
+    {
+        return;
+    }
+    mDeferredCompileStatusChecked = true;
+
+    if (!mImplementation->checkDeferredCompileStatus(context, &mInfoLog))
+    {
+        mState.mCompileStatus = CompileStatus::NOT_COMPILED;
+    }
+}
+
+bool Shader::translate(ShHandle compilerHandle)
+{
+    std::vector<const char *> srcStrings;
+
+    if (!mLastCompiledSourcePath.empty())
+    {
+        srcStrings.push_back(mLastCompiledSourcePath.c_str());
+    }
+
+    srcStrings.push_back(mLastCompiledSource.c_str());
+
+    if (!sh::Compile(compilerHandle, &srcStrings[0], srcStrings.size(), mLastCompileOptions))
+    {
+        mInfoLog = sh::GetInfoLog(compilerHandle);
+        return false;
+    }
+
+    mState.mTranslatedSource = sh::GetObjectCode(compilerHandle);
+
     // Gather the shader information
     mState.mShaderVersion = sh::GetShaderVersion(compilerHandle);
 
@@ -446,10 +542,7 @@ void Shader::resolveCompile(const Context *context)
             UNREACHABLE();
     }
 
-    ASSERT(!mState.mTranslatedSource.empty());
-
-    bool success = mImplementation->postTranslateCompile(context, mBoundCompiler.get(), &mInfoLog);
-    mState.mCompileStatus = success ? CompileStatus::COMPILED : CompileStatus::NOT_COMPILED;
+    return true;
 }
 
 void Shader::addRef()
@@ -488,6 +581,12 @@ bool Shader::isCompiled(const Context *context)
     return mState.mCompileStatus == CompileStatus::COMPILED;
 }
 
+bool Shader::getCompileStatus(const Context *context)
+{
+    resolveDeferredCompileStatus(context);
+    return mState.mCompileStatus == CompileStatus::COMPILED;
+}
+
 int Shader::getShaderVersion(const Context *context)
 {
     resolveCompile(context);
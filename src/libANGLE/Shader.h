@@ -23,6 +23,7 @@
 #include "common/Optional.h"
 #include "common/angleutils.h"
 #include "libANGLE/Debug.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/angletypes.h"
 
 namespace rx
@@ -152,6 +153,9 @@ class Shader final : angle::NonCopyable, public LabeledObject
 
     void compile(const Context *context);
     bool isCompiled(const Context *context);
+    // The compile status reported to the application. Unlike isCompiled, it includes the result
+    // of work the implementation deferred past the translation, such as a native compile.
+    bool getCompileStatus(const Context *context);
 
     void addRef();
     void release(const Context *context);
@@ -188,6 +192,8 @@ class Shader final : angle::NonCopyable, public LabeledObject
     const std::string &getCompilerResourcesString() const;
 
   private:
+    class TranslateTask;
+
     ~Shader() override;
     static void GetSourceImpl(const std::string &source,
                               GLsizei bufSize,
@@ -195,6 +201,11 @@ class Shader final : angle::NonCopyable, public LabeledObject
                               char *buffer);
 
     void resolveCompile(const Context *context);
+    void resolveDeferredCompileStatus(const Context *context);
+    bool translate(ShHandle compilerHandle);
+    // Waits for a translation posted to a worker thread. The task is kept so its result can be
+    // read afterwards.
+    void waitForTranslateTask();
 
     ShaderState mState;
     std::string mLastCompiledSource;
@@ -207,10 +218,17 @@ class Shader final : angle::NonCopyable, public LabeledObject
     unsigned int mRefCount;     // Number of program objects this shader is attached to
     bool mDeleteStatus;         // Flag to indicate that the shader can be deleted when no longer in use
     std::string mInfoLog;
+    bool mDeferredCompileStatusChecked;
 
     // We keep a reference to the translator in order to defer compiles while preserving settings.
     BindingPointer<Compiler> mBoundCompiler;
 
+    // The translation starts when the shader is compiled, on a worker thread if the
+    // implementation allows it. The translated state isn't accessed until it has finished.
+    std::unique_ptr<TranslateTask> mTranslateTask;
+    angle::WaitableEvent mTranslateEvent;
+    bool mTranslateTaskPosted;
+
     ShaderProgramManager *mResourceManager;
 };
 
@@ -782,9 +782,11 @@ void State::setEnableFeature(GLenum feature, bool enabled)
             break;
         case GL_TEXTURE_2D:
             mGLES1State.mTexUnitEnables[mActiveSampler].set(TextureType::_2D, enabled);
+            mGLES1State.setDirty(GLES1State::DIRTY_GLES1_TEXTURE_UNIT_ENABLE);
             break;
         case GL_TEXTURE_CUBE_MAP:
             mGLES1State.mTexUnitEnables[mActiveSampler].set(TextureType::CubeMap, enabled);
+            mGLES1State.setDirty(GLES1State::DIRTY_GLES1_TEXTURE_UNIT_ENABLE);
             break;
 
         default:
@@ -436,6 +436,7 @@ class State : public angle::ObserverInterface, angle::NonCopyable
     const DirtyBits &getDirtyBits() const { return mDirtyBits; }
     void clearDirtyBits() { mDirtyBits.reset(); }
     void clearDirtyBits(const DirtyBits &bitset) { mDirtyBits &= ~bitset; }
+    void setDirtyBits(const DirtyBits &bitset) { mDirtyBits |= bitset; }
     void setAllDirtyBits() { mDirtyBits.set(); }
 
     using DirtyObjects = angle::BitSet<DIRTY_OBJECT_MAX>;
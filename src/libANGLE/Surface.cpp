@@ -18,6 +18,7 @@
 #include "libANGLE/Framebuffer.h"
 #include "libANGLE/Texture.h"
 #include "libANGLE/Thread.h"
+#include "libANGLE/features.h"
 #include "libANGLE/formatutils.h"
 #include "libANGLE/renderer/EGLImplFactory.h"
 
@@ -154,6 +155,10 @@ Error Surface::destroyImpl(const Display *display)
 
 void Surface::postSwap(const gl::Context *context)
 {
+#if ANGLE_CAPTURE_ENABLED
+    context->onPostSwap();
+#endif  // ANGLE_CAPTURE_ENABLED
+
     if (mRobustResourceInitialization && mSwapBehavior != EGL_BUFFER_PRESERVED)
     {
         mInitState = gl::InitState::MayNeedInit;
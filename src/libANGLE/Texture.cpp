@@ -50,6 +50,122 @@ InitState DetermineInitState(const Context *context, const uint8_t *pixels)
                : InitState::Initialized;
 }
 
+// Past this many disjoint written areas, the rest of the image is initialized right away.
+constexpr size_t kMaxWrittenAreas = 16;
+
+bool BoxContains(const Box &outer, const Box &inner)
+{
+    return inner.x >= outer.x && inner.y >= outer.y && inner.z >= outer.z &&
+           inner.x + inner.width <= outer.x + outer.width &&
+           inner.y + inner.height <= outer.y + outer.height &&
+           inner.z + inner.depth <= outer.z + outer.depth;
+}
+
+bool SpansMatchOrTouch(int startA, int sizeA, int startB, int sizeB, bool *matchOut)
+{
+    *matchOut = (startA == startB && sizeA == sizeB);
+    return startA <= startB + sizeB && startB <= startA + sizeA;
+}
+
+// Merges two boxes when their union is itself a box.
+bool TryMergeBoxes(const Box &a, const Box &b, Box *mergedOut)
+{
+    if (BoxContains(a, b))
+    {
+        *mergedOut = a;
+        return true;
+    }
+    if (BoxContains(b, a))
+    {
+        *mergedOut = b;
+        return true;
+    }
+
+    bool xMatch = false;
+    bool yMatch = false;
+    bool zMatch = false;
+    if (!SpansMatchOrTouch(a.x, a.width, b.x, b.width, &xMatch) ||
+        !SpansMatchOrTouch(a.y, a.height, b.y, b.height, &yMatch) ||
+        !SpansMatchOrTouch(a.z, a.depth, b.z, b.depth, &zMatch))
+    {
+        return false;
+    }
+
+    // The boxes must line up on two axes to be extended along the third.
+    if (static_cast<int>(xMatch) + static_cast<int>(yMatch) + static_cast<int>(zMatch) < 2)
+    {
+        return false;
+    }
+
+    int x0     = std::min(a.x, b.x);
+    int y0     = std::min(a.y, b.y);
+    int z0     = std::min(a.z, b.z);
+    int x1     = std::max(a.x + a.width, b.x + b.width);
+    int y1     = std::max(a.y + a.height, b.y + b.height);
+    int z1     = std::max(a.z + a.depth, b.z + b.depth);
+    *mergedOut = Box(x0, y0, z0, x1 - x0, y1 - y0, z1 - z0);
+    return true;
+}
+
+// Appends the parts of |from| that are outside |subtracted| as disjoint boxes.
+void SubtractBox(const Box &from, const Box &subtracted, std::vector<Box> *remainingOut)
+{
+    int x0 = std::max(from.x, subtracted.x);
+    int y0 = std::max(from.y, subtracted.y);
+    int z0 = std::max(from.z, subtracted.z);
+    int x1 = std::min(from.x + from.width, subtracted.x + subtracted.width);
+    int y1 = std::min(from.y + from.height, subtracted.y + subtracted.height);
+    int z1 = std::min(from.z + from.depth, subtracted.z + subtracted.depth);
+    if (x0 >= x1 || y0 >= y1 || z0 >= z1)
+    {
+        remainingOut->push_back(from);
+        return;
+    }
+
+    // Slabs on either side along x, then y within the overlapping x range, then z within the
+    // overlapping x and y ranges.
+    if (from.x < x0)
+    {
+        remainingOut->emplace_back(from.x, from.y, from.z, x0 - from.x, from.height, from.depth);
+    }
+    if (x1 < from.x + from.width)
+    {
+        remainingOut->emplace_back(x1, from.y, from.z, from.x + from.width - x1, from.height,
+                                   from.depth);
+    }
+    if (from.y < y0)
+    {
+        remainingOut->emplace_back(x0, from.y, from.z, x1 - x0, y0 - from.y, from.depth);
+    }
+    if (y1 < from.y + from.height)
+    {
+        remainingOut->emplace_back(x0, y1, from.z, x1 - x0, from.y + from.height - y1, from.depth);
+    }
+    if (from.z < z0)
+    {
+        remainingOut->emplace_back(x0, y0, from.z, x1 - x0, y1 - y0, z0 - from.z);
+    }
+    if (z1 < from.z + from.depth)
+    {
+        remainingOut->emplace_back(x0, y0, z1, x1 - x0, y1 - y0, from.z + from.depth - z1);
+    }
+}
+
+std::vector<Box> GetUnwrittenAreas(const ImageDesc &desc)
+{
+    std::vector<Box> unwritten = {Box(Offset(), desc.size)};
+    for (const Box &written : desc.writtenAreas)
+    {
+        std::vector<Box> remaining;
+        for (const Box &area : unwritten)
+        {
+            SubtractBox(area, written, &remaining);
+        }
+        unwritten = std::move(remaining);
+    }
+    return unwritten;
+}
+
 }  // namespace
 
 bool IsMipmapFiltered(const SamplerState &samplerState)
@@ -1069,8 +1185,19 @@ Error Texture::copySubImage(const Context *context,
     // Ensure source FBO is initialized.
     ANGLE_TRY(source->ensureReadAttachmentInitialized(context, GL_COLOR_BUFFER_BIT));
 
-    Box destBox(destOffset.x, destOffset.y, destOffset.y, sourceArea.width, sourceArea.height, 1);
-    ANGLE_TRY(ensureSubImageInitialized(context, target, level, destBox));
+    // Only the part of the source area inside the framebuffer is copied.
+    const FramebufferAttachment *readAttachment = source->getReadColorbuffer();
+    ASSERT(readAttachment);
+    Rectangle clippedSourceArea;
+    if (ClipRectangle(sourceArea, Rectangle(0, 0, readAttachment->getSize().width,
+                                            readAttachment->getSize().height),
+                      &clippedSourceArea))
+    {
+        Box destBox(destOffset.x + clippedSourceArea.x - sourceArea.x,
+                    destOffset.y + clippedSourceArea.y - sourceArea.y, destOffset.z,
+                    clippedSourceArea.width, clippedSourceArea.height, 1);
+        ANGLE_TRY(ensureSubImageInitialized(context, target, level, destBox));
+    }
 
     ImageIndex index = ImageIndex::MakeFromTarget(target, level);
 
@@ -1497,7 +1624,8 @@ Error Texture::ensureInitialized(const Context *context)
             ASSERT(mState.mInitState == InitState::MayNeedInit);
             ANGLE_TRY(initializeContents(context, index));
             desc.initState = InitState::Initialized;
-            anyDirty       = true;
+            desc.writtenAreas.clear();
+            anyDirty = true;
         }
     }
     if (anyDirty)
@@ -1523,9 +1651,67 @@ void Texture::setInitState(const ImageIndex &imageIndex, InitState initState)
 {
     ImageDesc newDesc = mState.getImageDesc(imageIndex);
     newDesc.initState = initState;
+    newDesc.writtenAreas.clear();
     mState.setImageDesc(imageIndex.getTarget(), imageIndex.getLevelIndex(), newDesc);
 }
 
+Error Texture::initializeContents(const Context *context, const ImageIndex &imageIndex)
+{
+    const ImageDesc &desc = mState.getImageDesc(imageIndex);
+    if (desc.writtenAreas.empty())
+    {
+        return FramebufferAttachmentObject::initializeContents(context, imageIndex);
+    }
+
+    // Clear around the areas the application already wrote.
+    ImageIndex levelIndex =
+        ImageIndex::MakeFromTarget(imageIndex.getTarget(), imageIndex.getLevelIndex());
+    for (const Box &area : GetUnwrittenAreas(desc))
+    {
+        ANGLE_TRY(mTexture->initializeSubImageContents(context, levelIndex, area));
+    }
+    return NoError();
+}
+
+Error Texture::addWrittenArea(const Context *context, const ImageIndex &imageIndex, const Box &area)
+{
+    ImageDesc newDesc = mState.getImageDesc(imageIndex);
+    ASSERT(newDesc.initState == InitState::MayNeedInit);
+
+    Box merged = area;
+    for (size_t areaIndex = 0; areaIndex < newDesc.writtenAreas.size();)
+    {
+        if (TryMergeBoxes(newDesc.writtenAreas[areaIndex], merged, &merged))
+        {
+            // The grown box may now merge with areas that were checked before.
+            newDesc.writtenAreas.erase(newDesc.writtenAreas.begin() + areaIndex);
+            areaIndex = 0;
+        }
+        else
+        {
+            areaIndex++;
+        }
+    }
+    newDesc.writtenAreas.push_back(merged);
+
+    if (merged == Box(Offset(), newDesc.size))
+    {
+        setInitState(imageIndex, InitState::Initialized);
+        return NoError();
+    }
+
+    mState.setImageDesc(imageIndex.getTarget(), imageIndex.getLevelIndex(), newDesc);
+
+    // Stop tracking images written in many small pieces.
+    if (newDesc.writtenAreas.size() > kMaxWrittenAreas)
+    {
+        ANGLE_TRY(initializeContents(context, imageIndex));
+        setInitState(imageIndex, InitState::Initialized);
+    }
+
+    return NoError();
+}
+
 Error Texture::ensureSubImageInitialized(const Context *context,
                                          TextureTarget target,
                                          size_t level,
@@ -1537,7 +1723,6 @@ Error Texture::ensureSubImageInitialized(const Context *context,
     }
 
     // Pre-initialize the texture contents if necessary.
-    // TODO(jmadill): Check if area overlaps the entire texture.
     ImageIndex imageIndex  = ImageIndex::MakeFromTarget(target, static_cast<GLint>(level));
     const auto &desc       = mState.getImageDesc(imageIndex);
     if (desc.initState == InitState::MayNeedInit)
@@ -1546,11 +1731,20 @@ Error Texture::ensureSubImageInitialized(const Context *context,
         bool coversWholeImage = area.x == 0 && area.y == 0 && area.z == 0 &&
                                 area.width == desc.size.width && area.height == desc.size.height &&
                                 area.depth == desc.size.depth;
-        if (!coversWholeImage)
+        if (coversWholeImage)
+        {
+            setInitState(imageIndex, InitState::Initialized);
+        }
+        else if (mTexture->supportsSubImageInitialization(imageIndex))
+        {
+            // Defer the clear to the first use, where only the parts left unwritten are cleared.
+            ANGLE_TRY(addWrittenArea(context, imageIndex, area));
+        }
+        else
         {
             ANGLE_TRY(initializeContents(context, imageIndex));
+            setInitState(imageIndex, InitState::Initialized);
         }
-        setInitState(imageIndex, InitState::Initialized);
     }
 
     return NoError();
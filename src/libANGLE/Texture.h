@@ -67,6 +67,10 @@ struct ImageDesc final
 
     // Needed for robust resource initialization.
     InitState initState;
+
+    // The parts of a MayNeedInit image that were written since it was defined. Only the rest of
+    // the image is cleared when it is initialized.
+    std::vector<Box> writtenAreas;
 };
 
 struct SwizzleState final
@@ -393,6 +397,7 @@ class Texture final : public egl::ImageSibling, public LabeledObject
     InitState initState(const ImageIndex &imageIndex) const override;
     InitState initState() const;
     void setInitState(const ImageIndex &imageIndex, InitState initState) override;
+    Error initializeContents(const Context *context, const ImageIndex &imageIndex) override;
 
     enum DirtyBitType
     {
@@ -452,6 +457,7 @@ class Texture final : public egl::ImageSibling, public LabeledObject
                                     TextureTarget target,
                                     size_t level,
                                     const gl::Box &area);
+    Error addWrittenArea(const Context *context, const ImageIndex &imageIndex, const Box &area);
 
     TextureState mState;
     DirtyBits mDirtyBits;
@@ -15,6 +15,26 @@
 
 namespace gl
 {
+namespace
+{
+constexpr GLint64 kUnlimitedElements = std::numeric_limits<GLint64>::max();
+
+GLint64 GetMinElementLimit(const std::array<GLint64, MAX_VERTEX_ATTRIBS> &limits,
+                           const AttributesMask &attribs)
+{
+    // Branchless so that the compiler can vectorize it.
+    unsigned long attribBits = attribs.to_ulong();
+    GLint64 minLimit         = kUnlimitedElements;
+    for (size_t attribIndex = 0; attribIndex < MAX_VERTEX_ATTRIBS; ++attribIndex)
+    {
+        GLint64 limit = ((attribBits >> attribIndex) & 1u) ? limits[attribIndex]
+                                                           : kUnlimitedElements;
+        minLimit = std::min(minLimit, limit);
+    }
+    return minLimit;
+}
+}  // anonymous namespace
+
 // VertexArrayState implementation.
 VertexArrayState::VertexArrayState(size_t maxAttribs, size_t maxAttribBindings)
     : mLabel(), mVertexBindings(maxAttribBindings)
@@ -55,6 +75,13 @@ VertexArray::VertexArray(rx::GLImplFactory *factory,
     {
         mArrayBufferObserverBindings.emplace_back(this, attribIndex);
     }
+
+    mCachedVertexElementLimits.fill(-1);
+    mCachedInstanceElementLimits.fill(-1);
+    for (size_t attribIndex = 0; attribIndex < maxAttribs; ++attribIndex)
+    {
+        updateCachedElementLimits(attribIndex);
+    }
 }
 
 void VertexArray::onDestroy(const Context *context)
@@ -161,6 +188,7 @@ void VertexArray::bindVertexBufferImpl(const Context *context,
     updateObserverBinding(bindingIndex);
     updateCachedBufferBindingSize(bindingIndex);
     updateCachedTransformFeedbackBindingValidation(bindingIndex, boundBuffer);
+    updateCachedElementLimitsForBinding(bindingIndex);
 }
 
 void VertexArray::bindVertexBuffer(const Context *context,
@@ -188,6 +216,7 @@ void VertexArray::setVertexAttribBinding(const Context *context,
         setDirtyAttribBit(attribIndex, DIRTY_ATTRIB_BINDING);
     }
     mState.mVertexAttributes[attribIndex].bindingIndex = static_cast<GLuint>(bindingIndex);
+    updateCachedElementLimits(attribIndex);
 }
 
 void VertexArray::setVertexBindingDivisor(size_t bindingIndex, GLuint divisor)
@@ -196,6 +225,7 @@ void VertexArray::setVertexBindingDivisor(size_t bindingIndex, GLuint divisor)
 
     mState.mVertexBindings[bindingIndex].setDivisor(divisor);
     setDirtyBindingBit(bindingIndex, DIRTY_BINDING_DIVISOR);
+    updateCachedElementLimitsForBinding(bindingIndex);
 }
 
 void VertexArray::setVertexAttribFormatImpl(size_t attribIndex,
@@ -216,6 +246,7 @@ void VertexArray::setVertexAttribFormatImpl(size_t attribIndex,
     attrib->relativeOffset = relativeOffset;
     mState.mVertexAttributesTypeMask.setIndex(GetVertexAttributeBaseType(*attrib), attribIndex);
     attrib->updateCachedSizePlusRelativeOffset();
+    updateCachedElementLimits(attribIndex);
 }
 
 void VertexArray::setVertexAttribFormat(size_t attribIndex,
@@ -358,6 +389,7 @@ void VertexArray::onSubjectStateChange(const gl::Context *context,
             if (index < mArrayBufferObserverBindings.size())
             {
                 updateCachedBufferBindingSize(index);
+                updateCachedElementLimitsForBinding(index);
             }
             break;
 
@@ -395,6 +427,7 @@ void VertexArray::updateObserverBinding(size_t bindingIndex)
 void VertexArray::updateCachedVertexAttributeSize(size_t attribIndex)
 {
     mState.mVertexAttributes[attribIndex].updateCachedSizePlusRelativeOffset();
+    updateCachedElementLimits(attribIndex);
 }
 
 void VertexArray::updateCachedBufferBindingSize(size_t bindingIndex)
@@ -409,6 +442,71 @@ void VertexArray::updateCachedTransformFeedbackBindingValidation(size_t bindingI
     mCachedTransformFeedbackConflictedBindingsMask.set(bindingIndex, hasConflict);
 }
 
+void VertexArray::updateCachedElementLimits(size_t attribIndex)
+{
+    const VertexAttribute &attrib = mState.mVertexAttributes[attribIndex];
+    const VertexBinding &binding  = mState.mVertexBindings[attrib.bindingIndex];
+
+    // Element i is fetched from [i * stride + relativeOffset, i * stride + relativeOffset + size)
+    // relative to the binding's offset, so it must end within the buffer.
+    GLuint64 bufferSizeMinusOffset = binding.getCachedBufferSizeMinusOffset();
+    GLint64 limit                  = -1;
+    if (bufferSizeMinusOffset >= attrib.cachedSizePlusRelativeOffset)
+    {
+        GLuint64 stride = binding.getStride();
+        GLuint64 maxElement =
+            (stride == 0) ? kUnlimitedElements
+                          : (bufferSizeMinusOffset - attrib.cachedSizePlusRelativeOffset) / stride;
+        limit = static_cast<GLint64>(
+            std::min(maxElement, static_cast<GLuint64>(kUnlimitedElements)));
+    }
+
+    GLuint divisor = binding.getDivisor();
+    if (divisor == 0)
+    {
+        mCachedVertexElementLimits[attribIndex]   = limit;
+        mCachedInstanceElementLimits[attribIndex] = kUnlimitedElements;
+        return;
+    }
+
+    // Instance i fetches element i / divisor, so the last instance that fits is the last one
+    // fetching element |limit|.
+    mCachedVertexElementLimits[attribIndex] = kUnlimitedElements;
+    if (limit < 0)
+    {
+        mCachedInstanceElementLimits[attribIndex] = -1;
+    }
+    else if (limit >= kUnlimitedElements / divisor)
+    {
+        mCachedInstanceElementLimits[attribIndex] = kUnlimitedElements;
+    }
+    else
+    {
+        mCachedInstanceElementLimits[attribIndex] = (limit + 1) * divisor - 1;
+    }
+}
+
+void VertexArray::updateCachedElementLimitsForBinding(size_t bindingIndex)
+{
+    for (size_t attribIndex = 0; attribIndex < mState.mVertexAttributes.size(); ++attribIndex)
+    {
+        if (mState.mVertexAttributes[attribIndex].bindingIndex == bindingIndex)
+        {
+            updateCachedElementLimits(attribIndex);
+        }
+    }
+}
+
+GLint64 VertexArray::getCachedMaxVertexIndex(const AttributesMask &attribs) const
+{
+    return GetMinElementLimit(mCachedVertexElementLimits, attribs);
+}
+
+GLint64 VertexArray::getCachedMaxInstanceIndex(const AttributesMask &attribs) const
+{
+    return GetMinElementLimit(mCachedInstanceElementLimits, attribs);
+}
+
 bool VertexArray::hasTransformFeedbackBindingConflict(const AttributesMask &activeAttribues) const
 {
     // Fast check first.
@@ -177,6 +177,12 @@ class VertexArray final : public angle::ObserverInterface, public LabeledObject
         return mState.hasEnabledNullPointerClientArray();
     }
 
+    // Used in draw call validation. Returns the largest vertex index, or instance index, that all
+    // of the buffer-backed attributes in |attribs| can fetch without reading past the end of their
+    // buffers. -1 means one of them can't fetch any element.
+    GLint64 getCachedMaxVertexIndex(const AttributesMask &attribs) const;
+    GLint64 getCachedMaxInstanceIndex(const AttributesMask &attribs) const;
+
     // Observer implementation
     void onSubjectStateChange(const gl::Context *context,
                               angle::SubjectIndex index,
@@ -263,6 +269,8 @@ class VertexArray final : public angle::ObserverInterface, public LabeledObject
     void updateCachedVertexAttributeSize(size_t attribIndex);
     void updateCachedBufferBindingSize(size_t bindingIndex);
     void updateCachedTransformFeedbackBindingValidation(size_t bindingIndex, const Buffer *buffer);
+    void updateCachedElementLimits(size_t attribIndex);
+    void updateCachedElementLimitsForBinding(size_t bindingIndex);
 
     GLuint mId;
 
@@ -278,6 +286,13 @@ class VertexArray final : public angle::ObserverInterface, public LabeledObject
     angle::ObserverBinding mElementArrayBufferObserverBinding;
 
     AttributesMask mCachedTransformFeedbackConflictedBindingsMask;
+
+    // The largest vertex index each attribute can fetch from its buffer, kept as a structure of
+    // arrays so the per-draw check is a min over a small array. Instanced attributes are limited
+    // by the instance index instead, and are unlimited in the other array.
+    using ElementLimits = std::array<GLint64, MAX_VERTEX_ATTRIBS>;
+    ElementLimits mCachedVertexElementLimits;
+    ElementLimits mCachedInstanceElementLimits;
 };
 
 }  // namespace gl
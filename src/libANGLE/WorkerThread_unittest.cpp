@@ -7,6 +7,10 @@
 //   Simple tests for the worker thread class.
 
 #include <array>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 #include <gtest/gtest.h>
 
 #include "libANGLE/WorkerThread.h"
@@ -56,4 +60,54 @@ TYPED_TEST(WorkerPoolTest, SimpleTask)
     }
 }
 
+#if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+// Tests that the async worker pool runs tasks on another thread, and that waiting on the returned
+// event blocks until the task is done.
+TEST(AsyncWorkerPoolTest, TaskRunsOnWorkerThread)
+{
+    class BlockingTask : public Closure
+    {
+      public:
+        void operator()() override
+        {
+            threadId = std::this_thread::get_id();
+
+            // Time out instead of deadlocking if the task runs inside postWorkerTask.
+            std::unique_lock<std::mutex> lock(mutex);
+            releasedBeforeTimeout =
+                condition.wait_for(lock, std::chrono::seconds(10), [this] { return released; });
+            finished = true;
+        }
+
+        void release()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                released = true;
+            }
+            condition.notify_one();
+        }
+
+        std::mutex mutex;
+        std::condition_variable condition;
+        bool released              = false;
+        bool releasedBeforeTimeout = false;
+        bool finished              = false;
+        std::thread::id threadId;
+    };
+
+    priv::AsyncWorkerPool workerPool(4);
+    BlockingTask task;
+    priv::AsyncWaitableEvent waitable = workerPool.postWorkerTask(&task);
+
+    // The task can only finish once it is released, after postWorkerTask has returned.
+    task.release();
+    waitable.wait();
+
+    EXPECT_TRUE(task.finished);
+    EXPECT_TRUE(task.releasedBeforeTimeout);
+    EXPECT_NE(std::this_thread::get_id(), task.threadId);
+}
+#endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+
 }  // anonymous namespace
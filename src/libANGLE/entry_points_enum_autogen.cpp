@@ -0,0 +1,1218 @@
+// GENERATED FILE - DO NOT EDIT.
+// Generated by generate_entry_points.py using data from gl.xml and gl_angle_ext.xml.
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// entry_points_enum_autogen.cpp:
+//   Helper methods for the GLES entry points enumeration.
+
+#include "libANGLE/entry_points_enum_autogen.h"
+
+#include "common/debug.h"
+
+namespace gl
+{
+const char *GetEntryPointName(EntryPoint ep)
+{
+    switch (ep)
+    {
+        case EntryPoint::Invalid:
+            return "Invalid";
+        case EntryPoint::ActiveShaderProgram:
+            return "glActiveShaderProgram";
+        case EntryPoint::ActiveTexture:
+            return "glActiveTexture";
+        case EntryPoint::AlphaFunc:
+            return "glAlphaFunc";
+        case EntryPoint::AlphaFuncx:
+            return "glAlphaFuncx";
+        case EntryPoint::AttachShader:
+            return "glAttachShader";
+        case EntryPoint::BeginQuery:
+            return "glBeginQuery";
+        case EntryPoint::BeginQueryEXT:
+            return "glBeginQueryEXT";
+        case EntryPoint::BeginTransformFeedback:
+            return "glBeginTransformFeedback";
+        case EntryPoint::BindAttribLocation:
+            return "glBindAttribLocation";
+        case EntryPoint::BindBuffer:
+            return "glBindBuffer";
+        case EntryPoint::BindBufferBase:
+            return "glBindBufferBase";
+        case EntryPoint::BindBufferRange:
+            return "glBindBufferRange";
+        case EntryPoint::BindFragmentInputLocationCHROMIUM:
+            return "glBindFragmentInputLocationCHROMIUM";
+        case EntryPoint::BindFramebuffer:
+            return "glBindFramebuffer";
+        case EntryPoint::BindFramebufferOES:
+            return "glBindFramebufferOES";
+        case EntryPoint::BindImageTexture:
+            return "glBindImageTexture";
+        case EntryPoint::BindProgramPipeline:
+            return "glBindProgramPipeline";
+        case EntryPoint::BindRenderbuffer:
+            return "glBindRenderbuffer";
+        case EntryPoint::BindRenderbufferOES:
+            return "glBindRenderbufferOES";
+        case EntryPoint::BindSampler:
+            return "glBindSampler";
+        case EntryPoint::BindTexture:
+            return "glBindTexture";
+        case EntryPoint::BindTransformFeedback:
+            return "glBindTransformFeedback";
+        case EntryPoint::BindUniformLocationCHROMIUM:
+            return "glBindUniformLocationCHROMIUM";
+        case EntryPoint::BindVertexArray:
+            return "glBindVertexArray";
+        case EntryPoint::BindVertexArrayOES:
+            return "glBindVertexArrayOES";
+        case EntryPoint::BindVertexBuffer:
+            return "glBindVertexBuffer";
+        case EntryPoint::BlendColor:
+            return "glBlendColor";
+        case EntryPoint::BlendEquation:
+            return "glBlendEquation";
+        case EntryPoint::BlendEquationSeparate:
+            return "glBlendEquationSeparate";
+        case EntryPoint::BlendFunc:
+            return "glBlendFunc";
+        case EntryPoint::BlendFuncSeparate:
+            return "glBlendFuncSeparate";
+        case EntryPoint::BlitFramebuffer:
+            return "glBlitFramebuffer";
+        case EntryPoint::BlitFramebufferANGLE:
+            return "glBlitFramebufferANGLE";
+        case EntryPoint::BufferData:
+            return "glBufferData";
+        case EntryPoint::BufferSubData:
+            return "glBufferSubData";
+        case EntryPoint::CheckFramebufferStatus:
+            return "glCheckFramebufferStatus";
+        case EntryPoint::CheckFramebufferStatusOES:
+            return "glCheckFramebufferStatusOES";
+        case EntryPoint::Clear:
+            return "glClear";
+        case EntryPoint::ClearBufferfi:
+            return "glClearBufferfi";
+        case EntryPoint::ClearBufferfv:
+            return "glClearBufferfv";
+        case EntryPoint::ClearBufferiv:
+            return "glClearBufferiv";
+        case EntryPoint::ClearBufferuiv:
+            return "glClearBufferuiv";
+        case EntryPoint::ClearColor:
+            return "glClearColor";
+        case EntryPoint::ClearColorx:
+            return "glClearColorx";
+        case EntryPoint::ClearDepthf:
+            return "glClearDepthf";
+        case EntryPoint::ClearDepthx:
+            return "glClearDepthx";
+        case EntryPoint::ClearStencil:
+            return "glClearStencil";
+        case EntryPoint::ClientActiveTexture:
+            return "glClientActiveTexture";
+        case EntryPoint::ClientWaitSync:
+            return "glClientWaitSync";
+        case EntryPoint::ClipPlanef:
+            return "glClipPlanef";
+        case EntryPoint::ClipPlanex:
+            return "glClipPlanex";
+        case EntryPoint::Color4f:
+            return "glColor4f";
+        case EntryPoint::Color4ub:
+            return "glColor4ub";
+        case EntryPoint::Color4x:
+            return "glColor4x";
+        case EntryPoint::ColorMask:
+            return "glColorMask";
+        case EntryPoint::ColorPointer:
+            return "glColorPointer";
+        case EntryPoint::CompileShader:
+            return "glCompileShader";
+        case EntryPoint::CompressedCopyTextureCHROMIUM:
+            return "glCompressedCopyTextureCHROMIUM";
+        case EntryPoint::CompressedTexImage2D:
+            return "glCompressedTexImage2D";
+        case EntryPoint::CompressedTexImage2DRobustANGLE:
+            return "glCompressedTexImage2DRobustANGLE";
+        case EntryPoint::CompressedTexImage3D:
+            return "glCompressedTexImage3D";
+        case EntryPoint::CompressedTexImage3DRobustANGLE:
+            return "glCompressedTexImage3DRobustANGLE";
+        case EntryPoint::CompressedTexSubImage2D:
+            return "glCompressedTexSubImage2D";
+        case EntryPoint::CompressedTexSubImage2DRobustANGLE:
+            return "glCompressedTexSubImage2DRobustANGLE";
+        case EntryPoint::CompressedTexSubImage3D:
+            return "glCompressedTexSubImage3D";
+        case EntryPoint::CompressedTexSubImage3DRobustANGLE:
+            return "glCompressedTexSubImage3DRobustANGLE";
+        case EntryPoint::CopyBufferSubData:
+            return "glCopyBufferSubData";
+        case EntryPoint::CopySubTextureCHROMIUM:
+            return "glCopySubTextureCHROMIUM";
+        case EntryPoint::CopyTexImage2D:
+            return "glCopyTexImage2D";
+        case EntryPoint::CopyTexSubImage2D:
+            return "glCopyTexSubImage2D";
+        case EntryPoint::CopyTexSubImage3D:
+            return "glCopyTexSubImage3D";
+        case EntryPoint::CopyTextureCHROMIUM:
+            return "glCopyTextureCHROMIUM";
+        case EntryPoint::CoverFillPathCHROMIUM:
+            return "glCoverFillPathCHROMIUM";
+        case EntryPoint::CoverFillPathInstancedCHROMIUM:
+            return "glCoverFillPathInstancedCHROMIUM";
+        case EntryPoint::CoverStrokePathCHROMIUM:
+            return "glCoverStrokePathCHROMIUM";
+        case EntryPoint::CoverStrokePathInstancedCHROMIUM:
+            return "glCoverStrokePathInstancedCHROMIUM";
+        case EntryPoint::CoverageModulationCHROMIUM:
+            return "glCoverageModulationCHROMIUM";
+        case EntryPoint::CreateProgram:
+            return "glCreateProgram";
+        case EntryPoint::CreateShader:
+            return "glCreateShader";
+        case EntryPoint::CreateShaderProgramv:
+            return "glCreateShaderProgramv";
+        case EntryPoint::CullFace:
+            return "glCullFace";
+        case EntryPoint::CurrentPaletteMatrixOES:
+            return "glCurrentPaletteMatrixOES";
+        case EntryPoint::DebugMessageCallbackKHR:
+            return "glDebugMessageCallbackKHR";
+        case EntryPoint::DebugMessageControlKHR:
+            return "glDebugMessageControlKHR";
+        case EntryPoint::DebugMessageInsertKHR:
+            return "glDebugMessageInsertKHR";
+        case EntryPoint::DeleteBuffers:
+            return "glDeleteBuffers";
+        case EntryPoint::DeleteFencesNV:
+            return "glDeleteFencesNV";
+        case EntryPoint::DeleteFramebuffers:
+            return "glDeleteFramebuffers";
+        case EntryPoint::DeleteFramebuffersOES:
+            return "glDeleteFramebuffersOES";
+        case EntryPoint::DeletePathsCHROMIUM:
+            return "glDeletePathsCHROMIUM";
+        case EntryPoint::DeleteProgram:
+            return "glDeleteProgram";
+        case EntryPoint::DeleteProgramPipelines:
+            return "glDeleteProgramPipelines";
+        case EntryPoint::DeleteQueries:
+            return "glDeleteQueries";
+        case EntryPoint::DeleteQueriesEXT:
+            return "glDeleteQueriesEXT";
+        case EntryPoint::DeleteRenderbuffers:
+            return "glDeleteRenderbuffers";
+        case EntryPoint::DeleteRenderbuffersOES:
+            return "glDeleteRenderbuffersOES";
+        case EntryPoint::DeleteSamplers:
+            return "glDeleteSamplers";
+        case EntryPoint::DeleteShader:
+            return "glDeleteShader";
+        case EntryPoint::DeleteSync:
+            return "glDeleteSync";
+        case EntryPoint::DeleteTextures:
+            return "glDeleteTextures";
+        case EntryPoint::DeleteTransformFeedbacks:
+            return "glDeleteTransformFeedbacks";
+        case EntryPoint::DeleteVertexArrays:
+            return "glDeleteVertexArrays";
+        case EntryPoint::DeleteVertexArraysOES:
+            return "glDeleteVertexArraysOES";
+        case EntryPoint::DepthFunc:
+            return "glDepthFunc";
+        case EntryPoint::DepthMask:
+            return "glDepthMask";
+        case EntryPoint::DepthRangef:
+            return "glDepthRangef";
+        case EntryPoint::DepthRangex:
+            return "glDepthRangex";
+        case EntryPoint::DetachShader:
+            return "glDetachShader";
+        case EntryPoint::Disable:
+            return "glDisable";
+        case EntryPoint::DisableClientState:
+            return "glDisableClientState";
+        case EntryPoint::DisableVertexAttribArray:
+            return "glDisableVertexAttribArray";
+        case EntryPoint::DiscardFramebufferEXT:
+            return "glDiscardFramebufferEXT";
+        case EntryPoint::DispatchCompute:
+            return "glDispatchCompute";
+        case EntryPoint::DispatchComputeIndirect:
+            return "glDispatchComputeIndirect";
+        case EntryPoint::DrawArrays:
+            return "glDrawArrays";
+        case EntryPoint::DrawArraysIndirect:
+            return "glDrawArraysIndirect";
+        case EntryPoint::DrawArraysInstanced:
+            return "glDrawArraysInstanced";
+        case EntryPoint::DrawArraysInstancedANGLE:
+            return "glDrawArraysInstancedANGLE";
+        case EntryPoint::DrawBuffers:
+            return "glDrawBuffers";
+        case EntryPoint::DrawBuffersEXT:
+            return "glDrawBuffersEXT";
+        case EntryPoint::DrawElements:
+            return "glDrawElements";
+        case EntryPoint::DrawElementsIndirect:
+            return "glDrawElementsIndirect";
+        case EntryPoint::DrawElementsInstanced:
+            return "glDrawElementsInstanced";
+        case EntryPoint::DrawElementsInstancedANGLE:
+            return "glDrawElementsInstancedANGLE";
+        case EntryPoint::DrawRangeElements:
+            return "glDrawRangeElements";
+        case EntryPoint::DrawTexfOES:
+            return "glDrawTexfOES";
+        case EntryPoint::DrawTexfvOES:
+            return "glDrawTexfvOES";
+        case EntryPoint::DrawTexiOES:
+            return "glDrawTexiOES";
+        case EntryPoint::DrawTexivOES:
+            return "glDrawTexivOES";
+        case EntryPoint::DrawTexsOES:
+            return "glDrawTexsOES";
+        case EntryPoint::DrawTexsvOES:
+            return "glDrawTexsvOES";
+        case EntryPoint::DrawTexxOES:
+            return "glDrawTexxOES";
+        case EntryPoint::DrawTexxvOES:
+            return "glDrawTexxvOES";
+        case EntryPoint::EGLImageTargetRenderbufferStorageOES:
+            return "glEGLImageTargetRenderbufferStorageOES";
+        case EntryPoint::EGLImageTargetTexture2DOES:
+            return "glEGLImageTargetTexture2DOES";
+        case EntryPoint::Enable:
+            return "glEnable";
+        case EntryPoint::EnableClientState:
+            return "glEnableClientState";
+        case EntryPoint::EnableVertexAttribArray:
+            return "glEnableVertexAttribArray";
+        case EntryPoint::EndQuery:
+            return "glEndQuery";
+        case EntryPoint::EndQueryEXT:
+            return "glEndQueryEXT";
+        case EntryPoint::EndTransformFeedback:
+            return "glEndTransformFeedback";
+        case EntryPoint::FenceSync:
+            return "glFenceSync";
+        case EntryPoint::Finish:
+            return "glFinish";
+        case EntryPoint::FinishFenceNV:
+            return "glFinishFenceNV";
+        case EntryPoint::Flush:
+            return "glFlush";
+        case EntryPoint::FlushMappedBufferRange:
+            return "glFlushMappedBufferRange";
+        case EntryPoint::FlushMappedBufferRangeEXT:
+            return "glFlushMappedBufferRangeEXT";
+        case EntryPoint::Fogf:
+            return "glFogf";
+        case EntryPoint::Fogfv:
+            return "glFogfv";
+        case EntryPoint::Fogx:
+            return "glFogx";
+        case EntryPoint::Fogxv:
+            return "glFogxv";
+        case EntryPoint::FramebufferParameteri:
+            return "glFramebufferParameteri";
+        case EntryPoint::FramebufferRenderbuffer:
+            return "glFramebufferRenderbuffer";
+        case EntryPoint::FramebufferRenderbufferOES:
+            return "glFramebufferRenderbufferOES";
+        case EntryPoint::FramebufferTexture2D:
+            return "glFramebufferTexture2D";
+        case EntryPoint::FramebufferTexture2DOES:
+            return "glFramebufferTexture2DOES";
+        case EntryPoint::FramebufferTextureLayer:
+            return "glFramebufferTextureLayer";
+        case EntryPoint::FramebufferTextureMultiviewLayeredANGLE:
+            return "glFramebufferTextureMultiviewLayeredANGLE";
+        case EntryPoint::FramebufferTextureMultiviewSideBySideANGLE:
+            return "glFramebufferTextureMultiviewSideBySideANGLE";
+        case EntryPoint::FrontFace:
+            return "glFrontFace";
+        case EntryPoint::Frustumf:
+            return "glFrustumf";
+        case EntryPoint::Frustumx:
+            return "glFrustumx";
+        case EntryPoint::GenBuffers:
+            return "glGenBuffers";
+        case EntryPoint::GenFencesNV:
+            return "glGenFencesNV";
+        case EntryPoint::GenFramebuffers:
+            return "glGenFramebuffers";
+        case EntryPoint::GenFramebuffersOES:
+            return "glGenFramebuffersOES";
+        case EntryPoint::GenPathsCHROMIUM:
+            return "glGenPathsCHROMIUM";
+        case EntryPoint::GenProgramPipelines:
+            return "glGenProgramPipelines";
+        case EntryPoint::GenQueries:
+            return "glGenQueries";
+        case EntryPoint::GenQueriesEXT:
+            return "glGenQueriesEXT";
+        case EntryPoint::GenRenderbuffers:
+            return "glGenRenderbuffers";
+        case EntryPoint::GenRenderbuffersOES:
+            return "glGenRenderbuffersOES";
+        case EntryPoint::GenSamplers:
+            return "glGenSamplers";
+        case EntryPoint::GenTextures:
+            return "glGenTextures";
+        case EntryPoint::GenTransformFeedbacks:
+            return "glGenTransformFeedbacks";
+        case EntryPoint::GenVertexArrays:
+            return "glGenVertexArrays";
+        case EntryPoint::GenVertexArraysOES:
+            return "glGenVertexArraysOES";
+        case EntryPoint::GenerateMipmap:
+            return "glGenerateMipmap";
+        case EntryPoint::GenerateMipmapOES:
+            return "glGenerateMipmapOES";
+        case EntryPoint::GetActiveAttrib:
+            return "glGetActiveAttrib";
+        case EntryPoint::GetActiveUniform:
+            return "glGetActiveUniform";
+        case EntryPoint::GetActiveUniformBlockName:
+            return "glGetActiveUniformBlockName";
+        case EntryPoint::GetActiveUniformBlockiv:
+            return "glGetActiveUniformBlockiv";
+        case EntryPoint::GetActiveUniformBlockivRobustANGLE:
+            return "glGetActiveUniformBlockivRobustANGLE";
+        case EntryPoint::GetActiveUniformsiv:
+            return "glGetActiveUniformsiv";
+        case EntryPoint::GetAttachedShaders:
+            return "glGetAttachedShaders";
+        case EntryPoint::GetAttribLocation:
+            return "glGetAttribLocation";
+        case EntryPoint::GetBooleani_v:
+            return "glGetBooleani_v";
+        case EntryPoint::GetBooleani_vRobustANGLE:
+            return "glGetBooleani_vRobustANGLE";
+        case EntryPoint::GetBooleanv:
+            return "glGetBooleanv";
+        case EntryPoint::GetBooleanvRobustANGLE:
+            return "glGetBooleanvRobustANGLE";
+        case EntryPoint::GetBufferParameteri64v:
+            return "glGetBufferParameteri64v";
+        case EntryPoint::GetBufferParameteri64vRobustANGLE:
+            return "glGetBufferParameteri64vRobustANGLE";
+        case EntryPoint::GetBufferParameteriv:
+            return "glGetBufferParameteriv";
+        case EntryPoint::GetBufferParameterivRobustANGLE:
+            return "glGetBufferParameterivRobustANGLE";
+        case EntryPoint::GetBufferPointerv:
+            return "glGetBufferPointerv";
+        case EntryPoint::GetBufferPointervOES:
+            return "glGetBufferPointervOES";
+        case EntryPoint::GetBufferPointervRobustANGLE:
+            return "glGetBufferPointervRobustANGLE";
+        case EntryPoint::GetClipPlanef:
+            return "glGetClipPlanef";
+        case EntryPoint::GetClipPlanex:
+            return "glGetClipPlanex";
+        case EntryPoint::GetDebugMessageLogKHR:
+            return "glGetDebugMessageLogKHR";
+        case EntryPoint::GetError:
+            return "glGetError";
+        case EntryPoint::GetFenceivNV:
+            return "glGetFenceivNV";
+        case EntryPoint::GetFixedv:
+            return "glGetFixedv";
+        case EntryPoint::GetFloatv:
+            return "glGetFloatv";
+        case EntryPoint::GetFloatvRobustANGLE:
+            return "glGetFloatvRobustANGLE";
+        case EntryPoint::GetFragDataLocation:
+            return "glGetFragDataLocation";
+        case EntryPoint::GetFramebufferAttachmentParameteriv:
+            return "glGetFramebufferAttachmentParameteriv";
+        case EntryPoint::GetFramebufferAttachmentParameterivOES:
+            return "glGetFramebufferAttachmentParameterivOES";
+        case EntryPoint::GetFramebufferAttachmentParameterivRobustANGLE:
+            return "glGetFramebufferAttachmentParameterivRobustANGLE";
+        case EntryPoint::GetFramebufferParameteriv:
+            return "glGetFramebufferParameteriv";
+        case EntryPoint::GetFramebufferParameterivRobustANGLE:
+            return "glGetFramebufferParameterivRobustANGLE";
+        case EntryPoint::GetGraphicsResetStatusEXT:
+            return "glGetGraphicsResetStatusEXT";
+        case EntryPoint::GetInteger64i_v:
+            return "glGetInteger64i_v";
+        case EntryPoint::GetInteger64i_vRobustANGLE:
+            return "glGetInteger64i_vRobustANGLE";
+        case EntryPoint::GetInteger64v:
+            return "glGetInteger64v";
+        case EntryPoint::GetInteger64vRobustANGLE:
+            return "glGetInteger64vRobustANGLE";
+        case EntryPoint::GetIntegeri_v:
+            return "glGetIntegeri_v";
+        case EntryPoint::GetIntegeri_vRobustANGLE:
+            return "glGetIntegeri_vRobustANGLE";
+        case EntryPoint::GetIntegerv:
+            return "glGetIntegerv";
+        case EntryPoint::GetIntegervRobustANGLE:
+            return "glGetIntegervRobustANGLE";
+        case EntryPoint::GetInternalformativ:
+            return "glGetInternalformativ";
+        case EntryPoint::GetInternalformativRobustANGLE:
+            return "glGetInternalformativRobustANGLE";
+        case EntryPoint::GetLightfv:
+            return "glGetLightfv";
+        case EntryPoint::GetLightxv:
+            return "glGetLightxv";
+        case EntryPoint::GetMaterialfv:
+            return "glGetMaterialfv";
+        case EntryPoint::GetMaterialxv:
+            return "glGetMaterialxv";
+        case EntryPoint::GetMultisamplefv:
+            return "glGetMultisamplefv";
+        case EntryPoint::GetMultisamplefvRobustANGLE:
+            return "glGetMultisamplefvRobustANGLE";
+        case EntryPoint::GetObjectLabelKHR:
+            return "glGetObjectLabelKHR";
+        case EntryPoint::GetObjectPtrLabelKHR:
+            return "glGetObjectPtrLabelKHR";
+        case EntryPoint::GetPathParameterfvCHROMIUM:
+            return "glGetPathParameterfvCHROMIUM";
+        case EntryPoint::GetPathParameterivCHROMIUM:
+            return "glGetPathParameterivCHROMIUM";
+        case EntryPoint::GetPointerv:
+            return "glGetPointerv";
+        case EntryPoint::GetPointervKHR:
+            return "glGetPointervKHR";
+        case EntryPoint::GetPointervRobustANGLERobustANGLE:
+            return "glGetPointervRobustANGLERobustANGLE";
+        case EntryPoint::GetProgramBinary:
+            return "glGetProgramBinary";
+        case EntryPoint::GetProgramBinaryOES:
+            return "glGetProgramBinaryOES";
+        case EntryPoint::GetProgramInfoLog:
+            return "glGetProgramInfoLog";
+        case EntryPoint::GetProgramInterfaceiv:
+            return "glGetProgramInterfaceiv";
+        case EntryPoint::GetProgramInterfaceivRobustANGLE:
+            return "glGetProgramInterfaceivRobustANGLE";
+        case EntryPoint::GetProgramPipelineInfoLog:
+            return "glGetProgramPipelineInfoLog";
+        case EntryPoint::GetProgramPipelineiv:
+            return "glGetProgramPipelineiv";
+        case EntryPoint::GetProgramResourceIndex:
+            return "glGetProgramResourceIndex";
+        case EntryPoint::GetProgramResourceLocation:
+            return "glGetProgramResourceLocation";
+        case EntryPoint::GetProgramResourceName:
+            return "glGetProgramResourceName";
+        case EntryPoint::GetProgramResourceiv:
+            return "glGetProgramResourceiv";
+        case EntryPoint::GetProgramiv:
+            return "glGetProgramiv";
+        case EntryPoint::GetProgramivRobustANGLE:
+            return "glGetProgramivRobustANGLE";
+        case EntryPoint::GetQueryObjecti64vEXT:
+            return "glGetQueryObjecti64vEXT";
+        case EntryPoint::GetQueryObjecti64vRobustANGLE:
+            return "glGetQueryObjecti64vRobustANGLE";
+        case EntryPoint::GetQueryObjectivEXT:
+            return "glGetQueryObjectivEXT";
+        case EntryPoint::GetQueryObjectivRobustANGLE:
+            return "glGetQueryObjectivRobustANGLE";
+        case EntryPoint::GetQueryObjectui64vEXT:
+            return "glGetQueryObjectui64vEXT";
+        case EntryPoint::GetQueryObjectui64vRobustANGLE:
+            return "glGetQueryObjectui64vRobustANGLE";
+        case EntryPoint::GetQueryObjectuiv:
+            return "glGetQueryObjectuiv";
+        case EntryPoint::GetQueryObjectuivEXT:
+            return "glGetQueryObjectuivEXT";
+        case EntryPoint::GetQueryObjectuivRobustANGLE:
+            return "glGetQueryObjectuivRobustANGLE";
+        case EntryPoint::GetQueryiv:
+            return "glGetQueryiv";
+        case EntryPoint::GetQueryivEXT:
+            return "glGetQueryivEXT";
+        case EntryPoint::GetQueryivRobustANGLE:
+            return "glGetQueryivRobustANGLE";
+        case EntryPoint::GetRenderbufferParameteriv:
+            return "glGetRenderbufferParameteriv";
+        case EntryPoint::GetRenderbufferParameterivOES:
+            return "glGetRenderbufferParameterivOES";
+        case EntryPoint::GetRenderbufferParameterivRobustANGLE:
+            return "glGetRenderbufferParameterivRobustANGLE";
+        case EntryPoint::GetSamplerParameterIivRobustANGLE:
+            return "glGetSamplerParameterIivRobustANGLE";
+        case EntryPoint::GetSamplerParameterIuivRobustANGLE:
+            return "glGetSamplerParameterIuivRobustANGLE";
+        case EntryPoint::GetSamplerParameterfv:
+            return "glGetSamplerParameterfv";
+        case EntryPoint::GetSamplerParameterfvRobustANGLE:
+            return "glGetSamplerParameterfvRobustANGLE";
+        case EntryPoint::GetSamplerParameteriv:
+            return "glGetSamplerParameteriv";
+        case EntryPoint::GetSamplerParameterivRobustANGLE:
+            return "glGetSamplerParameterivRobustANGLE";
+        case EntryPoint::GetShaderInfoLog:
+            return "glGetShaderInfoLog";
+        case EntryPoint::GetShaderPrecisionFormat:
+            return "glGetShaderPrecisionFormat";
+        case EntryPoint::GetShaderSource:
+            return "glGetShaderSource";
+        case EntryPoint::GetShaderiv:
+            return "glGetShaderiv";
+        case EntryPoint::GetShaderivRobustANGLE:
+            return "glGetShaderivRobustANGLE";
+        case EntryPoint::GetString:
+            return "glGetString";
+        case EntryPoint::GetStringi:
+            return "glGetStringi";
+        case EntryPoint::GetSynciv:
+            return "glGetSynciv";
+        case EntryPoint::GetTexEnvfv:
+            return "glGetTexEnvfv";
+        case EntryPoint::GetTexEnviv:
+            return "glGetTexEnviv";
+        case EntryPoint::GetTexEnvxv:
+            return "glGetTexEnvxv";
+        case EntryPoint::GetTexGenfvOES:
+            return "glGetTexGenfvOES";
+        case EntryPoint::GetTexGenivOES:
+            return "glGetTexGenivOES";
+        case EntryPoint::GetTexGenxvOES:
+            return "glGetTexGenxvOES";
+        case EntryPoint::GetTexLevelParameterfv:
+            return "glGetTexLevelParameterfv";
+        case EntryPoint::GetTexLevelParameterfvRobustANGLE:
+            return "glGetTexLevelParameterfvRobustANGLE";
+        case EntryPoint::GetTexLevelParameteriv:
+            return "glGetTexLevelParameteriv";
+        case EntryPoint::GetTexLevelParameterivRobustANGLE:
+            return "glGetTexLevelParameterivRobustANGLE";
+        case EntryPoint::GetTexParameterIivRobustANGLE:
+            return "glGetTexParameterIivRobustANGLE";
+        case EntryPoint::GetTexParameterIuivRobustANGLE:
+            return "glGetTexParameterIuivRobustANGLE";
+        case EntryPoint::GetTexParameterfv:
+            return "glGetTexParameterfv";
+        case EntryPoint::GetTexParameterfvRobustANGLE:
+            return "glGetTexParameterfvRobustANGLE";
+        case EntryPoint::GetTexParameteriv:
+            return "glGetTexParameteriv";
+        case EntryPoint::GetTexParameterivRobustANGLE:
+            return "glGetTexParameterivRobustANGLE";
+        case EntryPoint::GetTexParameterxv:
+            return "glGetTexParameterxv";
+        case EntryPoint::GetTransformFeedbackVarying:
+            return "glGetTransformFeedbackVarying";
+        case EntryPoint::GetTranslatedShaderSourceANGLE:
+            return "glGetTranslatedShaderSourceANGLE";
+        case EntryPoint::GetUniformBlockIndex:
+            return "glGetUniformBlockIndex";
+        case EntryPoint::GetUniformIndices:
+            return "glGetUniformIndices";
+        case EntryPoint::GetUniformLocation:
+            return "glGetUniformLocation";
+        case EntryPoint::GetUniformfv:
+            return "glGetUniformfv";
+        case EntryPoint::GetUniformfvRobustANGLE:
+            return "glGetUniformfvRobustANGLE";
+        case EntryPoint::GetUniformiv:
+            return "glGetUniformiv";
+        case EntryPoint::GetUniformivRobustANGLE:
+            return "glGetUniformivRobustANGLE";
+        case EntryPoint::GetUniformuiv:
+            return "glGetUniformuiv";
+        case EntryPoint::GetUniformuivRobustANGLE:
+            return "glGetUniformuivRobustANGLE";
+        case EntryPoint::GetVertexAttribIiv:
+            return "glGetVertexAttribIiv";
+        case EntryPoint::GetVertexAttribIivRobustANGLE:
+            return "glGetVertexAttribIivRobustANGLE";
+        case EntryPoint::GetVertexAttribIuiv:
+            return "glGetVertexAttribIuiv";
+        case EntryPoint::GetVertexAttribIuivRobustANGLE:
+            return "glGetVertexAttribIuivRobustANGLE";
+        case EntryPoint::GetVertexAttribPointerv:
+            return "glGetVertexAttribPointerv";
+        case EntryPoint::GetVertexAttribPointervRobustANGLE:
+            return "glGetVertexAttribPointervRobustANGLE";
+        case EntryPoint::GetVertexAttribfv:
+            return "glGetVertexAttribfv";
+        case EntryPoint::GetVertexAttribfvRobustANGLE:
+            return "glGetVertexAttribfvRobustANGLE";
+        case EntryPoint::GetVertexAttribiv:
+            return "glGetVertexAttribiv";
+        case EntryPoint::GetVertexAttribivRobustANGLE:
+            return "glGetVertexAttribivRobustANGLE";
+        case EntryPoint::GetnUniformfvEXT:
+            return "glGetnUniformfvEXT";
+        case EntryPoint::GetnUniformfvRobustANGLE:
+            return "glGetnUniformfvRobustANGLE";
+        case EntryPoint::GetnUniformivEXT:
+            return "glGetnUniformivEXT";
+        case EntryPoint::GetnUniformivRobustANGLE:
+            return "glGetnUniformivRobustANGLE";
+        case EntryPoint::GetnUniformuivRobustANGLE:
+            return "glGetnUniformuivRobustANGLE";
+        case EntryPoint::Hint:
+            return "glHint";
+        case EntryPoint::InsertEventMarkerEXT:
+            return "glInsertEventMarkerEXT";
+        case EntryPoint::InvalidateFramebuffer:
+            return "glInvalidateFramebuffer";
+        case EntryPoint::InvalidateSubFramebuffer:
+            return "glInvalidateSubFramebuffer";
+        case EntryPoint::IsBuffer:
+            return "glIsBuffer";
+        case EntryPoint::IsEnabled:
+            return "glIsEnabled";
+        case EntryPoint::IsFenceNV:
+            return "glIsFenceNV";
+        case EntryPoint::IsFramebuffer:
+            return "glIsFramebuffer";
+        case EntryPoint::IsFramebufferOES:
+            return "glIsFramebufferOES";
+        case EntryPoint::IsPathCHROMIUM:
+            return "glIsPathCHROMIUM";
+        case EntryPoint::IsProgram:
+            return "glIsProgram";
+        case EntryPoint::IsProgramPipeline:
+            return "glIsProgramPipeline";
+        case EntryPoint::IsQuery:
+            return "glIsQuery";
+        case EntryPoint::IsQueryEXT:
+            return "glIsQueryEXT";
+        case EntryPoint::IsRenderbuffer:
+            return "glIsRenderbuffer";
+        case EntryPoint::IsRenderbufferOES:
+            return "glIsRenderbufferOES";
+        case EntryPoint::IsSampler:
+            return "glIsSampler";
+        case EntryPoint::IsShader:
+            return "glIsShader";
+        case EntryPoint::IsSync:
+            return "glIsSync";
+        case EntryPoint::IsTexture:
+            return "glIsTexture";
+        case EntryPoint::IsTransformFeedback:
+            return "glIsTransformFeedback";
+        case EntryPoint::IsVertexArray:
+            return "glIsVertexArray";
+        case EntryPoint::IsVertexArrayOES:
+            return "glIsVertexArrayOES";
+        case EntryPoint::LightModelf:
+            return "glLightModelf";
+        case EntryPoint::LightModelfv:
+            return "glLightModelfv";
+        case EntryPoint::LightModelx:
+            return "glLightModelx";
+        case EntryPoint::LightModelxv:
+            return "glLightModelxv";
+        case EntryPoint::Lightf:
+            return "glLightf";
+        case EntryPoint::Lightfv:
+            return "glLightfv";
+        case EntryPoint::Lightx:
+            return "glLightx";
+        case EntryPoint::Lightxv:
+            return "glLightxv";
+        case EntryPoint::LineWidth:
+            return "glLineWidth";
+        case EntryPoint::LineWidthx:
+            return "glLineWidthx";
+        case EntryPoint::LinkProgram:
+            return "glLinkProgram";
+        case EntryPoint::LoadIdentity:
+            return "glLoadIdentity";
+        case EntryPoint::LoadMatrixf:
+            return "glLoadMatrixf";
+        case EntryPoint::LoadMatrixx:
+            return "glLoadMatrixx";
+        case EntryPoint::LoadPaletteFromModelViewMatrixOES:
+            return "glLoadPaletteFromModelViewMatrixOES";
+        case EntryPoint::LogicOp:
+            return "glLogicOp";
+        case EntryPoint::MapBufferOES:
+            return "glMapBufferOES";
+        case EntryPoint::MapBufferRange:
+            return "glMapBufferRange";
+        case EntryPoint::MapBufferRangeEXT:
+            return "glMapBufferRangeEXT";
+        case EntryPoint::Materialf:
+            return "glMaterialf";
+        case EntryPoint::Materialfv:
+            return "glMaterialfv";
+        case EntryPoint::Materialx:
+            return "glMaterialx";
+        case EntryPoint::Materialxv:
+            return "glMaterialxv";
+        case EntryPoint::MatrixIndexPointerOES:
+            return "glMatrixIndexPointerOES";
+        case EntryPoint::MatrixLoadIdentityCHROMIUM:
+            return "glMatrixLoadIdentityCHROMIUM";
+        case EntryPoint::MatrixLoadfCHROMIUM:
+            return "glMatrixLoadfCHROMIUM";
+        case EntryPoint::MatrixMode:
+            return "glMatrixMode";
+        case EntryPoint::MemoryBarrier:
+            return "glMemoryBarrier";
+        case EntryPoint::MemoryBarrierByRegion:
+            return "glMemoryBarrierByRegion";
+        case EntryPoint::MultMatrixf:
+            return "glMultMatrixf";
+        case EntryPoint::MultMatrixx:
+            return "glMultMatrixx";
+        case EntryPoint::MultiTexCoord4f:
+            return "glMultiTexCoord4f";
+        case EntryPoint::MultiTexCoord4x:
+            return "glMultiTexCoord4x";
+        case EntryPoint::Normal3f:
+            return "glNormal3f";
+        case EntryPoint::Normal3x:
+            return "glNormal3x";
+        case EntryPoint::NormalPointer:
+            return "glNormalPointer";
+        case EntryPoint::ObjectLabelKHR:
+            return "glObjectLabelKHR";
+        case EntryPoint::ObjectPtrLabelKHR:
+            return "glObjectPtrLabelKHR";
+        case EntryPoint::Orthof:
+            return "glOrthof";
+        case EntryPoint::Orthox:
+            return "glOrthox";
+        case EntryPoint::PathCommandsCHROMIUM:
+            return "glPathCommandsCHROMIUM";
+        case EntryPoint::PathParameterfCHROMIUM:
+            return "glPathParameterfCHROMIUM";
+        case EntryPoint::PathParameteriCHROMIUM:
+            return "glPathParameteriCHROMIUM";
+        case EntryPoint::PathStencilFuncCHROMIUM:
+            return "glPathStencilFuncCHROMIUM";
+        case EntryPoint::PauseTransformFeedback:
+            return "glPauseTransformFeedback";
+        case EntryPoint::PixelStorei:
+            return "glPixelStorei";
+        case EntryPoint::PointParameterf:
+            return "glPointParameterf";
+        case EntryPoint::PointParameterfv:
+            return "glPointParameterfv";
+        case EntryPoint::PointParameterx:
+            return "glPointParameterx";
+        case EntryPoint::PointParameterxv:
+            return "glPointParameterxv";
+        case EntryPoint::PointSize:
+            return "glPointSize";
+        case EntryPoint::PointSizePointerOES:
+            return "glPointSizePointerOES";
+        case EntryPoint::PointSizex:
+            return "glPointSizex";
+        case EntryPoint::PolygonOffset:
+            return "glPolygonOffset";
+        case EntryPoint::PolygonOffsetx:
+            return "glPolygonOffsetx";
+        case EntryPoint::PopDebugGroupKHR:
+            return "glPopDebugGroupKHR";
+        case EntryPoint::PopGroupMarkerEXT:
+            return "glPopGroupMarkerEXT";
+        case EntryPoint::PopMatrix:
+            return "glPopMatrix";
+        case EntryPoint::ProgramBinary:
+            return "glProgramBinary";
+        case EntryPoint::ProgramBinaryOES:
+            return "glProgramBinaryOES";
+        case EntryPoint::ProgramParameteri:
+            return "glProgramParameteri";
+        case EntryPoint::ProgramPathFragmentInputGenCHROMIUM:
+            return "glProgramPathFragmentInputGenCHROMIUM";
+        case EntryPoint::ProgramUniform1f:
+            return "glProgramUniform1f";
+        case EntryPoint::ProgramUniform1fv:
+            return "glProgramUniform1fv";
+        case EntryPoint::ProgramUniform1i:
+            return "glProgramUniform1i";
+        case EntryPoint::ProgramUniform1iv:
+            return "glProgramUniform1iv";
+        case EntryPoint::ProgramUniform1ui:
+            return "glProgramUniform1ui";
+        case EntryPoint::ProgramUniform1uiv:
+            return "glProgramUniform1uiv";
+        case EntryPoint::ProgramUniform2f:
+            return "glProgramUniform2f";
+        case EntryPoint::ProgramUniform2fv:
+            return "glProgramUniform2fv";
+        case EntryPoint::ProgramUniform2i:
+            return "glProgramUniform2i";
+        case EntryPoint::ProgramUniform2iv:
+            return "glProgramUniform2iv";
+        case EntryPoint::ProgramUniform2ui:
+            return "glProgramUniform2ui";
+        case EntryPoint::ProgramUniform2uiv:
+            return "glProgramUniform2uiv";
+        case EntryPoint::ProgramUniform3f:
+            return "glProgramUniform3f";
+        case EntryPoint::ProgramUniform3fv:
+            return "glProgramUniform3fv";
+        case EntryPoint::ProgramUniform3i:
+            return "glProgramUniform3i";
+        case EntryPoint::ProgramUniform3iv:
+            return "glProgramUniform3iv";
+        case EntryPoint::ProgramUniform3ui:
+            return "glProgramUniform3ui";
+        case EntryPoint::ProgramUniform3uiv:
+            return "glProgramUniform3uiv";
+        case EntryPoint::ProgramUniform4f:
+            return "glProgramUniform4f";
+        case EntryPoint::ProgramUniform4fv:
+            return "glProgramUniform4fv";
+        case EntryPoint::ProgramUniform4i:
+            return "glProgramUniform4i";
+        case EntryPoint::ProgramUniform4iv:
+            return "glProgramUniform4iv";
+        case EntryPoint::ProgramUniform4ui:
+            return "glProgramUniform4ui";
+        case EntryPoint::ProgramUniform4uiv:
+            return "glProgramUniform4uiv";
+        case EntryPoint::ProgramUniformMatrix2fv:
+            return "glProgramUniformMatrix2fv";
+        case EntryPoint::ProgramUniformMatrix2x3fv:
+            return "glProgramUniformMatrix2x3fv";
+        case EntryPoint::ProgramUniformMatrix2x4fv:
+            return "glProgramUniformMatrix2x4fv";
+        case EntryPoint::ProgramUniformMatrix3fv:
+            return "glProgramUniformMatrix3fv";
+        case EntryPoint::ProgramUniformMatrix3x2fv:
+            return "glProgramUniformMatrix3x2fv";
+        case EntryPoint::ProgramUniformMatrix3x4fv:
+            return "glProgramUniformMatrix3x4fv";
+        case EntryPoint::ProgramUniformMatrix4fv:
+            return "glProgramUniformMatrix4fv";
+        case EntryPoint::ProgramUniformMatrix4x2fv:
+            return "glProgramUniformMatrix4x2fv";
+        case EntryPoint::ProgramUniformMatrix4x3fv:
+            return "glProgramUniformMatrix4x3fv";
+        case EntryPoint::PushDebugGroupKHR:
+            return "glPushDebugGroupKHR";
+        case EntryPoint::PushGroupMarkerEXT:
+            return "glPushGroupMarkerEXT";
+        case EntryPoint::PushMatrix:
+            return "glPushMatrix";
+        case EntryPoint::QueryCounterEXT:
+            return "glQueryCounterEXT";
+        case EntryPoint::QueryMatrixxOES:
+            return "glQueryMatrixxOES";
+        case EntryPoint::ReadBuffer:
+            return "glReadBuffer";
+        case EntryPoint::ReadPixels:
+            return "glReadPixels";
+        case EntryPoint::ReadPixelsRobustANGLE:
+            return "glReadPixelsRobustANGLE";
+        case EntryPoint::ReadnPixelsEXT:
+            return "glReadnPixelsEXT";
+        case EntryPoint::ReadnPixelsRobustANGLE:
+            return "glReadnPixelsRobustANGLE";
+        case EntryPoint::ReleaseShaderCompiler:
+            return "glReleaseShaderCompiler";
+        case EntryPoint::RenderbufferStorage:
+            return "glRenderbufferStorage";
+        case EntryPoint::RenderbufferStorageMultisample:
+            return "glRenderbufferStorageMultisample";
+        case EntryPoint::RenderbufferStorageMultisampleANGLE:
+            return "glRenderbufferStorageMultisampleANGLE";
+        case EntryPoint::RenderbufferStorageOES:
+            return "glRenderbufferStorageOES";
+        case EntryPoint::RequestExtensionANGLE:
+            return "glRequestExtensionANGLE";
+        case EntryPoint::ResumeTransformFeedback:
+            return "glResumeTransformFeedback";
+        case EntryPoint::Rotatef:
+            return "glRotatef";
+        case EntryPoint::Rotatex:
+            return "glRotatex";
+        case EntryPoint::SampleCoverage:
+            return "glSampleCoverage";
+        case EntryPoint::SampleCoveragex:
+            return "glSampleCoveragex";
+        case EntryPoint::SampleMaski:
+            return "glSampleMaski";
+        case EntryPoint::SamplerParameterIivRobustANGLE:
+            return "glSamplerParameterIivRobustANGLE";
+        case EntryPoint::SamplerParameterIuivRobustANGLE:
+            return "glSamplerParameterIuivRobustANGLE";
+        case EntryPoint::SamplerParameterf:
+            return "glSamplerParameterf";
+        case EntryPoint::SamplerParameterfv:
+            return "glSamplerParameterfv";
+        case EntryPoint::SamplerParameterfvRobustANGLE:
+            return "glSamplerParameterfvRobustANGLE";
+        case EntryPoint::SamplerParameteri:
+            return "glSamplerParameteri";
+        case EntryPoint::SamplerParameteriv:
+            return "glSamplerParameteriv";
+        case EntryPoint::SamplerParameterivRobustANGLE:
+            return "glSamplerParameterivRobustANGLE";
+        case EntryPoint::Scalef:
+            return "glScalef";
+        case EntryPoint::Scalex:
+            return "glScalex";
+        case EntryPoint::Scissor:
+            return "glScissor";
+        case EntryPoint::SetFenceNV:
+            return "glSetFenceNV";
+        case EntryPoint::ShadeModel:
+            return "glShadeModel";
+        case EntryPoint::ShaderBinary:
+            return "glShaderBinary";
+        case EntryPoint::ShaderSource:
+            return "glShaderSource";
+        case EntryPoint::StencilFillPathCHROMIUM:
+            return "glStencilFillPathCHROMIUM";
+        case EntryPoint::StencilFillPathInstancedCHROMIUM:
+            return "glStencilFillPathInstancedCHROMIUM";
+        case EntryPoint::StencilFunc:
+            return "glStencilFunc";
+        case EntryPoint::StencilFuncSeparate:
+            return "glStencilFuncSeparate";
+        case EntryPoint::StencilMask:
+            return "glStencilMask";
+        case EntryPoint::StencilMaskSeparate:
+            return "glStencilMaskSeparate";
+        case EntryPoint::StencilOp:
+            return "glStencilOp";
+        case EntryPoint::StencilOpSeparate:
+            return "glStencilOpSeparate";
+        case EntryPoint::StencilStrokePathCHROMIUM:
+            return "glStencilStrokePathCHROMIUM";
+        case EntryPoint::StencilStrokePathInstancedCHROMIUM:
+            return "glStencilStrokePathInstancedCHROMIUM";
+        case EntryPoint::StencilThenCoverFillPathCHROMIUM:
+            return "glStencilThenCoverFillPathCHROMIUM";
+        case EntryPoint::StencilThenCoverFillPathInstancedCHROMIUM:
+            return "glStencilThenCoverFillPathInstancedCHROMIUM";
+        case EntryPoint::StencilThenCoverStrokePathCHROMIUM:
+            return "glStencilThenCoverStrokePathCHROMIUM";
+        case EntryPoint::StencilThenCoverStrokePathInstancedCHROMIUM:
+            return "glStencilThenCoverStrokePathInstancedCHROMIUM";
+        case EntryPoint::TestFenceNV:
+            return "glTestFenceNV";
+        case EntryPoint::TexCoordPointer:
+            return "glTexCoordPointer";
+        case EntryPoint::TexEnvf:
+            return "glTexEnvf";
+        case EntryPoint::TexEnvfv:
+            return "glTexEnvfv";
+        case EntryPoint::TexEnvi:
+            return "glTexEnvi";
+        case EntryPoint::TexEnviv:
+            return "glTexEnviv";
+        case EntryPoint::TexEnvx:
+            return "glTexEnvx";
+        case EntryPoint::TexEnvxv:
+            return "glTexEnvxv";
+        case EntryPoint::TexGenfOES:
+            return "glTexGenfOES";
+        case EntryPoint::TexGenfvOES:
+            return "glTexGenfvOES";
+        case EntryPoint::TexGeniOES:
+            return "glTexGeniOES";
+        case EntryPoint::TexGenivOES:
+            return "glTexGenivOES";
+        case EntryPoint::TexGenxOES:
+            return "glTexGenxOES";
+        case EntryPoint::TexGenxvOES:
+            return "glTexGenxvOES";
+        case EntryPoint::TexImage2D:
+            return "glTexImage2D";
+        case EntryPoint::TexImage2DRobustANGLE:
+            return "glTexImage2DRobustANGLE";
+        case EntryPoint::TexImage3D:
+            return "glTexImage3D";
+        case EntryPoint::TexImage3DRobustANGLE:
+            return "glTexImage3DRobustANGLE";
+        case EntryPoint::TexParameterIivRobustANGLE:
+            return "glTexParameterIivRobustANGLE";
+        case EntryPoint::TexParameterIuivRobustANGLE:
+            return "glTexParameterIuivRobustANGLE";
+        case EntryPoint::TexParameterf:
+            return "glTexParameterf";
+        case EntryPoint::TexParameterfv:
+            return "glTexParameterfv";
+        case EntryPoint::TexParameterfvRobustANGLE:
+            return "glTexParameterfvRobustANGLE";
+        case EntryPoint::TexParameteri:
+            return "glTexParameteri";
+        case EntryPoint::TexParameteriv:
+            return "glTexParameteriv";
+        case EntryPoint::TexParameterivRobustANGLE:
+            return "glTexParameterivRobustANGLE";
+        case EntryPoint::TexParameterx:
+            return "glTexParameterx";
+        case EntryPoint::TexParameterxv:
+            return "glTexParameterxv";
+        case EntryPoint::TexStorage1DEXT:
+            return "glTexStorage1DEXT";
+        case EntryPoint::TexStorage2D:
+            return "glTexStorage2D";
+        case EntryPoint::TexStorage2DEXT:
+            return "glTexStorage2DEXT";
+        case EntryPoint::TexStorage2DMultisample:
+            return "glTexStorage2DMultisample";
+        case EntryPoint::TexStorage3D:
+            return "glTexStorage3D";
+        case EntryPoint::TexStorage3DEXT:
+            return "glTexStorage3DEXT";
+        case EntryPoint::TexSubImage2D:
+            return "glTexSubImage2D";
+        case EntryPoint::TexSubImage2DRobustANGLE:
+            return "glTexSubImage2DRobustANGLE";
+        case EntryPoint::TexSubImage3D:
+            return "glTexSubImage3D";
+        case EntryPoint::TexSubImage3DRobustANGLE:
+            return "glTexSubImage3DRobustANGLE";
+        case EntryPoint::TransformFeedbackVaryings:
+            return "glTransformFeedbackVaryings";
+        case EntryPoint::Translatef:
+            return "glTranslatef";
+        case EntryPoint::Translatex:
+            return "glTranslatex";
+        case EntryPoint::Uniform1f:
+            return "glUniform1f";
+        case EntryPoint::Uniform1fv:
+            return "glUniform1fv";
+        case EntryPoint::Uniform1i:
+            return "glUniform1i";
+        case EntryPoint::Uniform1iv:
+            return "glUniform1iv";
+        case EntryPoint::Uniform1ui:
+            return "glUniform1ui";
+        case EntryPoint::Uniform1uiv:
+            return "glUniform1uiv";
+        case EntryPoint::Uniform2f:
+            return "glUniform2f";
+        case EntryPoint::Uniform2fv:
+            return "glUniform2fv";
+        case EntryPoint::Uniform2i:
+            return "glUniform2i";
+        case EntryPoint::Uniform2iv:
+            return "glUniform2iv";
+        case EntryPoint::Uniform2ui:
+            return "glUniform2ui";
+        case EntryPoint::Uniform2uiv:
+            return "glUniform2uiv";
+        case EntryPoint::Uniform3f:
+            return "glUniform3f";
+        case EntryPoint::Uniform3fv:
+            return "glUniform3fv";
+        case EntryPoint::Uniform3i:
+            return "glUniform3i";
+        case EntryPoint::Uniform3iv:
+            return "glUniform3iv";
+        case EntryPoint::Uniform3ui:
+            return "glUniform3ui";
+        case EntryPoint::Uniform3uiv:
+            return "glUniform3uiv";
+        case EntryPoint::Uniform4f:
+            return "glUniform4f";
+        case EntryPoint::Uniform4fv:
+            return "glUniform4fv";
+        case EntryPoint::Uniform4i:
+            return "glUniform4i";
+        case EntryPoint::Uniform4iv:
+            return "glUniform4iv";
+        case EntryPoint::Uniform4ui:
+            return "glUniform4ui";
+        case EntryPoint::Uniform4uiv:
+            return "glUniform4uiv";
+        case EntryPoint::UniformBlockBinding:
+            return "glUniformBlockBinding";
+        case EntryPoint::UniformMatrix2fv:
+            return "glUniformMatrix2fv";
+        case EntryPoint::UniformMatrix2x3fv:
+            return "glUniformMatrix2x3fv";
+        case EntryPoint::UniformMatrix2x4fv:
+            return "glUniformMatrix2x4fv";
+        case EntryPoint::UniformMatrix3fv:
+            return "glUniformMatrix3fv";
+        case EntryPoint::UniformMatrix3x2fv:
+            return "glUniformMatrix3x2fv";
+        case EntryPoint::UniformMatrix3x4fv:
+            return "glUniformMatrix3x4fv";
+        case EntryPoint::UniformMatrix4fv:
+            return "glUniformMatrix4fv";
+        case EntryPoint::UniformMatrix4x2fv:
+            return "glUniformMatrix4x2fv";
+        case EntryPoint::UniformMatrix4x3fv:
+            return "glUniformMatrix4x3fv";
+        case EntryPoint::UnmapBuffer:
+            return "glUnmapBuffer";
+        case EntryPoint::UnmapBufferOES:
+            return "glUnmapBufferOES";
+        case EntryPoint::UseProgram:
+            return "glUseProgram";
+        case EntryPoint::UseProgramStages:
+            return "glUseProgramStages";
+        case EntryPoint::ValidateProgram:
+            return "glValidateProgram";
+        case EntryPoint::ValidateProgramPipeline:
+            return "glValidateProgramPipeline";
+        case EntryPoint::VertexAttrib1f:
+            return "glVertexAttrib1f";
+        case EntryPoint::VertexAttrib1fv:
+            return "glVertexAttrib1fv";
+        case EntryPoint::VertexAttrib2f:
+            return "glVertexAttrib2f";
+        case EntryPoint::VertexAttrib2fv:
+            return "glVertexAttrib2fv";
+        case EntryPoint::VertexAttrib3f:
+            return "glVertexAttrib3f";
+        case EntryPoint::VertexAttrib3fv:
+            return "glVertexAttrib3fv";
+        case EntryPoint::VertexAttrib4f:
+            return "glVertexAttrib4f";
+        case EntryPoint::VertexAttrib4fv:
+            return "glVertexAttrib4fv";
+        case EntryPoint::VertexAttribBinding:
+            return "glVertexAttribBinding";
+        case EntryPoint::VertexAttribDivisor:
+            return "glVertexAttribDivisor";
+        case EntryPoint::VertexAttribDivisorANGLE:
+            return "glVertexAttribDivisorANGLE";
+        case EntryPoint::VertexAttribFormat:
+            return "glVertexAttribFormat";
+        case EntryPoint::VertexAttribI4i:
+            return "glVertexAttribI4i";
+        case EntryPoint::VertexAttribI4iv:
+            return "glVertexAttribI4iv";
+        case EntryPoint::VertexAttribI4ui:
+            return "glVertexAttribI4ui";
+        case EntryPoint::VertexAttribI4uiv:
+            return "glVertexAttribI4uiv";
+        case EntryPoint::VertexAttribIFormat:
+            return "glVertexAttribIFormat";
+        case EntryPoint::VertexAttribIPointer:
+            return "glVertexAttribIPointer";
+        case EntryPoint::VertexAttribPointer:
+            return "glVertexAttribPointer";
+        case EntryPoint::VertexBindingDivisor:
+            return "glVertexBindingDivisor";
+        case EntryPoint::VertexPointer:
+            return "glVertexPointer";
+        case EntryPoint::Viewport:
+            return "glViewport";
+        case EntryPoint::WaitSync:
+            return "glWaitSync";
+        case EntryPoint::WeightPointerOES:
+            return "glWeightPointerOES";
+        default:
+            UNREACHABLE();
+            return "Invalid";
+    }
+}
+}  // namespace gl
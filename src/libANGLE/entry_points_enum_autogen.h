@@ -612,5 +612,7 @@ enum class EntryPoint
     WaitSync,
     WeightPointerOES
 };
+
+const char *GetEntryPointName(EntryPoint ep);
 }  // namespace gl
 #endif  // LIBGLESV2_ENTRY_POINTS_ENUM_AUTOGEN_H_
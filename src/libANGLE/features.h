@@ -52,14 +52,19 @@
 #define ANGLE_PROGRAM_LINK_VALIDATE_UNIFORM_PRECISION ANGLE_ENABLED
 #endif
 
+// Records the GLES calls made through the entry points. See libANGLE/FrameCapture.h.
+#if !defined(ANGLE_CAPTURE_ENABLED)
+#define ANGLE_CAPTURE_ENABLED ANGLE_DISABLED
+#endif
+
+// Measures the CPU time of each entry point call. See libANGLE/CallProfiler.h.
+#if !defined(ANGLE_CALL_PROFILING_ENABLED)
+#define ANGLE_CALL_PROFILING_ENABLED ANGLE_DISABLED
+#endif
+
 // Controls if our threading code uses std::async or falls back to single-threaded operations.
-// TODO(jmadill): Enable on Linux once STL chrono headers are updated.
 #if !defined(ANGLE_STD_ASYNC_WORKERS)
-#if defined(ANGLE_PLATFORM_WINDOWS)
 #define ANGLE_STD_ASYNC_WORKERS ANGLE_ENABLED
-#else
-#define ANGLE_STD_ASYNC_WORKERS ANGLE_DISABLED
-#endif  // defined(ANGLE_PLATFORM_WINDOWS)
 #endif  // !defined(ANGLE_STD_ASYNC_WORKERS)
 
 #endif // LIBANGLE_FEATURES_H_
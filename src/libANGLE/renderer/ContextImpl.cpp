@@ -21,6 +21,13 @@ ContextImpl::~ContextImpl()
 {
 }
 
+gl::State::DirtyBits ContextImpl::getDirtyBitsOnMakeCurrent() const
+{
+    gl::State::DirtyBits dirtyBits;
+    dirtyBits.set();
+    return dirtyBits;
+}
+
 void ContextImpl::stencilFillPath(const gl::Path *path, GLenum fillMode, GLuint mask)
 {
     UNREACHABLE();
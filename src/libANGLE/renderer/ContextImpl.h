@@ -149,6 +149,10 @@ class ContextImpl : public GLImplFactory
     // Context switching
     virtual void onMakeCurrent(const gl::Context *context) = 0;
 
+    // State that needs to be synced again after onMakeCurrent. Back-ends that know which native
+    // state other contexts have changed can return less than all of it.
+    virtual gl::State::DirtyBits getDirtyBitsOnMakeCurrent() const;
+
     // Native capabilities, unmodified by gl::Context.
     virtual const gl::Caps &getNativeCaps() const                  = 0;
     virtual const gl::TextureCapsMap &getNativeTextureCaps() const = 0;
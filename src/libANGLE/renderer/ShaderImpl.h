@@ -32,8 +32,20 @@ class ShaderImpl : angle::NonCopyable
                                       gl::Compiler *compiler,
                                       std::string *infoLog) = 0;
 
+    // Called the first time the application queries the compile status or info log of a shader
+    // that compiled successfully. Returns the result of work postTranslateCompile didn't wait for,
+    // appending any errors to |infoLog|.
+    virtual bool checkDeferredCompileStatus(const gl::Context *context, std::string *infoLog)
+    {
+        return true;
+    }
+
     virtual std::string getDebugInfo(const gl::Context *context) const = 0;
 
+    // Returns true if postTranslateCompile doesn't query the compiler. The translation can then
+    // run on a worker thread, while the compiler is used to translate other shaders.
+    virtual bool canTranslateOnWorkerThread() const { return true; }
+
     const gl::ShaderState &getData() const { return mData; }
 
   protected:
@@ -58,4 +58,17 @@ gl::Error TextureImpl::copyCompressedTexture(const gl::Context *context, const g
     return gl::InternalError() << "CHROMIUM_copy_compressed_texture exposed but not implemented.";
 }
 
+bool TextureImpl::supportsSubImageInitialization(const gl::ImageIndex &index) const
+{
+    return false;
+}
+
+gl::Error TextureImpl::initializeSubImageContents(const gl::Context *context,
+                                                  const gl::ImageIndex &index,
+                                                  const gl::Box &area)
+{
+    UNREACHABLE();
+    return gl::InternalError() << "Partial robust resource init not implemented.";
+}
+
 }  // namespace rx
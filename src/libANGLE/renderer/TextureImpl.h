@@ -143,6 +143,13 @@ class TextureImpl : public FramebufferAttachmentObjectImpl
     virtual gl::Error syncState(const gl::Context *context,
                                 const gl::Texture::DirtyBits &dirtyBits) = 0;
 
+    // Robust resource init of part of an image. Images that don't support it are initialized
+    // entirely before their first partial update.
+    virtual bool supportsSubImageInitialization(const gl::ImageIndex &index) const;
+    virtual gl::Error initializeSubImageContents(const gl::Context *context,
+                                                 const gl::ImageIndex &index,
+                                                 const gl::Box &area);
+
   protected:
     const gl::TextureState &mState;
 };
@@ -174,6 +174,12 @@ const std::map<std::string, unsigned int> &GetUniformRegisterMap(
     return *uniformRegisterMap;
 }
 
+bool ShaderD3D::canTranslateOnWorkerThread() const
+{
+    // postTranslateCompile reads the register assignments from the compiler.
+    return false;
+}
+
 bool ShaderD3D::postTranslateCompile(const gl::Context *context,
                                      gl::Compiler *compiler,
                                      std::string *infoLog)
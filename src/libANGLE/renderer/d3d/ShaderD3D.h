@@ -42,6 +42,7 @@ class ShaderD3D : public ShaderImpl
     ShCompileOptions prepareSourceAndReturnOptions(const gl::Context *context,
                                                    std::stringstream *sourceStream,
                                                    std::string *sourcePath) override;
+    bool canTranslateOnWorkerThread() const override;
     bool postTranslateCompile(const gl::Context *context,
                               gl::Compiler *compiler,
                               std::string *infoLog) override;
@@ -279,7 +279,7 @@ gl::Error BlitGL::copySubImageToLUMAWorkaroundTexture(const gl::Context *context
     ANGLE_TRY(initializeResources());
 
     BlitProgram *blitProgram = nullptr;
-    ANGLE_TRY(getBlitProgram(BlitProgramType::FLOAT_TO_FLOAT, &blitProgram));
+    ANGLE_TRY(getBlitProgram(BlitProgramType::FLOAT_TO_FLOAT, GL_NONE, &blitProgram));
 
     // Blit the framebuffer to the first scratch texture
     const FramebufferGL *sourceFramebufferGL = GetImplAs<FramebufferGL>(source);
@@ -368,7 +368,7 @@ gl::Error BlitGL::blitColorBufferWithShader(const gl::Framebuffer *source,
     ANGLE_TRY(initializeResources());
 
     BlitProgram *blitProgram = nullptr;
-    ANGLE_TRY(getBlitProgram(BlitProgramType::FLOAT_TO_FLOAT, &blitProgram));
+    ANGLE_TRY(getBlitProgram(BlitProgramType::FLOAT_TO_FLOAT, GL_NONE, &blitProgram));
 
     // We'll keep things simple by removing reversed coordinates from the rectangles. In the end
     // we'll apply the reversal to the source texture coordinates if needed. The destination
@@ -481,11 +481,23 @@ gl::ErrorOrResult<bool> BlitGL::copySubTexture(const gl::Context *context,
                                                const gl::Offset &destOffset,
                                                bool needsLumaWorkaround,
                                                GLenum lumaFormat,
+                                               GLenum destLumaFormat,
+                                               bool destSRGB,
                                                bool unpackFlipY,
                                                bool unpackPremultiplyAlpha,
                                                bool unpackUnmultiplyAlpha)
 {
     ASSERT(source->getType() == gl::TextureType::_2D);
+
+    // The destination receives the sampled values without sRGB encoding. Desktop GL only encodes
+    // when GL_FRAMEBUFFER_SRGB is enabled but GLES always does unless EXT_sRGB_write_control can
+    // disable it.
+    if (destSRGB && mFunctions->standard == STANDARD_GL_ES &&
+        !context->getExtensions().sRGBWriteControl)
+    {
+        return false;
+    }
+
     ANGLE_TRY(initializeResources());
 
     // Make sure the destination texture can be rendered to before setting anything else up.  Some
@@ -501,7 +513,7 @@ gl::ErrorOrResult<bool> BlitGL::copySubTexture(const gl::Context *context,
 
     BlitProgramType blitProgramType = getBlitProgramType(sourceComponentType, destComponentType);
     BlitProgram *blitProgram        = nullptr;
-    ANGLE_TRY(getBlitProgram(blitProgramType, &blitProgram));
+    ANGLE_TRY(getBlitProgram(blitProgramType, destLumaFormat, &blitProgram));
 
     // Setup the source texture
     if (needsLumaWorkaround)
@@ -535,6 +547,11 @@ gl::ErrorOrResult<bool> BlitGL::copySubTexture(const gl::Context *context,
         gl::Rectangle(destOffset.x, destOffset.y, sourceArea.width, sourceArea.height));
     scopedState.willUseTextureUnit(0);
 
+    if (destSRGB)
+    {
+        mStateManager->setFramebufferSRGBEnabled(context, false);
+    }
+
     mStateManager->activeTexture(0);
     mStateManager->bindTexture(gl::TextureType::_2D, source->getTextureID());
 
@@ -620,10 +637,10 @@ gl::Error BlitGL::copySubTextureCPUReadback(const gl::Context *context,
         readFunction     = angle::ReadColor<angle::R8G8B8A8, GLfloat>;
     }
 
-    gl::PixelUnpackState unpack;
-    unpack.alignment = 1;
-    mStateManager->setPixelUnpackState(unpack);
-    mStateManager->setPixelUnpackBuffer(nullptr);
+    gl::PixelPackState pack;
+    pack.alignment = 1;
+    mStateManager->setPixelPackState(pack);
+    mStateManager->setPixelPackBuffer(nullptr);
     mFunctions->readPixels(sourceArea.x, sourceArea.y, sourceArea.width, sourceArea.height,
                            readPixelsFormat, GL_UNSIGNED_BYTE, sourceMemory);
 
@@ -637,10 +654,10 @@ gl::Error BlitGL::copySubTextureCPUReadback(const gl::Context *context,
         destInternalFormatInfo.componentType, sourceArea.width, sourceArea.height, unpackFlipY,
         unpackPremultiplyAlpha, unpackUnmultiplyAlpha);
 
-    gl::PixelPackState pack;
-    pack.alignment = 1;
-    mStateManager->setPixelPackState(pack);
-    mStateManager->setPixelPackBuffer(nullptr);
+    gl::PixelUnpackState unpack;
+    unpack.alignment = 1;
+    mStateManager->setPixelUnpackState(unpack);
+    mStateManager->setPixelUnpackBuffer(nullptr);
 
     nativegl::TexSubImageFormat texSubImageFormat =
         nativegl::GetTexSubImageFormat(mFunctions, mWorkarounds, destFormat, destType);
@@ -914,9 +931,11 @@ BlitGL::BlitProgramType BlitGL::getBlitProgramType(GLenum sourceComponentType,
     }
 }
 
-gl::Error BlitGL::getBlitProgram(BlitProgramType type, BlitProgram **program)
+gl::Error BlitGL::getBlitProgram(BlitProgramType type,
+                                 GLenum destLumaFormat,
+                                 BlitProgram **program)
 {
-    BlitProgram &result = mBlitPrograms[type];
+    BlitProgram &result = mBlitPrograms[BlitProgramKey(type, destLumaFormat)];
     if (result.program == 0)
     {
         result.program = mFunctions->createProgram();
@@ -1062,18 +1081,36 @@ gl::Error BlitGL::getBlitProgram(BlitProgramType type, BlitProgram **program)
             fsSourceStream << "    " << samplerResultType << " color = " << sampleFunction
                            << "(u_source_texture, v_texcoord);\n";
 
-            // Perform the premultiply or unmultiply alpha logic
-            fsSourceStream << "    if (u_multiply_alpha)\n";
-            fsSourceStream << "    {\n";
-            fsSourceStream << "        color.xyz = color.xyz * color.a;\n";
-            fsSourceStream << "    }\n";
-            fsSourceStream << "    if (u_unmultiply_alpha && color.a != 0.0)\n";
-            fsSourceStream << "    {\n";
-            fsSourceStream << "         color.xyz = color.xyz / color.a;\n";
-            fsSourceStream << "    }\n";
+            // Perform the premultiply or unmultiply alpha logic. Integer sources are copied
+            // unchanged, alpha is not normalized for them.
+            if (type != BlitProgramType::UINT_TO_UINT)
+            {
+                fsSourceStream << "    if (u_multiply_alpha)\n";
+                fsSourceStream << "    {\n";
+                fsSourceStream << "        color.xyz = color.xyz * color.a;\n";
+                fsSourceStream << "    }\n";
+                fsSourceStream << "    if (u_unmultiply_alpha && color.a != 0.0)\n";
+                fsSourceStream << "    {\n";
+                fsSourceStream << "         color.xyz = color.xyz / color.a;\n";
+                fsSourceStream << "    }\n";
+
+                // Write the conversion to the destionation type
+                fsSourceStream << "    color = color * " << outputMultiplier << ";\n";
+            }
 
-            // Write the conversion to the destionation type
-            fsSourceStream << "    color = color * " << outputMultiplier << ";\n";
+            // Move the alpha channel to where the luma workaround of the destination stores it
+            if (destLumaFormat == GL_ALPHA)
+            {
+                fsSourceStream << "    color.r = color.a;\n";
+            }
+            else if (destLumaFormat == GL_LUMINANCE_ALPHA)
+            {
+                fsSourceStream << "    color.g = color.a;\n";
+            }
+            else
+            {
+                ASSERT(destLumaFormat == GL_NONE || destLumaFormat == GL_LUMINANCE);
+            }
 
             // Write the output assignment code
             fsSourceStream << "    " << outputVariableName << " = " << outputType << "(color);\n";
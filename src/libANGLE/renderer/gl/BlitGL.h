@@ -79,6 +79,8 @@ class BlitGL : angle::NonCopyable
                                            const gl::Offset &destOffset,
                                            bool needsLumaWorkaround,
                                            GLenum lumaFormat,
+                                           GLenum destLumaFormat,
+                                           bool destSRGB,
                                            bool unpackFlipY,
                                            bool unpackPremultiplyAlpha,
                                            bool unpackUnmultiplyAlpha);
@@ -142,10 +144,15 @@ class BlitGL : angle::NonCopyable
         UINT_TO_UINT,
     };
 
+    // Programs are also keyed by the luma format of the destination, or GL_NONE. Luminance and
+    // alpha destinations emulated with red or red-green textures need the output channels moved
+    // to where the workaround stores them.
+    using BlitProgramKey = std::pair<BlitProgramType, GLenum>;
+
     static BlitProgramType getBlitProgramType(GLenum sourceComponentType, GLenum destComponentType);
-    gl::Error getBlitProgram(BlitProgramType type, BlitProgram **program);
+    gl::Error getBlitProgram(BlitProgramType type, GLenum destLumaFormat, BlitProgram **program);
 
-    std::map<BlitProgramType, BlitProgram> mBlitPrograms;
+    std::map<BlitProgramKey, BlitProgram> mBlitPrograms;
 
     GLuint mScratchTextures[2];
     GLuint mScratchFBO;
@@ -10,6 +10,8 @@
 
 #include "common/debug.h"
 #include "common/utilities.h"
+#include "libANGLE/Buffer.h"
+#include "libANGLE/Context.h"
 #include "libANGLE/angletypes.h"
 #include "libANGLE/formatutils.h"
 #include "libANGLE/renderer/gl/FunctionsGL.h"
@@ -36,7 +38,8 @@ BufferGL::BufferGL(const gl::BufferState &state,
       mIsMapped(false),
       mMapOffset(0),
       mMapSize(0),
-      mShadowBufferData(!CanMapBufferForRead(functions)),
+      mCanMapForRead(CanMapBufferForRead(functions)),
+      mShadowBufferData(!mCanMapForRead),
       mShadowCopy(),
       mBufferSize(0),
       mFunctions(functions),
@@ -55,7 +58,7 @@ BufferGL::~BufferGL()
     mBufferID = 0;
 }
 
-gl::Error BufferGL::setData(const gl::Context * /*context*/,
+gl::Error BufferGL::setData(const gl::Context *context,
                             gl::BufferBinding /*target*/,
                             const void *data,
                             size_t size,
@@ -64,6 +67,12 @@ gl::Error BufferGL::setData(const gl::Context * /*context*/,
     mStateManager->bindBuffer(DestBufferOperationTarget, mBufferID);
     mFunctions->bufferData(gl::ToGLenum(DestBufferOperationTarget), size, data, ToGLenum(usage));
 
+    mShadowBufferData = needsShadowCopy(context);
+    if (!mShadowBufferData && !mShadowCopy.empty())
+    {
+        mShadowCopy = angle::MemoryBuffer();
+    }
+
     if (mShadowBufferData)
     {
         if (!mShadowCopy.resize(size))
@@ -211,6 +220,7 @@ gl::Error BufferGL::getIndexRange(const gl::Context *context,
     }
     else
     {
+        ASSERT(mCanMapForRead);
         mStateManager->bindBuffer(DestBufferOperationTarget, mBufferID);
 
         const gl::Type &typeInfo  = gl::GetTypeInfo(type);
@@ -228,4 +238,24 @@ GLuint BufferGL::getBufferID() const
 {
     return mBufferID;
 }
+
+bool BufferGL::needsShadowCopy(const gl::Context *context) const
+{
+    if (mCanMapForRead)
+    {
+        return false;
+    }
+
+    // WebGL doesn't allow buffers holding vertex or other data to be used as index buffers, so
+    // these buffers never need to be read back. Large static vertex buffers are the common case
+    // and would otherwise take twice their size in memory. If they are mapped, the write-only
+    // native mapping preserves the rest of their contents.
+    if (context->getExtensions().webglCompatibility &&
+        mState.getWebGLType() == gl::WebGLBufferType::OtherData)
+    {
+        return false;
+    }
+
+    return true;
+}
 }
@@ -59,10 +59,16 @@ class BufferGL : public BufferImpl
     GLuint getBufferID() const;
 
   private:
+    bool needsShadowCopy(const gl::Context *context) const;
+
     bool mIsMapped;
     size_t mMapOffset;
     size_t mMapSize;
 
+    // Drivers that can't map buffers for reading need a shadow copy of the buffer data to compute
+    // index ranges, and mapping then returns the shadow copy. needsShadowCopy skips it for WebGL
+    // buffers that can never be bound as index buffers.
+    const bool mCanMapForRead;
     bool mShadowBufferData;
     angle::MemoryBuffer mShadowCopy;
 
@@ -12,10 +12,32 @@
 #include "libANGLE/renderer/gl/StateManagerGL.h"
 #include "libANGLE/renderer/gl/TextureGL.h"
 
+#include "common/mathutil.h"
 #include "libANGLE/Framebuffer.h"
+#include "libANGLE/State.h"
+#include "libANGLE/formatutils.h"
 
 namespace rx
 {
+namespace
+{
+struct ClearTextureCommand
+{
+    const gl::FramebufferAttachment *attachment;
+    GLenum format;
+    GLenum type;
+    const void *data;
+};
+
+bool CanClearColorAttachmentAsTexture(const gl::FramebufferAttachment *attachment, bool isInteger)
+{
+    // Clears of sRGB attachments encode the clear color, while texture clears don't.
+    const gl::InternalFormat &format = *attachment->getFormat().info;
+    bool attachmentIsInteger =
+        (format.componentType == GL_INT || format.componentType == GL_UNSIGNED_INT);
+    return attachmentIsInteger == isInteger && format.colorEncoding != GL_SRGB;
+}
+}  // anonymous namespace
 
 ClearMultiviewGL::ClearMultiviewGL(const FunctionsGL *functions, StateManagerGL *stateManager)
     : mFunctions(functions), mStateManager(stateManager), mFramebuffer(0u)
@@ -30,8 +52,8 @@ ClearMultiviewGL::~ClearMultiviewGL()
     }
 }
 
-void ClearMultiviewGL::clearMultiviewFBO(const gl::FramebufferState &state,
-                                         const gl::Rectangle &scissorBase,
+void ClearMultiviewGL::clearMultiviewFBO(const gl::State &glState,
+                                         const gl::FramebufferState &state,
                                          ClearCommandType clearCommandType,
                                          GLbitfield mask,
                                          GLenum buffer,
@@ -44,19 +66,20 @@ void ClearMultiviewGL::clearMultiviewFBO(const gl::FramebufferState &state,
     switch (firstAttachment->getMultiviewLayout())
     {
         case GL_FRAMEBUFFER_MULTIVIEW_LAYERED_ANGLE:
-            clearLayeredFBO(state, clearCommandType, mask, buffer, drawbuffer, values, depth,
-                            stencil);
+            clearLayeredFBO(glState, state, clearCommandType, mask, buffer, drawbuffer, values,
+                            depth, stencil);
             break;
         case GL_FRAMEBUFFER_MULTIVIEW_SIDE_BY_SIDE_ANGLE:
-            clearSideBySideFBO(state, scissorBase, clearCommandType, mask, buffer, drawbuffer,
-                               values, depth, stencil);
+            clearSideBySideFBO(state, glState.getScissor(), clearCommandType, mask, buffer,
+                               drawbuffer, values, depth, stencil);
             break;
         default:
             UNREACHABLE();
     }
 }
 
-void ClearMultiviewGL::clearLayeredFBO(const gl::FramebufferState &state,
+void ClearMultiviewGL::clearLayeredFBO(const gl::State &glState,
+                                       const gl::FramebufferState &state,
                                        ClearCommandType clearCommandType,
                                        GLbitfield mask,
                                        GLenum buffer,
@@ -65,6 +88,12 @@ void ClearMultiviewGL::clearLayeredFBO(const gl::FramebufferState &state,
                                        GLfloat depth,
                                        GLint stencil)
 {
+    if (clearLayeredFBOWithClearTexture(glState, state, clearCommandType, mask, buffer,
+                                        drawbuffer, values, depth))
+    {
+        return;
+    }
+
     initializeResources();
 
     mStateManager->bindFramebuffer(GL_DRAW_FRAMEBUFFER, mFramebuffer);
@@ -87,6 +116,140 @@ void ClearMultiviewGL::clearLayeredFBO(const gl::FramebufferState &state,
     detachTextures(state);
 }
 
+bool ClearMultiviewGL::clearLayeredFBOWithClearTexture(const gl::State &glState,
+                                                       const gl::FramebufferState &state,
+                                                       ClearCommandType clearCommandType,
+                                                       GLbitfield mask,
+                                                       GLenum buffer,
+                                                       GLint drawbuffer,
+                                                       const uint8_t *values,
+                                                       GLfloat depth)
+{
+    if (mFunctions->clearTexSubImage == nullptr)
+    {
+        return false;
+    }
+
+    // Texture clears skip the per-fragment operations, which must not affect the clear.
+    if (glState.isScissorTestEnabled() || glState.isRasterizerDiscardEnabled())
+    {
+        return false;
+    }
+
+    const gl::BlendState &blendState = glState.getBlendState();
+    bool colorMaskEnabled = blendState.colorMaskRed && blendState.colorMaskGreen &&
+                            blendState.colorMaskBlue && blendState.colorMaskAlpha;
+
+    bool clearColor       = false;
+    bool clearDepth       = false;
+    bool clearStencil     = false;
+    GLenum colorFormat    = GL_RGBA;
+    GLenum colorType      = GL_FLOAT;
+    const void *colorData = nullptr;
+    GLfloat depthValue    = 0.0f;
+    switch (clearCommandType)
+    {
+        case ClearCommandType::Clear:
+            clearColor   = (mask & GL_COLOR_BUFFER_BIT) != 0;
+            clearDepth   = (mask & GL_DEPTH_BUFFER_BIT) != 0;
+            clearStencil = (mask & GL_STENCIL_BUFFER_BIT) != 0;
+            colorData    = &glState.getColorClearValue().red;
+            depthValue   = glState.getDepthClearValue();
+            break;
+        case ClearCommandType::ClearBufferfv:
+            clearColor = (buffer == GL_COLOR);
+            clearDepth = (buffer == GL_DEPTH);
+            colorData  = values;
+            depthValue = gl::clamp01(*reinterpret_cast<const GLfloat *>(values));
+            break;
+        case ClearCommandType::ClearBufferuiv:
+            clearColor  = true;
+            colorFormat = GL_RGBA_INTEGER;
+            colorType   = GL_UNSIGNED_INT;
+            colorData   = values;
+            break;
+        case ClearCommandType::ClearBufferiv:
+            clearColor   = (buffer == GL_COLOR);
+            clearStencil = (buffer == GL_STENCIL);
+            colorFormat  = GL_RGBA_INTEGER;
+            colorType    = GL_INT;
+            colorData    = values;
+            break;
+        case ClearCommandType::ClearBufferfi:
+            clearDepth   = true;
+            clearStencil = true;
+            depthValue   = gl::clamp01(depth);
+            break;
+        default:
+            UNREACHABLE();
+    }
+
+    std::vector<ClearTextureCommand> commands;
+
+    if (clearColor)
+    {
+        if (!colorMaskEnabled)
+        {
+            return false;
+        }
+
+        bool isInteger = (colorFormat == GL_RGBA_INTEGER);
+        for (size_t drawBufferIndex : state.getEnabledDrawBuffers())
+        {
+            if (clearCommandType != ClearCommandType::Clear &&
+                drawBufferIndex != static_cast<size_t>(drawbuffer))
+            {
+                continue;
+            }
+
+            const gl::FramebufferAttachment *attachment = state.getColorAttachment(drawBufferIndex);
+            if (attachment == nullptr)
+            {
+                continue;
+            }
+
+            if (!CanClearColorAttachmentAsTexture(attachment, isInteger))
+            {
+                return false;
+            }
+            commands.push_back({attachment, colorFormat, colorType, colorData});
+        }
+    }
+
+    if (clearStencil && state.getStencilAttachment() != nullptr)
+    {
+        // Stencil write masks and combined depth stencil textures would need special handling.
+        return false;
+    }
+
+    const gl::FramebufferAttachment *depthAttachment = state.getDepthAttachment();
+    if (clearDepth && depthAttachment != nullptr)
+    {
+        // Only the depth of combined depth stencil textures can't be cleared on its own.
+        if (!glState.getDepthStencilState().depthMask ||
+            depthAttachment->getFormat().info->stencilBits > 0)
+        {
+            return false;
+        }
+        commands.push_back({depthAttachment, GL_DEPTH_COMPONENT, GL_FLOAT, &depthValue});
+    }
+
+    for (const ClearTextureCommand &command : commands)
+    {
+        const gl::FramebufferAttachment *attachment = command.attachment;
+        ASSERT(attachment->getMultiviewLayout() == GL_FRAMEBUFFER_MULTIVIEW_LAYERED_ANGLE);
+
+        const TextureGL *textureGL = GetImplAs<TextureGL>(attachment->getTexture());
+        const gl::Extents &size    = attachment->getSize();
+        mFunctions->clearTexSubImage(textureGL->getTextureID(), attachment->mipLevel(), 0, 0,
+                                     attachment->getBaseViewIndex(), size.width, size.height,
+                                     attachment->getNumViews(), command.format, command.type,
+                                     command.data);
+    }
+
+    return true;
+}
+
 void ClearMultiviewGL::clearSideBySideFBO(const gl::FramebufferState &state,
                                           const gl::Rectangle &scissorBase,
                                           ClearCommandType clearCommandType,
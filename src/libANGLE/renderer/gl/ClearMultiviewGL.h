@@ -17,6 +17,7 @@
 namespace gl
 {
 class FramebufferState;
+class State;
 }  // namespace gl
 
 namespace rx
@@ -46,8 +47,8 @@ class ClearMultiviewGL : angle::NonCopyable
     ClearMultiviewGL(ClearMultiviewGL &&rht)                 = delete;
     ClearMultiviewGL &operator=(ClearMultiviewGL &&rht) = delete;
 
-    void clearMultiviewFBO(const gl::FramebufferState &state,
-                           const gl::Rectangle &scissorBase,
+    void clearMultiviewFBO(const gl::State &glState,
+                           const gl::FramebufferState &state,
                            ClearCommandType clearCommandType,
                            GLbitfield mask,
                            GLenum buffer,
@@ -60,7 +61,8 @@ class ClearMultiviewGL : angle::NonCopyable
   private:
     void attachTextures(const gl::FramebufferState &state, int layer);
     void detachTextures(const gl::FramebufferState &state);
-    void clearLayeredFBO(const gl::FramebufferState &state,
+    void clearLayeredFBO(const gl::State &glState,
+                         const gl::FramebufferState &state,
                          ClearCommandType clearCommandType,
                          GLbitfield mask,
                          GLenum buffer,
@@ -68,6 +70,16 @@ class ClearMultiviewGL : angle::NonCopyable
                          const uint8_t *values,
                          GLfloat depth,
                          GLint stencil);
+    // Clears the active layers of every attachment with a single glClearTexSubImage call each.
+    // Returns false without clearing anything if the result could differ from a regular clear.
+    bool clearLayeredFBOWithClearTexture(const gl::State &glState,
+                                         const gl::FramebufferState &state,
+                                         ClearCommandType clearCommandType,
+                                         GLbitfield mask,
+                                         GLenum buffer,
+                                         GLint drawbuffer,
+                                         const uint8_t *values,
+                                         GLfloat depth);
     void clearSideBySideFBO(const gl::FramebufferState &state,
                             const gl::Rectangle &scissorBase,
                             ClearCommandType clearCommandType,
@@ -40,6 +40,11 @@ ContextGL::~ContextGL()
 {
 }
 
+void ContextGL::onDestroy(const gl::Context *context)
+{
+    mRenderer->getStateManager()->onContextDestroyed(context);
+}
+
 gl::Error ContextGL::initialize()
 {
     return gl::NoError();
@@ -99,7 +104,8 @@ BufferImpl *ContextGL::createBuffer(const gl::BufferState &state)
 
 VertexArrayImpl *ContextGL::createVertexArray(const gl::VertexArrayState &data)
 {
-    return new VertexArrayGL(data, getFunctions(), getStateManager());
+    return new VertexArrayGL(data, getFunctions(), getStateManager(),
+                             mRenderer->getStreamingBuffer());
 }
 
 QueryImpl *ContextGL::createQuery(gl::QueryType type)
@@ -383,6 +389,11 @@ void ContextGL::onMakeCurrent(const gl::Context *context)
     ANGLE_SWALLOW_ERR(mRenderer->getStateManager()->onMakeCurrent(context));
 }
 
+gl::State::DirtyBits ContextGL::getDirtyBitsOnMakeCurrent() const
+{
+    return mRenderer->getStateManager()->getDirtyBitsOnMakeCurrent();
+}
+
 const gl::Caps &ContextGL::getNativeCaps() const
 {
     return mRenderer->getNativeCaps();
@@ -433,6 +444,11 @@ ClearMultiviewGL *ContextGL::getMultiviewClearer() const
     return mRenderer->getMultiviewClearer();
 }
 
+GLuint ContextGL::getPixelUnpackStagingBuffer() const
+{
+    return mRenderer->getPixelUnpackStagingBuffer();
+}
+
 gl::Error ContextGL::dispatchCompute(const gl::Context *context,
                                      GLuint numGroupsX,
                                      GLuint numGroupsY,
@@ -32,6 +32,8 @@ class ContextGL : public ContextImpl
     ContextGL(const gl::ContextState &state, RendererGL *renderer);
     ~ContextGL() override;
 
+    void onDestroy(const gl::Context *context) override;
+
     gl::Error initialize() override;
 
     // Shader creation
@@ -182,6 +184,7 @@ class ContextGL : public ContextImpl
 
     // Context switching
     void onMakeCurrent(const gl::Context *context) override;
+    gl::State::DirtyBits getDirtyBitsOnMakeCurrent() const override;
 
     // Caps queries
     const gl::Caps &getNativeCaps() const override;
@@ -197,6 +200,7 @@ class ContextGL : public ContextImpl
     const WorkaroundsGL &getWorkaroundsGL() const;
     BlitGL *getBlitter() const;
     ClearMultiviewGL *getMultiviewClearer() const;
+    GLuint getPixelUnpackStagingBuffer() const;
 
     gl::Error dispatchCompute(const gl::Context *context,
                               GLuint numGroupsX,
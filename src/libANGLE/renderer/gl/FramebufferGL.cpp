@@ -281,7 +281,7 @@ Error FramebufferGL::clear(const gl::Context *context, GLbitfield mask)
     else
     {
         ClearMultiviewGL *multiviewClearer = GetMultiviewClearer(context);
-        multiviewClearer->clearMultiviewFBO(mState, context->getGLState().getScissor(),
+        multiviewClearer->clearMultiviewFBO(context->getGLState(), mState,
                                             ClearMultiviewGL::ClearCommandType::Clear, mask,
                                             GL_NONE, 0, nullptr, 0.0f, 0);
     }
@@ -307,7 +307,7 @@ Error FramebufferGL::clearBufferfv(const gl::Context *context,
     else
     {
         ClearMultiviewGL *multiviewClearer = GetMultiviewClearer(context);
-        multiviewClearer->clearMultiviewFBO(mState, context->getGLState().getScissor(),
+        multiviewClearer->clearMultiviewFBO(context->getGLState(), mState,
                                             ClearMultiviewGL::ClearCommandType::ClearBufferfv,
                                             static_cast<GLbitfield>(0u), buffer, drawbuffer,
                                             reinterpret_cast<const uint8_t *>(values), 0.0f, 0);
@@ -334,7 +334,7 @@ Error FramebufferGL::clearBufferuiv(const gl::Context *context,
     else
     {
         ClearMultiviewGL *multiviewClearer = GetMultiviewClearer(context);
-        multiviewClearer->clearMultiviewFBO(mState, context->getGLState().getScissor(),
+        multiviewClearer->clearMultiviewFBO(context->getGLState(), mState,
                                             ClearMultiviewGL::ClearCommandType::ClearBufferuiv,
                                             static_cast<GLbitfield>(0u), buffer, drawbuffer,
                                             reinterpret_cast<const uint8_t *>(values), 0.0f, 0);
@@ -361,7 +361,7 @@ Error FramebufferGL::clearBufferiv(const gl::Context *context,
     else
     {
         ClearMultiviewGL *multiviewClearer = GetMultiviewClearer(context);
-        multiviewClearer->clearMultiviewFBO(mState, context->getGLState().getScissor(),
+        multiviewClearer->clearMultiviewFBO(context->getGLState(), mState,
                                             ClearMultiviewGL::ClearCommandType::ClearBufferiv,
                                             static_cast<GLbitfield>(0u), buffer, drawbuffer,
                                             reinterpret_cast<const uint8_t *>(values), 0.0f, 0);
@@ -389,7 +389,7 @@ Error FramebufferGL::clearBufferfi(const gl::Context *context,
     else
     {
         ClearMultiviewGL *multiviewClearer = GetMultiviewClearer(context);
-        multiviewClearer->clearMultiviewFBO(mState, context->getGLState().getScissor(),
+        multiviewClearer->clearMultiviewFBO(context->getGLState(), mState,
                                             ClearMultiviewGL::ClearCommandType::ClearBufferfi,
                                             static_cast<GLbitfield>(0u), buffer, drawbuffer,
                                             nullptr, depth, stencil);
@@ -26,6 +26,29 @@
 
 namespace rx
 {
+namespace
+{
+std::string GetDriverVersionString(const FunctionsGL *functions)
+{
+    std::ostringstream stream;
+    stream << reinterpret_cast<const char *>(functions->getString(GL_VENDOR)) << " "
+           << reinterpret_cast<const char *>(functions->getString(GL_RENDERER)) << " "
+           << reinterpret_cast<const char *>(functions->getString(GL_VERSION));
+    return stream.str();
+}
+
+bool SupportsBinaryRetrievableHint(const FunctionsGL *functions)
+{
+    // GL_PROGRAM_BINARY_RETRIEVABLE_HINT comes with GL_ARB_get_program_binary and ES 3.0.
+    // GL_OES_get_program_binary doesn't define it, and ES 2.0 drivers that expose
+    // glProgramParameteri through GL_EXT_separate_shader_objects only accept
+    // GL_PROGRAM_SEPARABLE.
+    return functions->programParameteri != nullptr &&
+           (functions->isAtLeastGL(gl::Version(4, 1)) ||
+            functions->hasGLExtension("GL_ARB_get_program_binary") ||
+            functions->isAtLeastGLES(gl::Version(3, 0)));
+}
+}  // anonymous namespace
 
 ProgramGL::ProgramGL(const gl::ProgramState &data,
                      const FunctionsGL *functions,
@@ -58,11 +81,26 @@ gl::LinkResult ProgramGL::load(const gl::Context *context,
 {
     preLink();
 
+    // Native binaries can't be loaded by a different driver, or even by another version of the
+    // same driver. Reject them before they reach glProgramBinary, which some drivers don't handle
+    // gracefully.
+    std::string driverVersion = stream->readString();
+    if (driverVersion != GetDriverVersionString(mFunctions))
+    {
+        infoLog << "Program binary was created by a different native driver.";
+        return false;
+    }
+
     // Read the binary format, size and blob
     GLenum binaryFormat   = stream->readInt<GLenum>();
     GLint binaryLength    = stream->readInt<GLint>();
     const uint8_t *binary = stream->data() + stream->offset();
     stream->skip(binaryLength);
+    if (stream->error() || binaryLength == 0)
+    {
+        infoLog << "Invalid program binary.";
+        return false;
+    }
 
     // Load the binary
     mFunctions->programBinary(mProgramID, binaryFormat, binary, binaryLength);
@@ -89,6 +127,7 @@ void ProgramGL::save(const gl::Context *context, gl::BinaryOutputStream *stream)
     mFunctions->getProgramBinary(mProgramID, binaryLength, &binaryLength, &binaryFormat,
                                  binary.data());
 
+    stream->writeString(GetDriverVersionString(mFunctions));
     stream->writeInt(binaryFormat);
     stream->writeInt(binaryLength);
     stream->writeBytes(binary.data(), binaryLength);
@@ -112,8 +151,7 @@ void ProgramGL::reapplyUBOBindingsIfNeeded(const gl::Context *context)
 
 void ProgramGL::setBinaryRetrievableHint(bool retrievable)
 {
-    // glProgramParameteri isn't always available on ES backends.
-    if (mFunctions->programParameteri)
+    if (SupportsBinaryRetrievableHint(mFunctions))
     {
         mFunctions->programParameteri(mProgramID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT,
                                       retrievable ? GL_TRUE : GL_FALSE);
@@ -131,10 +169,18 @@ gl::LinkResult ProgramGL::link(const gl::Context *context,
 {
     preLink();
 
+    // Successfully linked programs are saved to the program cache. Some drivers only return usable
+    // binaries if they were asked to before linking.
+    if (context->getMemoryProgramCache() != nullptr && SupportsBinaryRetrievableHint(mFunctions))
+    {
+        mFunctions->programParameteri(mProgramID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+
     if (mState.getAttachedShader(gl::ShaderType::Compute))
     {
-        const ShaderGL *computeShaderGL =
+        ShaderGL *computeShaderGL =
             GetImplAs<ShaderGL>(mState.getAttachedShader(gl::ShaderType::Compute));
+        computeShaderGL->compileNativeIfRequired(mFunctions);
 
         mFunctions->attachShader(mProgramID, computeShaderGL->getShaderID());
 
@@ -177,13 +223,21 @@ gl::LinkResult ProgramGL::link(const gl::Context *context,
                 &transformFeedbackVaryings[0], mState.getTransformFeedbackBufferMode());
         }
 
-        const ShaderGL *vertexShaderGL =
+        ShaderGL *vertexShaderGL =
             GetImplAs<ShaderGL>(mState.getAttachedShader(gl::ShaderType::Vertex));
-        const ShaderGL *fragmentShaderGL =
+        ShaderGL *fragmentShaderGL =
             GetImplAs<ShaderGL>(mState.getAttachedShader(gl::ShaderType::Fragment));
-        const ShaderGL *geometryShaderGL = rx::SafeGetImplAs<ShaderGL, gl::Shader>(
+        ShaderGL *geometryShaderGL = rx::SafeGetImplAs<ShaderGL, gl::Shader>(
             mState.getAttachedShader(gl::ShaderType::Geometry));
 
+        // Issue all the native compiles before attaching so the driver can run them in parallel.
+        vertexShaderGL->compileNativeIfRequired(mFunctions);
+        fragmentShaderGL->compileNativeIfRequired(mFunctions);
+        if (geometryShaderGL)
+        {
+            geometryShaderGL->compileNativeIfRequired(mFunctions);
+        }
+
         // Attach the shaders
         mFunctions->attachShader(mProgramID, vertexShaderGL->getShaderID());
         mFunctions->attachShader(mProgramID, fragmentShaderGL->getShaderID());
@@ -219,6 +273,17 @@ gl::LinkResult ProgramGL::link(const gl::Context *context,
     // Verify the link
     if (!checkLinkStatus(infoLog))
     {
+        // The native compile status of the shaders is only known once the link has been verified.
+        for (gl::ShaderType shaderType : gl::AllShaderTypes())
+        {
+            const gl::Shader *shader = mState.getAttachedShader(shaderType);
+            std::string shaderInfoLog;
+            if (shader &&
+                !GetImplAs<ShaderGL>(shader)->checkNativeCompileStatus(mFunctions, &shaderInfoLog))
+            {
+                infoLog << shaderInfoLog;
+            }
+        }
         return false;
     }
 
@@ -31,6 +31,7 @@
 #include "libANGLE/renderer/gl/SamplerGL.h"
 #include "libANGLE/renderer/gl/ShaderGL.h"
 #include "libANGLE/renderer/gl/StateManagerGL.h"
+#include "libANGLE/renderer/gl/StreamingBufferGL.h"
 #include "libANGLE/renderer/gl/SurfaceGL.h"
 #include "libANGLE/renderer/gl/SyncGL.h"
 #include "libANGLE/renderer/gl/TextureGL.h"
@@ -170,6 +171,8 @@ RendererGL::RendererGL(const FunctionsGL *functions, const egl::AttributeMap &at
       mStateManager(nullptr),
       mBlitter(nullptr),
       mMultiviewClearer(nullptr),
+      mStreamingBuffer(nullptr),
+      mPixelUnpackStagingBuffer(0),
       mUseDebugOutput(false),
       mCapsInitialized(false),
       mMultiviewImplementationType(MultiviewImplementationTypeGL::UNSPECIFIED)
@@ -179,6 +182,7 @@ RendererGL::RendererGL(const FunctionsGL *functions, const egl::AttributeMap &at
     mStateManager = new StateManagerGL(mFunctions, getNativeCaps(), getNativeExtensions());
     mBlitter      = new BlitGL(functions, mWorkarounds, mStateManager);
     mMultiviewClearer = new ClearMultiviewGL(functions, mStateManager);
+    mStreamingBuffer  = new StreamingBufferGL(functions, mStateManager);
 
     bool hasDebugOutput = mFunctions->isAtLeastGL(gl::Version(4, 3)) ||
                           mFunctions->hasGLExtension("GL_KHR_debug") ||
@@ -218,9 +222,26 @@ RendererGL::~RendererGL()
 {
     SafeDelete(mBlitter);
     SafeDelete(mMultiviewClearer);
+    SafeDelete(mStreamingBuffer);
+
+    if (mPixelUnpackStagingBuffer != 0)
+    {
+        mStateManager->deleteBuffer(mPixelUnpackStagingBuffer);
+        mPixelUnpackStagingBuffer = 0;
+    }
+
     SafeDelete(mStateManager);
 }
 
+GLuint RendererGL::getPixelUnpackStagingBuffer()
+{
+    if (mPixelUnpackStagingBuffer == 0)
+    {
+        mFunctions->genBuffers(1, &mPixelUnpackStagingBuffer);
+    }
+    return mPixelUnpackStagingBuffer;
+}
+
 gl::Error RendererGL::flush()
 {
     mFunctions->flush();
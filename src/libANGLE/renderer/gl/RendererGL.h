@@ -40,6 +40,7 @@ class ClearMultiviewGL;
 class ContextImpl;
 class FunctionsGL;
 class StateManagerGL;
+class StreamingBufferGL;
 
 class RendererGL : angle::NonCopyable
 {
@@ -165,6 +166,8 @@ class RendererGL : angle::NonCopyable
     const WorkaroundsGL &getWorkarounds() const { return mWorkarounds; }
     BlitGL *getBlitter() const { return mBlitter; }
     ClearMultiviewGL *getMultiviewClearer() const { return mMultiviewClearer; }
+    StreamingBufferGL *getStreamingBuffer() const { return mStreamingBuffer; }
+    GLuint getPixelUnpackStagingBuffer();
 
     MultiviewImplementationTypeGL getMultiviewImplementationType() const;
     const gl::Caps &getNativeCaps() const;
@@ -196,6 +199,11 @@ class RendererGL : angle::NonCopyable
 
     BlitGL *mBlitter;
     ClearMultiviewGL *mMultiviewClearer;
+    StreamingBufferGL *mStreamingBuffer;
+
+    // Pixel unpack buffer that rows of another unpack buffer are repacked into on the GPU when
+    // the driver can't upload them directly. Created on first use.
+    GLuint mPixelUnpackStagingBuffer;
 
     WorkaroundsGL mWorkarounds;
 
@@ -25,7 +25,8 @@ ShaderGL::ShaderGL(const gl::ShaderState &data,
                    MultiviewImplementationTypeGL multiviewImplementationType)
     : ShaderImpl(data),
       mShaderID(shaderID),
-      mMultiviewImplementationType(multiviewImplementationType)
+      mMultiviewImplementationType(multiviewImplementationType),
+      mNativeCompileRequired(false)
 {
 }
 
@@ -145,15 +146,42 @@ bool ShaderGL::postTranslateCompile(const gl::Context *context,
                                     gl::Compiler *compiler,
                                     std::string *infoLog)
 {
-    // Translate the ESSL into GLSL
-    const char *translatedSourceCString = mData.getTranslatedSource().c_str();
+    // The native shader is only compiled once a program using it is linked from source. Programs
+    // loaded from the program cache don't need it, so the native compile is skipped entirely.
+    mNativeCompileRequired = true;
+    return true;
+}
 
-    // Set the source
-    const FunctionsGL *functions = GetFunctionsGL(context);
+void ShaderGL::compileNativeIfRequired(const FunctionsGL *functions)
+{
+    if (!mNativeCompileRequired)
+    {
+        return;
+    }
+    mNativeCompileRequired = false;
+
+    // Set the translated GLSL source
+    const char *translatedSourceCString = mData.getTranslatedSource().c_str();
     functions->shaderSource(mShaderID, 1, &translatedSourceCString, nullptr);
     functions->compileShader(mShaderID);
 
-    // Check for compile errors from the native driver
+    // The translated source was already validated, so the native compile is expected to succeed.
+    // Querying its status here would wait for the driver to finish compiling, stalling the calling
+    // thread and preventing drivers that compile on their own threads from overlapping the work.
+    // Errors from the native driver are reported when the application queries the compile status
+    // or when the program fails to link instead.
+}
+
+bool ShaderGL::checkDeferredCompileStatus(const gl::Context *context, std::string *infoLog)
+{
+    // The application asked for the compile status, so the native compile can't be skipped.
+    const FunctionsGL *functions = GetFunctionsGL(context);
+    compileNativeIfRequired(functions);
+    return checkNativeCompileStatus(functions, infoLog);
+}
+
+bool ShaderGL::checkNativeCompileStatus(const FunctionsGL *functions, std::string *infoLog) const
+{
     GLint compileStatus = GL_FALSE;
     functions->getShaderiv(mShaderID, GL_COMPILE_STATUS, &compileStatus);
     if (compileStatus == GL_FALSE)
@@ -169,8 +197,8 @@ bool ShaderGL::postTranslateCompile(const gl::Context *context,
             std::vector<char> buf(infoLogLength);
             functions->getShaderInfoLog(mShaderID, infoLogLength, nullptr, &buf[0]);
 
-            *infoLog = &buf[0];
-            WARN() << std::endl << *infoLog;
+            *infoLog += buf.data();
+            WARN() << std::endl << buf.data();
         }
         else
         {
@@ -34,13 +34,24 @@ class ShaderGL : public ShaderImpl
     bool postTranslateCompile(const gl::Context *context,
                               gl::Compiler *compiler,
                               std::string *infoLog) override;
+    bool checkDeferredCompileStatus(const gl::Context *context, std::string *infoLog) override;
     std::string getDebugInfo(const gl::Context *context) const override;
 
     GLuint getShaderID() const;
 
+    // Compiles the native shader from the translated source if it changed since the last native
+    // compile. Must be called before the shader is attached to a program that is linked.
+    void compileNativeIfRequired(const FunctionsGL *functions);
+    bool isNativeCompileRequiredForTesting() const { return mNativeCompileRequired; }
+
+    // Checks the result of the native compile, which is not waited for when it is issued.
+    // Returns false and appends the native info log to |infoLog| if it failed.
+    bool checkNativeCompileStatus(const FunctionsGL *functions, std::string *infoLog) const;
+
   private:
     GLuint mShaderID;
     MultiviewImplementationTypeGL mMultiviewImplementationType;
+    bool mNativeCompileRequired;
 };
 
 }
@@ -161,6 +161,9 @@ StateManagerGL::StateManagerGL(const FunctionsGL *functions,
       mIsSideBySideDrawFramebuffer(false),
       mIsMultiviewEnabled(extensions.multiview),
       mLocalDirtyBits(),
+      mCurrentContextChangedBits(),
+      mContextSwitchDirtyBits(),
+      mDirtyBitsOnMakeCurrent(),
       mMultiviewDirtyBits(),
       mProgramTexturesAndSamplersDirty(true),
       mProgramStorageBuffersDirty(true)
@@ -439,14 +442,43 @@ void StateManagerGL::activeTexture(size_t unit)
 
 void StateManagerGL::bindTexture(gl::TextureType type, GLuint texture)
 {
-    if (mTextures[type][mTextureUnitIndex] != texture)
+    GLuint &binding = mTextures[type][mTextureUnitIndex];
+    if (binding != texture)
     {
-        mTextures[type][mTextureUnitIndex] = texture;
+        auto previousUnit = mTextureUnits.find(binding);
+        if (previousUnit != mTextureUnits.end() && previousUnit->second == mTextureUnitIndex)
+        {
+            mTextureUnits.erase(previousUnit);
+        }
+        if (texture != 0)
+        {
+            mTextureUnits[texture] = mTextureUnitIndex;
+        }
+
+        binding = texture;
         mFunctions->bindTexture(ToGLenum(type), texture);
         mLocalDirtyBits.set(gl::State::DIRTY_BIT_TEXTURE_BINDINGS);
     }
 }
 
+void StateManagerGL::bindTextureForModification(gl::TextureType type, GLuint texture)
+{
+    if (mTextures[type][mTextureUnitIndex] == texture)
+    {
+        return;
+    }
+
+    auto unit = mTextureUnits.find(texture);
+    if (unit != mTextureUnits.end())
+    {
+        ASSERT(mTextures[type][unit->second] == texture);
+        activeTexture(unit->second);
+        return;
+    }
+
+    bindTexture(type, texture);
+}
+
 void StateManagerGL::bindSampler(size_t unit, GLuint sampler)
 {
     if (mSamplers[unit] != sampler)
@@ -858,6 +890,48 @@ gl::Error StateManagerGL::onMakeCurrent(const gl::Context *context)
                 ANGLE_TRY(queryGL->resume());
             }
         }
+
+        // Everything changed while the previous context was current may now differ from the
+        // state of the other contexts.
+        const gl::State::DirtyBits changedBits = (mCurrentContextChangedBits | mLocalDirtyBits);
+        for (auto &contextDirtyBits : mContextSwitchDirtyBits)
+        {
+            if (contextDirtyBits.first != mPrevDrawContext)
+            {
+                contextDirtyBits.second |= changedBits;
+            }
+        }
+        mCurrentContextChangedBits.reset();
+
+        // A context that was never current here has to sync all of its state.
+        auto contextDirtyBits = mContextSwitchDirtyBits.find(contextID);
+        if (contextDirtyBits != mContextSwitchDirtyBits.end())
+        {
+            mDirtyBitsOnMakeCurrent = contextDirtyBits->second;
+            contextDirtyBits->second.reset();
+        }
+        else
+        {
+            mDirtyBitsOnMakeCurrent.set();
+            mContextSwitchDirtyBits[contextID].reset();
+        }
+
+        // The current values of any attribute may have been changed by the other contexts.
+        if (mDirtyBitsOnMakeCurrent[gl::State::DIRTY_BIT_CURRENT_VALUES])
+        {
+            mLocalDirtyCurrentValues.set();
+        }
+
+        // Texture, sampler, image and storage buffer bindings are only compared against the
+        // cached state at draw time.
+        mProgramTexturesAndSamplersDirty = true;
+        mProgramStorageBuffersDirty      = true;
+    }
+    else
+    {
+        // The native state already matches this context, except for the local changes that the
+        // next syncState applies.
+        mDirtyBitsOnMakeCurrent.reset();
     }
     onTransformFeedbackStateChange();
     mPrevDrawContext = contextID;
@@ -869,6 +943,11 @@ gl::Error StateManagerGL::onMakeCurrent(const gl::Context *context)
     return gl::NoError();
 }
 
+void StateManagerGL::onContextDestroyed(const gl::Context *context)
+{
+    mContextSwitchDirtyBits.erase(context->getContextState().getContextID());
+}
+
 void StateManagerGL::setGenericShaderState(const gl::Context *context)
 {
     const gl::State &glState = context->getGLState();
@@ -1748,6 +1827,8 @@ void StateManagerGL::syncState(const gl::Context *context, const gl::State::Dirt
         return;
     }
 
+    mCurrentContextChangedBits |= glAndLocalDirtyBits;
+
     // TODO(jmadill): Investigate only syncing vertex state for active attributes
     for (auto dirtyBit : glAndLocalDirtyBits)
     {
@@ -2056,6 +2137,7 @@ void StateManagerGL::syncState(const gl::Context *context, const gl::State::Dirt
                 break;
         }
 
+        mCurrentContextChangedBits |= mLocalDirtyBits;
         mLocalDirtyBits.reset();
     }
 }
@@ -2114,6 +2196,8 @@ void StateManagerGL::setDitherEnabled(bool enabled)
         {
             mFunctions->disable(GL_DITHER);
         }
+
+        mLocalDirtyBits.set(gl::State::DIRTY_BIT_DITHER_ENABLED);
     }
 }
 
@@ -16,6 +16,7 @@
 #include "libANGLE/renderer/gl/functionsgl_typedefs.h"
 
 #include <map>
+#include <unordered_map>
 
 namespace gl
 {
@@ -63,6 +64,11 @@ class StateManagerGL final : angle::NonCopyable
                          size_t size);
     void activeTexture(size_t unit);
     void bindTexture(gl::TextureType type, GLuint texture);
+
+    // Binds a texture so that it can be modified through the active texture unit. If the texture is
+    // already bound to a unit, that unit is made active instead of replacing the binding of the
+    // active unit, which the next draw would have to restore.
+    void bindTextureForModification(gl::TextureType type, GLuint texture);
     void bindSampler(size_t unit, GLuint sampler);
     void bindImageTexture(GLuint unit,
                           GLuint texture,
@@ -173,6 +179,13 @@ class StateManagerGL final : angle::NonCopyable
     gl::Error resumeAllQueries();
     gl::Error resumeQuery(gl::QueryType type);
     gl::Error onMakeCurrent(const gl::Context *context);
+    void onContextDestroyed(const gl::Context *context);
+
+    // The state that may differ from the native state after the last onMakeCurrent.
+    const gl::State::DirtyBits &getDirtyBitsOnMakeCurrent() const
+    {
+        return mDirtyBitsOnMakeCurrent;
+    }
 
     void syncState(const gl::Context *context, const gl::State::DirtyBits &glDirtyBits);
 
@@ -231,6 +244,9 @@ class StateManagerGL final : angle::NonCopyable
 
     size_t mTextureUnitIndex;
     angle::PackedEnumMap<gl::TextureType, std::vector<GLuint>> mTextures;
+    // The unit each texture was last bound to, for as long as it stays bound there. Lets
+    // bindTextureForModification find the unit without searching every binding.
+    std::unordered_map<GLuint, size_t> mTextureUnits;
     std::vector<GLuint> mSamplers;
 
     struct ImageUnitBinding
@@ -358,6 +374,14 @@ class StateManagerGL final : angle::NonCopyable
     gl::State::DirtyBits mLocalDirtyBits;
     gl::AttributesMask mLocalDirtyCurrentValues;
 
+    // All contexts share the native context, so switching contexts only needs to sync the state
+    // that was changed while another context was current. The state changed since the current
+    // context was made current is accumulated here, and added to the pending bits of every other
+    // context when switching away from it.
+    gl::State::DirtyBits mCurrentContextChangedBits;
+    std::unordered_map<gl::ContextID, gl::State::DirtyBits> mContextSwitchDirtyBits;
+    gl::State::DirtyBits mDirtyBitsOnMakeCurrent;
+
     // ANGLE_multiview dirty bits.
     angle::BitSet<MULTIVIEW_DIRTY_BIT_MAX> mMultiviewDirtyBits;
 
@@ -0,0 +1,298 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// StreamingBufferGL.cpp: Implements the StreamingBufferGL class.
+
+#include "libANGLE/renderer/gl/StreamingBufferGL.h"
+
+#include <algorithm>
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+#include "libANGLE/renderer/gl/FunctionsGL.h"
+#include "libANGLE/renderer/gl/StateManagerGL.h"
+#include "libANGLE/renderer/gl/renderergl_utils.h"
+
+namespace rx
+{
+namespace
+{
+constexpr size_t kInitialBufferSize = 1024 * 1024;
+
+// Keeps every allocation suitably aligned for both vertex attributes and indices.
+constexpr size_t kAllocationAlignment = 16;
+
+// One second, in nanoseconds. Waits are retried until the fence is signaled.
+constexpr GLuint64 kFenceWaitTimeout = 1000000000;
+
+constexpr GLbitfield kPersistentMapAccess =
+    (GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+}  // anonymous namespace
+
+constexpr size_t StreamingBufferGL::kRegionCount;
+
+StreamingBufferGL::StreamingBufferGL(const FunctionsGL *functions, StateManagerGL *stateManager)
+    : mFunctions(functions),
+      mStateManager(stateManager),
+      mBufferID(0),
+      mStorageSerial(0),
+      mSize(0),
+      mHead(0),
+      mPersistentlyMapped(false),
+      mPersistentMapPointer(nullptr),
+      mNextFenceSerial(1)
+{
+    ASSERT(mFunctions);
+    ASSERT(mStateManager);
+    mRegionFenceSerials.fill(0);
+    mRegionsUsedSinceFence.fill(false);
+}
+
+StreamingBufferGL::~StreamingBufferGL()
+{
+    releaseStorage();
+}
+
+gl::Error StreamingBufferGL::map(size_t size, uint8_t **mapPointerOut, size_t *offsetOut)
+{
+    const size_t alignedSize = roundUp(std::max<size_t>(size, 1), kAllocationAlignment);
+
+    // Keep allocations within one region so a single allocation never waits on the whole buffer.
+    if (mBufferID == 0 || alignedSize > mSize / kRegionCount)
+    {
+        size_t newSize = std::max(kInitialBufferSize, mSize);
+        while (newSize / kRegionCount < alignedSize)
+        {
+            newSize *= 2;
+        }
+        ANGLE_TRY(allocateStorage(newSize));
+    }
+
+    mStateManager->bindBuffer(gl::BufferBinding::Array, mBufferID);
+
+    size_t offset = mHead;
+    bool wrapped  = false;
+    if (offset + alignedSize > mSize)
+    {
+        offset  = 0;
+        wrapped = true;
+    }
+
+    if (mPersistentlyMapped)
+    {
+        const size_t regionSize  = mSize / kRegionCount;
+        const size_t firstRegion = offset / regionSize;
+        const size_t lastRegion  = (offset + alignedSize - 1) / regionSize;
+
+        // Appending to the region of the previous allocation needs no synchronization, since
+        // draws never read past what was written before them.
+        bool continuesRegion = !wrapped && mHead > 0 && (mHead - 1) / regionSize == firstRegion;
+
+        size_t firstNewRegion = continuesRegion ? firstRegion + 1 : firstRegion;
+        if (firstNewRegion <= lastRegion)
+        {
+            // All draws using the regions written so far have been issued, so they can be fenced.
+            ANGLE_TRY(fenceUsedRegions());
+            for (size_t regionIndex = firstNewRegion; regionIndex <= lastRegion; ++regionIndex)
+            {
+                ANGLE_TRY(waitForRegion(regionIndex));
+            }
+        }
+
+        for (size_t regionIndex = firstRegion; regionIndex <= lastRegion; ++regionIndex)
+        {
+            mRegionsUsedSinceFence[regionIndex] = true;
+        }
+
+        *mapPointerOut = mPersistentMapPointer + offset;
+    }
+    else
+    {
+        if (wrapped)
+        {
+            // Orphan the storage so the driver can keep the old data alive for pending draws.
+            mFunctions->bufferData(GL_ARRAY_BUFFER, mSize, nullptr, GL_STREAM_DRAW);
+        }
+
+        // Without glMapBufferRange, the fallback maps the whole buffer with synchronization.
+        GLbitfield access = GL_MAP_WRITE_BIT;
+        if (mFunctions->mapBufferRange != nullptr)
+        {
+            access |= (GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+        }
+
+        *mapPointerOut =
+            MapBufferRangeWithFallback(mFunctions, GL_ARRAY_BUFFER, offset, alignedSize, access);
+        if (*mapPointerOut == nullptr)
+        {
+            return gl::OutOfMemory() << "Failed to map the client data streaming buffer.";
+        }
+    }
+
+    *offsetOut = offset;
+    mHead      = offset + alignedSize;
+
+    return gl::NoError();
+}
+
+bool StreamingBufferGL::unmap()
+{
+    if (mPersistentlyMapped)
+    {
+        // Coherent mappings make the writes visible to the next draw call.
+        return true;
+    }
+
+    mStateManager->bindBuffer(gl::BufferBinding::Array, mBufferID);
+    return mFunctions->unmapBuffer(GL_ARRAY_BUFFER) == GL_TRUE;
+}
+
+GLuint StreamingBufferGL::getBufferID() const
+{
+    return mBufferID;
+}
+
+uint64_t StreamingBufferGL::getStorageSerial() const
+{
+    return mStorageSerial;
+}
+
+gl::Error StreamingBufferGL::allocateStorage(size_t size)
+{
+    // Generate the new name before deleting the old buffer so the two never share a name.
+    GLuint newBufferID = 0;
+    mFunctions->genBuffers(1, &newBufferID);
+    releaseStorage();
+
+    mBufferID = newBufferID;
+    mStorageSerial++;
+    mStateManager->bindBuffer(gl::BufferBinding::Array, mBufferID);
+
+    mPersistentlyMapped = (mFunctions->bufferStorage != nullptr &&
+                           mFunctions->mapBufferRange != nullptr && mFunctions->fenceSync != nullptr);
+
+    if (mPersistentlyMapped)
+    {
+        mFunctions->bufferStorage(GL_ARRAY_BUFFER, size, nullptr, kPersistentMapAccess);
+        mPersistentMapPointer = reinterpret_cast<uint8_t *>(
+            mFunctions->mapBufferRange(GL_ARRAY_BUFFER, 0, size, kPersistentMapAccess));
+        if (mPersistentMapPointer == nullptr)
+        {
+            return gl::OutOfMemory() << "Failed to map the client data streaming buffer.";
+        }
+    }
+    else
+    {
+        mFunctions->bufferData(GL_ARRAY_BUFFER, size, nullptr, GL_STREAM_DRAW);
+    }
+
+    mSize = size;
+    mHead = 0;
+
+    return gl::NoError();
+}
+
+void StreamingBufferGL::releaseStorage()
+{
+    for (auto &fence : mFences)
+    {
+        mFunctions->deleteSync(fence.second);
+    }
+    mFences.clear();
+    mRegionFenceSerials.fill(0);
+    mRegionsUsedSinceFence.fill(false);
+
+    if (mBufferID != 0)
+    {
+        if (mPersistentMapPointer != nullptr)
+        {
+            mStateManager->bindBuffer(gl::BufferBinding::Array, mBufferID);
+            mFunctions->unmapBuffer(GL_ARRAY_BUFFER);
+            mPersistentMapPointer = nullptr;
+        }
+
+        // Pending draws keep the storage alive in the driver.
+        mStateManager->deleteBuffer(mBufferID);
+        mBufferID = 0;
+    }
+
+    mPersistentlyMapped = false;
+    mSize               = 0;
+    mHead               = 0;
+}
+
+gl::Error StreamingBufferGL::fenceUsedRegions()
+{
+    if (std::find(mRegionsUsedSinceFence.begin(), mRegionsUsedSinceFence.end(), true) ==
+        mRegionsUsedSinceFence.end())
+    {
+        return gl::NoError();
+    }
+
+    GLsync fence = mFunctions->fenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    if (fence == 0)
+    {
+        return gl::OutOfMemory() << "glFenceSync failed to create a GLsync object.";
+    }
+
+    uint64_t serial = mNextFenceSerial++;
+    mFences.emplace_back(serial, fence);
+
+    for (size_t regionIndex = 0; regionIndex < kRegionCount; ++regionIndex)
+    {
+        if (mRegionsUsedSinceFence[regionIndex])
+        {
+            mRegionFenceSerials[regionIndex]    = serial;
+            mRegionsUsedSinceFence[regionIndex] = false;
+        }
+    }
+
+    return gl::NoError();
+}
+
+gl::Error StreamingBufferGL::waitForRegion(size_t regionIndex)
+{
+    uint64_t serial = mRegionFenceSerials[regionIndex];
+    if (serial == 0)
+    {
+        return gl::NoError();
+    }
+    mRegionFenceSerials[regionIndex] = 0;
+
+    // Fences that were already waited for have been removed from the queue.
+    auto fenceEnd = mFences.begin();
+    while (fenceEnd != mFences.end() && fenceEnd->first <= serial)
+    {
+        ++fenceEnd;
+    }
+
+    if (fenceEnd == mFences.begin())
+    {
+        return gl::NoError();
+    }
+
+    GLsync fence  = std::prev(fenceEnd)->second;
+    GLenum result = GL_TIMEOUT_EXPIRED;
+    do
+    {
+        result = mFunctions->clientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, kFenceWaitTimeout);
+    } while (result == GL_TIMEOUT_EXPIRED);
+
+    for (auto fenceIter = mFences.begin(); fenceIter != fenceEnd; ++fenceIter)
+    {
+        mFunctions->deleteSync(fenceIter->second);
+    }
+    mFences.erase(mFences.begin(), fenceEnd);
+
+    if (result == GL_WAIT_FAILED)
+    {
+        return gl::OutOfMemory() << "Failed to wait for the client data streaming buffer.";
+    }
+
+    return gl::NoError();
+}
+
+}  // namespace rx
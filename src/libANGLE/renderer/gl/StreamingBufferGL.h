@@ -0,0 +1,79 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// StreamingBufferGL.h: Defines the StreamingBufferGL class, a ring buffer used to stream client
+// memory vertex and index data to the native driver.
+
+#ifndef LIBANGLE_RENDERER_GL_STREAMINGBUFFERGL_H_
+#define LIBANGLE_RENDERER_GL_STREAMINGBUFFERGL_H_
+
+#include <array>
+#include <deque>
+
+#include "angle_gl.h"
+#include "common/angleutils.h"
+#include "libANGLE/Error.h"
+
+namespace rx
+{
+
+class FunctionsGL;
+class StateManagerGL;
+
+// Data is appended to the buffer until it wraps, so writes never touch data that an earlier draw
+// may still be reading. When the native driver supports persistent mapping, the buffer is mapped
+// once and fences tell when a region can be written again. Otherwise each allocation is mapped
+// unsynchronized and the storage is orphaned when the buffer wraps.
+class StreamingBufferGL : angle::NonCopyable
+{
+  public:
+    StreamingBufferGL(const FunctionsGL *functions, StateManagerGL *stateManager);
+    ~StreamingBufferGL();
+
+    // Returns a pointer to |size| bytes of writable storage and its offset in the buffer. The
+    // buffer is left bound to GL_ARRAY_BUFFER. Mapping can reallocate, orphan or fence the buffer,
+    // so it must be called at most once per draw call, for all of the data the draw streams.
+    gl::Error map(size_t size, uint8_t **mapPointerOut, size_t *offsetOut);
+
+    // Must be called once the mapped data is written, before it is used in a draw call. Returns
+    // false if the data was corrupted and needs to be written again.
+    bool unmap();
+
+    GLuint getBufferID() const;
+
+    // Changes every time the buffer is reallocated. Vertex arrays that still have an older
+    // buffer bound to their element array binding must bind the new one.
+    uint64_t getStorageSerial() const;
+
+  private:
+    gl::Error allocateStorage(size_t size);
+    void releaseStorage();
+    gl::Error fenceUsedRegions();
+    gl::Error waitForRegion(size_t regionIndex);
+
+    static constexpr size_t kRegionCount = 4;
+
+    const FunctionsGL *mFunctions;
+    StateManagerGL *mStateManager;
+
+    GLuint mBufferID;
+    uint64_t mStorageSerial;
+    size_t mSize;
+    size_t mHead;
+    bool mPersistentlyMapped;
+    uint8_t *mPersistentMapPointer;
+
+    // Fences are created in order, so waiting on one also waits for all the previous ones. Each
+    // region keeps the serial of the first fence created after its last use.
+    std::deque<std::pair<uint64_t, GLsync>> mFences;
+    uint64_t mNextFenceSerial;
+    std::array<uint64_t, kRegionCount> mRegionFenceSerials;
+    std::array<bool, kRegionCount> mRegionsUsedSinceFence;
+};
+
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_GL_STREAMINGBUFFERGL_H_
@@ -18,6 +18,7 @@
 #include "libANGLE/queryconversions.h"
 #include "libANGLE/renderer/gl/BlitGL.h"
 #include "libANGLE/renderer/gl/BufferGL.h"
+#include "libANGLE/renderer/gl/ContextGL.h"
 #include "libANGLE/renderer/gl/FramebufferGL.h"
 #include "libANGLE/renderer/gl/FunctionsGL.h"
 #include "libANGLE/renderer/gl/StateManagerGL.h"
@@ -214,7 +215,7 @@ void TextureGL::setImageHelper(const gl::Context *context,
     nativegl::TexImageFormat texImageFormat =
         nativegl::GetTexImageFormat(functions, workarounds, internalFormat, format, type);
 
-    stateManager->bindTexture(getType(), mTextureID);
+    stateManager->bindTextureForModification(getType(), mTextureID);
 
     if (nativegl::UseTexImage2D(getType()))
     {
@@ -276,7 +277,7 @@ gl::Error TextureGL::setSubImage(const gl::Context *context,
     ASSERT(getLevelInfo(target, level).lumaWorkaround.enabled ==
            GetLevelInfo(format, texSubImageFormat.format).lumaWorkaround.enabled);
 
-    stateManager->bindTexture(getType(), mTextureID);
+    stateManager->bindTextureForModification(getType(), mTextureID);
     if (workarounds.unpackOverlappingRowsSeparatelyUnpackBuffer && unpackBuffer &&
         unpack.rowLength != 0 && unpack.rowLength < area.width)
     {
@@ -334,6 +335,14 @@ gl::Error TextureGL::setSubImageRowByRowWorkaround(const gl::Context *context,
     const FunctionsGL *functions = GetFunctionsGL(context);
     StateManagerGL *stateManager = GetStateManagerGL(context);
 
+    // Uploading one row at a time costs a texture upload per row, repack the rows into a staging
+    // buffer on the GPU instead if buffers can be copied.
+    if (functions->copyBufferSubData != nullptr)
+    {
+        return setSubImageRowByRowStaged(context, target, level, area, format, type, unpack,
+                                         unpackBuffer, pixels);
+    }
+
     gl::PixelUnpackState directUnpack;
     directUnpack.alignment   = 1;
     stateManager->setPixelUnpackState(directUnpack);
@@ -382,6 +391,83 @@ gl::Error TextureGL::setSubImageRowByRowWorkaround(const gl::Context *context,
     return gl::NoError();
 }
 
+gl::Error TextureGL::setSubImageRowByRowStaged(const gl::Context *context,
+                                               gl::TextureTarget target,
+                                               size_t level,
+                                               const gl::Box &area,
+                                               GLenum format,
+                                               GLenum type,
+                                               const gl::PixelUnpackState &unpack,
+                                               const gl::Buffer *unpackBuffer,
+                                               const uint8_t *pixels)
+{
+    const FunctionsGL *functions = GetFunctionsGL(context);
+    StateManagerGL *stateManager = GetStateManagerGL(context);
+
+    const gl::InternalFormat &glFormat = gl::GetInternalFormatInfo(format, type);
+    GLuint rowBytes                    = 0;
+    ANGLE_TRY_RESULT(glFormat.computeRowPitch(type, area.width, unpack.alignment, unpack.rowLength),
+                     rowBytes);
+    GLuint imageBytes = 0;
+    ANGLE_TRY_RESULT(glFormat.computeDepthPitch(area.height, unpack.imageHeight, rowBytes),
+                     imageBytes);
+
+    bool useTexImage3D = nativegl::UseTexImage3D(getType());
+    GLuint skipBytes   = 0;
+    ANGLE_TRY_RESULT(glFormat.computeSkipBytes(rowBytes, imageBytes, unpack, useTexImage3D),
+                     skipBytes);
+
+    // The staged rows are tightly packed.
+    const size_t stagingRowBytes =
+        static_cast<size_t>(area.width) * glFormat.computePixelBytes(type);
+    const size_t stagingImageBytes = stagingRowBytes * area.height;
+
+    // |pixels| is an offset into the unpack buffer. The copies stay on the GPU, so the upload
+    // doesn't wait for earlier writes to the unpack buffer to finish.
+    const GLuint stagingBuffer = GetImplAs<ContextGL>(context)->getPixelUnpackStagingBuffer();
+    stateManager->bindBuffer(gl::BufferBinding::CopyRead,
+                             GetImplAs<BufferGL>(unpackBuffer)->getBufferID());
+    stateManager->bindBuffer(gl::BufferBinding::CopyWrite, stagingBuffer);
+    functions->bufferData(GL_COPY_WRITE_BUFFER, stagingImageBytes * area.depth, nullptr,
+                          GL_STREAM_COPY);
+
+    const size_t sourceOffset = reinterpret_cast<uintptr_t>(pixels) + skipBytes;
+    size_t stagingOffset      = 0;
+    for (GLint image = 0; image < area.depth; ++image)
+    {
+        for (GLint row = 0; row < area.height; ++row)
+        {
+            functions->copyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER,
+                                         sourceOffset + image * imageBytes + row * rowBytes,
+                                         stagingOffset, stagingRowBytes);
+            stagingOffset += stagingRowBytes;
+        }
+    }
+
+    gl::PixelUnpackState directUnpack;
+    directUnpack.alignment = 1;
+    stateManager->setPixelUnpackState(directUnpack);
+    stateManager->bindBuffer(gl::BufferBinding::PixelUnpack, stagingBuffer);
+
+    if (useTexImage3D)
+    {
+        functions->texSubImage3D(ToGLenum(target), static_cast<GLint>(level), area.x, area.y,
+                                 area.z, area.width, area.height, area.depth, format, type,
+                                 nullptr);
+    }
+    else
+    {
+        ASSERT(nativegl::UseTexImage2D(getType()));
+        functions->texSubImage2D(ToGLenum(target), static_cast<GLint>(level), area.x, area.y,
+                                 area.width, area.height, format, type, nullptr);
+    }
+
+    // The frontend still has the unpack buffer bound.
+    stateManager->setPixelUnpackBuffer(unpackBuffer);
+
+    return gl::NoError();
+}
+
 gl::Error TextureGL::setSubImagePaddingWorkaround(const gl::Context *context,
                                                   gl::TextureTarget target,
                                                   size_t level,
@@ -488,7 +574,7 @@ gl::Error TextureGL::setCompressedImage(const gl::Context *context,
     nativegl::CompressedTexImageFormat compressedTexImageFormat =
         nativegl::GetCompressedTexImageFormat(functions, workarounds, internalFormat);
 
-    stateManager->bindTexture(getType(), mTextureID);
+    stateManager->bindTextureForModification(getType(), mTextureID);
     if (nativegl::UseTexImage2D(getType()))
     {
         ASSERT(size.depth == 1);
@@ -533,7 +619,7 @@ gl::Error TextureGL::setCompressedSubImage(const gl::Context *context,
     nativegl::CompressedTexSubImageFormat compressedTexSubImageFormat =
         nativegl::GetCompressedSubTexImageFormat(functions, workarounds, format);
 
-    stateManager->bindTexture(getType(), mTextureID);
+    stateManager->bindTextureForModification(getType(), mTextureID);
     if (nativegl::UseTexImage2D(getType()))
     {
         ASSERT(area.z == 0 && area.depth == 1);
@@ -576,7 +662,7 @@ gl::Error TextureGL::copyImage(const gl::Context *context,
     nativegl::CopyTexImageImageFormat copyTexImageFormat =
         nativegl::GetCopyTexImageImageFormat(functions, workarounds, internalFormat, type);
 
-    stateManager->bindTexture(getType(), mTextureID);
+    stateManager->bindTextureForModification(getType(), mTextureID);
 
     const FramebufferGL *sourceFramebufferGL = GetImplAs<FramebufferGL>(source);
     gl::Extents fbSize = sourceFramebufferGL->getState().getReadAttachment()->getSize();
@@ -692,7 +778,7 @@ gl::Error TextureGL::copySubImage(const gl::Context *context,
     gl::Offset destOffset(origDestOffset.x + sourceArea.x - origSourceArea.x,
                           origDestOffset.y + sourceArea.y - origSourceArea.y, origDestOffset.z);
 
-    stateManager->bindTexture(getType(), mTextureID);
+    stateManager->bindTextureForModification(getType(), mTextureID);
     stateManager->bindFramebuffer(GL_READ_FRAMEBUFFER, sourceFramebufferGL->getFramebufferID());
 
     const LevelInfoGL &levelInfo = getLevelInfo(target, level);
@@ -822,17 +908,20 @@ gl::Error TextureGL::copySubTextureHelper(const gl::Context *context,
         }
     }
 
-    // Check if the destination is renderable and copy on the GPU
+    // Check if the destination is renderable and copy on the GPU. Only formats that cannot be
+    // rendered to natively, such as RGB9_E5, need to be converted on the CPU.
     const LevelInfoGL &destLevelInfo = getLevelInfo(target, level);
-    if (!destSRGB &&
-        nativegl::SupportsNativeRendering(functions, getType(), destLevelInfo.nativeInternalFormat))
+    if (nativegl::SupportsNativeRendering(functions, getType(), destLevelInfo.nativeInternalFormat))
     {
+        GLenum destLumaFormat =
+            destLevelInfo.lumaWorkaround.enabled ? destLevelInfo.sourceFormat : GL_NONE;
+
         bool copySucceded = false;
         ANGLE_TRY_RESULT(blitter->copySubTexture(
                              context, sourceGL, sourceLevel, sourceComponentType, this, target,
                              level, destComponentType, sourceImageDesc.size, sourceArea, destOffset,
-                             needsLumaWorkaround, sourceLevelInfo.sourceFormat, unpackFlipY,
-                             unpackPremultiplyAlpha, unpackUnmultiplyAlpha),
+                             needsLumaWorkaround, sourceLevelInfo.sourceFormat, destLumaFormat,
+                             destSRGB, unpackFlipY, unpackPremultiplyAlpha, unpackUnmultiplyAlpha),
                          copySucceded);
         if (copySucceded)
         {
@@ -860,7 +949,7 @@ gl::Error TextureGL::setStorage(const gl::Context *context,
     nativegl::TexStorageFormat texStorageFormat =
         nativegl::GetTexStorageFormat(functions, workarounds, internalFormat);
 
-    stateManager->bindTexture(getType(), mTextureID);
+    stateManager->bindTextureForModification(getType(), mTextureID);
     if (nativegl::UseTexImage2D(getType()))
     {
         ASSERT(size.depth == 1);
@@ -1029,7 +1118,7 @@ gl::Error TextureGL::setStorageMultisample(const gl::Context *context,
     nativegl::TexStorageFormat texStorageFormat =
         nativegl::GetTexStorageFormat(functions, workarounds, internalFormat);
 
-    stateManager->bindTexture(getType(), mTextureID);
+    stateManager->bindTextureForModification(getType(), mTextureID);
 
     ASSERT(size.depth == 1);
 
@@ -1056,7 +1145,7 @@ gl::Error TextureGL::generateMipmap(const gl::Context *context)
     const FunctionsGL *functions = GetFunctionsGL(context);
     StateManagerGL *stateManager = GetStateManagerGL(context);
 
-    stateManager->bindTexture(getType(), mTextureID);
+    stateManager->bindTextureForModification(getType(), mTextureID);
     functions->generateMipmap(ToGLenum(getType()));
 
     const GLuint effectiveBaseLevel = mState.getEffectiveBaseLevel();
@@ -1074,7 +1163,7 @@ gl::Error TextureGL::bindTexImage(const gl::Context *context, egl::Surface *surf
     StateManagerGL *stateManager = GetStateManagerGL(context);
 
     // Make sure this texture is bound
-    stateManager->bindTexture(getType(), mTextureID);
+    stateManager->bindTextureForModification(getType(), mTextureID);
 
     setLevelInfo(getType(), 0, 1, LevelInfoGL());
     return gl::NoError();
@@ -1088,7 +1177,7 @@ gl::Error TextureGL::releaseTexImage(const gl::Context *context)
     const FunctionsGL *functions = GetFunctionsGL(context);
     StateManagerGL *stateManager = GetStateManagerGL(context);
 
-    stateManager->bindTexture(getType(), mTextureID);
+    stateManager->bindTextureForModification(getType(), mTextureID);
     if (nativegl::UseTexImage2D(getType()))
     {
         functions->texImage2D(ToGLenum(getType()), 0, GL_RGBA, 0, 0, 0, GL_RGBA, GL_UNSIGNED_BYTE,
@@ -1119,7 +1208,7 @@ gl::Error TextureGL::syncState(const gl::Context *context, const gl::Texture::Di
     const FunctionsGL *functions = GetFunctionsGL(context);
     StateManagerGL *stateManager = GetStateManagerGL(context);
 
-    stateManager->bindTexture(getType(), mTextureID);
+    stateManager->bindTextureForModification(getType(), mTextureID);
 
     if (dirtyBits[gl::Texture::DIRTY_BIT_BASE_LEVEL] || dirtyBits[gl::Texture::DIRTY_BIT_MAX_LEVEL])
     {
@@ -1255,7 +1344,7 @@ gl::Error TextureGL::setBaseLevel(const gl::Context *context, GLuint baseLevel)
         mAppliedBaseLevel = baseLevel;
         mLocalDirtyBits.set(gl::Texture::DIRTY_BIT_BASE_LEVEL);
 
-        stateManager->bindTexture(getType(), mTextureID);
+        stateManager->bindTextureForModification(getType(), mTextureID);
         functions->texParameteri(ToGLenum(getType()), GL_TEXTURE_BASE_LEVEL, baseLevel);
     }
     return gl::NoError();
@@ -1271,7 +1360,7 @@ void TextureGL::setMinFilter(const gl::Context *context, GLenum filter)
         mAppliedSampler.minFilter = filter;
         mLocalDirtyBits.set(gl::Texture::DIRTY_BIT_MIN_FILTER);
 
-        stateManager->bindTexture(getType(), mTextureID);
+        stateManager->bindTextureForModification(getType(), mTextureID);
         functions->texParameteri(ToGLenum(getType()), GL_TEXTURE_MIN_FILTER, filter);
     }
 }
@@ -1285,7 +1374,7 @@ void TextureGL::setMagFilter(const gl::Context *context, GLenum filter)
         mAppliedSampler.magFilter = filter;
         mLocalDirtyBits.set(gl::Texture::DIRTY_BIT_MAG_FILTER);
 
-        stateManager->bindTexture(getType(), mTextureID);
+        stateManager->bindTextureForModification(getType(), mTextureID);
         functions->texParameteri(ToGLenum(getType()), GL_TEXTURE_MAG_FILTER, filter);
     }
 }
@@ -1306,7 +1395,7 @@ void TextureGL::setSwizzle(const gl::Context *context, GLint swizzle[4])
         mLocalDirtyBits.set(gl::Texture::DIRTY_BIT_SWIZZLE_BLUE);
         mLocalDirtyBits.set(gl::Texture::DIRTY_BIT_SWIZZLE_ALPHA);
 
-        stateManager->bindTexture(getType(), mTextureID);
+        stateManager->bindTextureForModification(getType(), mTextureID);
         functions->texParameteriv(ToGLenum(getType()), GL_TEXTURE_SWIZZLE_RGBA, swizzle);
     }
 }
@@ -1592,4 +1681,65 @@ gl::Error TextureGL::initializeContents(const gl::Context *context,
     return gl::NoError();
 }
 
+bool TextureGL::supportsSubImageInitialization(const gl::ImageIndex &index) const
+{
+    const gl::ImageDesc &desc                    = mState.getImageDesc(index);
+    const gl::InternalFormat &internalFormatInfo = *desc.format.info;
+    return desc.samples == 0 && !internalFormatInfo.compressed &&
+           internalFormatInfo.depthBits == 0 && internalFormatInfo.stencilBits == 0;
+}
+
+gl::Error TextureGL::initializeSubImageContents(const gl::Context *context,
+                                                const gl::ImageIndex &index,
+                                                const gl::Box &area)
+{
+    ASSERT(supportsSubImageInitialization(index));
+
+    const FunctionsGL *functions     = GetFunctionsGL(context);
+    StateManagerGL *stateManager     = GetStateManagerGL(context);
+    const WorkaroundsGL &workarounds = GetWorkaroundsGL(context);
+
+    const gl::InternalFormat &internalFormatInfo = *mState.getImageDesc(index).format.info;
+    nativegl::TexSubImageFormat nativeSubImageFormat = nativegl::GetTexSubImageFormat(
+        functions, workarounds, internalFormatInfo.format, internalFormatInfo.type);
+
+    // The application may have an unpack buffer bound, upload the zeros from client memory.
+    gl::PixelUnpackState unpackState;
+    unpackState.alignment = 1;
+    stateManager->setPixelUnpackState(unpackState);
+    stateManager->setPixelUnpackBuffer(nullptr);
+
+    GLuint imageSize = 0;
+    ANGLE_TRY_RESULT(internalFormatInfo.computePackUnpackEndByte(
+                         nativeSubImageFormat.type, gl::Extents(area.width, area.height, area.depth),
+                         unpackState, nativegl::UseTexImage3D(getType())),
+                     imageSize);
+
+    angle::MemoryBuffer *zero;
+    ANGLE_TRY(context->getZeroFilledBuffer(imageSize, &zero));
+
+    stateManager->bindTextureForModification(getType(), mTextureID);
+    if (nativegl::UseTexImage2D(getType()))
+    {
+        functions->texSubImage2D(ToGLenum(index.getTarget()), index.getLevelIndex(), area.x, area.y,
+                                 area.width, area.height, nativeSubImageFormat.format,
+                                 nativeSubImageFormat.type, zero->data());
+    }
+    else
+    {
+        ASSERT(nativegl::UseTexImage3D(getType()));
+        functions->texSubImage3D(ToGLenum(index.getTarget()), index.getLevelIndex(), area.x, area.y,
+                                 area.z, area.width, area.height, area.depth,
+                                 nativeSubImageFormat.format, nativeSubImageFormat.type,
+                                 zero->data());
+    }
+
+    // Restore the frontend's unpack state.
+    const gl::State &glState = context->getGLState();
+    stateManager->setPixelUnpackState(glState.getUnpackState());
+    stateManager->setPixelUnpackBuffer(glState.getTargetBuffer(gl::BufferBinding::PixelUnpack));
+
+    return gl::NoError();
+}
+
 }  // namespace rx
@@ -171,6 +171,10 @@ class TextureGL : public TextureImpl
 
     gl::Error initializeContents(const gl::Context *context,
                                  const gl::ImageIndex &imageIndex) override;
+    bool supportsSubImageInitialization(const gl::ImageIndex &index) const override;
+    gl::Error initializeSubImageContents(const gl::Context *context,
+                                         const gl::ImageIndex &index,
+                                         const gl::Box &area) override;
 
     void setMinFilter(const gl::Context *context, GLenum filter);
     void setMagFilter(const gl::Context *context, GLenum filter);
@@ -204,6 +208,16 @@ class TextureGL : public TextureImpl
                                             const gl::Buffer *unpackBuffer,
                                             const uint8_t *pixels);
 
+    gl::Error setSubImageRowByRowStaged(const gl::Context *context,
+                                        gl::TextureTarget target,
+                                        size_t level,
+                                        const gl::Box &area,
+                                        GLenum format,
+                                        GLenum type,
+                                        const gl::PixelUnpackState &unpack,
+                                        const gl::Buffer *unpackBuffer,
+                                        const uint8_t *pixels);
+
     gl::Error setSubImagePaddingWorkaround(const gl::Context *context,
                                            gl::TextureTarget target,
                                            size_t level,
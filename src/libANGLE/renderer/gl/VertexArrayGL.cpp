@@ -18,6 +18,7 @@
 #include "libANGLE/renderer/gl/BufferGL.h"
 #include "libANGLE/renderer/gl/FunctionsGL.h"
 #include "libANGLE/renderer/gl/StateManagerGL.h"
+#include "libANGLE/renderer/gl/StreamingBufferGL.h"
 #include "libANGLE/renderer/gl/renderergl_utils.h"
 
 using namespace gl;
@@ -48,25 +49,28 @@ GLuint GetAdjustedDivisor(GLuint numViews, GLuint divisor)
     return numViews * divisor;
 }
 
+// Alignment of the streamed attribute data that follows streamed indices.
+constexpr size_t kStreamingDataAlignment = 16;
+
 }  // anonymous namespace
 
 VertexArrayGL::VertexArrayGL(const VertexArrayState &state,
                              const FunctionsGL *functions,
-                             StateManagerGL *stateManager)
+                             StateManagerGL *stateManager,
+                             StreamingBufferGL *streamingBuffer)
     : VertexArrayImpl(state),
       mFunctions(functions),
       mStateManager(stateManager),
+      mStreamingBuffer(streamingBuffer),
       mVertexArrayID(0),
       mAppliedNumViews(1),
       mAppliedElementArrayBuffer(),
       mAppliedBindings(state.getMaxBindings()),
-      mStreamingElementArrayBufferSize(0),
-      mStreamingElementArrayBuffer(0),
-      mStreamingArrayBufferSize(0),
-      mStreamingArrayBuffer(0)
+      mAppliedStreamingBufferSerial(0)
 {
     ASSERT(mFunctions);
     ASSERT(mStateManager);
+    ASSERT(mStreamingBuffer);
     mFunctions->genVertexArrays(1, &mVertexArrayID);
 
     // Set the cached vertex attribute array and vertex attribute binding array size
@@ -86,14 +90,7 @@ void VertexArrayGL::destroy(const gl::Context *context)
     mStateManager->deleteVertexArray(mVertexArrayID);
     mVertexArrayID = 0;
     mAppliedNumViews = 1;
-
-    mStateManager->deleteBuffer(mStreamingElementArrayBuffer);
-    mStreamingElementArrayBufferSize = 0;
-    mStreamingElementArrayBuffer     = 0;
-
-    mStateManager->deleteBuffer(mStreamingArrayBuffer);
-    mStreamingArrayBufferSize = 0;
-    mStreamingArrayBuffer     = 0;
+    mAppliedStreamingBufferSerial = 0;
 
     mAppliedElementArrayBuffer.set(context, nullptr);
     for (auto &binding : mAppliedBindings)
@@ -151,8 +148,7 @@ gl::Error VertexArrayGL::syncDrawState(const gl::Context *context,
     const gl::AttributesMask &needsStreamingAttribs =
         (mState.getEnabledClientMemoryAttribsMask() & activeAttributesMask);
 
-    // Determine if an index buffer needs to be streamed and the range of vertices that need to be
-    // copied
+    // Determine the range of vertices that need to be copied
     IndexRange indexRange;
     if (type != GL_NONE)
     {
@@ -166,9 +162,13 @@ gl::Error VertexArrayGL::syncDrawState(const gl::Context *context,
         indexRange.end   = first + count - 1;
     }
 
-    if (needsStreamingAttribs.any())
+    // Indices in client memory are streamed in the same allocation as the attributes.
+    const bool needsStreamingIndices =
+        (type != GL_NONE && mState.getElementArrayBuffer().get() == nullptr);
+    if (needsStreamingIndices || needsStreamingAttribs.any())
     {
-        ANGLE_TRY(streamAttributes(needsStreamingAttribs, instanceCount, indexRange));
+        ANGLE_TRY(streamClientData(context, needsStreamingAttribs, instanceCount, indexRange,
+                                   needsStreamingIndices ? count : 0, type, indices, outIndices));
     }
 
     return gl::NoError();
@@ -210,7 +210,7 @@ gl::Error VertexArrayGL::syncIndexData(const gl::Context *context,
     }
     else
     {
-        // Need to stream the index buffer
+        // The indices are copied by streamClientData.
         // TODO: if GLES, nothing needs to be streamed
 
         // Only compute the index range if the attributes also need to be streamed
@@ -218,39 +218,6 @@ gl::Error VertexArrayGL::syncIndexData(const gl::Context *context,
         {
             *outIndexRange = ComputeIndexRange(type, indices, count, primitiveRestartEnabled);
         }
-
-        // Allocate the streaming element array buffer
-        if (mStreamingElementArrayBuffer == 0)
-        {
-            mFunctions->genBuffers(1, &mStreamingElementArrayBuffer);
-            mStreamingElementArrayBufferSize = 0;
-        }
-
-        mStateManager->bindVertexArray(mVertexArrayID, getAppliedElementArrayBufferID());
-
-        mStateManager->bindBuffer(gl::BufferBinding::ElementArray, mStreamingElementArrayBuffer);
-        mAppliedElementArrayBuffer.set(context, nullptr);
-
-        // Make sure the element array buffer is large enough
-        const Type &indexTypeInfo          = GetTypeInfo(type);
-        size_t requiredStreamingBufferSize = indexTypeInfo.bytes * count;
-        if (requiredStreamingBufferSize > mStreamingElementArrayBufferSize)
-        {
-            // Copy the indices in while resizing the buffer
-            mFunctions->bufferData(GL_ELEMENT_ARRAY_BUFFER, requiredStreamingBufferSize, indices,
-                                   GL_DYNAMIC_DRAW);
-            mStreamingElementArrayBufferSize = requiredStreamingBufferSize;
-        }
-        else
-        {
-            // Put the indices at the beginning of the buffer
-            mFunctions->bufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, requiredStreamingBufferSize,
-                                      indices);
-        }
-
-        // Set the index offset for the draw call to zero since the supplied index pointer is to
-        // client data
-        *outIndices = nullptr;
     }
 
     return gl::NoError();
@@ -287,52 +254,64 @@ void VertexArrayGL::computeStreamingAttributeSizes(const gl::AttributesMask &att
     }
 }
 
-gl::Error VertexArrayGL::streamAttributes(const gl::AttributesMask &attribsToStream,
+gl::Error VertexArrayGL::streamClientData(const gl::Context *context,
+                                          const gl::AttributesMask &attribsToStream,
                                           GLsizei instanceCount,
-                                          const gl::IndexRange &indexRange) const
+                                          const gl::IndexRange &indexRange,
+                                          GLsizei indexCount,
+                                          GLenum indexType,
+                                          const void *indices,
+                                          const void **outIndices) const
 {
+    // The indices go first, padded so that the attribute data after them stays aligned.
+    const size_t indexDataSize =
+        (indexCount > 0) ? GetTypeInfo(indexType).bytes * static_cast<size_t>(indexCount) : 0;
+    const size_t attributeDataStart = roundUp<size_t>(indexDataSize, kStreamingDataAlignment);
+
     // Sync the vertex attribute state and track what data needs to be streamed
     size_t streamingDataSize    = 0;
     size_t maxAttributeDataSize = 0;
-
-    computeStreamingAttributeSizes(attribsToStream, instanceCount, indexRange, &streamingDataSize,
-                                   &maxAttributeDataSize);
-
-    if (streamingDataSize == 0)
+    if (attribsToStream.any())
     {
-        return gl::NoError();
+        computeStreamingAttributeSizes(attribsToStream, instanceCount, indexRange,
+                                       &streamingDataSize, &maxAttributeDataSize);
     }
 
-    if (mStreamingArrayBuffer == 0)
+    if (indexDataSize == 0 && streamingDataSize == 0)
     {
-        mFunctions->genBuffers(1, &mStreamingArrayBuffer);
-        mStreamingArrayBufferSize = 0;
+        return gl::NoError();
     }
 
-    // If first is greater than zero, a slack space needs to be left at the beginning of the buffer
-    // so that the same 'first' argument can be passed into the draw call.
-    const size_t bufferEmptySpace   = maxAttributeDataSize * indexRange.start;
-    const size_t requiredBufferSize = streamingDataSize + bufferEmptySpace;
-
-    mStateManager->bindBuffer(gl::BufferBinding::Array, mStreamingArrayBuffer);
-    if (requiredBufferSize > mStreamingArrayBufferSize)
-    {
-        mFunctions->bufferData(GL_ARRAY_BUFFER, requiredBufferSize, nullptr, GL_DYNAMIC_DRAW);
-        mStreamingArrayBufferSize = requiredBufferSize;
-    }
+    // If first is greater than zero, a slack space needs to be left before the attribute data so
+    // that the same 'first' argument can be passed into the draw call.
+    const size_t bufferEmptySpace =
+        (streamingDataSize > 0) ? maxAttributeDataSize * indexRange.start : 0;
+    const size_t requiredBufferSize = attributeDataStart + bufferEmptySpace + streamingDataSize;
 
     mStateManager->bindVertexArray(mVertexArrayID, getAppliedElementArrayBufferID());
 
+    // All of the draw's data is written to a single allocation of the shared streaming buffer. The
+    // buffer can be reallocated, orphaned or fenced by the allocation, which must not happen once
+    // part of the draw's data has been written.
+    //
     // Unmapping a buffer can return GL_FALSE to indicate that the system has corrupted the data
     // somehow (such as by a screen change), retry writing the data a few times and return
     // OUT_OF_MEMORY if that fails.
-    GLboolean unmapResult     = GL_FALSE;
+    bool unmapped             = false;
+    size_t bufferOffset       = 0;
     size_t unmapRetryAttempts = 5;
-    while (unmapResult != GL_TRUE && --unmapRetryAttempts > 0)
+    while (!unmapped && --unmapRetryAttempts > 0)
     {
-        uint8_t *bufferPointer = MapBufferRangeWithFallback(mFunctions, GL_ARRAY_BUFFER, 0,
-                                                            requiredBufferSize, GL_MAP_WRITE_BIT);
-        size_t curBufferOffset = bufferEmptySpace;
+        // The streaming buffer is left bound to GL_ARRAY_BUFFER for the attribute pointers below.
+        uint8_t *bufferPointer = nullptr;
+        ANGLE_TRY(mStreamingBuffer->map(requiredBufferSize, &bufferPointer, &bufferOffset));
+
+        if (indexDataSize > 0)
+        {
+            memcpy(bufferPointer, indices, indexDataSize);
+        }
+
+        size_t curBufferOffset = attributeDataStart + bufferEmptySpace;
 
         const auto &attribs  = mState.getVertexAttributes();
         const auto &bindings = mState.getVertexBindings();
@@ -379,7 +358,8 @@ gl::Error VertexArrayGL::streamAttributes(const gl::AttributesMask &attribsToStr
             }
 
             // Compute where the 0-index vertex would be.
-            const size_t vertexStartOffset = curBufferOffset - (firstIndex * destStride);
+            const size_t vertexStartOffset =
+                bufferOffset + curBufferOffset - (firstIndex * destStride);
 
             callVertexAttribPointer(static_cast<GLuint>(idx), attrib,
                                     static_cast<GLsizei>(destStride),
@@ -388,14 +368,26 @@ gl::Error VertexArrayGL::streamAttributes(const gl::AttributesMask &attribsToStr
             curBufferOffset += destStride * streamedVertexCount;
         }
 
-        unmapResult = mFunctions->unmapBuffer(GL_ARRAY_BUFFER);
+        unmapped = mStreamingBuffer->unmap();
     }
 
-    if (unmapResult != GL_TRUE)
+    if (!unmapped)
     {
         return gl::OutOfMemory() << "Failed to unmap the client data streaming buffer.";
     }
 
+    if (indexDataSize > 0)
+    {
+        mStateManager->bindBuffer(gl::BufferBinding::ElementArray,
+                                  mStreamingBuffer->getBufferID());
+        mAppliedElementArrayBuffer.set(context, nullptr);
+        mAppliedStreamingBufferSerial = mStreamingBuffer->getStorageSerial();
+
+        // The supplied index pointer is to client data, the draw call uses the offset of the
+        // copied indices instead
+        *outIndices = reinterpret_cast<const void *>(bufferOffset);
+    }
+
     return gl::NoError();
 }
 
@@ -408,7 +400,12 @@ GLuint VertexArrayGL::getAppliedElementArrayBufferID() const
 {
     if (mAppliedElementArrayBuffer.get() == nullptr)
     {
-        return mStreamingElementArrayBuffer;
+        // The streaming buffer may have been reallocated since it was bound to this vertex array.
+        if (mAppliedStreamingBufferSerial != mStreamingBuffer->getStorageSerial())
+        {
+            return 0;
+        }
+        return mStreamingBuffer->getBufferID();
     }
 
     return GetImplAs<BufferGL>(mAppliedElementArrayBuffer.get())->getBufferID();
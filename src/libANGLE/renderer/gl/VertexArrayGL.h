@@ -16,13 +16,15 @@ namespace rx
 
 class FunctionsGL;
 class StateManagerGL;
+class StreamingBufferGL;
 
 class VertexArrayGL : public VertexArrayImpl
 {
   public:
     VertexArrayGL(const gl::VertexArrayState &data,
                   const FunctionsGL *functions,
-                  StateManagerGL *stateManager);
+                  StateManagerGL *stateManager,
+                  StreamingBufferGL *streamingBuffer);
     ~VertexArrayGL() override;
 
     void destroy(const gl::Context *context) override;
@@ -62,7 +64,8 @@ class VertexArrayGL : public VertexArrayImpl
                             bool primitiveRestartEnabled,
                             const void **outIndices) const;
 
-    // Apply index data, only sets outIndexRange if attributesNeedStreaming is true
+    // Apply index data from an element array buffer, only sets outIndexRange if
+    // attributesNeedStreaming is true. Indices in client memory are streamed by streamClientData.
     gl::Error syncIndexData(const gl::Context *context,
                             GLsizei count,
                             GLenum type,
@@ -80,10 +83,17 @@ class VertexArrayGL : public VertexArrayImpl
                                         size_t *outStreamingDataSize,
                                         size_t *outMaxAttributeDataSize) const;
 
-    // Stream attributes that have client data
-    gl::Error streamAttributes(const gl::AttributesMask &attribsToStream,
+    // Stream the attributes that have client data and, if indexCount is not zero, the indices in
+    // client memory. Everything a draw streams is written with a single map of the streaming
+    // buffer.
+    gl::Error streamClientData(const gl::Context *context,
+                               const gl::AttributesMask &attribsToStream,
                                GLsizei instanceCount,
-                               const gl::IndexRange &indexRange) const;
+                               const gl::IndexRange &indexRange,
+                               GLsizei indexCount,
+                               GLenum indexType,
+                               const void *indices,
+                               const void **outIndices) const;
     void syncDirtyAttrib(const gl::Context *context,
                          size_t attribIndex,
                          const gl::VertexArray::DirtyAttribBits &dirtyAttribBits);
@@ -111,6 +121,7 @@ class VertexArrayGL : public VertexArrayImpl
 
     const FunctionsGL *mFunctions;
     StateManagerGL *mStateManager;
+    StreamingBufferGL *mStreamingBuffer;
 
     GLuint mVertexArrayID;
     int mAppliedNumViews;
@@ -120,11 +131,9 @@ class VertexArrayGL : public VertexArrayImpl
     mutable std::vector<gl::VertexAttribute> mAppliedAttributes;
     mutable std::vector<gl::VertexBinding> mAppliedBindings;
 
-    mutable size_t mStreamingElementArrayBufferSize;
-    mutable GLuint mStreamingElementArrayBuffer;
-
-    mutable size_t mStreamingArrayBufferSize;
-    mutable GLuint mStreamingArrayBuffer;
+    // Storage serial of the streaming buffer last bound as this vertex array's element array
+    // buffer, or 0 if it was never bound.
+    mutable uint64_t mAppliedStreamingBufferSerial;
 };
 }  // namespace rx
 
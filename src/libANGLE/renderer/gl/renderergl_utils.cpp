@@ -917,6 +917,11 @@ void GenerateCaps(const FunctionsGL *functions,
     extensions->packSubimage = functions->standard == STANDARD_GL_DESKTOP ||
                                functions->isAtLeastGLES(gl::Version(3, 0)) ||
                                functions->hasGLESExtension("GL_NV_pack_subimage");
+    extensions->pixelBufferObject = functions->isAtLeastGL(gl::Version(2, 1)) ||
+                                    functions->hasGLExtension("GL_ARB_pixel_buffer_object") ||
+                                    functions->hasGLExtension("GL_EXT_pixel_buffer_object") ||
+                                    functions->isAtLeastGLES(gl::Version(3, 0)) ||
+                                    functions->hasGLESExtension("GL_NV_pixel_buffer_object");
     extensions->vertexArrayObject = functions->isAtLeastGL(gl::Version(3, 0)) ||
                                     functions->hasGLExtension("GL_ARB_vertex_array_object") ||
                                     functions->isAtLeastGLES(gl::Version(3, 0)) ||
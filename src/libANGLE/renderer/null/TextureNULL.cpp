@@ -153,4 +153,16 @@ gl::Error TextureNULL::initializeContents(const gl::Context *context,
     return gl::NoError();
 }
 
+bool TextureNULL::supportsSubImageInitialization(const gl::ImageIndex &index) const
+{
+    return true;
+}
+
+gl::Error TextureNULL::initializeSubImageContents(const gl::Context *context,
+                                                  const gl::ImageIndex &index,
+                                                  const gl::Box &area)
+{
+    return gl::NoError();
+}
+
 }  // namespace rx
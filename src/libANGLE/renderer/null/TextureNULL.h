@@ -97,6 +97,10 @@ class TextureNULL : public TextureImpl
 
     gl::Error initializeContents(const gl::Context *context,
                                  const gl::ImageIndex &imageIndex) override;
+    bool supportsSubImageInitialization(const gl::ImageIndex &index) const override;
+    gl::Error initializeSubImageContents(const gl::Context *context,
+                                         const gl::ImageIndex &index,
+                                         const gl::Box &area) override;
 };
 
 }  // namespace rx
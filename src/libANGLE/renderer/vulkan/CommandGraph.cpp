@@ -158,7 +158,10 @@ bool CommandGraphResource::checkResourceInUseAndRefreshDeps(RendererVk *renderer
 
 // CommandGraphNode implementation.
 
-CommandGraphNode::CommandGraphNode() : mHasChildren(false), mVisitedState(VisitedState::Unvisited)
+CommandGraphNode::CommandGraphNode()
+    : mRenderPassBarrierDstStageMask(0),
+      mHasChildren(false),
+      mVisitedState(VisitedState::Unvisited)
 {
 }
 
@@ -174,6 +177,10 @@ CommandGraphNode::~CommandGraphNode()
 CommandBuffer *CommandGraphNode::getOutsideRenderPassCommands()
 {
     ASSERT(!mHasChildren);
+
+    // Outside commands execute before the RenderPass and its deferred attachment barriers, so
+    // they can't be appended once the RenderPass was recorded. Use a new node instead.
+    ASSERT(!mInsideRenderPassCommands.valid());
     return &mOutsideRenderPassCommands;
 }
 
@@ -245,13 +252,12 @@ void CommandGraphNode::storeRenderPassInfo(const Framebuffer &framebuffer,
 
 void CommandGraphNode::appendColorRenderTarget(Serial serial, RenderTargetVk *colorRenderTarget)
 {
-    ASSERT(mOutsideRenderPassCommands.valid());
-
     // TODO(jmadill): Use automatic layout transition. http://anglebug.com/2361
-    colorRenderTarget->image->changeLayoutWithStages(
-        VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
-        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
-        &mOutsideRenderPassCommands);
+    VkImageMemoryBarrier imageMemoryBarrier;
+    colorRenderTarget->image->changeLayoutDeferred(
+        VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, &imageMemoryBarrier);
+    mRenderPassImageBarriers.push_back(imageMemoryBarrier);
+    mRenderPassBarrierDstStageMask |= VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
 
     mRenderPassDesc.packColorAttachment(*colorRenderTarget->image);
     colorRenderTarget->resource->onWriteResource(this, serial);
@@ -260,7 +266,6 @@ void CommandGraphNode::appendColorRenderTarget(Serial serial, RenderTargetVk *co
 void CommandGraphNode::appendDepthStencilRenderTarget(Serial serial,
                                                       RenderTargetVk *depthStencilRenderTarget)
 {
-    ASSERT(mOutsideRenderPassCommands.valid());
     ASSERT(depthStencilRenderTarget->image->getFormat().textureFormat().hasDepthOrStencilBits());
 
     // TODO(jmadill): Use automatic layout transition. http://anglebug.com/2361
@@ -268,10 +273,11 @@ void CommandGraphNode::appendDepthStencilRenderTarget(Serial serial,
     VkImageAspectFlags aspectFlags = (format.depthBits > 0 ? VK_IMAGE_ASPECT_DEPTH_BIT : 0) |
                                      (format.stencilBits > 0 ? VK_IMAGE_ASPECT_STENCIL_BIT : 0);
 
-    depthStencilRenderTarget->image->changeLayoutWithStages(
-        aspectFlags, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
-        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,
-        &mOutsideRenderPassCommands);
+    VkImageMemoryBarrier imageMemoryBarrier;
+    depthStencilRenderTarget->image->changeLayoutDeferred(
+        aspectFlags, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL, &imageMemoryBarrier);
+    mRenderPassImageBarriers.push_back(imageMemoryBarrier);
+    mRenderPassBarrierDstStageMask |= VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
 
     mRenderPassDesc.packDepthStencilAttachment(*depthStencilRenderTarget->image);
     depthStencilRenderTarget->resource->onWriteResource(this, serial);
@@ -353,18 +359,59 @@ void CommandGraphNode::visitParents(std::vector<CommandGraphNode *> *stack)
     mVisitedState = VisitedState::Ready;
 }
 
-Error CommandGraphNode::visitAndExecute(VkDevice device,
+void CommandGraphNode::markVisited()
+{
+    ASSERT(mVisitedState == VisitedState::Ready);
+    mVisitedState = VisitedState::Visited;
+}
+
+Error CommandGraphNode::finishRecording()
+{
+    if (mOutsideRenderPassCommands.valid())
+    {
+        ANGLE_TRY(mOutsideRenderPassCommands.end());
+    }
+
+    if (mInsideRenderPassCommands.valid())
+    {
+        ANGLE_TRY(mInsideRenderPassCommands.end());
+    }
+
+    return NoError();
+}
+
+Error CommandGraphNode::executeCommands(VkDevice device,
                                         Serial serial,
                                         RenderPassCache *renderPassCache,
+                                        std::vector<VkCommandBuffer> *pendingCommands,
                                         CommandBuffer *primaryCommandBuffer)
 {
+    ASSERT(mVisitedState == VisitedState::Visited);
+
     if (mOutsideRenderPassCommands.valid())
     {
-        mOutsideRenderPassCommands.end();
-        primaryCommandBuffer->executeCommands(1, &mOutsideRenderPassCommands);
+        pendingCommands->push_back(mOutsideRenderPassCommands.getHandle());
     }
 
-    if (mInsideRenderPassCommands.valid())
+    // The outside RenderPass commands and the attachment transitions must execute before the
+    // RenderPass begins.
+    bool beginsRenderPass = mInsideRenderPassCommands.valid();
+    if ((beginsRenderPass || !mRenderPassImageBarriers.empty()) && !pendingCommands->empty())
+    {
+        primaryCommandBuffer->executeCommands(static_cast<uint32_t>(pendingCommands->size()),
+                                              pendingCommands->data());
+        pendingCommands->clear();
+    }
+
+    if (!mRenderPassImageBarriers.empty())
+    {
+        primaryCommandBuffer->pipelineBarrier(
+            VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, mRenderPassBarrierDstStageMask, 0, 0, nullptr, 0,
+            nullptr, static_cast<uint32_t>(mRenderPassImageBarriers.size()),
+            mRenderPassImageBarriers.data());
+    }
+
+    if (beginsRenderPass)
     {
         // Pull a compatible RenderPass from the cache.
         // TODO(jmadill): Insert real ops and layout transitions.
@@ -372,8 +419,6 @@ Error CommandGraphNode::visitAndExecute(VkDevice device,
         ANGLE_TRY(
             renderPassCache->getCompatibleRenderPass(device, serial, mRenderPassDesc, &renderPass));
 
-        mInsideRenderPassCommands.end();
-
         VkRenderPassBeginInfo beginInfo;
         beginInfo.sType                    = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
         beginInfo.pNext                    = nullptr;
@@ -392,7 +437,6 @@ Error CommandGraphNode::visitAndExecute(VkDevice device,
         primaryCommandBuffer->endRenderPass();
     }
 
-    mVisitedState = VisitedState::Visited;
     return NoError();
 }
 
@@ -439,7 +483,38 @@ Error CommandGraph::submitCommands(VkDevice device,
         return NoError();
     }
 
-    std::vector<CommandGraphNode *> nodeStack;
+    // Scheduling is done up front so that recording into the primary command buffer is a flat
+    // walk over the nodes in dependency order.
+    scheduleNodes(&mScheduledNodes);
+
+    Error error = recordScheduledNodes(device, serial, renderPassCache, primaryCommandBufferOut);
+
+    // The schedule and the pending secondary command buffers only belong to this submit, even if
+    // recording failed part way through.
+    mPendingCommands.clear();
+    mScheduledNodes.clear();
+
+    ANGLE_TRY(error);
+
+    // TODO(jmadill): Use pool allocation so we don't need to deallocate command graph.
+    for (CommandGraphNode *node : mNodes)
+    {
+        delete node;
+    }
+    mNodes.clear();
+
+    return NoError();
+}
+
+Error CommandGraph::recordScheduledNodes(VkDevice device,
+                                         Serial serial,
+                                         RenderPassCache *renderPassCache,
+                                         CommandBuffer *primaryCommandBuffer)
+{
+    for (CommandGraphNode *node : mScheduledNodes)
+    {
+        ANGLE_TRY(node->finishRecording());
+    }
 
     VkCommandBufferBeginInfo beginInfo;
     beginInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
@@ -447,7 +522,30 @@ Error CommandGraph::submitCommands(VkDevice device,
     beginInfo.flags            = 0;
     beginInfo.pInheritanceInfo = nullptr;
 
-    ANGLE_TRY(primaryCommandBufferOut->begin(beginInfo));
+    ANGLE_TRY(primaryCommandBuffer->begin(beginInfo));
+
+    ASSERT(mPendingCommands.empty());
+    for (CommandGraphNode *node : mScheduledNodes)
+    {
+        ANGLE_TRY(node->executeCommands(device, serial, renderPassCache, &mPendingCommands,
+                                        primaryCommandBuffer));
+    }
+
+    if (!mPendingCommands.empty())
+    {
+        primaryCommandBuffer->executeCommands(static_cast<uint32_t>(mPendingCommands.size()),
+                                              mPendingCommands.data());
+    }
+
+    return primaryCommandBuffer->end();
+}
+
+void CommandGraph::scheduleNodes(std::vector<CommandGraphNode *> *scheduledNodesOut)
+{
+    ASSERT(scheduledNodesOut->empty());
+    scheduledNodesOut->reserve(mNodes.size());
+
+    std::vector<CommandGraphNode *> nodeStack;
 
     for (CommandGraphNode *topLevelNode : mNodes)
     {
@@ -468,8 +566,8 @@ Error CommandGraph::submitCommands(VkDevice device,
                     node->visitParents(&nodeStack);
                     break;
                 case VisitedState::Ready:
-                    ANGLE_TRY(node->visitAndExecute(device, serial, renderPassCache,
-                                                    primaryCommandBufferOut));
+                    node->markVisited();
+                    scheduledNodesOut->push_back(node);
                     nodeStack.pop_back();
                     break;
                 case VisitedState::Visited:
@@ -482,16 +580,7 @@ Error CommandGraph::submitCommands(VkDevice device,
         }
     }
 
-    ANGLE_TRY(primaryCommandBufferOut->end());
-
-    // TODO(jmadill): Use pool allocation so we don't need to deallocate command graph.
-    for (CommandGraphNode *node : mNodes)
-    {
-        delete node;
-    }
-    mNodes.clear();
-
-    return NoError();
+    ASSERT(scheduledNodesOut->size() == mNodes.size());
 }
 
 bool CommandGraph::empty() const
@@ -111,6 +111,8 @@ class CommandGraphNode final : angle::NonCopyable
 
     // storeRenderPassInfo and append*RenderTarget store info relevant to the RenderPass.
     // Note: RenderTargets must be added in order, with the depth/stencil being added last.
+    // The attachment layout transitions are batched into a single pipeline barrier that is
+    // recorded into the primary command buffer right before the RenderPass begins.
     void appendColorRenderTarget(Serial serial, RenderTargetVk *colorRenderTarget);
     void appendDepthStencilRenderTarget(Serial serial, RenderTargetVk *depthStencilRenderTarget);
 
@@ -127,9 +129,18 @@ class CommandGraphNode final : angle::NonCopyable
     // Commands for traversing the node on a flush operation.
     VisitedState visitedState() const;
     void visitParents(std::vector<CommandGraphNode *> *stack);
-    Error visitAndExecute(VkDevice device,
+    void markVisited();
+
+    // Ends recording of the secondary command buffers. Called once the node has been scheduled.
+    Error finishRecording();
+
+    // Records the node's commands into the primary command buffer. Outside RenderPass commands
+    // are appended to 'pendingCommands' so consecutive ones are executed with a single
+    // vkCmdExecuteCommands call. The pending list is flushed before a RenderPass begins.
+    Error executeCommands(VkDevice device,
                           Serial serial,
                           RenderPassCache *renderPassCache,
+                          std::vector<VkCommandBuffer> *pendingCommands,
                           CommandBuffer *primaryCommandBuffer);
 
     const gl::Rectangle &getRenderPassRenderArea() const;
@@ -146,6 +157,10 @@ class CommandGraphNode final : angle::NonCopyable
     gl::Rectangle mRenderPassRenderArea;
     gl::AttachmentArray<VkClearValue> mRenderPassClearValues;
 
+    // Layout transitions of the RenderPass attachments, recorded with one barrier call.
+    std::vector<VkImageMemoryBarrier> mRenderPassImageBarriers;
+    VkPipelineStageFlags mRenderPassBarrierDstStageMask;
+
     // Keep a separate buffers for commands inside and outside a RenderPass.
     // TODO(jmadill): We might not need inside and outside RenderPass commands separate.
     CommandBuffer mOutsideRenderPassCommands;
@@ -183,7 +198,21 @@ class CommandGraph final : angle::NonCopyable
     bool empty() const;
 
   private:
+    // Orders the open nodes so that every node comes after all of its parents. Nodes with no
+    // path between them keep the order in which they were allocated.
+    void scheduleNodes(std::vector<CommandGraphNode *> *scheduledNodesOut);
+
+    // Records the scheduled nodes into the primary command buffer.
+    Error recordScheduledNodes(VkDevice device,
+                               Serial serial,
+                               RenderPassCache *renderPassCache,
+                               CommandBuffer *primaryCommandBuffer);
+
     std::vector<CommandGraphNode *> mNodes;
+
+    // Scratch storage reused between submits to avoid reallocating on every flush.
+    std::vector<CommandGraphNode *> mScheduledNodes;
+    std::vector<VkCommandBuffer> mPendingCommands;
 };
 
 }  // namespace vk
@@ -57,6 +57,8 @@ ContextVk::ContextVk(const gl::ContextState &state, RendererVk *renderer)
       mDynamicDescriptorPool(),
       mTexturesDirty(false),
       mVertexArrayBindingHasChanged(false),
+      mPushConstantsCommandBuffer(nullptr),
+      mPushConstantsProgram(nullptr),
       mClearColorMask(kAllColorChannelsMask)
 {
     memset(&mClearColorValue, 0, sizeof(mClearColorValue));
@@ -164,11 +166,13 @@ gl::Error ContextVk::setupDraw(const gl::Context *context,
     ANGLE_TRY(vkFBO->getCommandGraphNodeForDraw(this, &graphNode));
 
     vk::CommandBuffer *commandBuffer = nullptr;
+    bool pushConstantsUndefined      = false;
 
     if (!graphNode->getInsideRenderPassCommands()->valid())
     {
         mTexturesDirty    = true;
         *newCommandBufferOut = true;
+        pushConstantsUndefined = true;
         ANGLE_TRY(graphNode->beginInsideRenderPassRecording(mRenderer, &commandBuffer));
     }
     else
@@ -231,6 +235,21 @@ gl::Error ContextVk::setupDraw(const gl::Context *context,
             programVk->getDynamicOffsets());
     }
 
+    // Push the default uniforms if they changed, or if this command buffer was last given another
+    // program's uniforms.
+    if (programVk->usesDefaultUniformsPushConstants())
+    {
+        bool forcePushConstants = pushConstantsUndefined ||
+                                  commandBuffer != mPushConstantsCommandBuffer ||
+                                  queueSerial != mPushConstantsQueueSerial ||
+                                  programVk != mPushConstantsProgram;
+        programVk->updatePushConstants(mRenderer->getGraphicsPipelineLayout(), commandBuffer,
+                                       forcePushConstants);
+        mPushConstantsCommandBuffer = commandBuffer;
+        mPushConstantsQueueSerial   = queueSerial;
+        mPushConstantsProgram       = programVk;
+    }
+
     *drawNodeOut = graphNode;
     return gl::NoError();
 }
@@ -17,6 +17,7 @@
 
 namespace rx
 {
+class ProgramVk;
 class RendererVk;
 
 class ContextVk : public ContextImpl
@@ -189,6 +190,13 @@ class ContextVk : public ContextImpl
     bool mTexturesDirty;
     bool mVertexArrayBindingHasChanged;
 
+    // The command buffer and program of the last push constant update. Push constants persist in
+    // a command buffer across draws, so pushes are skipped while both are unchanged. Command
+    // buffers are freed on submit, so the queue serial guards against a reused pointer.
+    const vk::CommandBuffer *mPushConstantsCommandBuffer;
+    Serial mPushConstantsQueueSerial;
+    const ProgramVk *mPushConstantsProgram;
+
     // Cached clear value/mask for color and depth/stencil.
     VkClearValue mClearColorValue;
     VkClearValue mClearDepthStencilValue;
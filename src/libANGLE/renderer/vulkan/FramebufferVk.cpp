@@ -752,17 +752,6 @@ gl::Error FramebufferVk::getCommandGraphNodeForDraw(ContextVk *contextVk,
 
     std::vector<VkClearValue> attachmentClearValues;
 
-    vk::CommandBuffer *commandBuffer = nullptr;
-    if (!(*nodeOut)->getOutsideRenderPassCommands()->valid())
-    {
-        ANGLE_TRY((*nodeOut)->beginOutsideRenderPassRecording(
-            renderer->getDevice(), renderer->getCommandPool(), &commandBuffer));
-    }
-    else
-    {
-        commandBuffer = (*nodeOut)->getOutsideRenderPassCommands();
-    }
-
     // Initialize RenderPass info.
     // TODO(jmadill): Support gaps in RenderTargets. http://anglebug.com/2394
     const auto &colorRenderTargets = mRenderTargetCache.getColors();
@@ -33,6 +33,9 @@ constexpr char kLayoutMarkerBegin[]    = "@@ LAYOUT-";
 constexpr char kMarkerEnd[]            = " @@";
 constexpr char kUniformQualifier[]     = "uniform";
 
+constexpr char kDefaultUniformsPaddingMarker[]       = "@@ DEFAULT-UNIFORMS-PADDING @@";
+constexpr uint32_t kDefaultUniformsPaddingElementSize = 16;
+
 void InsertLayoutSpecifierString(std::string *shaderString,
                                  const std::string &variableName,
                                  const std::string &layoutString)
@@ -108,6 +111,8 @@ GlslangWrapper::~GlslangWrapper()
 gl::LinkResult GlslangWrapper::linkProgram(const gl::Context *glContext,
                                            const gl::ProgramState &programState,
                                            const gl::ProgramLinkedResources &resources,
+                                           bool useDefaultUniformsPushConstants,
+                                           uint32_t fragmentUniformsPushConstantsOffset,
                                            std::vector<uint32_t> *vertexCodeOut,
                                            std::vector<uint32_t> *fragmentCodeOut)
 {
@@ -170,17 +175,47 @@ gl::LinkResult GlslangWrapper::linkProgram(const gl::Context *glContext,
     }
 
     // Bind the default uniforms for vertex and fragment shaders.
-    // See corresponding code in OutputVulkanGLSL.cpp.
+    // See corresponding code in TranslatorVulkan.cpp.
     std::stringstream searchStringBuilder;
     searchStringBuilder << "@@ DEFAULT-UNIFORMS-SET-BINDING @@";
     std::string searchString = searchStringBuilder.str();
 
-    std::string vertexDefaultUniformsBinding   = "set = 0, binding = 0";
-    std::string fragmentDefaultUniformsBinding = "set = 0, binding = 1";
+    std::string vertexDefaultUniformsBinding;
+    std::string fragmentDefaultUniformsBinding;
+    std::string vertexDefaultUniformsPadding;
+    std::string fragmentDefaultUniformsPadding;
+
+    if (useDefaultUniformsPushConstants)
+    {
+        // Push constant blocks default to std430, but the uniform data is packed as std140.
+        vertexDefaultUniformsBinding   = "push_constant, std140";
+        fragmentDefaultUniformsBinding = "push_constant, std140";
+
+        // The fragment uniforms follow the vertex uniforms in the push constant range. Pad the
+        // start of the fragment block so its members land at the right offsets.
+        ASSERT(fragmentUniformsPushConstantsOffset % kDefaultUniformsPaddingElementSize == 0);
+        int paddingCount = static_cast<int>(fragmentUniformsPushConstantsOffset /
+                                            kDefaultUniformsPaddingElementSize);
+        if (paddingCount > 0)
+        {
+            fragmentDefaultUniformsPadding =
+                "    vec4 angleDefaultUniformsPadding[" + Str(paddingCount) + "];";
+        }
+    }
+    else
+    {
+        vertexDefaultUniformsBinding   = "set = 0, binding = 0";
+        fragmentDefaultUniformsBinding = "set = 0, binding = 1";
+    }
 
     angle::ReplaceSubstring(&vertexSource, searchString, vertexDefaultUniformsBinding);
     angle::ReplaceSubstring(&fragmentSource, searchString, fragmentDefaultUniformsBinding);
 
+    angle::ReplaceSubstring(&vertexSource, kDefaultUniformsPaddingMarker,
+                            vertexDefaultUniformsPadding);
+    angle::ReplaceSubstring(&fragmentSource, kDefaultUniformsPaddingMarker,
+                            fragmentDefaultUniformsPadding);
+
     // Assign textures to a descriptor set and binding.
     int textureCount     = 0;
     const auto &uniforms = programState.getUniforms();
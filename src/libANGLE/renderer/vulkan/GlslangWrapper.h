@@ -23,9 +23,14 @@ class GlslangWrapper : public gl::RefCountObjectNoID
     static GlslangWrapper *GetReference();
     static void ReleaseReference();
 
+    // When |useDefaultUniformsPushConstants| is set, the default uniform blocks are declared as
+    // push constants instead of uniform buffers, with the fragment block starting at
+    // |fragmentUniformsPushConstantsOffset| bytes.
     gl::LinkResult linkProgram(const gl::Context *glContext,
                                const gl::ProgramState &programState,
                                const gl::ProgramLinkedResources &resources,
+                               bool useDefaultUniformsPushConstants,
+                               uint32_t fragmentUniformsPushConstantsOffset,
                                std::vector<uint32_t> *vertexCodeOut,
                                std::vector<uint32_t> *fragmentCodeOut);
 
@@ -25,6 +25,9 @@ namespace
 
 constexpr size_t kUniformBlockDynamicBufferMinSize = 256 * 128;
 
+// Each stage's default uniforms start on a vec4 boundary in the push constant range.
+constexpr size_t kPushConstantsStageAlignment = 16;
+
 gl::Error InitDefaultUniformBlock(const gl::Context *context,
                                   gl::Shader *shader,
                                   sh::BlockLayoutMap *blockLayoutMapOut,
@@ -148,10 +151,13 @@ ProgramVk::ProgramVk(const gl::ProgramState &state)
     : ProgramImpl(state),
       mDefaultUniformBlocks(),
       mUniformBlocksOffsets(),
+      mUseDefaultUniformsPushConstants(false),
+      mPushConstantsOffsets(),
       mUsedDescriptorSetRange(),
       mDirtyTextures(true)
 {
     mUniformBlocksOffsets.fill(0);
+    mPushConstantsOffsets.fill(0);
     mUsedDescriptorSetRange.invalidate();
 }
 
@@ -188,6 +194,9 @@ vk::Error ProgramVk::reset(ContextVk *contextVk)
     mUsedDescriptorSetRange.invalidate();
     mDirtyTextures       = false;
 
+    mUseDefaultUniformsPushConstants = false;
+    mPushConstantsOffsets.fill(0);
+
     return vk::NoError();
 }
 
@@ -225,12 +234,17 @@ gl::LinkResult ProgramVk::link(const gl::Context *glContext,
 
     ANGLE_TRY(reset(contextVk));
 
+    // The default uniform block sizes decide how the blocks are declared in the shaders.
+    ANGLE_TRY(initDefaultUniformBlocks(glContext));
+
     std::vector<uint32_t> vertexCode;
     std::vector<uint32_t> fragmentCode;
     bool linkSuccess = false;
-    ANGLE_TRY_RESULT(
-        glslangWrapper->linkProgram(glContext, mState, resources, &vertexCode, &fragmentCode),
-        linkSuccess);
+    ANGLE_TRY_RESULT(glslangWrapper->linkProgram(
+                         glContext, mState, resources, mUseDefaultUniformsPushConstants,
+                         mPushConstantsOffsets[vk::ShaderType::FragmentShader], &vertexCode,
+                         &fragmentCode),
+                     linkSuccess);
     if (!linkSuccess)
     {
         return false;
@@ -260,8 +274,6 @@ gl::LinkResult ProgramVk::link(const gl::Context *glContext,
         mFragmentModuleSerial = renderer->issueShaderSerial();
     }
 
-    ANGLE_TRY(initDefaultUniformBlocks(glContext));
-
     if (!mState.getSamplerUniformRange().empty())
     {
         // Ensure the descriptor set range includes the textures at position 1.
@@ -333,6 +345,19 @@ gl::Error ProgramVk::initDefaultUniformBlocks(const gl::Context *glContext)
         }
     }
 
+    // Default uniforms that fit in the push constant range are pushed directly into the command
+    // buffer at draw time. This skips the copy into a dynamic buffer and the descriptor set
+    // updates that a new buffer requires.
+    size_t pushConstantsSize = 0;
+    for (vk::ShaderType shaderType : vk::AllShaderTypes())
+    {
+        mPushConstantsOffsets[shaderType] = static_cast<uint32_t>(pushConstantsSize);
+        pushConstantsSize += roundUp(requiredBufferSize[shaderType], kPushConstantsStageAlignment);
+    }
+    mUseDefaultUniformsPushConstants =
+        (pushConstantsSize > 0 &&
+         pushConstantsSize <= renderer->getDefaultUniformsPushConstantsSize());
+
     bool anyDirty = false;
     bool allDirty = true;
 
@@ -345,10 +370,13 @@ gl::Error ProgramVk::initDefaultUniformBlocks(const gl::Context *glContext)
             {
                 return gl::OutOfMemory() << "Memory allocation failure.";
             }
-            size_t minAlignment = static_cast<size_t>(
-                renderer->getPhysicalDeviceProperties().limits.minUniformBufferOffsetAlignment);
 
-            mDefaultUniformBlocks[shaderType].storage.init(minAlignment);
+            if (!mUseDefaultUniformsPushConstants)
+            {
+                size_t minAlignment = static_cast<size_t>(
+                    renderer->getPhysicalDeviceProperties().limits.minUniformBufferOffsetAlignment);
+                mDefaultUniformBlocks[shaderType].storage.init(minAlignment);
+            }
 
             // Initialize uniform buffer memory to zero by default.
             mDefaultUniformBlocks[shaderType].uniformData.fill(0);
@@ -362,7 +390,7 @@ gl::Error ProgramVk::initDefaultUniformBlocks(const gl::Context *glContext)
         }
     }
 
-    if (anyDirty)
+    if (anyDirty && !mUseDefaultUniformsPushConstants)
     {
         // Initialize the "empty" uniform block if necessary.
         if (!allDirty)
@@ -720,6 +748,12 @@ vk::Error ProgramVk::updateUniforms(ContextVk *contextVk)
         return vk::NoError();
     }
 
+    // Push constant uniforms are recorded directly into the draw's command buffer instead.
+    if (mUseDefaultUniformsPushConstants)
+    {
+        return vk::NoError();
+    }
+
     ASSERT(mUsedDescriptorSetRange.contains(0));
 
     // Update buffer memory by immediate mapping. This immediate update only works once.
@@ -755,6 +789,36 @@ vk::Error ProgramVk::updateUniforms(ContextVk *contextVk)
     return vk::NoError();
 }
 
+void ProgramVk::updatePushConstants(const vk::PipelineLayout &pipelineLayout,
+                                    vk::CommandBuffer *commandBuffer,
+                                    bool forceUpdate)
+{
+    ASSERT(mUseDefaultUniformsPushConstants);
+
+    for (vk::ShaderType shaderType : vk::AllShaderTypes())
+    {
+        DefaultUniformBlock &uniformBlock = mDefaultUniformBlocks[shaderType];
+
+        if (uniformBlock.uniformData.empty() || (!uniformBlock.uniformsDirty && !forceUpdate))
+        {
+            continue;
+        }
+
+        // The range is shared by both stages, so every push must name both of them.
+        const VkShaderStageFlags stageFlags =
+            (VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT);
+        commandBuffer->pushConstants(pipelineLayout, stageFlags, mPushConstantsOffsets[shaderType],
+                                     static_cast<uint32_t>(uniformBlock.uniformData.size()),
+                                     uniformBlock.uniformData.data());
+        uniformBlock.uniformsDirty = false;
+    }
+}
+
+bool ProgramVk::usesDefaultUniformsPushConstants() const
+{
+    return mUseDefaultUniformsPushConstants;
+}
+
 vk::Error ProgramVk::updateDefaultUniformsDescriptorSet(ContextVk *contextVk)
 {
     vk::ShaderMap<VkDescriptorBufferInfo> descriptorBufferInfo;
@@ -833,14 +897,11 @@ gl::Error ProgramVk::updateTexturesDescriptorSet(const gl::Context *context)
     }
 
     ContextVk *contextVk = GetImplAs<ContextVk>(context);
-    ANGLE_TRY(allocateDescriptorSet(contextVk, vk::TextureIndex));
-
     ASSERT(mUsedDescriptorSetRange.contains(1));
-    VkDescriptorSet descriptorSet = mDescriptorSets[1];
 
     // TODO(jmadill): Don't hard-code the texture limit.
     ShaderTextureArray<VkDescriptorImageInfo> descriptorImageInfo;
-    ShaderTextureArray<VkWriteDescriptorSet> writeDescriptorInfo;
+    vk::TextureDescriptorDesc texturesDesc;
     uint32_t imageCount = 0;
 
     const gl::State &glState     = contextVk->getGLState();
@@ -872,27 +933,52 @@ gl::Error ProgramVk::updateTexturesDescriptorSet(const gl::Context *context)
         imageInfo.imageView   = textureVk->getImageView().getHandle();
         imageInfo.imageLayout = image.getCurrentLayout();
 
-        auto &writeInfo = writeDescriptorInfo[imageCount];
+        texturesDesc.update(imageCount, textureVk->getSerial(), imageInfo.imageLayout);
+
+        imageCount++;
+    }
+
+    ASSERT(imageCount > 0);
+
+    // Switching back to a previously used set of textures only needs a bind of the cached set.
+    vk::DynamicDescriptorPool *dynamicDescriptorPool = contextVk->getDynamicDescriptorPool();
+    VkDescriptorSet cachedDescriptorSet              = VK_NULL_HANDLE;
+    if (dynamicDescriptorPool->getCachedTextureDescriptorSet(texturesDesc, &cachedDescriptorSet))
+    {
+        if (mDescriptorSets.size() <= vk::TextureIndex)
+        {
+            mDescriptorSets.resize(vk::TextureIndex + 1, VK_NULL_HANDLE);
+        }
+        mDescriptorSets[vk::TextureIndex] = cachedDescriptorSet;
+        mDirtyTextures                    = false;
+        return gl::NoError();
+    }
+
+    ANGLE_TRY(allocateDescriptorSet(contextVk, vk::TextureIndex));
+    VkDescriptorSet descriptorSet = mDescriptorSets[vk::TextureIndex];
+
+    ShaderTextureArray<VkWriteDescriptorSet> writeDescriptorInfo;
+    for (uint32_t imageIndex = 0; imageIndex < imageCount; ++imageIndex)
+    {
+        auto &writeInfo = writeDescriptorInfo[imageIndex];
 
         writeInfo.sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
         writeInfo.pNext            = nullptr;
         writeInfo.dstSet           = descriptorSet;
-        writeInfo.dstBinding       = imageCount;
+        writeInfo.dstBinding       = imageIndex;
         writeInfo.dstArrayElement  = 0;
         writeInfo.descriptorCount  = 1;
         writeInfo.descriptorType   = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-        writeInfo.pImageInfo       = &imageInfo;
+        writeInfo.pImageInfo       = &descriptorImageInfo[imageIndex];
         writeInfo.pBufferInfo      = nullptr;
         writeInfo.pTexelBufferView = nullptr;
-
-        imageCount++;
     }
 
     VkDevice device = contextVk->getDevice();
-
-    ASSERT(imageCount > 0);
     vkUpdateDescriptorSets(device, imageCount, writeDescriptorInfo.data(), 0, nullptr);
 
+    dynamicDescriptorPool->cacheTextureDescriptorSet(texturesDesc, descriptorSet);
+
     mDirtyTextures = false;
     return gl::NoError();
 }
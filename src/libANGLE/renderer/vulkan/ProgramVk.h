@@ -106,6 +106,13 @@ class ProgramVk : public ProgramImpl
 
     vk::Error updateUniforms(ContextVk *contextVk);
 
+    // Programs with small default uniform blocks keep them in push constants. |forceUpdate| is
+    // needed whenever the command buffer's push constants might hold another program's data.
+    bool usesDefaultUniformsPushConstants() const;
+    void updatePushConstants(const vk::PipelineLayout &pipelineLayout,
+                             vk::CommandBuffer *commandBuffer,
+                             bool forceUpdate);
+
     const std::vector<VkDescriptorSet> &getDescriptorSets() const;
     const uint32_t *getDynamicOffsets();
     uint32_t getDynamicOffsetsCount();
@@ -161,6 +168,11 @@ class ProgramVk : public ProgramImpl
     vk::ShaderMap<DefaultUniformBlock> mDefaultUniformBlocks;
     vk::ShaderMap<uint32_t> mUniformBlocksOffsets;
 
+    // When set, the default uniform blocks live in push constants at these offsets rather than in
+    // |storage|, and descriptor set 0 is unused.
+    bool mUseDefaultUniformsPushConstants;
+    vk::ShaderMap<uint32_t> mPushConstantsOffsets;
+
     // This is a special "empty" placeholder buffer for when a shader has no uniforms.
     // It is necessary because we want to keep a compatible pipeline layout in all cases,
     // and Vulkan does not tolerate having null handles in a descriptor set.
@@ -45,6 +45,10 @@ namespace
 // one for the vertex shader.
 constexpr size_t kUniformBufferDescriptorsPerDescriptorSet = 2;
 
+// Programs whose default uniforms fit in this many bytes of push constants skip the uniform buffer
+// entirely. The cap keeps the per-draw push small on devices that expose very large limits.
+constexpr uint32_t kMaxDefaultUniformsPushConstantsSize = 256;
+
 VkResult VerifyExtensionsPresent(const std::vector<VkExtensionProperties> &extensionProps,
                                  const std::vector<const char *> &enabledExtensionNames)
 {
@@ -657,6 +661,22 @@ uint32_t RendererVk::getUniformBufferDescriptorCount()
     return kUniformBufferDescriptorsPerDescriptorSet;
 }
 
+uint32_t RendererVk::getDefaultUniformsPushConstantsSize() const
+{
+    return std::min<uint32_t>(mPhysicalDeviceProperties.limits.maxPushConstantsSize,
+                              kMaxDefaultUniformsPushConstantsSize);
+}
+
+VkPushConstantRange RendererVk::getDefaultUniformsPushConstantRange() const
+{
+    // Both stages share one range so that a single push covers the vertex and fragment uniforms.
+    VkPushConstantRange pushConstantRange;
+    pushConstantRange.stageFlags = (VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT);
+    pushConstantRange.offset     = 0;
+    pushConstantRange.size       = getDefaultUniformsPushConstantsSize();
+    return pushConstantRange;
+}
+
 const vk::CommandPool &RendererVk::getCommandPool() const
 {
     return mCommandPool;
@@ -938,14 +958,16 @@ vk::Error RendererVk::initGraphicsPipelineLayout()
         mGraphicsDescriptorSetLayouts.push_back(std::move(textureLayout));
     }
 
+    VkPushConstantRange pushConstantRange = getDefaultUniformsPushConstantRange();
+
     VkPipelineLayoutCreateInfo createInfo;
     createInfo.sType                  = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
     createInfo.pNext                  = nullptr;
     createInfo.flags                  = 0;
     createInfo.setLayoutCount         = static_cast<uint32_t>(mGraphicsDescriptorSetLayouts.size());
     createInfo.pSetLayouts            = mGraphicsDescriptorSetLayouts[0].ptr();
-    createInfo.pushConstantRangeCount = 0;
-    createInfo.pPushConstantRanges    = nullptr;
+    createInfo.pushConstantRangeCount = 1;
+    createInfo.pPushConstantRanges    = &pushConstantRange;
 
     ANGLE_TRY(mGraphicsPipelineLayout.init(mDevice, createInfo));
 
@@ -966,14 +988,18 @@ vk::Error RendererVk::getInternalUniformPipelineLayout(const vk::PipelineLayout
     }
 
     // Here we use the knowledge that the "graphics" descriptor set has uniform blocks at offset 0.
+    // The push constant range matches the graphics layout so that internal draws recorded between
+    // application draws don't disturb the pushed default uniforms.
+    VkPushConstantRange pushConstantRange = getDefaultUniformsPushConstantRange();
+
     VkPipelineLayoutCreateInfo createInfo;
     createInfo.sType                  = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
     createInfo.pNext                  = nullptr;
     createInfo.flags                  = 0;
     createInfo.setLayoutCount         = 1;
     createInfo.pSetLayouts            = mGraphicsDescriptorSetLayouts[0].ptr();
-    createInfo.pushConstantRangeCount = 0;
-    createInfo.pPushConstantRanges    = nullptr;
+    createInfo.pushConstantRangeCount = 1;
+    createInfo.pPushConstantRanges    = &pushConstantRange;
 
     ANGLE_TRY(mInternalUniformPipelineLayout.init(mDevice, createInfo));
 
@@ -985,6 +1011,11 @@ Serial RendererVk::issueShaderSerial()
     return mShaderSerialFactory.generate();
 }
 
+Serial RendererVk::issueTextureSerial()
+{
+    return mTextureSerialFactory.generate();
+}
+
 vk::Error RendererVk::getAppPipeline(const ProgramVk *programVk,
                                      const vk::PipelineDesc &desc,
                                      const gl::AttributesMask &activeAttribLocationsMask,
@@ -69,6 +69,8 @@ class RendererVk : angle::NonCopyable
     const gl::Limitations &getNativeLimitations() const;
     uint32_t getMaxActiveTextures();
     uint32_t getUniformBufferDescriptorCount();
+    uint32_t getDefaultUniformsPushConstantsSize() const;
+    VkPushConstantRange getDefaultUniformsPushConstantRange() const;
 
     GlslangWrapper *getGlslangWrapper();
 
@@ -141,6 +143,9 @@ class RendererVk : angle::NonCopyable
     // Issues a new serial for linked shader modules. Used in the pipeline cache.
     Serial issueShaderSerial();
 
+    // Issues a new serial for a texture's image view and sampler pair. Used in descriptor caching.
+    Serial issueTextureSerial();
+
     vk::ShaderLibrary *getShaderLibrary();
 
   private:
@@ -171,6 +176,7 @@ class RendererVk : angle::NonCopyable
     GlslangWrapper *mGlslangWrapper;
     SerialFactory mQueueSerialFactory;
     SerialFactory mShaderSerialFactory;
+    SerialFactory mTextureSerialFactory;
     Serial mLastCompletedQueueSerial;
     Serial mCurrentQueueSerial;
 
@@ -59,6 +59,53 @@ void MapSwizzleState(GLenum internalFormat,
 constexpr VkBufferUsageFlags kStagingBufferFlags =
     (VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
 constexpr size_t kStagingBufferSize = 1024 * 16;
+
+bool RangesOverlap(int32_t startA, uint32_t sizeA, int32_t startB, uint32_t sizeB)
+{
+    return startA < startB + static_cast<int32_t>(sizeB) &&
+           startB < startA + static_cast<int32_t>(sizeA);
+}
+
+// Copies that write disjoint texels can be recorded without a barrier between them.
+bool CopyRegionsOverlap(const VkBufferImageCopy &a, const VkBufferImageCopy &b)
+{
+    const VkImageSubresourceLayers &subresourceA = a.imageSubresource;
+    const VkImageSubresourceLayers &subresourceB = b.imageSubresource;
+
+    if (subresourceA.mipLevel != subresourceB.mipLevel)
+    {
+        return false;
+    }
+
+    if (!RangesOverlap(subresourceA.baseArrayLayer, subresourceA.layerCount,
+                       subresourceB.baseArrayLayer, subresourceB.layerCount))
+    {
+        return false;
+    }
+
+    return RangesOverlap(a.imageOffset.x, a.imageExtent.width, b.imageOffset.x,
+                         b.imageExtent.width) &&
+           RangesOverlap(a.imageOffset.y, a.imageExtent.height, b.imageOffset.y,
+                         b.imageExtent.height) &&
+           RangesOverlap(a.imageOffset.z, a.imageExtent.depth, b.imageOffset.z,
+                         b.imageExtent.depth);
+}
+
+void RecordCopyRegions(VkBuffer bufferHandle,
+                       const std::vector<VkBufferImageCopy> &copyRegions,
+                       size_t firstRegion,
+                       vk::ImageHelper *image,
+                       vk::CommandBuffer *commandBuffer)
+{
+    if (firstRegion == copyRegions.size())
+    {
+        return;
+    }
+
+    uint32_t regionCount = static_cast<uint32_t>(copyRegions.size() - firstRegion);
+    commandBuffer->copyBufferToImage(bufferHandle, image->getImage(), image->getCurrentLayout(),
+                                     regionCount, &copyRegions[firstRegion]);
+}
 }  // anonymous namespace
 
 // StagingStorage implementation.
@@ -119,11 +166,12 @@ gl::Error PixelBuffer::stageSubresourceUpdate(ContextVk *contextVk,
     bool newBufferAllocated = false;
     uint32_t stagingOffset  = 0;
     size_t allocationSize   = outputDepthPitch * extents.depth;
-    mStagingBuffer.allocate(renderer, allocationSize, &stagingPointer, &bufferHandle,
-                            &stagingOffset, &newBufferAllocated);
+    ANGLE_TRY(mStagingBuffer.allocate(renderer, allocationSize, &stagingPointer, &bufferHandle,
+                                      &stagingOffset, &newBufferAllocated));
 
     const uint8_t *source = pixels + inputSkipBytes;
 
+    // The load function converts straight into the mapped staging memory.
     LoadImageFunctionInfo loadFunction = vkFormat.loadFunctions(type);
 
     loadFunction.loadFunction(extents.width, extents.height, extents.depth, source, inputRowPitch,
@@ -184,8 +232,8 @@ gl::Error PixelBuffer::stageSubresourceUpdateFromRenderTarget(const gl::Context
 
     // The destination is only one layer deep.
     size_t allocationSize = outputDepthPitch;
-    mStagingBuffer.allocate(renderer, allocationSize, &stagingPointer, &bufferHandle,
-                            &stagingOffset, &newBufferAllocated);
+    ANGLE_TRY(mStagingBuffer.allocate(renderer, allocationSize, &stagingPointer, &bufferHandle,
+                                      &stagingOffset, &newBufferAllocated));
 
     PackPixelsParams params;
     params.area        = sourceArea;
@@ -247,23 +295,57 @@ vk::Error PixelBuffer::flushUpdatesToImage(RendererVk *renderer,
 
     ANGLE_TRY(mStagingBuffer.flush(renderer->getDevice()));
 
+    // Conservatively flush all writes to the image. We could use a more restricted barrier.
+    image->changeLayoutWithStages(VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                  VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                  VK_PIPELINE_STAGE_TRANSFER_BIT, commandBuffer);
+
+    // Updates are gathered into a single copy per staging buffer. Copies within one command have
+    // no ordering guarantees, so an update that overlaps one since the last barrier must wait for
+    // them with a transfer barrier. Otherwise the writes race and the wrong data can win, as seen
+    // in dEQP-gles2.functional_texture_specification_texsubimage2d_align_2d* on Windows AMD.
+    VkBuffer pendingBufferHandle = VK_NULL_HANDLE;
+    size_t firstPendingRegion    = 0;
+    mCopyRegions.clear();
+
     for (const SubresourceUpdate &update : mSubresourceUpdates)
     {
         ASSERT(update.bufferHandle != VK_NULL_HANDLE);
 
-        // Conservatively flush all writes to the image. We could use a more restricted barrier.
-        // Do not move this above the for loop, otherwise multiple updates can have race conditions
-        // and not be applied correctly as seen i:
-        // dEQP-gles2.functional_texture_specification_texsubimage2d_align_2d* tests on Windows AMD
-        image->changeLayoutWithStages(
-            VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-            VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, commandBuffer);
+        bool overlapsPreviousCopy = false;
+        for (const VkBufferImageCopy &copyRegion : mCopyRegions)
+        {
+            if (CopyRegionsOverlap(copyRegion, update.copyRegion))
+            {
+                overlapsPreviousCopy = true;
+                break;
+            }
+        }
+
+        if (overlapsPreviousCopy || update.bufferHandle != pendingBufferHandle)
+        {
+            RecordCopyRegions(pendingBufferHandle, mCopyRegions, firstPendingRegion, image,
+                              commandBuffer);
+            firstPendingRegion = mCopyRegions.size();
+        }
+
+        if (overlapsPreviousCopy)
+        {
+            image->changeLayoutWithStages(
+                VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, commandBuffer);
+            mCopyRegions.clear();
+            firstPendingRegion = 0;
+        }
 
-        commandBuffer->copyBufferToImage(update.bufferHandle, image->getImage(),
-                                         image->getCurrentLayout(), 1, &update.copyRegion);
+        pendingBufferHandle = update.bufferHandle;
+        mCopyRegions.push_back(update.copyRegion);
     }
 
+    RecordCopyRegions(pendingBufferHandle, mCopyRegions, firstPendingRegion, image, commandBuffer);
+
     mSubresourceUpdates.clear();
+    mCopyRegions.clear();
     mStagingBuffer.releaseRetainedBuffers(renderer);
 
     return vk::NoError();
@@ -472,9 +554,12 @@ vk::Error TextureVk::getCommandBufferForWrite(RendererVk *renderer,
 {
     const VkDevice device = renderer->getDevice();
     updateQueueSerial(renderer->getCurrentQueueSerial());
-    if (!hasChildlessWritingNode())
+    // Writes can only be appended to the current node if it hasn't recorded a RenderPass. Its
+    // commands outside the RenderPass run first, before the attachment layout transitions.
+    if (!hasChildlessWritingNode() ||
+        getCurrentWritingNode()->getInsideRenderPassCommands()->valid())
     {
-        beginWriteResource(renderer, outCommandBuffer);
+        ANGLE_TRY(beginWriteResource(renderer, outCommandBuffer));
     }
     else
     {
@@ -628,6 +713,7 @@ gl::Error TextureVk::syncState(const gl::Context *context, const gl::Texture::Di
     samplerInfo.unnormalizedCoordinates = VK_FALSE;
 
     ANGLE_TRY(mSampler.init(contextVk->getDevice(), samplerInfo));
+    mSerial = contextVk->getRenderer()->issueTextureSerial();
     return gl::NoError();
 }
 
@@ -674,6 +760,11 @@ const vk::Sampler &TextureVk::getSampler() const
     return mSampler;
 }
 
+Serial TextureVk::getSerial() const
+{
+    return mSerial;
+}
+
 vk::Error TextureVk::initImage(RendererVk *renderer,
                                const vk::Format &format,
                                const gl::Extents &extents,
@@ -700,6 +791,7 @@ vk::Error TextureVk::initImage(RendererVk *renderer,
                                    mappedSwizzle, &mMipmapImageView, levelCount));
     ANGLE_TRY(mImage.initImageView(device, mState.getType(), VK_IMAGE_ASPECT_COLOR_BIT,
                                    mappedSwizzle, &mBaseLevelImageView, 1));
+    mSerial = renderer->issueTextureSerial();
 
     // TODO(jmadill): Fold this into the RenderPass load/store ops. http://anglebug.com/2361
     VkClearColorValue black = {{0, 0, 0, 1.0f}};
@@ -63,6 +63,9 @@ class PixelBuffer final : angle::NonCopyable
 
     vk::DynamicBuffer mStagingBuffer;
     std::vector<SubresourceUpdate> mSubresourceUpdates;
+
+    // Scratch storage for the copy regions recorded by one flush.
+    std::vector<VkBufferImageCopy> mCopyRegions;
 };
 
 class TextureVk : public TextureImpl, public vk::CommandGraphResource
@@ -157,6 +160,9 @@ class TextureVk : public TextureImpl, public vk::CommandGraphResource
     const vk::ImageView &getImageView() const;
     const vk::Sampler &getSampler() const;
 
+    // Changes whenever the image view or the sampler is recreated. Used to key descriptor sets.
+    Serial getSerial() const;
+
     vk::Error ensureImageInitialized(RendererVk *renderer);
 
   private:
@@ -179,6 +185,7 @@ class TextureVk : public TextureImpl, public vk::CommandGraphResource
     vk::ImageView mBaseLevelImageView;
     vk::ImageView mMipmapImageView;
     vk::Sampler mSampler;
+    Serial mSerial;
 
     RenderTargetVk mRenderTarget;
 
@@ -866,6 +866,49 @@ bool operator==(const AttachmentOpsArray &lhs, const AttachmentOpsArray &rhs)
 {
     return (memcmp(&lhs, &rhs, sizeof(AttachmentOpsArray)) == 0);
 }
+
+// TextureDescriptorDesc implementation.
+TextureDescriptorDesc::TextureDescriptorDesc()
+{
+    reset();
+}
+
+TextureDescriptorDesc::~TextureDescriptorDesc()
+{
+}
+
+TextureDescriptorDesc::TextureDescriptorDesc(const TextureDescriptorDesc &other)
+{
+    memcpy(&mBindings, &other.mBindings, sizeof(mBindings));
+}
+
+TextureDescriptorDesc &TextureDescriptorDesc::operator=(const TextureDescriptorDesc &other)
+{
+    memcpy(&mBindings, &other.mBindings, sizeof(mBindings));
+    return *this;
+}
+
+void TextureDescriptorDesc::update(size_t index, Serial textureSerial, VkImageLayout imageLayout)
+{
+    // Serials are compared truncated to 32 bits to keep the key compact.
+    mBindings[index].textureSerial = static_cast<uint32_t>(textureSerial.getValue());
+    mBindings[index].imageLayout   = static_cast<uint32_t>(imageLayout);
+}
+
+void TextureDescriptorDesc::reset()
+{
+    memset(&mBindings, 0, sizeof(mBindings));
+}
+
+size_t TextureDescriptorDesc::hash() const
+{
+    return angle::ComputeGenericHash(mBindings);
+}
+
+bool operator==(const TextureDescriptorDesc &lhs, const TextureDescriptorDesc &rhs)
+{
+    return (memcmp(&lhs, &rhs, sizeof(TextureDescriptorDesc)) == 0);
+}
 }  // namespace vk
 
 // RenderPassCache implementation.
@@ -117,6 +117,37 @@ bool operator==(const AttachmentOpsArray &lhs, const AttachmentOpsArray &rhs);
 
 static_assert(sizeof(AttachmentOpsArray) == 80, "Size check failed");
 
+// Identifies one texture binding in a texture descriptor set. The serial changes whenever the
+// texture's image view or sampler is recreated, so it stands in for both Vulkan handles.
+struct alignas(8) PackedTextureDescriptorDesc final
+{
+    uint32_t textureSerial;
+    uint32_t imageLayout;
+};
+
+static_assert(sizeof(PackedTextureDescriptorDesc) == 8, "Size check failed");
+
+// Key for a cached texture descriptor set. Two keys compare equal only if a descriptor set
+// written for one is a valid descriptor set for the other.
+class TextureDescriptorDesc final
+{
+  public:
+    TextureDescriptorDesc();
+    ~TextureDescriptorDesc();
+    TextureDescriptorDesc(const TextureDescriptorDesc &other);
+    TextureDescriptorDesc &operator=(const TextureDescriptorDesc &other);
+
+    void update(size_t index, Serial textureSerial, VkImageLayout imageLayout);
+    void reset();
+
+    size_t hash() const;
+
+  private:
+    std::array<PackedTextureDescriptorDesc, gl::IMPLEMENTATION_MAX_SHADER_TEXTURES> mBindings;
+};
+
+bool operator==(const TextureDescriptorDesc &lhs, const TextureDescriptorDesc &rhs);
+
 struct alignas(8) PackedShaderStageInfo final
 {
     uint32_t stage;
@@ -371,6 +402,12 @@ struct hash<rx::vk::PipelineDesc>
     size_t operator()(const rx::vk::PipelineDesc &key) const { return key.hash(); }
 };
 
+template <>
+struct hash<rx::vk::TextureDescriptorDesc>
+{
+    size_t operator()(const rx::vk::TextureDescriptorDesc &key) const { return key.hash(); }
+};
+
 }  // namespace std
 
 namespace rx
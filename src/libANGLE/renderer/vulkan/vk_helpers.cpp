@@ -274,6 +274,7 @@ DynamicDescriptorPool::~DynamicDescriptorPool()
 void DynamicDescriptorPool::destroy(RendererVk *rendererVk)
 {
     ASSERT(mCurrentDescriptorSetPool.valid());
+    mTextureDescriptorSetCache.clear();
     mCurrentDescriptorSetPool.destroy(rendererVk->getDevice());
 }
 
@@ -340,11 +341,33 @@ Error DynamicDescriptorPool::allocateNewPool(const VkDevice &device)
     descriptorPoolInfo.poolSizeCount = DescriptorPoolIndexCount;
     descriptorPoolInfo.pPoolSizes    = poolSizes;
 
+    // Descriptor sets from the previous pool are only valid until it is retired.
+    mTextureDescriptorSetCache.clear();
+
     mCurrentAllocatedDescriptorSetCount = 0;
     ANGLE_TRY(mCurrentDescriptorSetPool.init(device, descriptorPoolInfo));
     return NoError();
 }
 
+bool DynamicDescriptorPool::getCachedTextureDescriptorSet(const TextureDescriptorDesc &desc,
+                                                          VkDescriptorSet *descriptorSetOut) const
+{
+    auto iter = mTextureDescriptorSetCache.find(desc);
+    if (iter == mTextureDescriptorSetCache.end())
+    {
+        return false;
+    }
+
+    *descriptorSetOut = iter->second;
+    return true;
+}
+
+void DynamicDescriptorPool::cacheTextureDescriptorSet(const TextureDescriptorDesc &desc,
+                                                      VkDescriptorSet descriptorSet)
+{
+    mTextureDescriptorSetCache[desc] = descriptorSet;
+}
+
 void DynamicDescriptorPool::setMaxSetsPerPoolForTesting(uint32_t maxSetsPerPool)
 {
     mMaxSetsPerPool = maxSetsPerPool;
@@ -719,6 +742,15 @@ void ImageHelper::changeLayoutWithStages(VkImageAspectFlags aspectMask,
                                          CommandBuffer *commandBuffer)
 {
     VkImageMemoryBarrier imageMemoryBarrier;
+    changeLayoutDeferred(aspectMask, newLayout, &imageMemoryBarrier);
+    commandBuffer->singleImageBarrier(srcStageMask, dstStageMask, 0, imageMemoryBarrier);
+}
+
+void ImageHelper::changeLayoutDeferred(VkImageAspectFlags aspectMask,
+                                       VkImageLayout newLayout,
+                                       VkImageMemoryBarrier *imageMemoryBarrierOut)
+{
+    VkImageMemoryBarrier &imageMemoryBarrier = *imageMemoryBarrierOut;
     imageMemoryBarrier.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
     imageMemoryBarrier.pNext               = nullptr;
     imageMemoryBarrier.srcAccessMask       = 0;
@@ -758,8 +790,6 @@ void ImageHelper::changeLayoutWithStages(VkImageAspectFlags aspectMask,
         imageMemoryBarrier.dstAccessMask |= VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
     }
 
-    commandBuffer->singleImageBarrier(srcStageMask, dstStageMask, 0, imageMemoryBarrier);
-
     mCurrentLayout = newLayout;
 }
 
@@ -106,6 +106,14 @@ class DynamicDescriptorPool final : angle::NonCopyable
                                  uint32_t descriptorSetCount,
                                  VkDescriptorSet *descriptorSetsOut);
 
+    // Texture descriptor sets that were allocated from the current pool and written with the
+    // bindings in 'desc' can be reused as long as the pool is alive. The cache is emptied when
+    // the pool fills up and is retired.
+    bool getCachedTextureDescriptorSet(const TextureDescriptorDesc &desc,
+                                       VkDescriptorSet *descriptorSetOut) const;
+    void cacheTextureDescriptorSet(const TextureDescriptorDesc &desc,
+                                   VkDescriptorSet descriptorSet);
+
     // For testing only!
     void setMaxSetsPerPoolForTesting(uint32_t maxSetsPerPool);
 
@@ -117,6 +125,8 @@ class DynamicDescriptorPool final : angle::NonCopyable
     size_t mCurrentAllocatedDescriptorSetCount;
     uint32_t mUniformBufferDescriptorsPerSet;
     uint32_t mCombinedImageSamplerDescriptorsPerSet;
+
+    std::unordered_map<TextureDescriptorDesc, VkDescriptorSet> mTextureDescriptorSetCache;
 };
 
 // This class' responsibility is to create index buffers needed to support line loops in Vulkan.
@@ -216,6 +226,12 @@ class ImageHelper final : angle::NonCopyable
                                 VkPipelineStageFlags dstStageMask,
                                 CommandBuffer *commandBuffer);
 
+    // Like changeLayoutWithStages, but returns the barrier instead of recording it. This lets the
+    // caller batch the transitions of several images into one vkCmdPipelineBarrier call.
+    void changeLayoutDeferred(VkImageAspectFlags aspectMask,
+                              VkImageLayout newLayout,
+                              VkImageMemoryBarrier *imageMemoryBarrierOut);
+
     void clearColor(const VkClearColorValue &color, CommandBuffer *commandBuffer);
 
     void clearDepthStencil(VkImageAspectFlags aspectFlags,
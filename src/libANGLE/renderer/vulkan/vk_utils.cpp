@@ -393,6 +393,22 @@ Error CommandBuffer::reset()
     return NoError();
 }
 
+void CommandBuffer::pipelineBarrier(VkPipelineStageFlags srcStageMask,
+                                    VkPipelineStageFlags dstStageMask,
+                                    VkDependencyFlags dependencyFlags,
+                                    uint32_t memoryBarrierCount,
+                                    const VkMemoryBarrier *memoryBarriers,
+                                    uint32_t bufferMemoryBarrierCount,
+                                    const VkBufferMemoryBarrier *bufferMemoryBarriers,
+                                    uint32_t imageMemoryBarrierCount,
+                                    const VkImageMemoryBarrier *imageMemoryBarriers)
+{
+    ASSERT(valid());
+    vkCmdPipelineBarrier(mHandle, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount,
+                         memoryBarriers, bufferMemoryBarrierCount, bufferMemoryBarriers,
+                         imageMemoryBarrierCount, imageMemoryBarriers);
+}
+
 void CommandBuffer::singleImageBarrier(VkPipelineStageFlags srcStageMask,
                                        VkPipelineStageFlags dstStageMask,
                                        VkDependencyFlags dependencyFlags,
@@ -580,6 +596,16 @@ void CommandBuffer::bindDescriptorSets(VkPipelineBindPoint bindPoint,
                             descriptorSets, dynamicOffsetCount, dynamicOffsets);
 }
 
+void CommandBuffer::pushConstants(const PipelineLayout &layout,
+                                  VkShaderStageFlags stageFlags,
+                                  uint32_t offset,
+                                  uint32_t size,
+                                  const void *data)
+{
+    ASSERT(valid());
+    vkCmdPushConstants(mHandle, layout.getHandle(), stageFlags, offset, size, data);
+}
+
 void CommandBuffer::executeCommands(uint32_t commandBufferCount,
                                     const vk::CommandBuffer *commandBuffers)
 {
@@ -587,6 +613,13 @@ void CommandBuffer::executeCommands(uint32_t commandBufferCount,
     vkCmdExecuteCommands(mHandle, commandBufferCount, commandBuffers[0].ptr());
 }
 
+void CommandBuffer::executeCommands(uint32_t commandBufferCount,
+                                    const VkCommandBuffer *commandBuffers)
+{
+    ASSERT(valid());
+    vkCmdExecuteCommands(mHandle, commandBufferCount, commandBuffers);
+}
+
 void CommandBuffer::updateBuffer(const vk::Buffer &buffer,
                                  VkDeviceSize dstOffset,
                                  VkDeviceSize dataSize,
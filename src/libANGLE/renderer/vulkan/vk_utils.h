@@ -319,6 +319,16 @@ class CommandBuffer : public WrappedObject<CommandBuffer, VkCommandBuffer>
     Error end();
     Error reset();
 
+    void pipelineBarrier(VkPipelineStageFlags srcStageMask,
+                         VkPipelineStageFlags dstStageMask,
+                         VkDependencyFlags dependencyFlags,
+                         uint32_t memoryBarrierCount,
+                         const VkMemoryBarrier *memoryBarriers,
+                         uint32_t bufferMemoryBarrierCount,
+                         const VkBufferMemoryBarrier *bufferMemoryBarriers,
+                         uint32_t imageMemoryBarrierCount,
+                         const VkImageMemoryBarrier *imageMemoryBarriers);
+
     void singleImageBarrier(VkPipelineStageFlags srcStageMask,
                             VkPipelineStageFlags dstStageMask,
                             VkDependencyFlags dependencyFlags,
@@ -399,8 +409,14 @@ class CommandBuffer : public WrappedObject<CommandBuffer, VkCommandBuffer>
                             const VkDescriptorSet *descriptorSets,
                             uint32_t dynamicOffsetCount,
                             const uint32_t *dynamicOffsets);
+    void pushConstants(const PipelineLayout &layout,
+                       VkShaderStageFlags stageFlags,
+                       uint32_t offset,
+                       uint32_t size,
+                       const void *data);
 
     void executeCommands(uint32_t commandBufferCount, const CommandBuffer *commandBuffers);
+    void executeCommands(uint32_t commandBufferCount, const VkCommandBuffer *commandBuffers);
     void updateBuffer(const vk::Buffer &buffer,
                       VkDeviceSize dstOffset,
                       VkDeviceSize dataSize,
@@ -114,65 +114,23 @@ bool ValidateDrawAttribs(Context *context, GLint primcount, GLint maxVertex, GLi
         return true;
     }
 
-    const auto &vertexAttribs  = vao->getVertexAttributes();
-    const auto &vertexBindings = vao->getVertexBindings();
-
     bool isGLES1 = context->getClientVersion() < Version(2, 0);
 
     const AttributesMask &activeAttribs = ((isGLES1 ? context->getVertexArraysAttributeMask()
                                                     : program->getActiveAttribLocationsMask()) &
                                            vao->getEnabledAttributesMask() & ~clientAttribs);
 
-    for (size_t attributeIndex : activeAttribs)
+    // [OpenGL ES 3.0.2] section 2.9.4 page 40:
+    // We can return INVALID_OPERATION if our array buffer does not have enough backing data.
+    // The VertexArray keeps how many elements each attribute can fetch from its buffer, so this
+    // doesn't need to look at the attributes one by one. The max vertex comes from an unsigned
+    // index range, so it is read back as unsigned.
+    GLint64 maxVertexIndex = static_cast<GLint64>(static_cast<GLuint>(maxVertex));
+    if (maxVertexIndex > vao->getCachedMaxVertexIndex(activeAttribs) ||
+        static_cast<GLint64>(primcount) - 1 > vao->getCachedMaxInstanceIndex(activeAttribs))
     {
-        const VertexAttribute &attrib = vertexAttribs[attributeIndex];
-        ASSERT(attrib.enabled);
-
-        const VertexBinding &binding = vertexBindings[attrib.bindingIndex];
-        ASSERT(isGLES1 || program->isAttribLocationActive(attributeIndex));
-
-        GLint maxVertexElement = maxVertex;
-        GLuint divisor         = binding.getDivisor();
-        if (divisor != 0)
-        {
-            maxVertexElement = (primcount - 1) / divisor;
-        }
-
-        // We do manual overflow checks here instead of using safe_math.h because it was
-        // a bottleneck. Thanks to some properties of GL we know inequalities that can
-        // help us make the overflow checks faster.
-
-        // The max possible attribSize is 16 for a vector of 4 32 bit values.
-        constexpr uint64_t kMaxAttribSize = 16;
-        constexpr uint64_t kIntMax        = std::numeric_limits<int>::max();
-        constexpr uint64_t kUint64Max     = std::numeric_limits<uint64_t>::max();
-
-        // We know attribStride is given as a GLsizei which is typedefed to int.
-        // We also know an upper bound for attribSize.
-        static_assert(std::is_same<int, GLsizei>::value, "Unexpected type");
-        ASSERT(ComputeVertexAttributeStride(attrib, binding) == binding.getStride());
-        uint64_t attribStride = binding.getStride();
-        ASSERT(attribStride <= kIntMax && ComputeVertexAttributeTypeSize(attrib) <= kMaxAttribSize);
-
-        // Computing the product of two 32-bit ints will fit in 64 bits without overflow.
-        static_assert(kIntMax * kIntMax < kUint64Max, "Unexpected overflow");
-        uint64_t attribDataSizeMinusAttribSize = maxVertexElement * attribStride;
-
-        // An overflow can happen when adding the offset, check for it.
-        if (attribDataSizeMinusAttribSize > kUint64Max - attrib.cachedSizePlusRelativeOffset)
-        {
-            ANGLE_VALIDATION_ERR(context, InvalidOperation(), IntegerOverflow);
-            return false;
-        }
-
-        // [OpenGL ES 3.0.2] section 2.9.4 page 40:
-        // We can return INVALID_OPERATION if our array buffer does not have enough backing data.
-        if (attribDataSizeMinusAttribSize + attrib.cachedSizePlusRelativeOffset >
-            binding.getCachedBufferSizeMinusOffset())
-        {
-            ANGLE_VALIDATION_ERR(context, InvalidOperation(), InsufficientVertexBufferSize);
-            return false;
-        }
+        ANGLE_VALIDATION_ERR(context, InvalidOperation(), InsufficientVertexBufferSize);
+        return false;
     }
 
     if (webglCompatibility && vao->hasTransformFeedbackBindingConflict(activeAttribs))
@@ -1066,6 +1024,30 @@ bool ValidateWebGLVertexAttribPointer(Context *context,
     return true;
 }
 
+bool ValidateWebGLBufferType(Context *context, BufferBinding target, GLuint buffer)
+{
+    ASSERT(context->getExtensions().webglCompatibility);
+
+    // WebGL 1.0 [Section 6.1] and WebGL 2.0 [Section 5.1]: The copy targets accept buffers of
+    // either type.
+    const Buffer *bufferObject = context->getBuffer(buffer);
+    if (bufferObject == nullptr || target == BufferBinding::CopyRead ||
+        target == BufferBinding::CopyWrite)
+    {
+        return true;
+    }
+
+    WebGLBufferType webglType = bufferObject->getWebGLType();
+    if ((webglType == WebGLBufferType::ElementArray && target != BufferBinding::ElementArray) ||
+        (webglType == WebGLBufferType::OtherData && target == BufferBinding::ElementArray))
+    {
+        ANGLE_VALIDATION_ERR(context, InvalidOperation(), BufferWebGLTypeMismatch);
+        return false;
+    }
+
+    return true;
+}
+
 Program *GetValidProgram(Context *context, GLuint id)
 {
     // ES3 spec (section 2.11.1) -- "Commands that accept shader or program object names will
@@ -83,6 +83,9 @@ bool ValidateWebGLVertexAttribPointer(Context *context,
                                       const void *ptr,
                                       bool pureInteger);
 
+// WebGL buffers that held indices can't be bound to other data targets, and vice versa.
+bool ValidateWebGLBufferType(Context *context, BufferBinding target, GLuint buffer);
+
 // Returns valid program if id is a valid program name
 // Errors INVALID_OPERATION if valid shader is given and returns NULL
 // Errors INVALID_VALUE otherwise and returns NULL
@@ -4419,6 +4419,12 @@ bool ValidateBindBuffer(Context *context, BufferBinding target, GLuint buffer)
         return false;
     }
 
+    if (context->getExtensions().webglCompatibility &&
+        !ValidateWebGLBufferType(context, target, buffer))
+    {
+        return false;
+    }
+
     return true;
 }
 
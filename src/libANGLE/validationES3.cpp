@@ -1595,6 +1595,12 @@ static bool ValidateBindBufferCommon(Context *context,
             return false;
     }
 
+    if (context->getExtensions().webglCompatibility &&
+        !ValidateWebGLBufferType(context, target, buffer))
+    {
+        return false;
+    }
+
     return true;
 }
 
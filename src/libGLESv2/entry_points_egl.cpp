@@ -67,6 +67,7 @@ EGLint EGLAPIENTRY GetError(void)
 EGLDisplay EGLAPIENTRY GetDisplay(EGLNativeDisplayType display_id)
 {
     EVENT("(EGLNativeDisplayType display_id = 0x%0.8p)", display_id);
+    ANGLE_SCOPED_GLOBAL_LOCK();
 
     return Display::GetDisplayFromNativeDisplay(display_id, AttributeMap());
 }
@@ -75,6 +76,8 @@ EGLBoolean EGLAPIENTRY Initialize(EGLDisplay dpy, EGLint *major, EGLint *minor)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLint *major = 0x%0.8p, EGLint *minor = 0x%0.8p)", dpy,
           major, minor);
+    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_DISPLAY_LOCK(dpy);
     Thread *thread = GetCurrentThread();
 
     Display *display = static_cast<Display *>(dpy);
@@ -103,6 +106,8 @@ EGLBoolean EGLAPIENTRY Initialize(EGLDisplay dpy, EGLint *major, EGLint *minor)
 EGLBoolean EGLAPIENTRY Terminate(EGLDisplay dpy)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p)", dpy);
+    ANGLE_SCOPED_GLOBAL_LOCK();
+    ANGLE_SCOPED_DISPLAY_LOCK(dpy);
     Thread *thread = GetCurrentThread();
 
     Display *display = static_cast<Display *>(dpy);
@@ -131,6 +136,7 @@ EGLBoolean EGLAPIENTRY Terminate(EGLDisplay dpy)
 const char *EGLAPIENTRY QueryString(EGLDisplay dpy, EGLint name)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLint name = %d)", dpy, name);
+    ANGLE_SCOPED_DISPLAY_LOCK(dpy);
     Thread *thread = GetCurrentThread();
 
     Display *display = static_cast<Display *>(dpy);
@@ -184,6 +190,7 @@ EGLBoolean EGLAPIENTRY GetConfigs(EGLDisplay dpy,
         "(EGLDisplay dpy = 0x%0.8p, EGLConfig *configs = 0x%0.8p, "
         "EGLint config_size = %d, EGLint *num_config = 0x%0.8p)",
         dpy, configs, config_size, num_config);
+    ANGLE_SCOPED_DISPLAY_LOCK(dpy);
     Thread *thread = GetCurrentThread();
 
     Display *display = static_cast<Display *>(dpy);
@@ -211,6 +218,7 @@ EGLBoolean EGLAPIENTRY ChooseConfig(EGLDisplay dpy,
         "(EGLDisplay dpy = 0x%0.8p, const EGLint *attrib_list = 0x%0.8p, "
         "EGLConfig *configs = 0x%0.8p, EGLint config_size = %d, EGLint *num_config = 0x%0.8p)",
         dpy, attrib_list, configs, config_size, num_config);
+    ANGLE_SCOPED_DISPLAY_LOCK(dpy);
     Thread *thread = GetCurrentThread();
 
     Display *display       = static_cast<Display *>(dpy);
@@ -238,6 +246,7 @@ EGLBoolean EGLAPIENTRY GetConfigAttrib(EGLDisplay dpy,
         "(EGLDisplay dpy = 0x%0.8p, EGLConfig config = 0x%0.8p, EGLint attribute = %d, EGLint "
         "*value = 0x%0.8p)",
         dpy, config, attribute, value);
+    ANGLE_SCOPED_DISPLAY_LOCK(dpy);
     Thread *thread = GetCurrentThread();
 
     Display *display      = static_cast<Display *>(dpy);
@@ -265,6 +274,7 @@ EGLSurface EGLAPIENTRY CreateWindowSurface(EGLDisplay dpy,
         "(EGLDisplay dpy = 0x%0.8p, EGLConfig config = 0x%0.8p, EGLNativeWindowType win = 0x%0.8p, "
         "const EGLint *attrib_list = 0x%0.8p)",
         dpy, config, win, attrib_list);
+    ANGLE_SCOPED_DISPLAY_LOCK(dpy);
     Thread *thread = GetCurrentThread();
 
     Display *display        = static_cast<Display *>(dpy);
@@ -297,6 +307,7 @@ EGLSurface EGLAPIENTRY CreatePbufferSurface(EGLDisplay dpy,
         "(EGLDisplay dpy = 0x%0.8p, EGLConfig config = 0x%0.8p, const EGLint *attrib_list = "
         "0x%0.8p)",
         dpy, config, attrib_list);
+    ANGLE_SCOPED_DISPLAY_LOCK(dpy);
     Thread *thread = GetCurrentThread();
 
     Display *display        = static_cast<Display *>(dpy);
@@ -331,6 +342,7 @@ EGLSurface EGLAPIENTRY CreatePixmapSurface(EGLDisplay dpy,
         "0x%0.8p, "
         "const EGLint *attrib_list = 0x%0.8p)",
         dpy, config, pixmap, attrib_list);
+    ANGLE_SCOPED_DISPLAY_LOCK(dpy);
     Thread *thread = GetCurrentThread();
 
     Display *display      = static_cast<Display *>(dpy);
@@ -352,6 +364,7 @@ EGLSurface EGLAPIENTRY CreatePixmapSurface(EGLDisplay dpy,
 EGLBoolean EGLAPIENTRY DestroySurface(EGLDisplay dpy, EGLSurface surface)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p)", dpy, surface);
+    ANGLE_SCOPED_DISPLAY_LOCK(dpy);
     Thread *thread = GetCurrentThread();
 
     Display *display    = static_cast<Display *>(dpy);
@@ -390,6 +403,7 @@ EGLBoolean EGLAPIENTRY QuerySurface(EGLDisplay dpy,
         "(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p, EGLint attribute = %d, EGLint "
         "*value = 0x%0.8p)",
         dpy, surface, attribute, value);
+    ANGLE_SCOPED_DISPLAY_LOCK(dpy);
     Thread *thread = GetCurrentThread();
 
     const Display *display    = static_cast<const Display *>(dpy);
@@ -418,6 +432,7 @@ EGLContext EGLAPIENTRY CreateContext(EGLDisplay dpy,
         "0x%0.8p, "
         "const EGLint *attrib_list = 0x%0.8p)",
         dpy, config, share_context, attrib_list);
+    ANGLE_SCOPED_DISPLAY_LOCK(dpy);
     Thread *thread = GetCurrentThread();
 
     Display *display             = static_cast<Display *>(dpy);
@@ -447,6 +462,7 @@ EGLContext EGLAPIENTRY CreateContext(EGLDisplay dpy,
 EGLBoolean EGLAPIENTRY DestroyContext(EGLDisplay dpy, EGLContext ctx)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLContext ctx = 0x%0.8p)", dpy, ctx);
+    ANGLE_SCOPED_DISPLAY_LOCK(dpy);
     Thread *thread = GetCurrentThread();
 
     Display *display     = static_cast<Display *>(dpy);
@@ -487,6 +503,8 @@ EGLBoolean EGLAPIENTRY MakeCurrent(EGLDisplay dpy, EGLSurface draw, EGLSurface r
         "(EGLDisplay dpy = 0x%0.8p, EGLSurface draw = 0x%0.8p, EGLSurface read = 0x%0.8p, "
         "EGLContext ctx = 0x%0.8p)",
         dpy, draw, read, ctx);
+    // Also lock the display of the context this thread releases, if it belongs to another one.
+    ScopedDisplayLock displayLock(GetDisplayMutex(dpy), GetCurrentContextDisplayMutex());
     Thread *thread = GetCurrentThread();
 
     Display *display     = static_cast<Display *>(dpy);
@@ -568,6 +586,7 @@ EGLBoolean EGLAPIENTRY QueryContext(EGLDisplay dpy, EGLContext ctx, EGLint attri
         "(EGLDisplay dpy = 0x%0.8p, EGLContext ctx = 0x%0.8p, EGLint attribute = %d, EGLint *value "
         "= 0x%0.8p)",
         dpy, ctx, attribute, value);
+    ANGLE_SCOPED_DISPLAY_LOCK(dpy);
     Thread *thread = GetCurrentThread();
 
     Display *display     = static_cast<Display *>(dpy);
@@ -589,6 +608,7 @@ EGLBoolean EGLAPIENTRY QueryContext(EGLDisplay dpy, EGLContext ctx, EGLint attri
 EGLBoolean EGLAPIENTRY WaitGL(void)
 {
     EVENT("()");
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Thread *thread = GetCurrentThread();
 
     Display *display = thread->getCurrentDisplay();
@@ -616,6 +636,7 @@ EGLBoolean EGLAPIENTRY WaitGL(void)
 EGLBoolean EGLAPIENTRY WaitNative(EGLint engine)
 {
     EVENT("(EGLint engine = %d)", engine);
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Thread *thread = GetCurrentThread();
 
     Display *display = thread->getCurrentDisplay();
@@ -646,6 +667,7 @@ EGLBoolean EGLAPIENTRY WaitNative(EGLint engine)
 EGLBoolean EGLAPIENTRY SwapBuffers(EGLDisplay dpy, EGLSurface surface)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p)", dpy, surface);
+    ANGLE_SCOPED_DISPLAY_LOCK(dpy);
     Thread *thread = GetCurrentThread();
 
     Display *display    = static_cast<Display *>(dpy);
@@ -676,6 +698,7 @@ EGLBoolean EGLAPIENTRY SwapBuffers(EGLDisplay dpy, EGLSurface surface)
         return EGL_FALSE;
     }
 
+    thread->getContext()->throttleSwap();
     error = eglSurface->swap(thread->getContext());
     if (error.isError())
     {
@@ -693,6 +716,7 @@ EGLBoolean EGLAPIENTRY CopyBuffers(EGLDisplay dpy, EGLSurface surface, EGLNative
         "(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p, EGLNativePixmapType target = "
         "0x%0.8p)",
         dpy, surface, target);
+    ANGLE_SCOPED_DISPLAY_LOCK(dpy);
     Thread *thread = GetCurrentThread();
 
     Display *display    = static_cast<Display *>(dpy);
@@ -722,6 +746,7 @@ EGLBoolean EGLAPIENTRY BindTexImage(EGLDisplay dpy, EGLSurface surface, EGLint b
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p, EGLint buffer = %d)", dpy,
           surface, buffer);
+    ANGLE_SCOPED_DISPLAY_LOCK(dpy);
     Thread *thread = GetCurrentThread();
 
     Display *display    = static_cast<Display *>(dpy);
@@ -793,6 +818,7 @@ EGLBoolean EGLAPIENTRY SurfaceAttrib(EGLDisplay dpy,
         "(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p, EGLint attribute = %d, EGLint "
         "value = %d)",
         dpy, surface, attribute, value);
+    ANGLE_SCOPED_DISPLAY_LOCK(dpy);
     Thread *thread = GetCurrentThread();
 
     Display *display    = static_cast<Display *>(dpy);
@@ -815,6 +841,7 @@ EGLBoolean EGLAPIENTRY ReleaseTexImage(EGLDisplay dpy, EGLSurface surface, EGLin
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p, EGLint buffer = %d)", dpy,
           surface, buffer);
+    ANGLE_SCOPED_DISPLAY_LOCK(dpy);
     Thread *thread = GetCurrentThread();
 
     Display *display    = static_cast<Display *>(dpy);
@@ -864,6 +891,7 @@ EGLBoolean EGLAPIENTRY ReleaseTexImage(EGLDisplay dpy, EGLSurface surface, EGLin
 EGLBoolean EGLAPIENTRY SwapInterval(EGLDisplay dpy, EGLint interval)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLint interval = %d)", dpy, interval);
+    ANGLE_SCOPED_DISPLAY_LOCK(dpy);
     Thread *thread = GetCurrentThread();
 
     Display *display = static_cast<Display *>(dpy);
@@ -939,6 +967,7 @@ EGLSurface EGLAPIENTRY CreatePbufferFromClientBuffer(EGLDisplay dpy,
         "(EGLDisplay dpy = 0x%0.8p, EGLenum buftype = 0x%X, EGLClientBuffer buffer = 0x%0.8p, "
         "EGLConfig config = 0x%0.8p, const EGLint *attrib_list = 0x%0.8p)",
         dpy, buftype, buffer, config, attrib_list);
+    ANGLE_SCOPED_DISPLAY_LOCK(dpy);
     Thread *thread = GetCurrentThread();
 
     Display *display        = static_cast<Display *>(dpy);
@@ -979,6 +1008,7 @@ EGLBoolean EGLAPIENTRY ReleaseThread(void)
 EGLBoolean EGLAPIENTRY WaitClient(void)
 {
     EVENT("()");
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Thread *thread = GetCurrentThread();
 
     Display *display = thread->getCurrentDisplay();
@@ -1018,6 +1048,7 @@ EGLSync EGLAPIENTRY CreateSync(EGLDisplay dpy, EGLenum type, const EGLAttrib *at
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLenum type = 0x%X, const EGLint* attrib_list = 0x%0.8p)",
           dpy, type, attrib_list);
+    ANGLE_SCOPED_DISPLAY_LOCK(dpy);
     Thread *thread = GetCurrentThread();
 
     UNIMPLEMENTED();
@@ -1028,6 +1059,7 @@ EGLSync EGLAPIENTRY CreateSync(EGLDisplay dpy, EGLenum type, const EGLAttrib *at
 EGLBoolean EGLAPIENTRY DestroySync(EGLDisplay dpy, EGLSync sync)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSync sync = 0x%0.8p)", dpy, sync);
+    ANGLE_SCOPED_DISPLAY_LOCK(dpy);
     Thread *thread = GetCurrentThread();
 
     UNIMPLEMENTED();
@@ -1041,6 +1073,7 @@ EGLint EGLAPIENTRY ClientWaitSync(EGLDisplay dpy, EGLSync sync, EGLint flags, EG
         "(EGLDisplay dpy = 0x%0.8p, EGLSync sync = 0x%0.8p, EGLint flags = 0x%X, EGLTime timeout = "
         "%d)",
         dpy, sync, flags, timeout);
+    ANGLE_SCOPED_DISPLAY_LOCK(dpy);
     Thread *thread = GetCurrentThread();
 
     UNIMPLEMENTED();
@@ -1057,6 +1090,7 @@ EGLBoolean EGLAPIENTRY GetSyncAttrib(EGLDisplay dpy,
         "(EGLDisplay dpy = 0x%0.8p, EGLSync sync = 0x%0.8p, EGLint attribute = 0x%X, EGLAttrib "
         "*value = 0x%0.8p)",
         dpy, sync, attribute, value);
+    ANGLE_SCOPED_DISPLAY_LOCK(dpy);
     Thread *thread = GetCurrentThread();
 
     UNIMPLEMENTED();
@@ -1074,6 +1108,7 @@ EGLImage EGLAPIENTRY CreateImage(EGLDisplay dpy,
         "(EGLDisplay dpy = 0x%0.8p, EGLContext ctx = 0x%0.8p, EGLenum target = 0x%X, "
         "EGLClientBuffer buffer = 0x%0.8p, const EGLAttrib *attrib_list = 0x%0.8p)",
         dpy, ctx, target, buffer, attrib_list);
+    ANGLE_SCOPED_DISPLAY_LOCK(dpy);
     Thread *thread = GetCurrentThread();
 
     UNIMPLEMENTED();
@@ -1084,6 +1119,7 @@ EGLImage EGLAPIENTRY CreateImage(EGLDisplay dpy,
 EGLBoolean EGLAPIENTRY DestroyImage(EGLDisplay dpy, EGLImage image)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLImage image = 0x%0.8p)", dpy, image);
+    ANGLE_SCOPED_DISPLAY_LOCK(dpy);
     Thread *thread = GetCurrentThread();
 
     UNIMPLEMENTED();
@@ -1099,6 +1135,7 @@ EGLDisplay EGLAPIENTRY GetPlatformDisplay(EGLenum platform,
         "(EGLenum platform = %d, void* native_display = 0x%0.8p, const EGLint* attrib_list = "
         "0x%0.8p)",
         platform, native_display, attrib_list);
+    ANGLE_SCOPED_GLOBAL_LOCK();
     Thread *thread = GetCurrentThread();
 
     Error err = ValidateGetPlatformDisplay(platform, native_display, attrib_list);
@@ -1135,6 +1172,7 @@ EGLSurface EGLAPIENTRY CreatePlatformWindowSurface(EGLDisplay dpy,
         "(EGLDisplay dpy = 0x%0.8p, EGLConfig config = 0x%0.8p, void* native_window = 0x%0.8p, "
         "const EGLint* attrib_list = 0x%0.8p)",
         dpy, config, native_window, attrib_list);
+    ANGLE_SCOPED_DISPLAY_LOCK(dpy);
     Thread *thread = GetCurrentThread();
 
     UNIMPLEMENTED();
@@ -1151,6 +1189,7 @@ EGLSurface EGLAPIENTRY CreatePlatformPixmapSurface(EGLDisplay dpy,
         "(EGLDisplay dpy = 0x%0.8p, EGLConfig config = 0x%0.8p, void* native_pixmap = 0x%0.8p, "
         "const EGLint* attrib_list = 0x%0.8p)",
         dpy, config, native_pixmap, attrib_list);
+    ANGLE_SCOPED_DISPLAY_LOCK(dpy);
     Thread *thread = GetCurrentThread();
 
     UNIMPLEMENTED();
@@ -1162,6 +1201,7 @@ EGLBoolean EGLAPIENTRY WaitSync(EGLDisplay dpy, EGLSync sync, EGLint flags)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSync sync = 0x%0.8p, EGLint flags = 0x%X)", dpy, sync,
           flags);
+    ANGLE_SCOPED_DISPLAY_LOCK(dpy);
     Thread *thread = GetCurrentThread();
 
     UNIMPLEMENTED();
@@ -20,14 +20,17 @@ void GL_APIENTRY AlphaFunc(GLenum func, GLfloat ref)
 {
     EVENT("(GLenum func = 0x%X, GLfloat ref = %f)", func, ref);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::AlphaFunc);
         AlphaTestFunc funcPacked = FromGLenum<AlphaTestFunc>(func);
         context->gatherParams<EntryPoint::AlphaFunc>(funcPacked, ref);
 
         if (context->skipValidation() || ValidateAlphaFunc(context, funcPacked, ref))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->alphaFunc(funcPacked, ref);
         }
     }
@@ -37,14 +40,17 @@ void GL_APIENTRY AlphaFuncx(GLenum func, GLfixed ref)
 {
     EVENT("(GLenum func = 0x%X, GLfixed ref = 0x%X)", func, ref);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::AlphaFuncx);
         AlphaTestFunc funcPacked = FromGLenum<AlphaTestFunc>(func);
         context->gatherParams<EntryPoint::AlphaFuncx>(funcPacked, ref);
 
         if (context->skipValidation() || ValidateAlphaFuncx(context, funcPacked, ref))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->alphaFuncx(funcPacked, ref);
         }
     }
@@ -55,13 +61,16 @@ void GL_APIENTRY ClearColorx(GLfixed red, GLfixed green, GLfixed blue, GLfixed a
     EVENT("(GLfixed red = 0x%X, GLfixed green = 0x%X, GLfixed blue = 0x%X, GLfixed alpha = 0x%X)",
           red, green, blue, alpha);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ClearColorx);
         context->gatherParams<EntryPoint::ClearColorx>(red, green, blue, alpha);
 
         if (context->skipValidation() || ValidateClearColorx(context, red, green, blue, alpha))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->clearColorx(red, green, blue, alpha);
         }
     }
@@ -71,13 +80,16 @@ void GL_APIENTRY ClearDepthx(GLfixed depth)
 {
     EVENT("(GLfixed depth = 0x%X)", depth);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ClearDepthx);
         context->gatherParams<EntryPoint::ClearDepthx>(depth);
 
         if (context->skipValidation() || ValidateClearDepthx(context, depth))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->clearDepthx(depth);
         }
     }
@@ -87,13 +99,16 @@ void GL_APIENTRY ClientActiveTexture(GLenum texture)
 {
     EVENT("(GLenum texture = 0x%X)", texture);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ClientActiveTexture);
         context->gatherParams<EntryPoint::ClientActiveTexture>(texture);
 
         if (context->skipValidation() || ValidateClientActiveTexture(context, texture))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->clientActiveTexture(texture);
         }
     }
@@ -103,13 +118,16 @@ void GL_APIENTRY ClipPlanef(GLenum p, const GLfloat *eqn)
 {
     EVENT("(GLenum p = 0x%X, const GLfloat *eqn = 0x%0.8p)", p, eqn);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ClipPlanef);
         context->gatherParams<EntryPoint::ClipPlanef>(p, eqn);
 
         if (context->skipValidation() || ValidateClipPlanef(context, p, eqn))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->clipPlanef(p, eqn);
         }
     }
@@ -119,13 +137,16 @@ void GL_APIENTRY ClipPlanex(GLenum plane, const GLfixed *equation)
 {
     EVENT("(GLenum plane = 0x%X, const GLfixed *equation = 0x%0.8p)", plane, equation);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ClipPlanex);
         context->gatherParams<EntryPoint::ClipPlanex>(plane, equation);
 
         if (context->skipValidation() || ValidateClipPlanex(context, plane, equation))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->clipPlanex(plane, equation);
         }
     }
@@ -136,13 +157,16 @@ void GL_APIENTRY Color4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha
     EVENT("(GLfloat red = %f, GLfloat green = %f, GLfloat blue = %f, GLfloat alpha = %f)", red,
           green, blue, alpha);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Color4f);
         context->gatherParams<EntryPoint::Color4f>(red, green, blue, alpha);
 
         if (context->skipValidation() || ValidateColor4f(context, red, green, blue, alpha))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->color4f(red, green, blue, alpha);
         }
     }
@@ -153,13 +177,16 @@ void GL_APIENTRY Color4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alph
     EVENT("(GLubyte red = %d, GLubyte green = %d, GLubyte blue = %d, GLubyte alpha = %d)", red,
           green, blue, alpha);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Color4ub);
         context->gatherParams<EntryPoint::Color4ub>(red, green, blue, alpha);
 
         if (context->skipValidation() || ValidateColor4ub(context, red, green, blue, alpha))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->color4ub(red, green, blue, alpha);
         }
     }
@@ -170,13 +197,16 @@ void GL_APIENTRY Color4x(GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha
     EVENT("(GLfixed red = 0x%X, GLfixed green = 0x%X, GLfixed blue = 0x%X, GLfixed alpha = 0x%X)",
           red, green, blue, alpha);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Color4x);
         context->gatherParams<EntryPoint::Color4x>(red, green, blue, alpha);
 
         if (context->skipValidation() || ValidateColor4x(context, red, green, blue, alpha))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->color4x(red, green, blue, alpha);
         }
     }
@@ -188,13 +218,16 @@ void GL_APIENTRY ColorPointer(GLint size, GLenum type, GLsizei stride, const voi
         "(GLint size = %d, GLenum type = 0x%X, GLsizei stride = %d, const void *pointer = 0x%0.8p)",
         size, type, stride, pointer);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ColorPointer);
         context->gatherParams<EntryPoint::ColorPointer>(size, type, stride, pointer);
 
         if (context->skipValidation() || ValidateColorPointer(context, size, type, stride, pointer))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->colorPointer(size, type, stride, pointer);
         }
     }
@@ -204,13 +237,16 @@ void GL_APIENTRY DepthRangex(GLfixed n, GLfixed f)
 {
     EVENT("(GLfixed n = 0x%X, GLfixed f = 0x%X)", n, f);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DepthRangex);
         context->gatherParams<EntryPoint::DepthRangex>(n, f);
 
         if (context->skipValidation() || ValidateDepthRangex(context, n, f))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->depthRangex(n, f);
         }
     }
@@ -220,14 +256,17 @@ void GL_APIENTRY DisableClientState(GLenum array)
 {
     EVENT("(GLenum array = 0x%X)", array);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DisableClientState);
         ClientVertexArrayType arrayPacked = FromGLenum<ClientVertexArrayType>(array);
         context->gatherParams<EntryPoint::DisableClientState>(arrayPacked);
 
         if (context->skipValidation() || ValidateDisableClientState(context, arrayPacked))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->disableClientState(arrayPacked);
         }
     }
@@ -237,14 +276,17 @@ void GL_APIENTRY EnableClientState(GLenum array)
 {
     EVENT("(GLenum array = 0x%X)", array);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::EnableClientState);
         ClientVertexArrayType arrayPacked = FromGLenum<ClientVertexArrayType>(array);
         context->gatherParams<EntryPoint::EnableClientState>(arrayPacked);
 
         if (context->skipValidation() || ValidateEnableClientState(context, arrayPacked))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->enableClientState(arrayPacked);
         }
     }
@@ -254,13 +296,16 @@ void GL_APIENTRY Fogf(GLenum pname, GLfloat param)
 {
     EVENT("(GLenum pname = 0x%X, GLfloat param = %f)", pname, param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Fogf);
         context->gatherParams<EntryPoint::Fogf>(pname, param);
 
         if (context->skipValidation() || ValidateFogf(context, pname, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->fogf(pname, param);
         }
     }
@@ -270,13 +315,16 @@ void GL_APIENTRY Fogfv(GLenum pname, const GLfloat *params)
 {
     EVENT("(GLenum pname = 0x%X, const GLfloat *params = 0x%0.8p)", pname, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Fogfv);
         context->gatherParams<EntryPoint::Fogfv>(pname, params);
 
         if (context->skipValidation() || ValidateFogfv(context, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->fogfv(pname, params);
         }
     }
@@ -286,13 +334,16 @@ void GL_APIENTRY Fogx(GLenum pname, GLfixed param)
 {
     EVENT("(GLenum pname = 0x%X, GLfixed param = 0x%X)", pname, param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Fogx);
         context->gatherParams<EntryPoint::Fogx>(pname, param);
 
         if (context->skipValidation() || ValidateFogx(context, pname, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->fogx(pname, param);
         }
     }
@@ -302,13 +353,16 @@ void GL_APIENTRY Fogxv(GLenum pname, const GLfixed *param)
 {
     EVENT("(GLenum pname = 0x%X, const GLfixed *param = 0x%0.8p)", pname, param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Fogxv);
         context->gatherParams<EntryPoint::Fogxv>(pname, param);
 
         if (context->skipValidation() || ValidateFogxv(context, pname, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->fogxv(pname, param);
         }
     }
@@ -321,13 +375,16 @@ void GL_APIENTRY Frustumf(GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n,
         "f = %f)",
         l, r, b, t, n, f);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Frustumf);
         context->gatherParams<EntryPoint::Frustumf>(l, r, b, t, n, f);
 
         if (context->skipValidation() || ValidateFrustumf(context, l, r, b, t, n, f))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->frustumf(l, r, b, t, n, f);
         }
     }
@@ -340,13 +397,16 @@ void GL_APIENTRY Frustumx(GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed n,
         "0x%X, GLfixed f = 0x%X)",
         l, r, b, t, n, f);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Frustumx);
         context->gatherParams<EntryPoint::Frustumx>(l, r, b, t, n, f);
 
         if (context->skipValidation() || ValidateFrustumx(context, l, r, b, t, n, f))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->frustumx(l, r, b, t, n, f);
         }
     }
@@ -356,13 +416,16 @@ void GL_APIENTRY GetClipPlanef(GLenum plane, GLfloat *equation)
 {
     EVENT("(GLenum plane = 0x%X, GLfloat *equation = 0x%0.8p)", plane, equation);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetClipPlanef);
         context->gatherParams<EntryPoint::GetClipPlanef>(plane, equation);
 
         if (context->skipValidation() || ValidateGetClipPlanef(context, plane, equation))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getClipPlanef(plane, equation);
         }
     }
@@ -372,13 +435,16 @@ void GL_APIENTRY GetClipPlanex(GLenum plane, GLfixed *equation)
 {
     EVENT("(GLenum plane = 0x%X, GLfixed *equation = 0x%0.8p)", plane, equation);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetClipPlanex);
         context->gatherParams<EntryPoint::GetClipPlanex>(plane, equation);
 
         if (context->skipValidation() || ValidateGetClipPlanex(context, plane, equation))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getClipPlanex(plane, equation);
         }
     }
@@ -388,13 +454,16 @@ void GL_APIENTRY GetFixedv(GLenum pname, GLfixed *params)
 {
     EVENT("(GLenum pname = 0x%X, GLfixed *params = 0x%0.8p)", pname, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetFixedv);
         context->gatherParams<EntryPoint::GetFixedv>(pname, params);
 
         if (context->skipValidation() || ValidateGetFixedv(context, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getFixedv(pname, params);
         }
     }
@@ -405,13 +474,16 @@ void GL_APIENTRY GetLightfv(GLenum light, GLenum pname, GLfloat *params)
     EVENT("(GLenum light = 0x%X, GLenum pname = 0x%X, GLfloat *params = 0x%0.8p)", light, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetLightfv);
         context->gatherParams<EntryPoint::GetLightfv>(light, pname, params);
 
         if (context->skipValidation() || ValidateGetLightfv(context, light, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getLightfv(light, pname, params);
         }
     }
@@ -422,13 +494,16 @@ void GL_APIENTRY GetLightxv(GLenum light, GLenum pname, GLfixed *params)
     EVENT("(GLenum light = 0x%X, GLenum pname = 0x%X, GLfixed *params = 0x%0.8p)", light, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetLightxv);
         context->gatherParams<EntryPoint::GetLightxv>(light, pname, params);
 
         if (context->skipValidation() || ValidateGetLightxv(context, light, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getLightxv(light, pname, params);
         }
     }
@@ -439,13 +514,16 @@ void GL_APIENTRY GetMaterialfv(GLenum face, GLenum pname, GLfloat *params)
     EVENT("(GLenum face = 0x%X, GLenum pname = 0x%X, GLfloat *params = 0x%0.8p)", face, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetMaterialfv);
         context->gatherParams<EntryPoint::GetMaterialfv>(face, pname, params);
 
         if (context->skipValidation() || ValidateGetMaterialfv(context, face, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getMaterialfv(face, pname, params);
         }
     }
@@ -456,13 +534,16 @@ void GL_APIENTRY GetMaterialxv(GLenum face, GLenum pname, GLfixed *params)
     EVENT("(GLenum face = 0x%X, GLenum pname = 0x%X, GLfixed *params = 0x%0.8p)", face, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetMaterialxv);
         context->gatherParams<EntryPoint::GetMaterialxv>(face, pname, params);
 
         if (context->skipValidation() || ValidateGetMaterialxv(context, face, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getMaterialxv(face, pname, params);
         }
     }
@@ -472,13 +553,16 @@ void GL_APIENTRY GetPointerv(GLenum pname, void **params)
 {
     EVENT("(GLenum pname = 0x%X, void **params = 0x%0.8p)", pname, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetPointerv);
         context->gatherParams<EntryPoint::GetPointerv>(pname, params);
 
         if (context->skipValidation() || ValidateGetPointerv(context, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getPointerv(pname, params);
         }
     }
@@ -489,13 +573,16 @@ void GL_APIENTRY GetTexEnvfv(GLenum target, GLenum pname, GLfloat *params)
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLfloat *params = 0x%0.8p)", target, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetTexEnvfv);
         context->gatherParams<EntryPoint::GetTexEnvfv>(target, pname, params);
 
         if (context->skipValidation() || ValidateGetTexEnvfv(context, target, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getTexEnvfv(target, pname, params);
         }
     }
@@ -506,13 +593,16 @@ void GL_APIENTRY GetTexEnviv(GLenum target, GLenum pname, GLint *params)
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", target, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetTexEnviv);
         context->gatherParams<EntryPoint::GetTexEnviv>(target, pname, params);
 
         if (context->skipValidation() || ValidateGetTexEnviv(context, target, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getTexEnviv(target, pname, params);
         }
     }
@@ -523,13 +613,16 @@ void GL_APIENTRY GetTexEnvxv(GLenum target, GLenum pname, GLfixed *params)
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLfixed *params = 0x%0.8p)", target, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetTexEnvxv);
         context->gatherParams<EntryPoint::GetTexEnvxv>(target, pname, params);
 
         if (context->skipValidation() || ValidateGetTexEnvxv(context, target, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getTexEnvxv(target, pname, params);
         }
     }
@@ -540,15 +633,18 @@ void GL_APIENTRY GetTexParameterxv(GLenum target, GLenum pname, GLfixed *params)
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLfixed *params = 0x%0.8p)", target, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetTexParameterxv);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::GetTexParameterxv>(targetPacked, pname, params);
 
         if (context->skipValidation() ||
             ValidateGetTexParameterxv(context, targetPacked, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getTexParameterxv(targetPacked, pname, params);
         }
     }
@@ -558,13 +654,16 @@ void GL_APIENTRY LightModelf(GLenum pname, GLfloat param)
 {
     EVENT("(GLenum pname = 0x%X, GLfloat param = %f)", pname, param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::LightModelf);
         context->gatherParams<EntryPoint::LightModelf>(pname, param);
 
         if (context->skipValidation() || ValidateLightModelf(context, pname, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->lightModelf(pname, param);
         }
     }
@@ -574,13 +673,16 @@ void GL_APIENTRY LightModelfv(GLenum pname, const GLfloat *params)
 {
     EVENT("(GLenum pname = 0x%X, const GLfloat *params = 0x%0.8p)", pname, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::LightModelfv);
         context->gatherParams<EntryPoint::LightModelfv>(pname, params);
 
         if (context->skipValidation() || ValidateLightModelfv(context, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->lightModelfv(pname, params);
         }
     }
@@ -590,13 +692,16 @@ void GL_APIENTRY LightModelx(GLenum pname, GLfixed param)
 {
     EVENT("(GLenum pname = 0x%X, GLfixed param = 0x%X)", pname, param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::LightModelx);
         context->gatherParams<EntryPoint::LightModelx>(pname, param);
 
         if (context->skipValidation() || ValidateLightModelx(context, pname, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->lightModelx(pname, param);
         }
     }
@@ -606,13 +711,16 @@ void GL_APIENTRY LightModelxv(GLenum pname, const GLfixed *param)
 {
     EVENT("(GLenum pname = 0x%X, const GLfixed *param = 0x%0.8p)", pname, param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::LightModelxv);
         context->gatherParams<EntryPoint::LightModelxv>(pname, param);
 
         if (context->skipValidation() || ValidateLightModelxv(context, pname, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->lightModelxv(pname, param);
         }
     }
@@ -622,13 +730,16 @@ void GL_APIENTRY Lightf(GLenum light, GLenum pname, GLfloat param)
 {
     EVENT("(GLenum light = 0x%X, GLenum pname = 0x%X, GLfloat param = %f)", light, pname, param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Lightf);
         context->gatherParams<EntryPoint::Lightf>(light, pname, param);
 
         if (context->skipValidation() || ValidateLightf(context, light, pname, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->lightf(light, pname, param);
         }
     }
@@ -639,13 +750,16 @@ void GL_APIENTRY Lightfv(GLenum light, GLenum pname, const GLfloat *params)
     EVENT("(GLenum light = 0x%X, GLenum pname = 0x%X, const GLfloat *params = 0x%0.8p)", light,
           pname, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Lightfv);
         context->gatherParams<EntryPoint::Lightfv>(light, pname, params);
 
         if (context->skipValidation() || ValidateLightfv(context, light, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->lightfv(light, pname, params);
         }
     }
@@ -655,13 +769,16 @@ void GL_APIENTRY Lightx(GLenum light, GLenum pname, GLfixed param)
 {
     EVENT("(GLenum light = 0x%X, GLenum pname = 0x%X, GLfixed param = 0x%X)", light, pname, param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Lightx);
         context->gatherParams<EntryPoint::Lightx>(light, pname, param);
 
         if (context->skipValidation() || ValidateLightx(context, light, pname, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->lightx(light, pname, param);
         }
     }
@@ -672,13 +789,16 @@ void GL_APIENTRY Lightxv(GLenum light, GLenum pname, const GLfixed *params)
     EVENT("(GLenum light = 0x%X, GLenum pname = 0x%X, const GLfixed *params = 0x%0.8p)", light,
           pname, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Lightxv);
         context->gatherParams<EntryPoint::Lightxv>(light, pname, params);
 
         if (context->skipValidation() || ValidateLightxv(context, light, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->lightxv(light, pname, params);
         }
     }
@@ -688,13 +808,16 @@ void GL_APIENTRY LineWidthx(GLfixed width)
 {
     EVENT("(GLfixed width = 0x%X)", width);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::LineWidthx);
         context->gatherParams<EntryPoint::LineWidthx>(width);
 
         if (context->skipValidation() || ValidateLineWidthx(context, width))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->lineWidthx(width);
         }
     }
@@ -704,13 +827,16 @@ void GL_APIENTRY LoadIdentity()
 {
     EVENT("()");
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::LoadIdentity);
         context->gatherParams<EntryPoint::LoadIdentity>();
 
         if (context->skipValidation() || ValidateLoadIdentity(context))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->loadIdentity();
         }
     }
@@ -720,13 +846,16 @@ void GL_APIENTRY LoadMatrixf(const GLfloat *m)
 {
     EVENT("(const GLfloat *m = 0x%0.8p)", m);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::LoadMatrixf);
         context->gatherParams<EntryPoint::LoadMatrixf>(m);
 
         if (context->skipValidation() || ValidateLoadMatrixf(context, m))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->loadMatrixf(m);
         }
     }
@@ -736,13 +865,16 @@ void GL_APIENTRY LoadMatrixx(const GLfixed *m)
 {
     EVENT("(const GLfixed *m = 0x%0.8p)", m);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::LoadMatrixx);
         context->gatherParams<EntryPoint::LoadMatrixx>(m);
 
         if (context->skipValidation() || ValidateLoadMatrixx(context, m))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->loadMatrixx(m);
         }
     }
@@ -752,13 +884,16 @@ void GL_APIENTRY LogicOp(GLenum opcode)
 {
     EVENT("(GLenum opcode = 0x%X)", opcode);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::LogicOp);
         context->gatherParams<EntryPoint::LogicOp>(opcode);
 
         if (context->skipValidation() || ValidateLogicOp(context, opcode))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->logicOp(opcode);
         }
     }
@@ -768,13 +903,16 @@ void GL_APIENTRY Materialf(GLenum face, GLenum pname, GLfloat param)
 {
     EVENT("(GLenum face = 0x%X, GLenum pname = 0x%X, GLfloat param = %f)", face, pname, param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Materialf);
         context->gatherParams<EntryPoint::Materialf>(face, pname, param);
 
         if (context->skipValidation() || ValidateMaterialf(context, face, pname, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->materialf(face, pname, param);
         }
     }
@@ -785,13 +923,16 @@ void GL_APIENTRY Materialfv(GLenum face, GLenum pname, const GLfloat *params)
     EVENT("(GLenum face = 0x%X, GLenum pname = 0x%X, const GLfloat *params = 0x%0.8p)", face, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Materialfv);
         context->gatherParams<EntryPoint::Materialfv>(face, pname, params);
 
         if (context->skipValidation() || ValidateMaterialfv(context, face, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->materialfv(face, pname, params);
         }
     }
@@ -801,13 +942,16 @@ void GL_APIENTRY Materialx(GLenum face, GLenum pname, GLfixed param)
 {
     EVENT("(GLenum face = 0x%X, GLenum pname = 0x%X, GLfixed param = 0x%X)", face, pname, param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Materialx);
         context->gatherParams<EntryPoint::Materialx>(face, pname, param);
 
         if (context->skipValidation() || ValidateMaterialx(context, face, pname, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->materialx(face, pname, param);
         }
     }
@@ -818,13 +962,16 @@ void GL_APIENTRY Materialxv(GLenum face, GLenum pname, const GLfixed *param)
     EVENT("(GLenum face = 0x%X, GLenum pname = 0x%X, const GLfixed *param = 0x%0.8p)", face, pname,
           param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Materialxv);
         context->gatherParams<EntryPoint::Materialxv>(face, pname, param);
 
         if (context->skipValidation() || ValidateMaterialxv(context, face, pname, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->materialxv(face, pname, param);
         }
     }
@@ -834,14 +981,17 @@ void GL_APIENTRY MatrixMode(GLenum mode)
 {
     EVENT("(GLenum mode = 0x%X)", mode);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::MatrixMode);
         MatrixType modePacked = FromGLenum<MatrixType>(mode);
         context->gatherParams<EntryPoint::MatrixMode>(modePacked);
 
         if (context->skipValidation() || ValidateMatrixMode(context, modePacked))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->matrixMode(modePacked);
         }
     }
@@ -851,13 +1001,16 @@ void GL_APIENTRY MultMatrixf(const GLfloat *m)
 {
     EVENT("(const GLfloat *m = 0x%0.8p)", m);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::MultMatrixf);
         context->gatherParams<EntryPoint::MultMatrixf>(m);
 
         if (context->skipValidation() || ValidateMultMatrixf(context, m))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->multMatrixf(m);
         }
     }
@@ -867,13 +1020,16 @@ void GL_APIENTRY MultMatrixx(const GLfixed *m)
 {
     EVENT("(const GLfixed *m = 0x%0.8p)", m);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::MultMatrixx);
         context->gatherParams<EntryPoint::MultMatrixx>(m);
 
         if (context->skipValidation() || ValidateMultMatrixx(context, m))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->multMatrixx(m);
         }
     }
@@ -884,13 +1040,16 @@ void GL_APIENTRY MultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r,
     EVENT("(GLenum target = 0x%X, GLfloat s = %f, GLfloat t = %f, GLfloat r = %f, GLfloat q = %f)",
           target, s, t, r, q);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::MultiTexCoord4f);
         context->gatherParams<EntryPoint::MultiTexCoord4f>(target, s, t, r, q);
 
         if (context->skipValidation() || ValidateMultiTexCoord4f(context, target, s, t, r, q))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->multiTexCoord4f(target, s, t, r, q);
         }
     }
@@ -903,13 +1062,16 @@ void GL_APIENTRY MultiTexCoord4x(GLenum texture, GLfixed s, GLfixed t, GLfixed r
         "0x%X)",
         texture, s, t, r, q);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::MultiTexCoord4x);
         context->gatherParams<EntryPoint::MultiTexCoord4x>(texture, s, t, r, q);
 
         if (context->skipValidation() || ValidateMultiTexCoord4x(context, texture, s, t, r, q))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->multiTexCoord4x(texture, s, t, r, q);
         }
     }
@@ -919,13 +1081,16 @@ void GL_APIENTRY Normal3f(GLfloat nx, GLfloat ny, GLfloat nz)
 {
     EVENT("(GLfloat nx = %f, GLfloat ny = %f, GLfloat nz = %f)", nx, ny, nz);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Normal3f);
         context->gatherParams<EntryPoint::Normal3f>(nx, ny, nz);
 
         if (context->skipValidation() || ValidateNormal3f(context, nx, ny, nz))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->normal3f(nx, ny, nz);
         }
     }
@@ -935,13 +1100,16 @@ void GL_APIENTRY Normal3x(GLfixed nx, GLfixed ny, GLfixed nz)
 {
     EVENT("(GLfixed nx = 0x%X, GLfixed ny = 0x%X, GLfixed nz = 0x%X)", nx, ny, nz);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Normal3x);
         context->gatherParams<EntryPoint::Normal3x>(nx, ny, nz);
 
         if (context->skipValidation() || ValidateNormal3x(context, nx, ny, nz))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->normal3x(nx, ny, nz);
         }
     }
@@ -952,13 +1120,16 @@ void GL_APIENTRY NormalPointer(GLenum type, GLsizei stride, const void *pointer)
     EVENT("(GLenum type = 0x%X, GLsizei stride = %d, const void *pointer = 0x%0.8p)", type, stride,
           pointer);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::NormalPointer);
         context->gatherParams<EntryPoint::NormalPointer>(type, stride, pointer);
 
         if (context->skipValidation() || ValidateNormalPointer(context, type, stride, pointer))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->normalPointer(type, stride, pointer);
         }
     }
@@ -971,13 +1142,16 @@ void GL_APIENTRY Orthof(GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n, G
         "f = %f)",
         l, r, b, t, n, f);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Orthof);
         context->gatherParams<EntryPoint::Orthof>(l, r, b, t, n, f);
 
         if (context->skipValidation() || ValidateOrthof(context, l, r, b, t, n, f))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->orthof(l, r, b, t, n, f);
         }
     }
@@ -990,13 +1164,16 @@ void GL_APIENTRY Orthox(GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed n, G
         "0x%X, GLfixed f = 0x%X)",
         l, r, b, t, n, f);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Orthox);
         context->gatherParams<EntryPoint::Orthox>(l, r, b, t, n, f);
 
         if (context->skipValidation() || ValidateOrthox(context, l, r, b, t, n, f))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->orthox(l, r, b, t, n, f);
         }
     }
@@ -1006,13 +1183,16 @@ void GL_APIENTRY PointParameterf(GLenum pname, GLfloat param)
 {
     EVENT("(GLenum pname = 0x%X, GLfloat param = %f)", pname, param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::PointParameterf);
         context->gatherParams<EntryPoint::PointParameterf>(pname, param);
 
         if (context->skipValidation() || ValidatePointParameterf(context, pname, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->pointParameterf(pname, param);
         }
     }
@@ -1022,13 +1202,16 @@ void GL_APIENTRY PointParameterfv(GLenum pname, const GLfloat *params)
 {
     EVENT("(GLenum pname = 0x%X, const GLfloat *params = 0x%0.8p)", pname, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::PointParameterfv);
         context->gatherParams<EntryPoint::PointParameterfv>(pname, params);
 
         if (context->skipValidation() || ValidatePointParameterfv(context, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->pointParameterfv(pname, params);
         }
     }
@@ -1038,13 +1221,16 @@ void GL_APIENTRY PointParameterx(GLenum pname, GLfixed param)
 {
     EVENT("(GLenum pname = 0x%X, GLfixed param = 0x%X)", pname, param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::PointParameterx);
         context->gatherParams<EntryPoint::PointParameterx>(pname, param);
 
         if (context->skipValidation() || ValidatePointParameterx(context, pname, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->pointParameterx(pname, param);
         }
     }
@@ -1054,13 +1240,16 @@ void GL_APIENTRY PointParameterxv(GLenum pname, const GLfixed *params)
 {
     EVENT("(GLenum pname = 0x%X, const GLfixed *params = 0x%0.8p)", pname, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::PointParameterxv);
         context->gatherParams<EntryPoint::PointParameterxv>(pname, params);
 
         if (context->skipValidation() || ValidatePointParameterxv(context, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->pointParameterxv(pname, params);
         }
     }
@@ -1070,13 +1259,16 @@ void GL_APIENTRY PointSize(GLfloat size)
 {
     EVENT("(GLfloat size = %f)", size);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::PointSize);
         context->gatherParams<EntryPoint::PointSize>(size);
 
         if (context->skipValidation() || ValidatePointSize(context, size))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->pointSize(size);
         }
     }
@@ -1086,13 +1278,16 @@ void GL_APIENTRY PointSizex(GLfixed size)
 {
     EVENT("(GLfixed size = 0x%X)", size);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::PointSizex);
         context->gatherParams<EntryPoint::PointSizex>(size);
 
         if (context->skipValidation() || ValidatePointSizex(context, size))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->pointSizex(size);
         }
     }
@@ -1102,13 +1297,16 @@ void GL_APIENTRY PolygonOffsetx(GLfixed factor, GLfixed units)
 {
     EVENT("(GLfixed factor = 0x%X, GLfixed units = 0x%X)", factor, units);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::PolygonOffsetx);
         context->gatherParams<EntryPoint::PolygonOffsetx>(factor, units);
 
         if (context->skipValidation() || ValidatePolygonOffsetx(context, factor, units))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->polygonOffsetx(factor, units);
         }
     }
@@ -1118,13 +1316,16 @@ void GL_APIENTRY PopMatrix()
 {
     EVENT("()");
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::PopMatrix);
         context->gatherParams<EntryPoint::PopMatrix>();
 
         if (context->skipValidation() || ValidatePopMatrix(context))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->popMatrix();
         }
     }
@@ -1134,13 +1335,16 @@ void GL_APIENTRY PushMatrix()
 {
     EVENT("()");
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::PushMatrix);
         context->gatherParams<EntryPoint::PushMatrix>();
 
         if (context->skipValidation() || ValidatePushMatrix(context))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->pushMatrix();
         }
     }
@@ -1150,13 +1354,16 @@ void GL_APIENTRY Rotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
 {
     EVENT("(GLfloat angle = %f, GLfloat x = %f, GLfloat y = %f, GLfloat z = %f)", angle, x, y, z);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Rotatef);
         context->gatherParams<EntryPoint::Rotatef>(angle, x, y, z);
 
         if (context->skipValidation() || ValidateRotatef(context, angle, x, y, z))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->rotatef(angle, x, y, z);
         }
     }
@@ -1167,13 +1374,16 @@ void GL_APIENTRY Rotatex(GLfixed angle, GLfixed x, GLfixed y, GLfixed z)
     EVENT("(GLfixed angle = 0x%X, GLfixed x = 0x%X, GLfixed y = 0x%X, GLfixed z = 0x%X)", angle, x,
           y, z);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Rotatex);
         context->gatherParams<EntryPoint::Rotatex>(angle, x, y, z);
 
         if (context->skipValidation() || ValidateRotatex(context, angle, x, y, z))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->rotatex(angle, x, y, z);
         }
     }
@@ -1183,13 +1393,16 @@ void GL_APIENTRY SampleCoveragex(GLclampx value, GLboolean invert)
 {
     EVENT("(GLclampx value = 0x%X, GLboolean invert = %u)", value, invert);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::SampleCoveragex);
         context->gatherParams<EntryPoint::SampleCoveragex>(value, invert);
 
         if (context->skipValidation() || ValidateSampleCoveragex(context, value, invert))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->sampleCoveragex(value, invert);
         }
     }
@@ -1199,13 +1412,16 @@ void GL_APIENTRY Scalef(GLfloat x, GLfloat y, GLfloat z)
 {
     EVENT("(GLfloat x = %f, GLfloat y = %f, GLfloat z = %f)", x, y, z);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Scalef);
         context->gatherParams<EntryPoint::Scalef>(x, y, z);
 
         if (context->skipValidation() || ValidateScalef(context, x, y, z))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->scalef(x, y, z);
         }
     }
@@ -1215,13 +1431,16 @@ void GL_APIENTRY Scalex(GLfixed x, GLfixed y, GLfixed z)
 {
     EVENT("(GLfixed x = 0x%X, GLfixed y = 0x%X, GLfixed z = 0x%X)", x, y, z);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Scalex);
         context->gatherParams<EntryPoint::Scalex>(x, y, z);
 
         if (context->skipValidation() || ValidateScalex(context, x, y, z))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->scalex(x, y, z);
         }
     }
@@ -1231,13 +1450,16 @@ void GL_APIENTRY ShadeModel(GLenum mode)
 {
     EVENT("(GLenum mode = 0x%X)", mode);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ShadeModel);
         context->gatherParams<EntryPoint::ShadeModel>(mode);
 
         if (context->skipValidation() || ValidateShadeModel(context, mode))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->shadeModel(mode);
         }
     }
@@ -1249,14 +1471,17 @@ void GL_APIENTRY TexCoordPointer(GLint size, GLenum type, GLsizei stride, const
         "(GLint size = %d, GLenum type = 0x%X, GLsizei stride = %d, const void *pointer = 0x%0.8p)",
         size, type, stride, pointer);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexCoordPointer);
         context->gatherParams<EntryPoint::TexCoordPointer>(size, type, stride, pointer);
 
         if (context->skipValidation() ||
             ValidateTexCoordPointer(context, size, type, stride, pointer))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texCoordPointer(size, type, stride, pointer);
         }
     }
@@ -1266,13 +1491,16 @@ void GL_APIENTRY TexEnvf(GLenum target, GLenum pname, GLfloat param)
 {
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLfloat param = %f)", target, pname, param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexEnvf);
         context->gatherParams<EntryPoint::TexEnvf>(target, pname, param);
 
         if (context->skipValidation() || ValidateTexEnvf(context, target, pname, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texEnvf(target, pname, param);
         }
     }
@@ -1283,13 +1511,16 @@ void GL_APIENTRY TexEnvfv(GLenum target, GLenum pname, const GLfloat *params)
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, const GLfloat *params = 0x%0.8p)", target,
           pname, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexEnvfv);
         context->gatherParams<EntryPoint::TexEnvfv>(target, pname, params);
 
         if (context->skipValidation() || ValidateTexEnvfv(context, target, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texEnvfv(target, pname, params);
         }
     }
@@ -1299,13 +1530,16 @@ void GL_APIENTRY TexEnvi(GLenum target, GLenum pname, GLint param)
 {
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLint param = %d)", target, pname, param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexEnvi);
         context->gatherParams<EntryPoint::TexEnvi>(target, pname, param);
 
         if (context->skipValidation() || ValidateTexEnvi(context, target, pname, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texEnvi(target, pname, param);
         }
     }
@@ -1316,13 +1550,16 @@ void GL_APIENTRY TexEnviv(GLenum target, GLenum pname, const GLint *params)
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, const GLint *params = 0x%0.8p)", target,
           pname, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexEnviv);
         context->gatherParams<EntryPoint::TexEnviv>(target, pname, params);
 
         if (context->skipValidation() || ValidateTexEnviv(context, target, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texEnviv(target, pname, params);
         }
     }
@@ -1333,13 +1570,16 @@ void GL_APIENTRY TexEnvx(GLenum target, GLenum pname, GLfixed param)
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLfixed param = 0x%X)", target, pname,
           param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexEnvx);
         context->gatherParams<EntryPoint::TexEnvx>(target, pname, param);
 
         if (context->skipValidation() || ValidateTexEnvx(context, target, pname, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texEnvx(target, pname, param);
         }
     }
@@ -1350,13 +1590,16 @@ void GL_APIENTRY TexEnvxv(GLenum target, GLenum pname, const GLfixed *params)
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, const GLfixed *params = 0x%0.8p)", target,
           pname, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexEnvxv);
         context->gatherParams<EntryPoint::TexEnvxv>(target, pname, params);
 
         if (context->skipValidation() || ValidateTexEnvxv(context, target, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texEnvxv(target, pname, params);
         }
     }
@@ -1367,14 +1610,17 @@ void GL_APIENTRY TexParameterx(GLenum target, GLenum pname, GLfixed param)
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLfixed param = 0x%X)", target, pname,
           param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexParameterx);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::TexParameterx>(targetPacked, pname, param);
 
         if (context->skipValidation() || ValidateTexParameterx(context, targetPacked, pname, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texParameterx(targetPacked, pname, param);
         }
     }
@@ -1385,15 +1631,18 @@ void GL_APIENTRY TexParameterxv(GLenum target, GLenum pname, const GLfixed *para
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, const GLfixed *params = 0x%0.8p)", target,
           pname, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexParameterxv);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::TexParameterxv>(targetPacked, pname, params);
 
         if (context->skipValidation() ||
             ValidateTexParameterxv(context, targetPacked, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texParameterxv(targetPacked, pname, params);
         }
     }
@@ -1403,13 +1652,16 @@ void GL_APIENTRY Translatef(GLfloat x, GLfloat y, GLfloat z)
 {
     EVENT("(GLfloat x = %f, GLfloat y = %f, GLfloat z = %f)", x, y, z);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Translatef);
         context->gatherParams<EntryPoint::Translatef>(x, y, z);
 
         if (context->skipValidation() || ValidateTranslatef(context, x, y, z))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->translatef(x, y, z);
         }
     }
@@ -1419,13 +1671,16 @@ void GL_APIENTRY Translatex(GLfixed x, GLfixed y, GLfixed z)
 {
     EVENT("(GLfixed x = 0x%X, GLfixed y = 0x%X, GLfixed z = 0x%X)", x, y, z);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Translatex);
         context->gatherParams<EntryPoint::Translatex>(x, y, z);
 
         if (context->skipValidation() || ValidateTranslatex(context, x, y, z))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->translatex(x, y, z);
         }
     }
@@ -1437,14 +1692,17 @@ void GL_APIENTRY VertexPointer(GLint size, GLenum type, GLsizei stride, const vo
         "(GLint size = %d, GLenum type = 0x%X, GLsizei stride = %d, const void *pointer = 0x%0.8p)",
         size, type, stride, pointer);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::VertexPointer);
         context->gatherParams<EntryPoint::VertexPointer>(size, type, stride, pointer);
 
         if (context->skipValidation() ||
             ValidateVertexPointer(context, size, type, stride, pointer))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->vertexPointer(size, type, stride, pointer);
         }
     }
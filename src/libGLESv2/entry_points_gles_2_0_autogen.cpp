@@ -20,13 +20,16 @@ void GL_APIENTRY ActiveTexture(GLenum texture)
 {
     EVENT("(GLenum texture = 0x%X)", texture);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ActiveTexture);
         context->gatherParams<EntryPoint::ActiveTexture>(texture);
 
         if (context->skipValidation() || ValidateActiveTexture(context, texture))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->activeTexture(texture);
         }
     }
@@ -36,13 +39,16 @@ void GL_APIENTRY AttachShader(GLuint program, GLuint shader)
 {
     EVENT("(GLuint program = %u, GLuint shader = %u)", program, shader);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::AttachShader);
         context->gatherParams<EntryPoint::AttachShader>(program, shader);
 
         if (context->skipValidation() || ValidateAttachShader(context, program, shader))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->attachShader(program, shader);
         }
     }
@@ -53,13 +59,16 @@ void GL_APIENTRY BindAttribLocation(GLuint program, GLuint index, const GLchar *
     EVENT("(GLuint program = %u, GLuint index = %u, const GLchar *name = 0x%0.8p)", program, index,
           name);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::BindAttribLocation);
         context->gatherParams<EntryPoint::BindAttribLocation>(program, index, name);
 
         if (context->skipValidation() || ValidateBindAttribLocation(context, program, index, name))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->bindAttribLocation(program, index, name);
         }
     }
@@ -69,14 +78,17 @@ void GL_APIENTRY BindBuffer(GLenum target, GLuint buffer)
 {
     EVENT("(GLenum target = 0x%X, GLuint buffer = %u)", target, buffer);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::BindBuffer);
         BufferBinding targetPacked = FromGLenum<BufferBinding>(target);
         context->gatherParams<EntryPoint::BindBuffer>(targetPacked, buffer);
 
         if (context->skipValidation() || ValidateBindBuffer(context, targetPacked, buffer))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->bindBuffer(targetPacked, buffer);
         }
     }
@@ -86,13 +98,16 @@ void GL_APIENTRY BindFramebuffer(GLenum target, GLuint framebuffer)
 {
     EVENT("(GLenum target = 0x%X, GLuint framebuffer = %u)", target, framebuffer);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::BindFramebuffer);
         context->gatherParams<EntryPoint::BindFramebuffer>(target, framebuffer);
 
         if (context->skipValidation() || ValidateBindFramebuffer(context, target, framebuffer))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->bindFramebuffer(target, framebuffer);
         }
     }
@@ -102,13 +117,16 @@ void GL_APIENTRY BindRenderbuffer(GLenum target, GLuint renderbuffer)
 {
     EVENT("(GLenum target = 0x%X, GLuint renderbuffer = %u)", target, renderbuffer);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::BindRenderbuffer);
         context->gatherParams<EntryPoint::BindRenderbuffer>(target, renderbuffer);
 
         if (context->skipValidation() || ValidateBindRenderbuffer(context, target, renderbuffer))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->bindRenderbuffer(target, renderbuffer);
         }
     }
@@ -118,14 +136,17 @@ void GL_APIENTRY BindTexture(GLenum target, GLuint texture)
 {
     EVENT("(GLenum target = 0x%X, GLuint texture = %u)", target, texture);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::BindTexture);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::BindTexture>(targetPacked, texture);
 
         if (context->skipValidation() || ValidateBindTexture(context, targetPacked, texture))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->bindTexture(targetPacked, texture);
         }
     }
@@ -136,13 +157,16 @@ void GL_APIENTRY BlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat al
     EVENT("(GLfloat red = %f, GLfloat green = %f, GLfloat blue = %f, GLfloat alpha = %f)", red,
           green, blue, alpha);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::BlendColor);
         context->gatherParams<EntryPoint::BlendColor>(red, green, blue, alpha);
 
         if (context->skipValidation() || ValidateBlendColor(context, red, green, blue, alpha))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->blendColor(red, green, blue, alpha);
         }
     }
@@ -152,13 +176,16 @@ void GL_APIENTRY BlendEquation(GLenum mode)
 {
     EVENT("(GLenum mode = 0x%X)", mode);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::BlendEquation);
         context->gatherParams<EntryPoint::BlendEquation>(mode);
 
         if (context->skipValidation() || ValidateBlendEquation(context, mode))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->blendEquation(mode);
         }
     }
@@ -168,13 +195,16 @@ void GL_APIENTRY BlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
 {
     EVENT("(GLenum modeRGB = 0x%X, GLenum modeAlpha = 0x%X)", modeRGB, modeAlpha);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::BlendEquationSeparate);
         context->gatherParams<EntryPoint::BlendEquationSeparate>(modeRGB, modeAlpha);
 
         if (context->skipValidation() || ValidateBlendEquationSeparate(context, modeRGB, modeAlpha))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->blendEquationSeparate(modeRGB, modeAlpha);
         }
     }
@@ -184,13 +214,16 @@ void GL_APIENTRY BlendFunc(GLenum sfactor, GLenum dfactor)
 {
     EVENT("(GLenum sfactor = 0x%X, GLenum dfactor = 0x%X)", sfactor, dfactor);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::BlendFunc);
         context->gatherParams<EntryPoint::BlendFunc>(sfactor, dfactor);
 
         if (context->skipValidation() || ValidateBlendFunc(context, sfactor, dfactor))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->blendFunc(sfactor, dfactor);
         }
     }
@@ -206,15 +239,18 @@ void GL_APIENTRY BlendFuncSeparate(GLenum sfactorRGB,
         "dfactorAlpha = 0x%X)",
         sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::BlendFuncSeparate);
         context->gatherParams<EntryPoint::BlendFuncSeparate>(sfactorRGB, dfactorRGB, sfactorAlpha,
                                                              dfactorAlpha);
 
         if (context->skipValidation() ||
             ValidateBlendFuncSeparate(context, sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->blendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
         }
     }
@@ -227,9 +263,11 @@ void GL_APIENTRY BufferData(GLenum target, GLsizeiptr size, const void *data, GL
         "0x%X)",
         target, size, data, usage);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::BufferData);
         BufferBinding targetPacked = FromGLenum<BufferBinding>(target);
         BufferUsage usagePacked    = FromGLenum<BufferUsage>(usage);
         context->gatherParams<EntryPoint::BufferData>(targetPacked, size, data, usagePacked);
@@ -237,6 +275,7 @@ void GL_APIENTRY BufferData(GLenum target, GLsizeiptr size, const void *data, GL
         if (context->skipValidation() ||
             ValidateBufferData(context, targetPacked, size, data, usagePacked))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->bufferData(targetPacked, size, data, usagePacked);
         }
     }
@@ -249,15 +288,18 @@ void GL_APIENTRY BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size,
         "0x%0.8p)",
         target, offset, size, data);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::BufferSubData);
         BufferBinding targetPacked = FromGLenum<BufferBinding>(target);
         context->gatherParams<EntryPoint::BufferSubData>(targetPacked, offset, size, data);
 
         if (context->skipValidation() ||
             ValidateBufferSubData(context, targetPacked, offset, size, data))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->bufferSubData(targetPacked, offset, size, data);
         }
     }
@@ -267,13 +309,16 @@ GLenum GL_APIENTRY CheckFramebufferStatus(GLenum target)
 {
     EVENT("(GLenum target = 0x%X)", target);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::CheckFramebufferStatus);
         context->gatherParams<EntryPoint::CheckFramebufferStatus>(target);
 
         if (context->skipValidation() || ValidateCheckFramebufferStatus(context, target))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->checkFramebufferStatus(target);
         }
     }
@@ -285,13 +330,16 @@ void GL_APIENTRY Clear(GLbitfield mask)
 {
     EVENT("(GLbitfield mask = 0x%X)", mask);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Clear);
         context->gatherParams<EntryPoint::Clear>(mask);
 
         if (context->skipValidation() || ValidateClear(context, mask))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->clear(mask);
         }
     }
@@ -302,13 +350,16 @@ void GL_APIENTRY ClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat al
     EVENT("(GLfloat red = %f, GLfloat green = %f, GLfloat blue = %f, GLfloat alpha = %f)", red,
           green, blue, alpha);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ClearColor);
         context->gatherParams<EntryPoint::ClearColor>(red, green, blue, alpha);
 
         if (context->skipValidation() || ValidateClearColor(context, red, green, blue, alpha))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->clearColor(red, green, blue, alpha);
         }
     }
@@ -318,13 +369,16 @@ void GL_APIENTRY ClearDepthf(GLfloat d)
 {
     EVENT("(GLfloat d = %f)", d);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ClearDepthf);
         context->gatherParams<EntryPoint::ClearDepthf>(d);
 
         if (context->skipValidation() || ValidateClearDepthf(context, d))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->clearDepthf(d);
         }
     }
@@ -334,13 +388,16 @@ void GL_APIENTRY ClearStencil(GLint s)
 {
     EVENT("(GLint s = %d)", s);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ClearStencil);
         context->gatherParams<EntryPoint::ClearStencil>(s);
 
         if (context->skipValidation() || ValidateClearStencil(context, s))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->clearStencil(s);
         }
     }
@@ -351,13 +408,16 @@ void GL_APIENTRY ColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboo
     EVENT("(GLboolean red = %u, GLboolean green = %u, GLboolean blue = %u, GLboolean alpha = %u)",
           red, green, blue, alpha);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ColorMask);
         context->gatherParams<EntryPoint::ColorMask>(red, green, blue, alpha);
 
         if (context->skipValidation() || ValidateColorMask(context, red, green, blue, alpha))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->colorMask(red, green, blue, alpha);
         }
     }
@@ -367,13 +427,16 @@ void GL_APIENTRY CompileShader(GLuint shader)
 {
     EVENT("(GLuint shader = %u)", shader);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::CompileShader);
         context->gatherParams<EntryPoint::CompileShader>(shader);
 
         if (context->skipValidation() || ValidateCompileShader(context, shader))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->compileShader(shader);
         }
     }
@@ -394,9 +457,11 @@ void GL_APIENTRY CompressedTexImage2D(GLenum target,
         "0x%0.8p)",
         target, level, internalformat, width, height, border, imageSize, data);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::CompressedTexImage2D);
         TextureTarget targetPacked = FromGLenum<TextureTarget>(target);
         context->gatherParams<EntryPoint::CompressedTexImage2D>(
             targetPacked, level, internalformat, width, height, border, imageSize, data);
@@ -405,6 +470,7 @@ void GL_APIENTRY CompressedTexImage2D(GLenum target,
             ValidateCompressedTexImage2D(context, targetPacked, level, internalformat, width,
                                          height, border, imageSize, data))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->compressedTexImage2D(targetPacked, level, internalformat, width, height,
                                           border, imageSize, data);
         }
@@ -427,9 +493,11 @@ void GL_APIENTRY CompressedTexSubImage2D(GLenum target,
         "*data = 0x%0.8p)",
         target, level, xoffset, yoffset, width, height, format, imageSize, data);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::CompressedTexSubImage2D);
         TextureTarget targetPacked = FromGLenum<TextureTarget>(target);
         context->gatherParams<EntryPoint::CompressedTexSubImage2D>(
             targetPacked, level, xoffset, yoffset, width, height, format, imageSize, data);
@@ -438,6 +506,7 @@ void GL_APIENTRY CompressedTexSubImage2D(GLenum target,
             ValidateCompressedTexSubImage2D(context, targetPacked, level, xoffset, yoffset, width,
                                             height, format, imageSize, data))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->compressedTexSubImage2D(targetPacked, level, xoffset, yoffset, width, height,
                                              format, imageSize, data);
         }
@@ -458,9 +527,11 @@ void GL_APIENTRY CopyTexImage2D(GLenum target,
         "GLint y = %d, GLsizei width = %d, GLsizei height = %d, GLint border = %d)",
         target, level, internalformat, x, y, width, height, border);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::CopyTexImage2D);
         TextureTarget targetPacked = FromGLenum<TextureTarget>(target);
         context->gatherParams<EntryPoint::CopyTexImage2D>(targetPacked, level, internalformat, x, y,
                                                           width, height, border);
@@ -469,6 +540,7 @@ void GL_APIENTRY CopyTexImage2D(GLenum target,
             ValidateCopyTexImage2D(context, targetPacked, level, internalformat, x, y, width,
                                    height, border))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->copyTexImage2D(targetPacked, level, internalformat, x, y, width, height,
                                     border);
         }
@@ -489,9 +561,11 @@ void GL_APIENTRY CopyTexSubImage2D(GLenum target,
         "= %d, GLint y = %d, GLsizei width = %d, GLsizei height = %d)",
         target, level, xoffset, yoffset, x, y, width, height);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::CopyTexSubImage2D);
         TextureTarget targetPacked = FromGLenum<TextureTarget>(target);
         context->gatherParams<EntryPoint::CopyTexSubImage2D>(targetPacked, level, xoffset, yoffset,
                                                              x, y, width, height);
@@ -500,6 +574,7 @@ void GL_APIENTRY CopyTexSubImage2D(GLenum target,
             ValidateCopyTexSubImage2D(context, targetPacked, level, xoffset, yoffset, x, y, width,
                                       height))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->copyTexSubImage2D(targetPacked, level, xoffset, yoffset, x, y, width, height);
         }
     }
@@ -509,13 +584,16 @@ GLuint GL_APIENTRY CreateProgram()
 {
     EVENT("()");
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::CreateProgram);
         context->gatherParams<EntryPoint::CreateProgram>();
 
         if (context->skipValidation() || ValidateCreateProgram(context))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->createProgram();
         }
     }
@@ -527,14 +605,17 @@ GLuint GL_APIENTRY CreateShader(GLenum type)
 {
     EVENT("(GLenum type = 0x%X)", type);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::CreateShader);
         ShaderType typePacked = FromGLenum<ShaderType>(type);
         context->gatherParams<EntryPoint::CreateShader>(typePacked);
 
         if (context->skipValidation() || ValidateCreateShader(context, typePacked))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->createShader(typePacked);
         }
     }
@@ -546,14 +627,17 @@ void GL_APIENTRY CullFace(GLenum mode)
 {
     EVENT("(GLenum mode = 0x%X)", mode);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::CullFace);
         CullFaceMode modePacked = FromGLenum<CullFaceMode>(mode);
         context->gatherParams<EntryPoint::CullFace>(modePacked);
 
         if (context->skipValidation() || ValidateCullFace(context, modePacked))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->cullFace(modePacked);
         }
     }
@@ -563,13 +647,16 @@ void GL_APIENTRY DeleteBuffers(GLsizei n, const GLuint *buffers)
 {
     EVENT("(GLsizei n = %d, const GLuint *buffers = 0x%0.8p)", n, buffers);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DeleteBuffers);
         context->gatherParams<EntryPoint::DeleteBuffers>(n, buffers);
 
         if (context->skipValidation() || ValidateDeleteBuffers(context, n, buffers))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->deleteBuffers(n, buffers);
         }
     }
@@ -579,13 +666,16 @@ void GL_APIENTRY DeleteFramebuffers(GLsizei n, const GLuint *framebuffers)
 {
     EVENT("(GLsizei n = %d, const GLuint *framebuffers = 0x%0.8p)", n, framebuffers);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DeleteFramebuffers);
         context->gatherParams<EntryPoint::DeleteFramebuffers>(n, framebuffers);
 
         if (context->skipValidation() || ValidateDeleteFramebuffers(context, n, framebuffers))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->deleteFramebuffers(n, framebuffers);
         }
     }
@@ -595,13 +685,16 @@ void GL_APIENTRY DeleteProgram(GLuint program)
 {
     EVENT("(GLuint program = %u)", program);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DeleteProgram);
         context->gatherParams<EntryPoint::DeleteProgram>(program);
 
         if (context->skipValidation() || ValidateDeleteProgram(context, program))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->deleteProgram(program);
         }
     }
@@ -611,13 +704,16 @@ void GL_APIENTRY DeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers)
 {
     EVENT("(GLsizei n = %d, const GLuint *renderbuffers = 0x%0.8p)", n, renderbuffers);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DeleteRenderbuffers);
         context->gatherParams<EntryPoint::DeleteRenderbuffers>(n, renderbuffers);
 
         if (context->skipValidation() || ValidateDeleteRenderbuffers(context, n, renderbuffers))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->deleteRenderbuffers(n, renderbuffers);
         }
     }
@@ -627,13 +723,16 @@ void GL_APIENTRY DeleteShader(GLuint shader)
 {
     EVENT("(GLuint shader = %u)", shader);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DeleteShader);
         context->gatherParams<EntryPoint::DeleteShader>(shader);
 
         if (context->skipValidation() || ValidateDeleteShader(context, shader))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->deleteShader(shader);
         }
     }
@@ -643,13 +742,16 @@ void GL_APIENTRY DeleteTextures(GLsizei n, const GLuint *textures)
 {
     EVENT("(GLsizei n = %d, const GLuint *textures = 0x%0.8p)", n, textures);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DeleteTextures);
         context->gatherParams<EntryPoint::DeleteTextures>(n, textures);
 
         if (context->skipValidation() || ValidateDeleteTextures(context, n, textures))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->deleteTextures(n, textures);
         }
     }
@@ -659,13 +761,16 @@ void GL_APIENTRY DepthFunc(GLenum func)
 {
     EVENT("(GLenum func = 0x%X)", func);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DepthFunc);
         context->gatherParams<EntryPoint::DepthFunc>(func);
 
         if (context->skipValidation() || ValidateDepthFunc(context, func))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->depthFunc(func);
         }
     }
@@ -675,13 +780,16 @@ void GL_APIENTRY DepthMask(GLboolean flag)
 {
     EVENT("(GLboolean flag = %u)", flag);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DepthMask);
         context->gatherParams<EntryPoint::DepthMask>(flag);
 
         if (context->skipValidation() || ValidateDepthMask(context, flag))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->depthMask(flag);
         }
     }
@@ -691,13 +799,16 @@ void GL_APIENTRY DepthRangef(GLfloat n, GLfloat f)
 {
     EVENT("(GLfloat n = %f, GLfloat f = %f)", n, f);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DepthRangef);
         context->gatherParams<EntryPoint::DepthRangef>(n, f);
 
         if (context->skipValidation() || ValidateDepthRangef(context, n, f))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->depthRangef(n, f);
         }
     }
@@ -707,13 +818,16 @@ void GL_APIENTRY DetachShader(GLuint program, GLuint shader)
 {
     EVENT("(GLuint program = %u, GLuint shader = %u)", program, shader);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DetachShader);
         context->gatherParams<EntryPoint::DetachShader>(program, shader);
 
         if (context->skipValidation() || ValidateDetachShader(context, program, shader))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->detachShader(program, shader);
         }
     }
@@ -723,13 +837,16 @@ void GL_APIENTRY Disable(GLenum cap)
 {
     EVENT("(GLenum cap = 0x%X)", cap);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Disable);
         context->gatherParams<EntryPoint::Disable>(cap);
 
         if (context->skipValidation() || ValidateDisable(context, cap))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->disable(cap);
         }
     }
@@ -739,13 +856,16 @@ void GL_APIENTRY DisableVertexAttribArray(GLuint index)
 {
     EVENT("(GLuint index = %u)", index);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DisableVertexAttribArray);
         context->gatherParams<EntryPoint::DisableVertexAttribArray>(index);
 
         if (context->skipValidation() || ValidateDisableVertexAttribArray(context, index))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->disableVertexAttribArray(index);
         }
     }
@@ -755,13 +875,16 @@ void GL_APIENTRY DrawArrays(GLenum mode, GLint first, GLsizei count)
 {
     EVENT("(GLenum mode = 0x%X, GLint first = %d, GLsizei count = %d)", mode, first, count);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DrawArrays);
         context->gatherParams<EntryPoint::DrawArrays>(mode, first, count);
 
         if (context->skipValidation() || ValidateDrawArrays(context, mode, first, count))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->drawArrays(mode, first, count);
         }
     }
@@ -774,13 +897,16 @@ void GL_APIENTRY DrawElements(GLenum mode, GLsizei count, GLenum type, const voi
         "0x%0.8p)",
         mode, count, type, indices);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DrawElements);
         context->gatherParams<EntryPoint::DrawElements>(mode, count, type, indices);
 
         if (context->skipValidation() || ValidateDrawElements(context, mode, count, type, indices))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->drawElements(mode, count, type, indices);
         }
     }
@@ -790,13 +916,16 @@ void GL_APIENTRY Enable(GLenum cap)
 {
     EVENT("(GLenum cap = 0x%X)", cap);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Enable);
         context->gatherParams<EntryPoint::Enable>(cap);
 
         if (context->skipValidation() || ValidateEnable(context, cap))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->enable(cap);
         }
     }
@@ -806,13 +935,16 @@ void GL_APIENTRY EnableVertexAttribArray(GLuint index)
 {
     EVENT("(GLuint index = %u)", index);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::EnableVertexAttribArray);
         context->gatherParams<EntryPoint::EnableVertexAttribArray>(index);
 
         if (context->skipValidation() || ValidateEnableVertexAttribArray(context, index))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->enableVertexAttribArray(index);
         }
     }
@@ -822,13 +954,16 @@ void GL_APIENTRY Finish()
 {
     EVENT("()");
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Finish);
         context->gatherParams<EntryPoint::Finish>();
 
         if (context->skipValidation() || ValidateFinish(context))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->finish();
         }
     }
@@ -838,13 +973,16 @@ void GL_APIENTRY Flush()
 {
     EVENT("()");
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Flush);
         context->gatherParams<EntryPoint::Flush>();
 
         if (context->skipValidation() || ValidateFlush(context))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->flush();
         }
     }
@@ -860,9 +998,11 @@ void GL_APIENTRY FramebufferRenderbuffer(GLenum target,
         "renderbuffer = %u)",
         target, attachment, renderbuffertarget, renderbuffer);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::FramebufferRenderbuffer);
         context->gatherParams<EntryPoint::FramebufferRenderbuffer>(
             target, attachment, renderbuffertarget, renderbuffer);
 
@@ -870,6 +1010,7 @@ void GL_APIENTRY FramebufferRenderbuffer(GLenum target,
             ValidateFramebufferRenderbuffer(context, target, attachment, renderbuffertarget,
                                             renderbuffer))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->framebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
         }
     }
@@ -886,9 +1027,11 @@ void GL_APIENTRY FramebufferTexture2D(GLenum target,
         "= %u, GLint level = %d)",
         target, attachment, textarget, texture, level);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::FramebufferTexture2D);
         TextureTarget textargetPacked = FromGLenum<TextureTarget>(textarget);
         context->gatherParams<EntryPoint::FramebufferTexture2D>(target, attachment, textargetPacked,
                                                                 texture, level);
@@ -897,6 +1040,7 @@ void GL_APIENTRY FramebufferTexture2D(GLenum target,
             ValidateFramebufferTexture2D(context, target, attachment, textargetPacked, texture,
                                          level))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->framebufferTexture2D(target, attachment, textargetPacked, texture, level);
         }
     }
@@ -906,13 +1050,16 @@ void GL_APIENTRY FrontFace(GLenum mode)
 {
     EVENT("(GLenum mode = 0x%X)", mode);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::FrontFace);
         context->gatherParams<EntryPoint::FrontFace>(mode);
 
         if (context->skipValidation() || ValidateFrontFace(context, mode))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->frontFace(mode);
         }
     }
@@ -922,13 +1069,16 @@ void GL_APIENTRY GenBuffers(GLsizei n, GLuint *buffers)
 {
     EVENT("(GLsizei n = %d, GLuint *buffers = 0x%0.8p)", n, buffers);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GenBuffers);
         context->gatherParams<EntryPoint::GenBuffers>(n, buffers);
 
         if (context->skipValidation() || ValidateGenBuffers(context, n, buffers))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->genBuffers(n, buffers);
         }
     }
@@ -938,13 +1088,16 @@ void GL_APIENTRY GenFramebuffers(GLsizei n, GLuint *framebuffers)
 {
     EVENT("(GLsizei n = %d, GLuint *framebuffers = 0x%0.8p)", n, framebuffers);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GenFramebuffers);
         context->gatherParams<EntryPoint::GenFramebuffers>(n, framebuffers);
 
         if (context->skipValidation() || ValidateGenFramebuffers(context, n, framebuffers))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->genFramebuffers(n, framebuffers);
         }
     }
@@ -954,13 +1107,16 @@ void GL_APIENTRY GenRenderbuffers(GLsizei n, GLuint *renderbuffers)
 {
     EVENT("(GLsizei n = %d, GLuint *renderbuffers = 0x%0.8p)", n, renderbuffers);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GenRenderbuffers);
         context->gatherParams<EntryPoint::GenRenderbuffers>(n, renderbuffers);
 
         if (context->skipValidation() || ValidateGenRenderbuffers(context, n, renderbuffers))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->genRenderbuffers(n, renderbuffers);
         }
     }
@@ -970,13 +1126,16 @@ void GL_APIENTRY GenTextures(GLsizei n, GLuint *textures)
 {
     EVENT("(GLsizei n = %d, GLuint *textures = 0x%0.8p)", n, textures);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GenTextures);
         context->gatherParams<EntryPoint::GenTextures>(n, textures);
 
         if (context->skipValidation() || ValidateGenTextures(context, n, textures))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->genTextures(n, textures);
         }
     }
@@ -986,14 +1145,17 @@ void GL_APIENTRY GenerateMipmap(GLenum target)
 {
     EVENT("(GLenum target = 0x%X)", target);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GenerateMipmap);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::GenerateMipmap>(targetPacked);
 
         if (context->skipValidation() || ValidateGenerateMipmap(context, targetPacked))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->generateMipmap(targetPacked);
         }
     }
@@ -1012,15 +1174,18 @@ void GL_APIENTRY GetActiveAttrib(GLuint program,
         "GLint *size = 0x%0.8p, GLenum *type = 0x%0.8p, GLchar *name = 0x%0.8p)",
         program, index, bufSize, length, size, type, name);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetActiveAttrib);
         context->gatherParams<EntryPoint::GetActiveAttrib>(program, index, bufSize, length, size,
                                                            type, name);
 
         if (context->skipValidation() ||
             ValidateGetActiveAttrib(context, program, index, bufSize, length, size, type, name))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getActiveAttrib(program, index, bufSize, length, size, type, name);
         }
     }
@@ -1039,15 +1204,18 @@ void GL_APIENTRY GetActiveUniform(GLuint program,
         "GLint *size = 0x%0.8p, GLenum *type = 0x%0.8p, GLchar *name = 0x%0.8p)",
         program, index, bufSize, length, size, type, name);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetActiveUniform);
         context->gatherParams<EntryPoint::GetActiveUniform>(program, index, bufSize, length, size,
                                                             type, name);
 
         if (context->skipValidation() ||
             ValidateGetActiveUniform(context, program, index, bufSize, length, size, type, name))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getActiveUniform(program, index, bufSize, length, size, type, name);
         }
     }
@@ -1063,14 +1231,17 @@ void GL_APIENTRY GetAttachedShaders(GLuint program,
         "0x%0.8p)",
         program, maxCount, count, shaders);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetAttachedShaders);
         context->gatherParams<EntryPoint::GetAttachedShaders>(program, maxCount, count, shaders);
 
         if (context->skipValidation() ||
             ValidateGetAttachedShaders(context, program, maxCount, count, shaders))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getAttachedShaders(program, maxCount, count, shaders);
         }
     }
@@ -1080,13 +1251,16 @@ GLint GL_APIENTRY GetAttribLocation(GLuint program, const GLchar *name)
 {
     EVENT("(GLuint program = %u, const GLchar *name = 0x%0.8p)", program, name);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetAttribLocation);
         context->gatherParams<EntryPoint::GetAttribLocation>(program, name);
 
         if (context->skipValidation() || ValidateGetAttribLocation(context, program, name))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->getAttribLocation(program, name);
         }
     }
@@ -1098,13 +1272,16 @@ void GL_APIENTRY GetBooleanv(GLenum pname, GLboolean *data)
 {
     EVENT("(GLenum pname = 0x%X, GLboolean *data = 0x%0.8p)", pname, data);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetBooleanv);
         context->gatherParams<EntryPoint::GetBooleanv>(pname, data);
 
         if (context->skipValidation() || ValidateGetBooleanv(context, pname, data))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getBooleanv(pname, data);
         }
     }
@@ -1115,15 +1292,18 @@ void GL_APIENTRY GetBufferParameteriv(GLenum target, GLenum pname, GLint *params
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", target, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetBufferParameteriv);
         BufferBinding targetPacked = FromGLenum<BufferBinding>(target);
         context->gatherParams<EntryPoint::GetBufferParameteriv>(targetPacked, pname, params);
 
         if (context->skipValidation() ||
             ValidateGetBufferParameteriv(context, targetPacked, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getBufferParameteriv(targetPacked, pname, params);
         }
     }
@@ -1133,13 +1313,16 @@ GLenum GL_APIENTRY GetError()
 {
     EVENT("()");
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetError);
         context->gatherParams<EntryPoint::GetError>();
 
         if (context->skipValidation() || ValidateGetError(context))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->getError();
         }
     }
@@ -1151,13 +1334,16 @@ void GL_APIENTRY GetFloatv(GLenum pname, GLfloat *data)
 {
     EVENT("(GLenum pname = 0x%X, GLfloat *data = 0x%0.8p)", pname, data);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetFloatv);
         context->gatherParams<EntryPoint::GetFloatv>(pname, data);
 
         if (context->skipValidation() || ValidateGetFloatv(context, pname, data))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getFloatv(pname, data);
         }
     }
@@ -1173,15 +1359,18 @@ void GL_APIENTRY GetFramebufferAttachmentParameteriv(GLenum target,
         "0x%0.8p)",
         target, attachment, pname, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetFramebufferAttachmentParameteriv);
         context->gatherParams<EntryPoint::GetFramebufferAttachmentParameteriv>(target, attachment,
                                                                                pname, params);
 
         if (context->skipValidation() ||
             ValidateGetFramebufferAttachmentParameteriv(context, target, attachment, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getFramebufferAttachmentParameteriv(target, attachment, pname, params);
         }
     }
@@ -1191,13 +1380,16 @@ void GL_APIENTRY GetIntegerv(GLenum pname, GLint *data)
 {
     EVENT("(GLenum pname = 0x%X, GLint *data = 0x%0.8p)", pname, data);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetIntegerv);
         context->gatherParams<EntryPoint::GetIntegerv>(pname, data);
 
         if (context->skipValidation() || ValidateGetIntegerv(context, pname, data))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getIntegerv(pname, data);
         }
     }
@@ -1213,14 +1405,17 @@ void GL_APIENTRY GetProgramInfoLog(GLuint program,
         "0x%0.8p)",
         program, bufSize, length, infoLog);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetProgramInfoLog);
         context->gatherParams<EntryPoint::GetProgramInfoLog>(program, bufSize, length, infoLog);
 
         if (context->skipValidation() ||
             ValidateGetProgramInfoLog(context, program, bufSize, length, infoLog))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getProgramInfoLog(program, bufSize, length, infoLog);
         }
     }
@@ -1231,13 +1426,16 @@ void GL_APIENTRY GetProgramiv(GLuint program, GLenum pname, GLint *params)
     EVENT("(GLuint program = %u, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", program, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetProgramiv);
         context->gatherParams<EntryPoint::GetProgramiv>(program, pname, params);
 
         if (context->skipValidation() || ValidateGetProgramiv(context, program, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getProgramiv(program, pname, params);
         }
     }
@@ -1248,14 +1446,17 @@ void GL_APIENTRY GetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", target, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetRenderbufferParameteriv);
         context->gatherParams<EntryPoint::GetRenderbufferParameteriv>(target, pname, params);
 
         if (context->skipValidation() ||
             ValidateGetRenderbufferParameteriv(context, target, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getRenderbufferParameteriv(target, pname, params);
         }
     }
@@ -1268,14 +1469,17 @@ void GL_APIENTRY GetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *lengt
         "0x%0.8p)",
         shader, bufSize, length, infoLog);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetShaderInfoLog);
         context->gatherParams<EntryPoint::GetShaderInfoLog>(shader, bufSize, length, infoLog);
 
         if (context->skipValidation() ||
             ValidateGetShaderInfoLog(context, shader, bufSize, length, infoLog))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getShaderInfoLog(shader, bufSize, length, infoLog);
         }
     }
@@ -1291,15 +1495,18 @@ void GL_APIENTRY GetShaderPrecisionFormat(GLenum shadertype,
         "*precision = 0x%0.8p)",
         shadertype, precisiontype, range, precision);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetShaderPrecisionFormat);
         context->gatherParams<EntryPoint::GetShaderPrecisionFormat>(shadertype, precisiontype,
                                                                     range, precision);
 
         if (context->skipValidation() ||
             ValidateGetShaderPrecisionFormat(context, shadertype, precisiontype, range, precision))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getShaderPrecisionFormat(shadertype, precisiontype, range, precision);
         }
     }
@@ -1312,14 +1519,17 @@ void GL_APIENTRY GetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length
         "0x%0.8p)",
         shader, bufSize, length, source);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetShaderSource);
         context->gatherParams<EntryPoint::GetShaderSource>(shader, bufSize, length, source);
 
         if (context->skipValidation() ||
             ValidateGetShaderSource(context, shader, bufSize, length, source))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getShaderSource(shader, bufSize, length, source);
         }
     }
@@ -1330,13 +1540,16 @@ void GL_APIENTRY GetShaderiv(GLuint shader, GLenum pname, GLint *params)
     EVENT("(GLuint shader = %u, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", shader, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetShaderiv);
         context->gatherParams<EntryPoint::GetShaderiv>(shader, pname, params);
 
         if (context->skipValidation() || ValidateGetShaderiv(context, shader, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getShaderiv(shader, pname, params);
         }
     }
@@ -1346,13 +1559,16 @@ const GLubyte *GL_APIENTRY GetString(GLenum name)
 {
     EVENT("(GLenum name = 0x%X)", name);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetString);
         context->gatherParams<EntryPoint::GetString>(name);
 
         if (context->skipValidation() || ValidateGetString(context, name))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->getString(name);
         }
     }
@@ -1365,15 +1581,18 @@ void GL_APIENTRY GetTexParameterfv(GLenum target, GLenum pname, GLfloat *params)
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLfloat *params = 0x%0.8p)", target, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetTexParameterfv);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::GetTexParameterfv>(targetPacked, pname, params);
 
         if (context->skipValidation() ||
             ValidateGetTexParameterfv(context, targetPacked, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getTexParameterfv(targetPacked, pname, params);
         }
     }
@@ -1384,15 +1603,18 @@ void GL_APIENTRY GetTexParameteriv(GLenum target, GLenum pname, GLint *params)
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", target, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetTexParameteriv);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::GetTexParameteriv>(targetPacked, pname, params);
 
         if (context->skipValidation() ||
             ValidateGetTexParameteriv(context, targetPacked, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getTexParameteriv(targetPacked, pname, params);
         }
     }
@@ -1402,13 +1624,16 @@ GLint GL_APIENTRY GetUniformLocation(GLuint program, const GLchar *name)
 {
     EVENT("(GLuint program = %u, const GLchar *name = 0x%0.8p)", program, name);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetUniformLocation);
         context->gatherParams<EntryPoint::GetUniformLocation>(program, name);
 
         if (context->skipValidation() || ValidateGetUniformLocation(context, program, name))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->getUniformLocation(program, name);
         }
     }
@@ -1421,13 +1646,16 @@ void GL_APIENTRY GetUniformfv(GLuint program, GLint location, GLfloat *params)
     EVENT("(GLuint program = %u, GLint location = %d, GLfloat *params = 0x%0.8p)", program,
           location, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetUniformfv);
         context->gatherParams<EntryPoint::GetUniformfv>(program, location, params);
 
         if (context->skipValidation() || ValidateGetUniformfv(context, program, location, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getUniformfv(program, location, params);
         }
     }
@@ -1438,13 +1666,16 @@ void GL_APIENTRY GetUniformiv(GLuint program, GLint location, GLint *params)
     EVENT("(GLuint program = %u, GLint location = %d, GLint *params = 0x%0.8p)", program, location,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetUniformiv);
         context->gatherParams<EntryPoint::GetUniformiv>(program, location, params);
 
         if (context->skipValidation() || ValidateGetUniformiv(context, program, location, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getUniformiv(program, location, params);
         }
     }
@@ -1455,14 +1686,17 @@ void GL_APIENTRY GetVertexAttribPointerv(GLuint index, GLenum pname, void **poin
     EVENT("(GLuint index = %u, GLenum pname = 0x%X, void **pointer = 0x%0.8p)", index, pname,
           pointer);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetVertexAttribPointerv);
         context->gatherParams<EntryPoint::GetVertexAttribPointerv>(index, pname, pointer);
 
         if (context->skipValidation() ||
             ValidateGetVertexAttribPointerv(context, index, pname, pointer))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getVertexAttribPointerv(index, pname, pointer);
         }
     }
@@ -1473,13 +1707,16 @@ void GL_APIENTRY GetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params)
     EVENT("(GLuint index = %u, GLenum pname = 0x%X, GLfloat *params = 0x%0.8p)", index, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetVertexAttribfv);
         context->gatherParams<EntryPoint::GetVertexAttribfv>(index, pname, params);
 
         if (context->skipValidation() || ValidateGetVertexAttribfv(context, index, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getVertexAttribfv(index, pname, params);
         }
     }
@@ -1490,13 +1727,16 @@ void GL_APIENTRY GetVertexAttribiv(GLuint index, GLenum pname, GLint *params)
     EVENT("(GLuint index = %u, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", index, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetVertexAttribiv);
         context->gatherParams<EntryPoint::GetVertexAttribiv>(index, pname, params);
 
         if (context->skipValidation() || ValidateGetVertexAttribiv(context, index, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getVertexAttribiv(index, pname, params);
         }
     }
@@ -1506,13 +1746,16 @@ void GL_APIENTRY Hint(GLenum target, GLenum mode)
 {
     EVENT("(GLenum target = 0x%X, GLenum mode = 0x%X)", target, mode);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Hint);
         context->gatherParams<EntryPoint::Hint>(target, mode);
 
         if (context->skipValidation() || ValidateHint(context, target, mode))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->hint(target, mode);
         }
     }
@@ -1522,13 +1765,16 @@ GLboolean GL_APIENTRY IsBuffer(GLuint buffer)
 {
     EVENT("(GLuint buffer = %u)", buffer);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::IsBuffer);
         context->gatherParams<EntryPoint::IsBuffer>(buffer);
 
         if (context->skipValidation() || ValidateIsBuffer(context, buffer))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->isBuffer(buffer);
         }
     }
@@ -1540,13 +1786,16 @@ GLboolean GL_APIENTRY IsEnabled(GLenum cap)
 {
     EVENT("(GLenum cap = 0x%X)", cap);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::IsEnabled);
         context->gatherParams<EntryPoint::IsEnabled>(cap);
 
         if (context->skipValidation() || ValidateIsEnabled(context, cap))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->isEnabled(cap);
         }
     }
@@ -1558,13 +1807,16 @@ GLboolean GL_APIENTRY IsFramebuffer(GLuint framebuffer)
 {
     EVENT("(GLuint framebuffer = %u)", framebuffer);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::IsFramebuffer);
         context->gatherParams<EntryPoint::IsFramebuffer>(framebuffer);
 
         if (context->skipValidation() || ValidateIsFramebuffer(context, framebuffer))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->isFramebuffer(framebuffer);
         }
     }
@@ -1576,13 +1828,16 @@ GLboolean GL_APIENTRY IsProgram(GLuint program)
 {
     EVENT("(GLuint program = %u)", program);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::IsProgram);
         context->gatherParams<EntryPoint::IsProgram>(program);
 
         if (context->skipValidation() || ValidateIsProgram(context, program))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->isProgram(program);
         }
     }
@@ -1594,13 +1849,16 @@ GLboolean GL_APIENTRY IsRenderbuffer(GLuint renderbuffer)
 {
     EVENT("(GLuint renderbuffer = %u)", renderbuffer);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::IsRenderbuffer);
         context->gatherParams<EntryPoint::IsRenderbuffer>(renderbuffer);
 
         if (context->skipValidation() || ValidateIsRenderbuffer(context, renderbuffer))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->isRenderbuffer(renderbuffer);
         }
     }
@@ -1612,13 +1870,16 @@ GLboolean GL_APIENTRY IsShader(GLuint shader)
 {
     EVENT("(GLuint shader = %u)", shader);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::IsShader);
         context->gatherParams<EntryPoint::IsShader>(shader);
 
         if (context->skipValidation() || ValidateIsShader(context, shader))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->isShader(shader);
         }
     }
@@ -1630,13 +1891,16 @@ GLboolean GL_APIENTRY IsTexture(GLuint texture)
 {
     EVENT("(GLuint texture = %u)", texture);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::IsTexture);
         context->gatherParams<EntryPoint::IsTexture>(texture);
 
         if (context->skipValidation() || ValidateIsTexture(context, texture))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->isTexture(texture);
         }
     }
@@ -1648,13 +1912,16 @@ void GL_APIENTRY LineWidth(GLfloat width)
 {
     EVENT("(GLfloat width = %f)", width);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::LineWidth);
         context->gatherParams<EntryPoint::LineWidth>(width);
 
         if (context->skipValidation() || ValidateLineWidth(context, width))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->lineWidth(width);
         }
     }
@@ -1664,13 +1931,16 @@ void GL_APIENTRY LinkProgram(GLuint program)
 {
     EVENT("(GLuint program = %u)", program);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::LinkProgram);
         context->gatherParams<EntryPoint::LinkProgram>(program);
 
         if (context->skipValidation() || ValidateLinkProgram(context, program))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->linkProgram(program);
         }
     }
@@ -1680,13 +1950,16 @@ void GL_APIENTRY PixelStorei(GLenum pname, GLint param)
 {
     EVENT("(GLenum pname = 0x%X, GLint param = %d)", pname, param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::PixelStorei);
         context->gatherParams<EntryPoint::PixelStorei>(pname, param);
 
         if (context->skipValidation() || ValidatePixelStorei(context, pname, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->pixelStorei(pname, param);
         }
     }
@@ -1696,13 +1969,16 @@ void GL_APIENTRY PolygonOffset(GLfloat factor, GLfloat units)
 {
     EVENT("(GLfloat factor = %f, GLfloat units = %f)", factor, units);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::PolygonOffset);
         context->gatherParams<EntryPoint::PolygonOffset>(factor, units);
 
         if (context->skipValidation() || ValidatePolygonOffset(context, factor, units))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->polygonOffset(factor, units);
         }
     }
@@ -1721,14 +1997,17 @@ void GL_APIENTRY ReadPixels(GLint x,
         "0x%X, GLenum type = 0x%X, void *pixels = 0x%0.8p)",
         x, y, width, height, format, type, pixels);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ReadPixels);
         context->gatherParams<EntryPoint::ReadPixels>(x, y, width, height, format, type, pixels);
 
         if (context->skipValidation() ||
             ValidateReadPixels(context, x, y, width, height, format, type, pixels))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->readPixels(x, y, width, height, format, type, pixels);
         }
     }
@@ -1738,13 +2017,16 @@ void GL_APIENTRY ReleaseShaderCompiler()
 {
     EVENT("()");
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ReleaseShaderCompiler);
         context->gatherParams<EntryPoint::ReleaseShaderCompiler>();
 
         if (context->skipValidation() || ValidateReleaseShaderCompiler(context))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->releaseShaderCompiler();
         }
     }
@@ -1760,15 +2042,18 @@ void GL_APIENTRY RenderbufferStorage(GLenum target,
         "%d)",
         target, internalformat, width, height);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::RenderbufferStorage);
         context->gatherParams<EntryPoint::RenderbufferStorage>(target, internalformat, width,
                                                                height);
 
         if (context->skipValidation() ||
             ValidateRenderbufferStorage(context, target, internalformat, width, height))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->renderbufferStorage(target, internalformat, width, height);
         }
     }
@@ -1778,13 +2063,16 @@ void GL_APIENTRY SampleCoverage(GLfloat value, GLboolean invert)
 {
     EVENT("(GLfloat value = %f, GLboolean invert = %u)", value, invert);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::SampleCoverage);
         context->gatherParams<EntryPoint::SampleCoverage>(value, invert);
 
         if (context->skipValidation() || ValidateSampleCoverage(context, value, invert))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->sampleCoverage(value, invert);
         }
     }
@@ -1795,13 +2083,16 @@ void GL_APIENTRY Scissor(GLint x, GLint y, GLsizei width, GLsizei height)
     EVENT("(GLint x = %d, GLint y = %d, GLsizei width = %d, GLsizei height = %d)", x, y, width,
           height);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Scissor);
         context->gatherParams<EntryPoint::Scissor>(x, y, width, height);
 
         if (context->skipValidation() || ValidateScissor(context, x, y, width, height))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->scissor(x, y, width, height);
         }
     }
@@ -1818,15 +2109,18 @@ void GL_APIENTRY ShaderBinary(GLsizei count,
         "void *binary = 0x%0.8p, GLsizei length = %d)",
         count, shaders, binaryformat, binary, length);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ShaderBinary);
         context->gatherParams<EntryPoint::ShaderBinary>(count, shaders, binaryformat, binary,
                                                         length);
 
         if (context->skipValidation() ||
             ValidateShaderBinary(context, count, shaders, binaryformat, binary, length))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->shaderBinary(count, shaders, binaryformat, binary, length);
         }
     }
@@ -1842,14 +2136,17 @@ void GL_APIENTRY ShaderSource(GLuint shader,
         "GLint *length = 0x%0.8p)",
         shader, count, string, length);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ShaderSource);
         context->gatherParams<EntryPoint::ShaderSource>(shader, count, string, length);
 
         if (context->skipValidation() ||
             ValidateShaderSource(context, shader, count, string, length))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->shaderSource(shader, count, string, length);
         }
     }
@@ -1859,13 +2156,16 @@ void GL_APIENTRY StencilFunc(GLenum func, GLint ref, GLuint mask)
 {
     EVENT("(GLenum func = 0x%X, GLint ref = %d, GLuint mask = %u)", func, ref, mask);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::StencilFunc);
         context->gatherParams<EntryPoint::StencilFunc>(func, ref, mask);
 
         if (context->skipValidation() || ValidateStencilFunc(context, func, ref, mask))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->stencilFunc(func, ref, mask);
         }
     }
@@ -1876,14 +2176,17 @@ void GL_APIENTRY StencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint
     EVENT("(GLenum face = 0x%X, GLenum func = 0x%X, GLint ref = %d, GLuint mask = %u)", face, func,
           ref, mask);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::StencilFuncSeparate);
         context->gatherParams<EntryPoint::StencilFuncSeparate>(face, func, ref, mask);
 
         if (context->skipValidation() ||
             ValidateStencilFuncSeparate(context, face, func, ref, mask))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->stencilFuncSeparate(face, func, ref, mask);
         }
     }
@@ -1893,13 +2196,16 @@ void GL_APIENTRY StencilMask(GLuint mask)
 {
     EVENT("(GLuint mask = %u)", mask);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::StencilMask);
         context->gatherParams<EntryPoint::StencilMask>(mask);
 
         if (context->skipValidation() || ValidateStencilMask(context, mask))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->stencilMask(mask);
         }
     }
@@ -1909,13 +2215,16 @@ void GL_APIENTRY StencilMaskSeparate(GLenum face, GLuint mask)
 {
     EVENT("(GLenum face = 0x%X, GLuint mask = %u)", face, mask);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::StencilMaskSeparate);
         context->gatherParams<EntryPoint::StencilMaskSeparate>(face, mask);
 
         if (context->skipValidation() || ValidateStencilMaskSeparate(context, face, mask))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->stencilMaskSeparate(face, mask);
         }
     }
@@ -1925,13 +2234,16 @@ void GL_APIENTRY StencilOp(GLenum fail, GLenum zfail, GLenum zpass)
 {
     EVENT("(GLenum fail = 0x%X, GLenum zfail = 0x%X, GLenum zpass = 0x%X)", fail, zfail, zpass);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::StencilOp);
         context->gatherParams<EntryPoint::StencilOp>(fail, zfail, zpass);
 
         if (context->skipValidation() || ValidateStencilOp(context, fail, zfail, zpass))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->stencilOp(fail, zfail, zpass);
         }
     }
@@ -1942,14 +2254,17 @@ void GL_APIENTRY StencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLe
     EVENT("(GLenum face = 0x%X, GLenum sfail = 0x%X, GLenum dpfail = 0x%X, GLenum dppass = 0x%X)",
           face, sfail, dpfail, dppass);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::StencilOpSeparate);
         context->gatherParams<EntryPoint::StencilOpSeparate>(face, sfail, dpfail, dppass);
 
         if (context->skipValidation() ||
             ValidateStencilOpSeparate(context, face, sfail, dpfail, dppass))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->stencilOpSeparate(face, sfail, dpfail, dppass);
         }
     }
@@ -1971,9 +2286,11 @@ void GL_APIENTRY TexImage2D(GLenum target,
         "void *pixels = 0x%0.8p)",
         target, level, internalformat, width, height, border, format, type, pixels);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexImage2D);
         TextureTarget targetPacked = FromGLenum<TextureTarget>(target);
         context->gatherParams<EntryPoint::TexImage2D>(targetPacked, level, internalformat, width,
                                                       height, border, format, type, pixels);
@@ -1982,6 +2299,7 @@ void GL_APIENTRY TexImage2D(GLenum target,
             ValidateTexImage2D(context, targetPacked, level, internalformat, width, height, border,
                                format, type, pixels))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texImage2D(targetPacked, level, internalformat, width, height, border, format,
                                 type, pixels);
         }
@@ -1992,14 +2310,17 @@ void GL_APIENTRY TexParameterf(GLenum target, GLenum pname, GLfloat param)
 {
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLfloat param = %f)", target, pname, param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexParameterf);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::TexParameterf>(targetPacked, pname, param);
 
         if (context->skipValidation() || ValidateTexParameterf(context, targetPacked, pname, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texParameterf(targetPacked, pname, param);
         }
     }
@@ -2010,15 +2331,18 @@ void GL_APIENTRY TexParameterfv(GLenum target, GLenum pname, const GLfloat *para
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, const GLfloat *params = 0x%0.8p)", target,
           pname, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexParameterfv);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::TexParameterfv>(targetPacked, pname, params);
 
         if (context->skipValidation() ||
             ValidateTexParameterfv(context, targetPacked, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texParameterfv(targetPacked, pname, params);
         }
     }
@@ -2028,14 +2352,17 @@ void GL_APIENTRY TexParameteri(GLenum target, GLenum pname, GLint param)
 {
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLint param = %d)", target, pname, param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexParameteri);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::TexParameteri>(targetPacked, pname, param);
 
         if (context->skipValidation() || ValidateTexParameteri(context, targetPacked, pname, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texParameteri(targetPacked, pname, param);
         }
     }
@@ -2046,15 +2373,18 @@ void GL_APIENTRY TexParameteriv(GLenum target, GLenum pname, const GLint *params
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, const GLint *params = 0x%0.8p)", target,
           pname, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexParameteriv);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::TexParameteriv>(targetPacked, pname, params);
 
         if (context->skipValidation() ||
             ValidateTexParameteriv(context, targetPacked, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texParameteriv(targetPacked, pname, params);
         }
     }
@@ -2076,9 +2406,11 @@ void GL_APIENTRY TexSubImage2D(GLenum target,
         "*pixels = 0x%0.8p)",
         target, level, xoffset, yoffset, width, height, format, type, pixels);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexSubImage2D);
         TextureTarget targetPacked = FromGLenum<TextureTarget>(target);
         context->gatherParams<EntryPoint::TexSubImage2D>(targetPacked, level, xoffset, yoffset,
                                                          width, height, format, type, pixels);
@@ -2087,6 +2419,7 @@ void GL_APIENTRY TexSubImage2D(GLenum target,
             ValidateTexSubImage2D(context, targetPacked, level, xoffset, yoffset, width, height,
                                   format, type, pixels))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texSubImage2D(targetPacked, level, xoffset, yoffset, width, height, format,
                                    type, pixels);
         }
@@ -2097,13 +2430,16 @@ void GL_APIENTRY Uniform1f(GLint location, GLfloat v0)
 {
     EVENT("(GLint location = %d, GLfloat v0 = %f)", location, v0);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Uniform1f);
         context->gatherParams<EntryPoint::Uniform1f>(location, v0);
 
         if (context->skipValidation() || ValidateUniform1f(context, location, v0))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniform1f(location, v0);
         }
     }
@@ -2114,13 +2450,16 @@ void GL_APIENTRY Uniform1fv(GLint location, GLsizei count, const GLfloat *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLfloat *value = 0x%0.8p)", location,
           count, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Uniform1fv);
         context->gatherParams<EntryPoint::Uniform1fv>(location, count, value);
 
         if (context->skipValidation() || ValidateUniform1fv(context, location, count, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniform1fv(location, count, value);
         }
     }
@@ -2130,13 +2469,16 @@ void GL_APIENTRY Uniform1i(GLint location, GLint v0)
 {
     EVENT("(GLint location = %d, GLint v0 = %d)", location, v0);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Uniform1i);
         context->gatherParams<EntryPoint::Uniform1i>(location, v0);
 
         if (context->skipValidation() || ValidateUniform1i(context, location, v0))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniform1i(location, v0);
         }
     }
@@ -2147,13 +2489,16 @@ void GL_APIENTRY Uniform1iv(GLint location, GLsizei count, const GLint *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLint *value = 0x%0.8p)", location,
           count, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Uniform1iv);
         context->gatherParams<EntryPoint::Uniform1iv>(location, count, value);
 
         if (context->skipValidation() || ValidateUniform1iv(context, location, count, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniform1iv(location, count, value);
         }
     }
@@ -2163,13 +2508,16 @@ void GL_APIENTRY Uniform2f(GLint location, GLfloat v0, GLfloat v1)
 {
     EVENT("(GLint location = %d, GLfloat v0 = %f, GLfloat v1 = %f)", location, v0, v1);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Uniform2f);
         context->gatherParams<EntryPoint::Uniform2f>(location, v0, v1);
 
         if (context->skipValidation() || ValidateUniform2f(context, location, v0, v1))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniform2f(location, v0, v1);
         }
     }
@@ -2180,13 +2528,16 @@ void GL_APIENTRY Uniform2fv(GLint location, GLsizei count, const GLfloat *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLfloat *value = 0x%0.8p)", location,
           count, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Uniform2fv);
         context->gatherParams<EntryPoint::Uniform2fv>(location, count, value);
 
         if (context->skipValidation() || ValidateUniform2fv(context, location, count, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniform2fv(location, count, value);
         }
     }
@@ -2196,13 +2547,16 @@ void GL_APIENTRY Uniform2i(GLint location, GLint v0, GLint v1)
 {
     EVENT("(GLint location = %d, GLint v0 = %d, GLint v1 = %d)", location, v0, v1);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Uniform2i);
         context->gatherParams<EntryPoint::Uniform2i>(location, v0, v1);
 
         if (context->skipValidation() || ValidateUniform2i(context, location, v0, v1))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniform2i(location, v0, v1);
         }
     }
@@ -2213,13 +2567,16 @@ void GL_APIENTRY Uniform2iv(GLint location, GLsizei count, const GLint *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLint *value = 0x%0.8p)", location,
           count, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Uniform2iv);
         context->gatherParams<EntryPoint::Uniform2iv>(location, count, value);
 
         if (context->skipValidation() || ValidateUniform2iv(context, location, count, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniform2iv(location, count, value);
         }
     }
@@ -2230,13 +2587,16 @@ void GL_APIENTRY Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
     EVENT("(GLint location = %d, GLfloat v0 = %f, GLfloat v1 = %f, GLfloat v2 = %f)", location, v0,
           v1, v2);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Uniform3f);
         context->gatherParams<EntryPoint::Uniform3f>(location, v0, v1, v2);
 
         if (context->skipValidation() || ValidateUniform3f(context, location, v0, v1, v2))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniform3f(location, v0, v1, v2);
         }
     }
@@ -2247,13 +2607,16 @@ void GL_APIENTRY Uniform3fv(GLint location, GLsizei count, const GLfloat *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLfloat *value = 0x%0.8p)", location,
           count, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Uniform3fv);
         context->gatherParams<EntryPoint::Uniform3fv>(location, count, value);
 
         if (context->skipValidation() || ValidateUniform3fv(context, location, count, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniform3fv(location, count, value);
         }
     }
@@ -2264,13 +2627,16 @@ void GL_APIENTRY Uniform3i(GLint location, GLint v0, GLint v1, GLint v2)
     EVENT("(GLint location = %d, GLint v0 = %d, GLint v1 = %d, GLint v2 = %d)", location, v0, v1,
           v2);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Uniform3i);
         context->gatherParams<EntryPoint::Uniform3i>(location, v0, v1, v2);
 
         if (context->skipValidation() || ValidateUniform3i(context, location, v0, v1, v2))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniform3i(location, v0, v1, v2);
         }
     }
@@ -2281,13 +2647,16 @@ void GL_APIENTRY Uniform3iv(GLint location, GLsizei count, const GLint *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLint *value = 0x%0.8p)", location,
           count, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Uniform3iv);
         context->gatherParams<EntryPoint::Uniform3iv>(location, count, value);
 
         if (context->skipValidation() || ValidateUniform3iv(context, location, count, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniform3iv(location, count, value);
         }
     }
@@ -2299,13 +2668,16 @@ void GL_APIENTRY Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, G
         "(GLint location = %d, GLfloat v0 = %f, GLfloat v1 = %f, GLfloat v2 = %f, GLfloat v3 = %f)",
         location, v0, v1, v2, v3);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Uniform4f);
         context->gatherParams<EntryPoint::Uniform4f>(location, v0, v1, v2, v3);
 
         if (context->skipValidation() || ValidateUniform4f(context, location, v0, v1, v2, v3))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniform4f(location, v0, v1, v2, v3);
         }
     }
@@ -2316,13 +2688,16 @@ void GL_APIENTRY Uniform4fv(GLint location, GLsizei count, const GLfloat *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLfloat *value = 0x%0.8p)", location,
           count, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Uniform4fv);
         context->gatherParams<EntryPoint::Uniform4fv>(location, count, value);
 
         if (context->skipValidation() || ValidateUniform4fv(context, location, count, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniform4fv(location, count, value);
         }
     }
@@ -2333,13 +2708,16 @@ void GL_APIENTRY Uniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v
     EVENT("(GLint location = %d, GLint v0 = %d, GLint v1 = %d, GLint v2 = %d, GLint v3 = %d)",
           location, v0, v1, v2, v3);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Uniform4i);
         context->gatherParams<EntryPoint::Uniform4i>(location, v0, v1, v2, v3);
 
         if (context->skipValidation() || ValidateUniform4i(context, location, v0, v1, v2, v3))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniform4i(location, v0, v1, v2, v3);
         }
     }
@@ -2350,13 +2728,16 @@ void GL_APIENTRY Uniform4iv(GLint location, GLsizei count, const GLint *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLint *value = 0x%0.8p)", location,
           count, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Uniform4iv);
         context->gatherParams<EntryPoint::Uniform4iv>(location, count, value);
 
         if (context->skipValidation() || ValidateUniform4iv(context, location, count, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniform4iv(location, count, value);
         }
     }
@@ -2372,14 +2753,17 @@ void GL_APIENTRY UniformMatrix2fv(GLint location,
         "= 0x%0.8p)",
         location, count, transpose, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::UniformMatrix2fv);
         context->gatherParams<EntryPoint::UniformMatrix2fv>(location, count, transpose, value);
 
         if (context->skipValidation() ||
             ValidateUniformMatrix2fv(context, location, count, transpose, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniformMatrix2fv(location, count, transpose, value);
         }
     }
@@ -2395,14 +2779,17 @@ void GL_APIENTRY UniformMatrix3fv(GLint location,
         "= 0x%0.8p)",
         location, count, transpose, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::UniformMatrix3fv);
         context->gatherParams<EntryPoint::UniformMatrix3fv>(location, count, transpose, value);
 
         if (context->skipValidation() ||
             ValidateUniformMatrix3fv(context, location, count, transpose, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniformMatrix3fv(location, count, transpose, value);
         }
     }
@@ -2418,14 +2805,17 @@ void GL_APIENTRY UniformMatrix4fv(GLint location,
         "= 0x%0.8p)",
         location, count, transpose, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::UniformMatrix4fv);
         context->gatherParams<EntryPoint::UniformMatrix4fv>(location, count, transpose, value);
 
         if (context->skipValidation() ||
             ValidateUniformMatrix4fv(context, location, count, transpose, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniformMatrix4fv(location, count, transpose, value);
         }
     }
@@ -2435,13 +2825,16 @@ void GL_APIENTRY UseProgram(GLuint program)
 {
     EVENT("(GLuint program = %u)", program);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::UseProgram);
         context->gatherParams<EntryPoint::UseProgram>(program);
 
         if (context->skipValidation() || ValidateUseProgram(context, program))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->useProgram(program);
         }
     }
@@ -2451,13 +2844,16 @@ void GL_APIENTRY ValidateProgram(GLuint program)
 {
     EVENT("(GLuint program = %u)", program);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ValidateProgram);
         context->gatherParams<EntryPoint::ValidateProgram>(program);
 
         if (context->skipValidation() || ValidateValidateProgram(context, program))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->validateProgram(program);
         }
     }
@@ -2467,13 +2863,16 @@ void GL_APIENTRY VertexAttrib1f(GLuint index, GLfloat x)
 {
     EVENT("(GLuint index = %u, GLfloat x = %f)", index, x);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::VertexAttrib1f);
         context->gatherParams<EntryPoint::VertexAttrib1f>(index, x);
 
         if (context->skipValidation() || ValidateVertexAttrib1f(context, index, x))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->vertexAttrib1f(index, x);
         }
     }
@@ -2483,13 +2882,16 @@ void GL_APIENTRY VertexAttrib1fv(GLuint index, const GLfloat *v)
 {
     EVENT("(GLuint index = %u, const GLfloat *v = 0x%0.8p)", index, v);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::VertexAttrib1fv);
         context->gatherParams<EntryPoint::VertexAttrib1fv>(index, v);
 
         if (context->skipValidation() || ValidateVertexAttrib1fv(context, index, v))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->vertexAttrib1fv(index, v);
         }
     }
@@ -2499,13 +2901,16 @@ void GL_APIENTRY VertexAttrib2f(GLuint index, GLfloat x, GLfloat y)
 {
     EVENT("(GLuint index = %u, GLfloat x = %f, GLfloat y = %f)", index, x, y);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::VertexAttrib2f);
         context->gatherParams<EntryPoint::VertexAttrib2f>(index, x, y);
 
         if (context->skipValidation() || ValidateVertexAttrib2f(context, index, x, y))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->vertexAttrib2f(index, x, y);
         }
     }
@@ -2515,13 +2920,16 @@ void GL_APIENTRY VertexAttrib2fv(GLuint index, const GLfloat *v)
 {
     EVENT("(GLuint index = %u, const GLfloat *v = 0x%0.8p)", index, v);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::VertexAttrib2fv);
         context->gatherParams<EntryPoint::VertexAttrib2fv>(index, v);
 
         if (context->skipValidation() || ValidateVertexAttrib2fv(context, index, v))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->vertexAttrib2fv(index, v);
         }
     }
@@ -2531,13 +2939,16 @@ void GL_APIENTRY VertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z)
 {
     EVENT("(GLuint index = %u, GLfloat x = %f, GLfloat y = %f, GLfloat z = %f)", index, x, y, z);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::VertexAttrib3f);
         context->gatherParams<EntryPoint::VertexAttrib3f>(index, x, y, z);
 
         if (context->skipValidation() || ValidateVertexAttrib3f(context, index, x, y, z))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->vertexAttrib3f(index, x, y, z);
         }
     }
@@ -2547,13 +2958,16 @@ void GL_APIENTRY VertexAttrib3fv(GLuint index, const GLfloat *v)
 {
     EVENT("(GLuint index = %u, const GLfloat *v = 0x%0.8p)", index, v);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::VertexAttrib3fv);
         context->gatherParams<EntryPoint::VertexAttrib3fv>(index, v);
 
         if (context->skipValidation() || ValidateVertexAttrib3fv(context, index, v))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->vertexAttrib3fv(index, v);
         }
     }
@@ -2564,13 +2978,16 @@ void GL_APIENTRY VertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, G
     EVENT("(GLuint index = %u, GLfloat x = %f, GLfloat y = %f, GLfloat z = %f, GLfloat w = %f)",
           index, x, y, z, w);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::VertexAttrib4f);
         context->gatherParams<EntryPoint::VertexAttrib4f>(index, x, y, z, w);
 
         if (context->skipValidation() || ValidateVertexAttrib4f(context, index, x, y, z, w))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->vertexAttrib4f(index, x, y, z, w);
         }
     }
@@ -2580,13 +2997,16 @@ void GL_APIENTRY VertexAttrib4fv(GLuint index, const GLfloat *v)
 {
     EVENT("(GLuint index = %u, const GLfloat *v = 0x%0.8p)", index, v);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::VertexAttrib4fv);
         context->gatherParams<EntryPoint::VertexAttrib4fv>(index, v);
 
         if (context->skipValidation() || ValidateVertexAttrib4fv(context, index, v))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->vertexAttrib4fv(index, v);
         }
     }
@@ -2604,15 +3024,18 @@ void GL_APIENTRY VertexAttribPointer(GLuint index,
         "GLsizei stride = %d, const void *pointer = 0x%0.8p)",
         index, size, type, normalized, stride, pointer);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::VertexAttribPointer);
         context->gatherParams<EntryPoint::VertexAttribPointer>(index, size, type, normalized,
                                                                stride, pointer);
 
         if (context->skipValidation() ||
             ValidateVertexAttribPointer(context, index, size, type, normalized, stride, pointer))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->vertexAttribPointer(index, size, type, normalized, stride, pointer);
         }
     }
@@ -2623,13 +3046,16 @@ void GL_APIENTRY Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
     EVENT("(GLint x = %d, GLint y = %d, GLsizei width = %d, GLsizei height = %d)", x, y, width,
           height);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Viewport);
         context->gatherParams<EntryPoint::Viewport>(x, y, width, height);
 
         if (context->skipValidation() || ValidateViewport(context, x, y, width, height))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->viewport(x, y, width, height);
         }
     }
@@ -20,14 +20,17 @@ void GL_APIENTRY BeginQuery(GLenum target, GLuint id)
 {
     EVENT("(GLenum target = 0x%X, GLuint id = %u)", target, id);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::BeginQuery);
         QueryType targetPacked = FromGLenum<QueryType>(target);
         context->gatherParams<EntryPoint::BeginQuery>(targetPacked, id);
 
         if (context->skipValidation() || ValidateBeginQuery(context, targetPacked, id))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->beginQuery(targetPacked, id);
         }
     }
@@ -37,13 +40,16 @@ void GL_APIENTRY BeginTransformFeedback(GLenum primitiveMode)
 {
     EVENT("(GLenum primitiveMode = 0x%X)", primitiveMode);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::BeginTransformFeedback);
         context->gatherParams<EntryPoint::BeginTransformFeedback>(primitiveMode);
 
         if (context->skipValidation() || ValidateBeginTransformFeedback(context, primitiveMode))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->beginTransformFeedback(primitiveMode);
         }
     }
@@ -53,15 +59,18 @@ void GL_APIENTRY BindBufferBase(GLenum target, GLuint index, GLuint buffer)
 {
     EVENT("(GLenum target = 0x%X, GLuint index = %u, GLuint buffer = %u)", target, index, buffer);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::BindBufferBase);
         BufferBinding targetPacked = FromGLenum<BufferBinding>(target);
         context->gatherParams<EntryPoint::BindBufferBase>(targetPacked, index, buffer);
 
         if (context->skipValidation() ||
             ValidateBindBufferBase(context, targetPacked, index, buffer))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->bindBufferBase(targetPacked, index, buffer);
         }
     }
@@ -75,9 +84,11 @@ BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLs
         "GLsizeiptr size = %d)",
         target, index, buffer, offset, size);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::BindBufferRange);
         BufferBinding targetPacked = FromGLenum<BufferBinding>(target);
         context->gatherParams<EntryPoint::BindBufferRange>(targetPacked, index, buffer, offset,
                                                            size);
@@ -85,6 +96,7 @@ BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLs
         if (context->skipValidation() ||
             ValidateBindBufferRange(context, targetPacked, index, buffer, offset, size))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->bindBufferRange(targetPacked, index, buffer, offset, size);
         }
     }
@@ -94,13 +106,16 @@ void GL_APIENTRY BindSampler(GLuint unit, GLuint sampler)
 {
     EVENT("(GLuint unit = %u, GLuint sampler = %u)", unit, sampler);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::BindSampler);
         context->gatherParams<EntryPoint::BindSampler>(unit, sampler);
 
         if (context->skipValidation() || ValidateBindSampler(context, unit, sampler))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->bindSampler(unit, sampler);
         }
     }
@@ -110,13 +125,16 @@ void GL_APIENTRY BindTransformFeedback(GLenum target, GLuint id)
 {
     EVENT("(GLenum target = 0x%X, GLuint id = %u)", target, id);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::BindTransformFeedback);
         context->gatherParams<EntryPoint::BindTransformFeedback>(target, id);
 
         if (context->skipValidation() || ValidateBindTransformFeedback(context, target, id))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->bindTransformFeedback(target, id);
         }
     }
@@ -126,13 +144,16 @@ void GL_APIENTRY BindVertexArray(GLuint array)
 {
     EVENT("(GLuint array = %u)", array);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::BindVertexArray);
         context->gatherParams<EntryPoint::BindVertexArray>(array);
 
         if (context->skipValidation() || ValidateBindVertexArray(context, array))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->bindVertexArray(array);
         }
     }
@@ -155,9 +176,11 @@ void GL_APIENTRY BlitFramebuffer(GLint srcX0,
         "filter = 0x%X)",
         srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::BlitFramebuffer);
         context->gatherParams<EntryPoint::BlitFramebuffer>(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0,
                                                            dstX1, dstY1, mask, filter);
 
@@ -165,6 +188,7 @@ void GL_APIENTRY BlitFramebuffer(GLint srcX0,
             ValidateBlitFramebuffer(context, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1,
                                     mask, filter))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->blitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask,
                                      filter);
         }
@@ -176,14 +200,17 @@ void GL_APIENTRY ClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, G
     EVENT("(GLenum buffer = 0x%X, GLint drawbuffer = %d, GLfloat depth = %f, GLint stencil = %d)",
           buffer, drawbuffer, depth, stencil);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ClearBufferfi);
         context->gatherParams<EntryPoint::ClearBufferfi>(buffer, drawbuffer, depth, stencil);
 
         if (context->skipValidation() ||
             ValidateClearBufferfi(context, buffer, drawbuffer, depth, stencil))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->clearBufferfi(buffer, drawbuffer, depth, stencil);
         }
     }
@@ -194,13 +221,16 @@ void GL_APIENTRY ClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *v
     EVENT("(GLenum buffer = 0x%X, GLint drawbuffer = %d, const GLfloat *value = 0x%0.8p)", buffer,
           drawbuffer, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ClearBufferfv);
         context->gatherParams<EntryPoint::ClearBufferfv>(buffer, drawbuffer, value);
 
         if (context->skipValidation() || ValidateClearBufferfv(context, buffer, drawbuffer, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->clearBufferfv(buffer, drawbuffer, value);
         }
     }
@@ -211,13 +241,16 @@ void GL_APIENTRY ClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *val
     EVENT("(GLenum buffer = 0x%X, GLint drawbuffer = %d, const GLint *value = 0x%0.8p)", buffer,
           drawbuffer, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ClearBufferiv);
         context->gatherParams<EntryPoint::ClearBufferiv>(buffer, drawbuffer, value);
 
         if (context->skipValidation() || ValidateClearBufferiv(context, buffer, drawbuffer, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->clearBufferiv(buffer, drawbuffer, value);
         }
     }
@@ -228,13 +261,16 @@ void GL_APIENTRY ClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *v
     EVENT("(GLenum buffer = 0x%X, GLint drawbuffer = %d, const GLuint *value = 0x%0.8p)", buffer,
           drawbuffer, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ClearBufferuiv);
         context->gatherParams<EntryPoint::ClearBufferuiv>(buffer, drawbuffer, value);
 
         if (context->skipValidation() || ValidateClearBufferuiv(context, buffer, drawbuffer, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->clearBufferuiv(buffer, drawbuffer, value);
         }
     }
@@ -245,13 +281,16 @@ GLenum GL_APIENTRY ClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeou
     EVENT("(GLsync sync = 0x%0.8p, GLbitfield flags = 0x%X, GLuint64 timeout = %llu)", sync, flags,
           timeout);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ClientWaitSync);
         context->gatherParams<EntryPoint::ClientWaitSync>(sync, flags, timeout);
 
         if (context->skipValidation() || ValidateClientWaitSync(context, sync, flags, timeout))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->clientWaitSync(sync, flags, timeout);
         }
     }
@@ -275,9 +314,11 @@ void GL_APIENTRY CompressedTexImage3D(GLenum target,
         "const void *data = 0x%0.8p)",
         target, level, internalformat, width, height, depth, border, imageSize, data);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::CompressedTexImage3D);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::CompressedTexImage3D>(
             targetPacked, level, internalformat, width, height, depth, border, imageSize, data);
@@ -286,6 +327,7 @@ void GL_APIENTRY CompressedTexImage3D(GLenum target,
             ValidateCompressedTexImage3D(context, targetPacked, level, internalformat, width,
                                          height, depth, border, imageSize, data))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->compressedTexImage3D(targetPacked, level, internalformat, width, height, depth,
                                           border, imageSize, data);
         }
@@ -310,9 +352,11 @@ void GL_APIENTRY CompressedTexSubImage3D(GLenum target,
         "= 0x%X, GLsizei imageSize = %d, const void *data = 0x%0.8p)",
         target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::CompressedTexSubImage3D);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::CompressedTexSubImage3D>(targetPacked, level, xoffset,
                                                                    yoffset, zoffset, width, height,
@@ -322,6 +366,7 @@ void GL_APIENTRY CompressedTexSubImage3D(GLenum target,
             ValidateCompressedTexSubImage3D(context, targetPacked, level, xoffset, yoffset, zoffset,
                                             width, height, depth, format, imageSize, data))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->compressedTexSubImage3D(targetPacked, level, xoffset, yoffset, zoffset, width,
                                              height, depth, format, imageSize, data);
         }
@@ -339,9 +384,11 @@ void GL_APIENTRY CopyBufferSubData(GLenum readTarget,
         "writeOffset = %d, GLsizeiptr size = %d)",
         readTarget, writeTarget, readOffset, writeOffset, size);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::CopyBufferSubData);
         BufferBinding readTargetPacked  = FromGLenum<BufferBinding>(readTarget);
         BufferBinding writeTargetPacked = FromGLenum<BufferBinding>(writeTarget);
         context->gatherParams<EntryPoint::CopyBufferSubData>(readTargetPacked, writeTargetPacked,
@@ -351,6 +398,7 @@ void GL_APIENTRY CopyBufferSubData(GLenum readTarget,
             ValidateCopyBufferSubData(context, readTargetPacked, writeTargetPacked, readOffset,
                                       writeOffset, size))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->copyBufferSubData(readTargetPacked, writeTargetPacked, readOffset, writeOffset,
                                        size);
         }
@@ -372,9 +420,11 @@ void GL_APIENTRY CopyTexSubImage3D(GLenum target,
         "zoffset = %d, GLint x = %d, GLint y = %d, GLsizei width = %d, GLsizei height = %d)",
         target, level, xoffset, yoffset, zoffset, x, y, width, height);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::CopyTexSubImage3D);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::CopyTexSubImage3D>(targetPacked, level, xoffset, yoffset,
                                                              zoffset, x, y, width, height);
@@ -383,6 +433,7 @@ void GL_APIENTRY CopyTexSubImage3D(GLenum target,
             ValidateCopyTexSubImage3D(context, targetPacked, level, xoffset, yoffset, zoffset, x, y,
                                       width, height))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->copyTexSubImage3D(targetPacked, level, xoffset, yoffset, zoffset, x, y, width,
                                        height);
         }
@@ -393,13 +444,16 @@ void GL_APIENTRY DeleteQueries(GLsizei n, const GLuint *ids)
 {
     EVENT("(GLsizei n = %d, const GLuint *ids = 0x%0.8p)", n, ids);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DeleteQueries);
         context->gatherParams<EntryPoint::DeleteQueries>(n, ids);
 
         if (context->skipValidation() || ValidateDeleteQueries(context, n, ids))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->deleteQueries(n, ids);
         }
     }
@@ -409,13 +463,16 @@ void GL_APIENTRY DeleteSamplers(GLsizei count, const GLuint *samplers)
 {
     EVENT("(GLsizei count = %d, const GLuint *samplers = 0x%0.8p)", count, samplers);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DeleteSamplers);
         context->gatherParams<EntryPoint::DeleteSamplers>(count, samplers);
 
         if (context->skipValidation() || ValidateDeleteSamplers(context, count, samplers))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->deleteSamplers(count, samplers);
         }
     }
@@ -425,13 +482,16 @@ void GL_APIENTRY DeleteSync(GLsync sync)
 {
     EVENT("(GLsync sync = 0x%0.8p)", sync);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DeleteSync);
         context->gatherParams<EntryPoint::DeleteSync>(sync);
 
         if (context->skipValidation() || ValidateDeleteSync(context, sync))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->deleteSync(sync);
         }
     }
@@ -441,13 +501,16 @@ void GL_APIENTRY DeleteTransformFeedbacks(GLsizei n, const GLuint *ids)
 {
     EVENT("(GLsizei n = %d, const GLuint *ids = 0x%0.8p)", n, ids);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DeleteTransformFeedbacks);
         context->gatherParams<EntryPoint::DeleteTransformFeedbacks>(n, ids);
 
         if (context->skipValidation() || ValidateDeleteTransformFeedbacks(context, n, ids))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->deleteTransformFeedbacks(n, ids);
         }
     }
@@ -457,13 +520,16 @@ void GL_APIENTRY DeleteVertexArrays(GLsizei n, const GLuint *arrays)
 {
     EVENT("(GLsizei n = %d, const GLuint *arrays = 0x%0.8p)", n, arrays);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DeleteVertexArrays);
         context->gatherParams<EntryPoint::DeleteVertexArrays>(n, arrays);
 
         if (context->skipValidation() || ValidateDeleteVertexArrays(context, n, arrays))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->deleteVertexArrays(n, arrays);
         }
     }
@@ -474,14 +540,17 @@ void GL_APIENTRY DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GL
     EVENT("(GLenum mode = 0x%X, GLint first = %d, GLsizei count = %d, GLsizei instancecount = %d)",
           mode, first, count, instancecount);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DrawArraysInstanced);
         context->gatherParams<EntryPoint::DrawArraysInstanced>(mode, first, count, instancecount);
 
         if (context->skipValidation() ||
             ValidateDrawArraysInstanced(context, mode, first, count, instancecount))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->drawArraysInstanced(mode, first, count, instancecount);
         }
     }
@@ -491,13 +560,16 @@ void GL_APIENTRY DrawBuffers(GLsizei n, const GLenum *bufs)
 {
     EVENT("(GLsizei n = %d, const GLenum *bufs = 0x%0.8p)", n, bufs);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DrawBuffers);
         context->gatherParams<EntryPoint::DrawBuffers>(n, bufs);
 
         if (context->skipValidation() || ValidateDrawBuffers(context, n, bufs))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->drawBuffers(n, bufs);
         }
     }
@@ -514,15 +586,18 @@ void GL_APIENTRY DrawElementsInstanced(GLenum mode,
         "0x%0.8p, GLsizei instancecount = %d)",
         mode, count, type, indices, instancecount);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DrawElementsInstanced);
         context->gatherParams<EntryPoint::DrawElementsInstanced>(mode, count, type, indices,
                                                                  instancecount);
 
         if (context->skipValidation() ||
             ValidateDrawElementsInstanced(context, mode, count, type, indices, instancecount))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->drawElementsInstanced(mode, count, type, indices, instancecount);
         }
     }
@@ -540,15 +615,18 @@ void GL_APIENTRY DrawRangeElements(GLenum mode,
         "= 0x%X, const void *indices = 0x%0.8p)",
         mode, start, end, count, type, indices);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DrawRangeElements);
         context->gatherParams<EntryPoint::DrawRangeElements>(mode, start, end, count, type,
                                                              indices);
 
         if (context->skipValidation() ||
             ValidateDrawRangeElements(context, mode, start, end, count, type, indices))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->drawRangeElements(mode, start, end, count, type, indices);
         }
     }
@@ -558,14 +636,17 @@ void GL_APIENTRY EndQuery(GLenum target)
 {
     EVENT("(GLenum target = 0x%X)", target);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::EndQuery);
         QueryType targetPacked = FromGLenum<QueryType>(target);
         context->gatherParams<EntryPoint::EndQuery>(targetPacked);
 
         if (context->skipValidation() || ValidateEndQuery(context, targetPacked))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->endQuery(targetPacked);
         }
     }
@@ -575,13 +656,16 @@ void GL_APIENTRY EndTransformFeedback()
 {
     EVENT("()");
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::EndTransformFeedback);
         context->gatherParams<EntryPoint::EndTransformFeedback>();
 
         if (context->skipValidation() || ValidateEndTransformFeedback(context))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->endTransformFeedback();
         }
     }
@@ -591,13 +675,16 @@ GLsync GL_APIENTRY FenceSync(GLenum condition, GLbitfield flags)
 {
     EVENT("(GLenum condition = 0x%X, GLbitfield flags = 0x%X)", condition, flags);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::FenceSync);
         context->gatherParams<EntryPoint::FenceSync>(condition, flags);
 
         if (context->skipValidation() || ValidateFenceSync(context, condition, flags))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->fenceSync(condition, flags);
         }
     }
@@ -610,15 +697,18 @@ void GL_APIENTRY FlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeip
     EVENT("(GLenum target = 0x%X, GLintptr offset = %d, GLsizeiptr length = %d)", target, offset,
           length);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::FlushMappedBufferRange);
         BufferBinding targetPacked = FromGLenum<BufferBinding>(target);
         context->gatherParams<EntryPoint::FlushMappedBufferRange>(targetPacked, offset, length);
 
         if (context->skipValidation() ||
             ValidateFlushMappedBufferRange(context, targetPacked, offset, length))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->flushMappedBufferRange(targetPacked, offset, length);
         }
     }
@@ -632,15 +722,18 @@ FramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint
         "GLint layer = %d)",
         target, attachment, texture, level, layer);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::FramebufferTextureLayer);
         context->gatherParams<EntryPoint::FramebufferTextureLayer>(target, attachment, texture,
                                                                    level, layer);
 
         if (context->skipValidation() ||
             ValidateFramebufferTextureLayer(context, target, attachment, texture, level, layer))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->framebufferTextureLayer(target, attachment, texture, level, layer);
         }
     }
@@ -650,13 +743,16 @@ void GL_APIENTRY GenQueries(GLsizei n, GLuint *ids)
 {
     EVENT("(GLsizei n = %d, GLuint *ids = 0x%0.8p)", n, ids);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GenQueries);
         context->gatherParams<EntryPoint::GenQueries>(n, ids);
 
         if (context->skipValidation() || ValidateGenQueries(context, n, ids))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->genQueries(n, ids);
         }
     }
@@ -666,13 +762,16 @@ void GL_APIENTRY GenSamplers(GLsizei count, GLuint *samplers)
 {
     EVENT("(GLsizei count = %d, GLuint *samplers = 0x%0.8p)", count, samplers);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GenSamplers);
         context->gatherParams<EntryPoint::GenSamplers>(count, samplers);
 
         if (context->skipValidation() || ValidateGenSamplers(context, count, samplers))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->genSamplers(count, samplers);
         }
     }
@@ -682,13 +781,16 @@ void GL_APIENTRY GenTransformFeedbacks(GLsizei n, GLuint *ids)
 {
     EVENT("(GLsizei n = %d, GLuint *ids = 0x%0.8p)", n, ids);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GenTransformFeedbacks);
         context->gatherParams<EntryPoint::GenTransformFeedbacks>(n, ids);
 
         if (context->skipValidation() || ValidateGenTransformFeedbacks(context, n, ids))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->genTransformFeedbacks(n, ids);
         }
     }
@@ -698,13 +800,16 @@ void GL_APIENTRY GenVertexArrays(GLsizei n, GLuint *arrays)
 {
     EVENT("(GLsizei n = %d, GLuint *arrays = 0x%0.8p)", n, arrays);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GenVertexArrays);
         context->gatherParams<EntryPoint::GenVertexArrays>(n, arrays);
 
         if (context->skipValidation() || ValidateGenVertexArrays(context, n, arrays))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->genVertexArrays(n, arrays);
         }
     }
@@ -721,9 +826,11 @@ void GL_APIENTRY GetActiveUniformBlockName(GLuint program,
         "*length = 0x%0.8p, GLchar *uniformBlockName = 0x%0.8p)",
         program, uniformBlockIndex, bufSize, length, uniformBlockName);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetActiveUniformBlockName);
         context->gatherParams<EntryPoint::GetActiveUniformBlockName>(
             program, uniformBlockIndex, bufSize, length, uniformBlockName);
 
@@ -731,6 +838,7 @@ void GL_APIENTRY GetActiveUniformBlockName(GLuint program,
             ValidateGetActiveUniformBlockName(context, program, uniformBlockIndex, bufSize, length,
                                               uniformBlockName))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getActiveUniformBlockName(program, uniformBlockIndex, bufSize, length,
                                                uniformBlockName);
         }
@@ -747,15 +855,18 @@ void GL_APIENTRY GetActiveUniformBlockiv(GLuint program,
         "0x%0.8p)",
         program, uniformBlockIndex, pname, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetActiveUniformBlockiv);
         context->gatherParams<EntryPoint::GetActiveUniformBlockiv>(program, uniformBlockIndex,
                                                                    pname, params);
 
         if (context->skipValidation() ||
             ValidateGetActiveUniformBlockiv(context, program, uniformBlockIndex, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
         }
     }
@@ -772,15 +883,18 @@ void GL_APIENTRY GetActiveUniformsiv(GLuint program,
         "GLenum pname = 0x%X, GLint *params = 0x%0.8p)",
         program, uniformCount, uniformIndices, pname, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetActiveUniformsiv);
         context->gatherParams<EntryPoint::GetActiveUniformsiv>(program, uniformCount,
                                                                uniformIndices, pname, params);
 
         if (context->skipValidation() || ValidateGetActiveUniformsiv(context, program, uniformCount,
                                                                      uniformIndices, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
         }
     }
@@ -791,15 +905,18 @@ void GL_APIENTRY GetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *pa
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLint64 *params = 0x%0.8p)", target, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetBufferParameteri64v);
         BufferBinding targetPacked = FromGLenum<BufferBinding>(target);
         context->gatherParams<EntryPoint::GetBufferParameteri64v>(targetPacked, pname, params);
 
         if (context->skipValidation() ||
             ValidateGetBufferParameteri64v(context, targetPacked, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getBufferParameteri64v(targetPacked, pname, params);
         }
     }
@@ -810,15 +927,18 @@ void GL_APIENTRY GetBufferPointerv(GLenum target, GLenum pname, void **params)
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, void **params = 0x%0.8p)", target, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetBufferPointerv);
         BufferBinding targetPacked = FromGLenum<BufferBinding>(target);
         context->gatherParams<EntryPoint::GetBufferPointerv>(targetPacked, pname, params);
 
         if (context->skipValidation() ||
             ValidateGetBufferPointerv(context, targetPacked, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getBufferPointerv(targetPacked, pname, params);
         }
     }
@@ -828,13 +948,16 @@ GLint GL_APIENTRY GetFragDataLocation(GLuint program, const GLchar *name)
 {
     EVENT("(GLuint program = %u, const GLchar *name = 0x%0.8p)", program, name);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetFragDataLocation);
         context->gatherParams<EntryPoint::GetFragDataLocation>(program, name);
 
         if (context->skipValidation() || ValidateGetFragDataLocation(context, program, name))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->getFragDataLocation(program, name);
         }
     }
@@ -847,13 +970,16 @@ void GL_APIENTRY GetInteger64i_v(GLenum target, GLuint index, GLint64 *data)
     EVENT("(GLenum target = 0x%X, GLuint index = %u, GLint64 *data = 0x%0.8p)", target, index,
           data);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetInteger64i_v);
         context->gatherParams<EntryPoint::GetInteger64i_v>(target, index, data);
 
         if (context->skipValidation() || ValidateGetInteger64i_v(context, target, index, data))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getInteger64i_v(target, index, data);
         }
     }
@@ -863,13 +989,16 @@ void GL_APIENTRY GetInteger64v(GLenum pname, GLint64 *data)
 {
     EVENT("(GLenum pname = 0x%X, GLint64 *data = 0x%0.8p)", pname, data);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetInteger64v);
         context->gatherParams<EntryPoint::GetInteger64v>(pname, data);
 
         if (context->skipValidation() || ValidateGetInteger64v(context, pname, data))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getInteger64v(pname, data);
         }
     }
@@ -879,13 +1008,16 @@ void GL_APIENTRY GetIntegeri_v(GLenum target, GLuint index, GLint *data)
 {
     EVENT("(GLenum target = 0x%X, GLuint index = %u, GLint *data = 0x%0.8p)", target, index, data);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetIntegeri_v);
         context->gatherParams<EntryPoint::GetIntegeri_v>(target, index, data);
 
         if (context->skipValidation() || ValidateGetIntegeri_v(context, target, index, data))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getIntegeri_v(target, index, data);
         }
     }
@@ -902,15 +1034,18 @@ void GL_APIENTRY GetInternalformativ(GLenum target,
         "= %d, GLint *params = 0x%0.8p)",
         target, internalformat, pname, bufSize, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetInternalformativ);
         context->gatherParams<EntryPoint::GetInternalformativ>(target, internalformat, pname,
                                                                bufSize, params);
 
         if (context->skipValidation() ||
             ValidateGetInternalformativ(context, target, internalformat, pname, bufSize, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getInternalformativ(target, internalformat, pname, bufSize, params);
         }
     }
@@ -927,15 +1062,18 @@ void GL_APIENTRY GetProgramBinary(GLuint program,
         "*binaryFormat = 0x%0.8p, void *binary = 0x%0.8p)",
         program, bufSize, length, binaryFormat, binary);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetProgramBinary);
         context->gatherParams<EntryPoint::GetProgramBinary>(program, bufSize, length, binaryFormat,
                                                             binary);
 
         if (context->skipValidation() ||
             ValidateGetProgramBinary(context, program, bufSize, length, binaryFormat, binary))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getProgramBinary(program, bufSize, length, binaryFormat, binary);
         }
     }
@@ -945,13 +1083,16 @@ void GL_APIENTRY GetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params)
 {
     EVENT("(GLuint id = %u, GLenum pname = 0x%X, GLuint *params = 0x%0.8p)", id, pname, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetQueryObjectuiv);
         context->gatherParams<EntryPoint::GetQueryObjectuiv>(id, pname, params);
 
         if (context->skipValidation() || ValidateGetQueryObjectuiv(context, id, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getQueryObjectuiv(id, pname, params);
         }
     }
@@ -962,14 +1103,17 @@ void GL_APIENTRY GetQueryiv(GLenum target, GLenum pname, GLint *params)
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", target, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetQueryiv);
         QueryType targetPacked = FromGLenum<QueryType>(target);
         context->gatherParams<EntryPoint::GetQueryiv>(targetPacked, pname, params);
 
         if (context->skipValidation() || ValidateGetQueryiv(context, targetPacked, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getQueryiv(targetPacked, pname, params);
         }
     }
@@ -980,14 +1124,17 @@ void GL_APIENTRY GetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *pa
     EVENT("(GLuint sampler = %u, GLenum pname = 0x%X, GLfloat *params = 0x%0.8p)", sampler, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetSamplerParameterfv);
         context->gatherParams<EntryPoint::GetSamplerParameterfv>(sampler, pname, params);
 
         if (context->skipValidation() ||
             ValidateGetSamplerParameterfv(context, sampler, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getSamplerParameterfv(sampler, pname, params);
         }
     }
@@ -998,14 +1145,17 @@ void GL_APIENTRY GetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *para
     EVENT("(GLuint sampler = %u, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", sampler, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetSamplerParameteriv);
         context->gatherParams<EntryPoint::GetSamplerParameteriv>(sampler, pname, params);
 
         if (context->skipValidation() ||
             ValidateGetSamplerParameteriv(context, sampler, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getSamplerParameteriv(sampler, pname, params);
         }
     }
@@ -1015,13 +1165,16 @@ const GLubyte *GL_APIENTRY GetStringi(GLenum name, GLuint index)
 {
     EVENT("(GLenum name = 0x%X, GLuint index = %u)", name, index);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetStringi);
         context->gatherParams<EntryPoint::GetStringi>(name, index);
 
         if (context->skipValidation() || ValidateGetStringi(context, name, index))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->getStringi(name, index);
         }
     }
@@ -1037,14 +1190,17 @@ GetSynciv(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *va
         "0x%0.8p, GLint *values = 0x%0.8p)",
         sync, pname, bufSize, length, values);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetSynciv);
         context->gatherParams<EntryPoint::GetSynciv>(sync, pname, bufSize, length, values);
 
         if (context->skipValidation() ||
             ValidateGetSynciv(context, sync, pname, bufSize, length, values))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getSynciv(sync, pname, bufSize, length, values);
         }
     }
@@ -1063,9 +1219,11 @@ void GL_APIENTRY GetTransformFeedbackVarying(GLuint program,
         "GLsizei *size = 0x%0.8p, GLenum *type = 0x%0.8p, GLchar *name = 0x%0.8p)",
         program, index, bufSize, length, size, type, name);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetTransformFeedbackVarying);
         context->gatherParams<EntryPoint::GetTransformFeedbackVarying>(program, index, bufSize,
                                                                        length, size, type, name);
 
@@ -1073,6 +1231,7 @@ void GL_APIENTRY GetTransformFeedbackVarying(GLuint program,
             ValidateGetTransformFeedbackVarying(context, program, index, bufSize, length, size,
                                                 type, name))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
         }
     }
@@ -1083,14 +1242,17 @@ GLuint GL_APIENTRY GetUniformBlockIndex(GLuint program, const GLchar *uniformBlo
     EVENT("(GLuint program = %u, const GLchar *uniformBlockName = 0x%0.8p)", program,
           uniformBlockName);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetUniformBlockIndex);
         context->gatherParams<EntryPoint::GetUniformBlockIndex>(program, uniformBlockName);
 
         if (context->skipValidation() ||
             ValidateGetUniformBlockIndex(context, program, uniformBlockName))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->getUniformBlockIndex(program, uniformBlockName);
         }
     }
@@ -1108,15 +1270,18 @@ void GL_APIENTRY GetUniformIndices(GLuint program,
         "0x%0.8p, GLuint *uniformIndices = 0x%0.8p)",
         program, uniformCount, uniformNames, uniformIndices);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetUniformIndices);
         context->gatherParams<EntryPoint::GetUniformIndices>(program, uniformCount, uniformNames,
                                                              uniformIndices);
 
         if (context->skipValidation() ||
             ValidateGetUniformIndices(context, program, uniformCount, uniformNames, uniformIndices))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getUniformIndices(program, uniformCount, uniformNames, uniformIndices);
         }
     }
@@ -1127,13 +1292,16 @@ void GL_APIENTRY GetUniformuiv(GLuint program, GLint location, GLuint *params)
     EVENT("(GLuint program = %u, GLint location = %d, GLuint *params = 0x%0.8p)", program, location,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetUniformuiv);
         context->gatherParams<EntryPoint::GetUniformuiv>(program, location, params);
 
         if (context->skipValidation() || ValidateGetUniformuiv(context, program, location, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getUniformuiv(program, location, params);
         }
     }
@@ -1144,13 +1312,16 @@ void GL_APIENTRY GetVertexAttribIiv(GLuint index, GLenum pname, GLint *params)
     EVENT("(GLuint index = %u, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", index, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetVertexAttribIiv);
         context->gatherParams<EntryPoint::GetVertexAttribIiv>(index, pname, params);
 
         if (context->skipValidation() || ValidateGetVertexAttribIiv(context, index, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getVertexAttribIiv(index, pname, params);
         }
     }
@@ -1161,13 +1332,16 @@ void GL_APIENTRY GetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params)
     EVENT("(GLuint index = %u, GLenum pname = 0x%X, GLuint *params = 0x%0.8p)", index, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetVertexAttribIuiv);
         context->gatherParams<EntryPoint::GetVertexAttribIuiv>(index, pname, params);
 
         if (context->skipValidation() || ValidateGetVertexAttribIuiv(context, index, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getVertexAttribIuiv(index, pname, params);
         }
     }
@@ -1181,15 +1355,18 @@ void GL_APIENTRY InvalidateFramebuffer(GLenum target,
         "(GLenum target = 0x%X, GLsizei numAttachments = %d, const GLenum *attachments = 0x%0.8p)",
         target, numAttachments, attachments);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::InvalidateFramebuffer);
         context->gatherParams<EntryPoint::InvalidateFramebuffer>(target, numAttachments,
                                                                  attachments);
 
         if (context->skipValidation() ||
             ValidateInvalidateFramebuffer(context, target, numAttachments, attachments))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->invalidateFramebuffer(target, numAttachments, attachments);
         }
     }
@@ -1208,9 +1385,11 @@ void GL_APIENTRY InvalidateSubFramebuffer(GLenum target,
         "GLint x = %d, GLint y = %d, GLsizei width = %d, GLsizei height = %d)",
         target, numAttachments, attachments, x, y, width, height);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::InvalidateSubFramebuffer);
         context->gatherParams<EntryPoint::InvalidateSubFramebuffer>(
             target, numAttachments, attachments, x, y, width, height);
 
@@ -1218,6 +1397,7 @@ void GL_APIENTRY InvalidateSubFramebuffer(GLenum target,
             ValidateInvalidateSubFramebuffer(context, target, numAttachments, attachments, x, y,
                                              width, height))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->invalidateSubFramebuffer(target, numAttachments, attachments, x, y, width,
                                               height);
         }
@@ -1228,13 +1408,16 @@ GLboolean GL_APIENTRY IsQuery(GLuint id)
 {
     EVENT("(GLuint id = %u)", id);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::IsQuery);
         context->gatherParams<EntryPoint::IsQuery>(id);
 
         if (context->skipValidation() || ValidateIsQuery(context, id))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->isQuery(id);
         }
     }
@@ -1246,13 +1429,16 @@ GLboolean GL_APIENTRY IsSampler(GLuint sampler)
 {
     EVENT("(GLuint sampler = %u)", sampler);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::IsSampler);
         context->gatherParams<EntryPoint::IsSampler>(sampler);
 
         if (context->skipValidation() || ValidateIsSampler(context, sampler))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->isSampler(sampler);
         }
     }
@@ -1264,13 +1450,16 @@ GLboolean GL_APIENTRY IsSync(GLsync sync)
 {
     EVENT("(GLsync sync = 0x%0.8p)", sync);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::IsSync);
         context->gatherParams<EntryPoint::IsSync>(sync);
 
         if (context->skipValidation() || ValidateIsSync(context, sync))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->isSync(sync);
         }
     }
@@ -1282,13 +1471,16 @@ GLboolean GL_APIENTRY IsTransformFeedback(GLuint id)
 {
     EVENT("(GLuint id = %u)", id);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::IsTransformFeedback);
         context->gatherParams<EntryPoint::IsTransformFeedback>(id);
 
         if (context->skipValidation() || ValidateIsTransformFeedback(context, id))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->isTransformFeedback(id);
         }
     }
@@ -1300,13 +1492,16 @@ GLboolean GL_APIENTRY IsVertexArray(GLuint array)
 {
     EVENT("(GLuint array = %u)", array);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::IsVertexArray);
         context->gatherParams<EntryPoint::IsVertexArray>(array);
 
         if (context->skipValidation() || ValidateIsVertexArray(context, array))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->isVertexArray(array);
         }
     }
@@ -1324,15 +1519,18 @@ void *GL_APIENTRY MapBufferRange(GLenum target,
         "0x%X)",
         target, offset, length, access);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::MapBufferRange);
         BufferBinding targetPacked = FromGLenum<BufferBinding>(target);
         context->gatherParams<EntryPoint::MapBufferRange>(targetPacked, offset, length, access);
 
         if (context->skipValidation() ||
             ValidateMapBufferRange(context, targetPacked, offset, length, access))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->mapBufferRange(targetPacked, offset, length, access);
         }
     }
@@ -1344,13 +1542,16 @@ void GL_APIENTRY PauseTransformFeedback()
 {
     EVENT("()");
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::PauseTransformFeedback);
         context->gatherParams<EntryPoint::PauseTransformFeedback>();
 
         if (context->skipValidation() || ValidatePauseTransformFeedback(context))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->pauseTransformFeedback();
         }
     }
@@ -1366,14 +1567,17 @@ void GL_APIENTRY ProgramBinary(GLuint program,
         "length = %d)",
         program, binaryFormat, binary, length);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramBinary);
         context->gatherParams<EntryPoint::ProgramBinary>(program, binaryFormat, binary, length);
 
         if (context->skipValidation() ||
             ValidateProgramBinary(context, program, binaryFormat, binary, length))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programBinary(program, binaryFormat, binary, length);
         }
     }
@@ -1383,13 +1587,16 @@ void GL_APIENTRY ProgramParameteri(GLuint program, GLenum pname, GLint value)
 {
     EVENT("(GLuint program = %u, GLenum pname = 0x%X, GLint value = %d)", program, pname, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramParameteri);
         context->gatherParams<EntryPoint::ProgramParameteri>(program, pname, value);
 
         if (context->skipValidation() || ValidateProgramParameteri(context, program, pname, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programParameteri(program, pname, value);
         }
     }
@@ -1399,13 +1606,16 @@ void GL_APIENTRY ReadBuffer(GLenum src)
 {
     EVENT("(GLenum src = 0x%X)", src);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ReadBuffer);
         context->gatherParams<EntryPoint::ReadBuffer>(src);
 
         if (context->skipValidation() || ValidateReadBuffer(context, src))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->readBuffer(src);
         }
     }
@@ -1422,9 +1632,11 @@ void GL_APIENTRY RenderbufferStorageMultisample(GLenum target,
         "= %d, GLsizei height = %d)",
         target, samples, internalformat, width, height);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::RenderbufferStorageMultisample);
         context->gatherParams<EntryPoint::RenderbufferStorageMultisample>(
             target, samples, internalformat, width, height);
 
@@ -1432,6 +1644,7 @@ void GL_APIENTRY RenderbufferStorageMultisample(GLenum target,
             ValidateRenderbufferStorageMultisample(context, target, samples, internalformat, width,
                                                    height))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->renderbufferStorageMultisample(target, samples, internalformat, width, height);
         }
     }
@@ -1441,13 +1654,16 @@ void GL_APIENTRY ResumeTransformFeedback()
 {
     EVENT("()");
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ResumeTransformFeedback);
         context->gatherParams<EntryPoint::ResumeTransformFeedback>();
 
         if (context->skipValidation() || ValidateResumeTransformFeedback(context))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->resumeTransformFeedback();
         }
     }
@@ -1457,13 +1673,16 @@ void GL_APIENTRY SamplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
 {
     EVENT("(GLuint sampler = %u, GLenum pname = 0x%X, GLfloat param = %f)", sampler, pname, param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::SamplerParameterf);
         context->gatherParams<EntryPoint::SamplerParameterf>(sampler, pname, param);
 
         if (context->skipValidation() || ValidateSamplerParameterf(context, sampler, pname, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->samplerParameterf(sampler, pname, param);
         }
     }
@@ -1474,13 +1693,16 @@ void GL_APIENTRY SamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat
     EVENT("(GLuint sampler = %u, GLenum pname = 0x%X, const GLfloat *param = 0x%0.8p)", sampler,
           pname, param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::SamplerParameterfv);
         context->gatherParams<EntryPoint::SamplerParameterfv>(sampler, pname, param);
 
         if (context->skipValidation() || ValidateSamplerParameterfv(context, sampler, pname, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->samplerParameterfv(sampler, pname, param);
         }
     }
@@ -1490,13 +1712,16 @@ void GL_APIENTRY SamplerParameteri(GLuint sampler, GLenum pname, GLint param)
 {
     EVENT("(GLuint sampler = %u, GLenum pname = 0x%X, GLint param = %d)", sampler, pname, param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::SamplerParameteri);
         context->gatherParams<EntryPoint::SamplerParameteri>(sampler, pname, param);
 
         if (context->skipValidation() || ValidateSamplerParameteri(context, sampler, pname, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->samplerParameteri(sampler, pname, param);
         }
     }
@@ -1507,13 +1732,16 @@ void GL_APIENTRY SamplerParameteriv(GLuint sampler, GLenum pname, const GLint *p
     EVENT("(GLuint sampler = %u, GLenum pname = 0x%X, const GLint *param = 0x%0.8p)", sampler,
           pname, param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::SamplerParameteriv);
         context->gatherParams<EntryPoint::SamplerParameteriv>(sampler, pname, param);
 
         if (context->skipValidation() || ValidateSamplerParameteriv(context, sampler, pname, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->samplerParameteriv(sampler, pname, param);
         }
     }
@@ -1536,9 +1764,11 @@ void GL_APIENTRY TexImage3D(GLenum target,
         "type = 0x%X, const void *pixels = 0x%0.8p)",
         target, level, internalformat, width, height, depth, border, format, type, pixels);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexImage3D);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::TexImage3D>(targetPacked, level, internalformat, width,
                                                       height, depth, border, format, type, pixels);
@@ -1547,6 +1777,7 @@ void GL_APIENTRY TexImage3D(GLenum target,
             ValidateTexImage3D(context, targetPacked, level, internalformat, width, height, depth,
                                border, format, type, pixels))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texImage3D(targetPacked, level, internalformat, width, height, depth, border,
                                 format, type, pixels);
         }
@@ -1561,9 +1792,11 @@ TexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width
         "%d, GLsizei height = %d)",
         target, levels, internalformat, width, height);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexStorage2D);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::TexStorage2D>(targetPacked, levels, internalformat, width,
                                                         height);
@@ -1571,6 +1804,7 @@ TexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width
         if (context->skipValidation() ||
             ValidateTexStorage2D(context, targetPacked, levels, internalformat, width, height))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texStorage2D(targetPacked, levels, internalformat, width, height);
         }
     }
@@ -1588,9 +1822,11 @@ void GL_APIENTRY TexStorage3D(GLenum target,
         "%d, GLsizei height = %d, GLsizei depth = %d)",
         target, levels, internalformat, width, height, depth);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexStorage3D);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::TexStorage3D>(targetPacked, levels, internalformat, width,
                                                         height, depth);
@@ -1598,6 +1834,7 @@ void GL_APIENTRY TexStorage3D(GLenum target,
         if (context->skipValidation() || ValidateTexStorage3D(context, targetPacked, levels,
                                                               internalformat, width, height, depth))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texStorage3D(targetPacked, levels, internalformat, width, height, depth);
         }
     }
@@ -1621,9 +1858,11 @@ void GL_APIENTRY TexSubImage3D(GLenum target,
         "= 0x%X, GLenum type = 0x%X, const void *pixels = 0x%0.8p)",
         target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexSubImage3D);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::TexSubImage3D>(targetPacked, level, xoffset, yoffset,
                                                          zoffset, width, height, depth, format,
@@ -1633,6 +1872,7 @@ void GL_APIENTRY TexSubImage3D(GLenum target,
             ValidateTexSubImage3D(context, targetPacked, level, xoffset, yoffset, zoffset, width,
                                   height, depth, format, type, pixels))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texSubImage3D(targetPacked, level, xoffset, yoffset, zoffset, width, height,
                                    depth, format, type, pixels);
         }
@@ -1649,15 +1889,18 @@ void GL_APIENTRY TransformFeedbackVaryings(GLuint program,
         "bufferMode = 0x%X)",
         program, count, varyings, bufferMode);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TransformFeedbackVaryings);
         context->gatherParams<EntryPoint::TransformFeedbackVaryings>(program, count, varyings,
                                                                      bufferMode);
 
         if (context->skipValidation() ||
             ValidateTransformFeedbackVaryings(context, program, count, varyings, bufferMode))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->transformFeedbackVaryings(program, count, varyings, bufferMode);
         }
     }
@@ -1667,13 +1910,16 @@ void GL_APIENTRY Uniform1ui(GLint location, GLuint v0)
 {
     EVENT("(GLint location = %d, GLuint v0 = %u)", location, v0);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Uniform1ui);
         context->gatherParams<EntryPoint::Uniform1ui>(location, v0);
 
         if (context->skipValidation() || ValidateUniform1ui(context, location, v0))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniform1ui(location, v0);
         }
     }
@@ -1684,13 +1930,16 @@ void GL_APIENTRY Uniform1uiv(GLint location, GLsizei count, const GLuint *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLuint *value = 0x%0.8p)", location,
           count, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Uniform1uiv);
         context->gatherParams<EntryPoint::Uniform1uiv>(location, count, value);
 
         if (context->skipValidation() || ValidateUniform1uiv(context, location, count, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniform1uiv(location, count, value);
         }
     }
@@ -1700,13 +1949,16 @@ void GL_APIENTRY Uniform2ui(GLint location, GLuint v0, GLuint v1)
 {
     EVENT("(GLint location = %d, GLuint v0 = %u, GLuint v1 = %u)", location, v0, v1);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Uniform2ui);
         context->gatherParams<EntryPoint::Uniform2ui>(location, v0, v1);
 
         if (context->skipValidation() || ValidateUniform2ui(context, location, v0, v1))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniform2ui(location, v0, v1);
         }
     }
@@ -1717,13 +1969,16 @@ void GL_APIENTRY Uniform2uiv(GLint location, GLsizei count, const GLuint *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLuint *value = 0x%0.8p)", location,
           count, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Uniform2uiv);
         context->gatherParams<EntryPoint::Uniform2uiv>(location, count, value);
 
         if (context->skipValidation() || ValidateUniform2uiv(context, location, count, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniform2uiv(location, count, value);
         }
     }
@@ -1734,13 +1989,16 @@ void GL_APIENTRY Uniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2)
     EVENT("(GLint location = %d, GLuint v0 = %u, GLuint v1 = %u, GLuint v2 = %u)", location, v0, v1,
           v2);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Uniform3ui);
         context->gatherParams<EntryPoint::Uniform3ui>(location, v0, v1, v2);
 
         if (context->skipValidation() || ValidateUniform3ui(context, location, v0, v1, v2))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniform3ui(location, v0, v1, v2);
         }
     }
@@ -1751,13 +2009,16 @@ void GL_APIENTRY Uniform3uiv(GLint location, GLsizei count, const GLuint *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLuint *value = 0x%0.8p)", location,
           count, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Uniform3uiv);
         context->gatherParams<EntryPoint::Uniform3uiv>(location, count, value);
 
         if (context->skipValidation() || ValidateUniform3uiv(context, location, count, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniform3uiv(location, count, value);
         }
     }
@@ -1768,13 +2029,16 @@ void GL_APIENTRY Uniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLu
     EVENT("(GLint location = %d, GLuint v0 = %u, GLuint v1 = %u, GLuint v2 = %u, GLuint v3 = %u)",
           location, v0, v1, v2, v3);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Uniform4ui);
         context->gatherParams<EntryPoint::Uniform4ui>(location, v0, v1, v2, v3);
 
         if (context->skipValidation() || ValidateUniform4ui(context, location, v0, v1, v2, v3))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniform4ui(location, v0, v1, v2, v3);
         }
     }
@@ -1785,13 +2049,16 @@ void GL_APIENTRY Uniform4uiv(GLint location, GLsizei count, const GLuint *value)
     EVENT("(GLint location = %d, GLsizei count = %d, const GLuint *value = 0x%0.8p)", location,
           count, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::Uniform4uiv);
         context->gatherParams<EntryPoint::Uniform4uiv>(location, count, value);
 
         if (context->skipValidation() || ValidateUniform4uiv(context, location, count, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniform4uiv(location, count, value);
         }
     }
@@ -1804,15 +2071,18 @@ void GL_APIENTRY UniformBlockBinding(GLuint program,
     EVENT("(GLuint program = %u, GLuint uniformBlockIndex = %u, GLuint uniformBlockBinding = %u)",
           program, uniformBlockIndex, uniformBlockBinding);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::UniformBlockBinding);
         context->gatherParams<EntryPoint::UniformBlockBinding>(program, uniformBlockIndex,
                                                                uniformBlockBinding);
 
         if (context->skipValidation() ||
             ValidateUniformBlockBinding(context, program, uniformBlockIndex, uniformBlockBinding))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
         }
     }
@@ -1828,14 +2098,17 @@ void GL_APIENTRY UniformMatrix2x3fv(GLint location,
         "= 0x%0.8p)",
         location, count, transpose, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::UniformMatrix2x3fv);
         context->gatherParams<EntryPoint::UniformMatrix2x3fv>(location, count, transpose, value);
 
         if (context->skipValidation() ||
             ValidateUniformMatrix2x3fv(context, location, count, transpose, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniformMatrix2x3fv(location, count, transpose, value);
         }
     }
@@ -1851,14 +2124,17 @@ void GL_APIENTRY UniformMatrix2x4fv(GLint location,
         "= 0x%0.8p)",
         location, count, transpose, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::UniformMatrix2x4fv);
         context->gatherParams<EntryPoint::UniformMatrix2x4fv>(location, count, transpose, value);
 
         if (context->skipValidation() ||
             ValidateUniformMatrix2x4fv(context, location, count, transpose, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniformMatrix2x4fv(location, count, transpose, value);
         }
     }
@@ -1874,14 +2150,17 @@ void GL_APIENTRY UniformMatrix3x2fv(GLint location,
         "= 0x%0.8p)",
         location, count, transpose, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::UniformMatrix3x2fv);
         context->gatherParams<EntryPoint::UniformMatrix3x2fv>(location, count, transpose, value);
 
         if (context->skipValidation() ||
             ValidateUniformMatrix3x2fv(context, location, count, transpose, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniformMatrix3x2fv(location, count, transpose, value);
         }
     }
@@ -1897,14 +2176,17 @@ void GL_APIENTRY UniformMatrix3x4fv(GLint location,
         "= 0x%0.8p)",
         location, count, transpose, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::UniformMatrix3x4fv);
         context->gatherParams<EntryPoint::UniformMatrix3x4fv>(location, count, transpose, value);
 
         if (context->skipValidation() ||
             ValidateUniformMatrix3x4fv(context, location, count, transpose, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniformMatrix3x4fv(location, count, transpose, value);
         }
     }
@@ -1920,14 +2202,17 @@ void GL_APIENTRY UniformMatrix4x2fv(GLint location,
         "= 0x%0.8p)",
         location, count, transpose, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::UniformMatrix4x2fv);
         context->gatherParams<EntryPoint::UniformMatrix4x2fv>(location, count, transpose, value);
 
         if (context->skipValidation() ||
             ValidateUniformMatrix4x2fv(context, location, count, transpose, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniformMatrix4x2fv(location, count, transpose, value);
         }
     }
@@ -1943,14 +2228,17 @@ void GL_APIENTRY UniformMatrix4x3fv(GLint location,
         "= 0x%0.8p)",
         location, count, transpose, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::UniformMatrix4x3fv);
         context->gatherParams<EntryPoint::UniformMatrix4x3fv>(location, count, transpose, value);
 
         if (context->skipValidation() ||
             ValidateUniformMatrix4x3fv(context, location, count, transpose, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->uniformMatrix4x3fv(location, count, transpose, value);
         }
     }
@@ -1960,14 +2248,17 @@ GLboolean GL_APIENTRY UnmapBuffer(GLenum target)
 {
     EVENT("(GLenum target = 0x%X)", target);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::UnmapBuffer);
         BufferBinding targetPacked = FromGLenum<BufferBinding>(target);
         context->gatherParams<EntryPoint::UnmapBuffer>(targetPacked);
 
         if (context->skipValidation() || ValidateUnmapBuffer(context, targetPacked))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->unmapBuffer(targetPacked);
         }
     }
@@ -1979,13 +2270,16 @@ void GL_APIENTRY VertexAttribDivisor(GLuint index, GLuint divisor)
 {
     EVENT("(GLuint index = %u, GLuint divisor = %u)", index, divisor);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::VertexAttribDivisor);
         context->gatherParams<EntryPoint::VertexAttribDivisor>(index, divisor);
 
         if (context->skipValidation() || ValidateVertexAttribDivisor(context, index, divisor))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->vertexAttribDivisor(index, divisor);
         }
     }
@@ -1996,13 +2290,16 @@ void GL_APIENTRY VertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint
     EVENT("(GLuint index = %u, GLint x = %d, GLint y = %d, GLint z = %d, GLint w = %d)", index, x,
           y, z, w);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::VertexAttribI4i);
         context->gatherParams<EntryPoint::VertexAttribI4i>(index, x, y, z, w);
 
         if (context->skipValidation() || ValidateVertexAttribI4i(context, index, x, y, z, w))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->vertexAttribI4i(index, x, y, z, w);
         }
     }
@@ -2012,13 +2309,16 @@ void GL_APIENTRY VertexAttribI4iv(GLuint index, const GLint *v)
 {
     EVENT("(GLuint index = %u, const GLint *v = 0x%0.8p)", index, v);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::VertexAttribI4iv);
         context->gatherParams<EntryPoint::VertexAttribI4iv>(index, v);
 
         if (context->skipValidation() || ValidateVertexAttribI4iv(context, index, v))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->vertexAttribI4iv(index, v);
         }
     }
@@ -2029,13 +2329,16 @@ void GL_APIENTRY VertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GL
     EVENT("(GLuint index = %u, GLuint x = %u, GLuint y = %u, GLuint z = %u, GLuint w = %u)", index,
           x, y, z, w);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::VertexAttribI4ui);
         context->gatherParams<EntryPoint::VertexAttribI4ui>(index, x, y, z, w);
 
         if (context->skipValidation() || ValidateVertexAttribI4ui(context, index, x, y, z, w))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->vertexAttribI4ui(index, x, y, z, w);
         }
     }
@@ -2045,13 +2348,16 @@ void GL_APIENTRY VertexAttribI4uiv(GLuint index, const GLuint *v)
 {
     EVENT("(GLuint index = %u, const GLuint *v = 0x%0.8p)", index, v);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::VertexAttribI4uiv);
         context->gatherParams<EntryPoint::VertexAttribI4uiv>(index, v);
 
         if (context->skipValidation() || ValidateVertexAttribI4uiv(context, index, v))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->vertexAttribI4uiv(index, v);
         }
     }
@@ -2065,14 +2371,17 @@ VertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, cons
         "*pointer = 0x%0.8p)",
         index, size, type, stride, pointer);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::VertexAttribIPointer);
         context->gatherParams<EntryPoint::VertexAttribIPointer>(index, size, type, stride, pointer);
 
         if (context->skipValidation() ||
             ValidateVertexAttribIPointer(context, index, size, type, stride, pointer))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->vertexAttribIPointer(index, size, type, stride, pointer);
         }
     }
@@ -2083,13 +2392,16 @@ void GL_APIENTRY WaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
     EVENT("(GLsync sync = 0x%0.8p, GLbitfield flags = 0x%X, GLuint64 timeout = %llu)", sync, flags,
           timeout);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::WaitSync);
         context->gatherParams<EntryPoint::WaitSync>(sync, flags, timeout);
 
         if (context->skipValidation() || ValidateWaitSync(context, sync, flags, timeout))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->waitSync(sync, flags, timeout);
         }
     }
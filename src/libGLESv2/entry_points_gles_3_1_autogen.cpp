@@ -20,13 +20,16 @@ void GL_APIENTRY ActiveShaderProgram(GLuint pipeline, GLuint program)
 {
     EVENT("(GLuint pipeline = %u, GLuint program = %u)", pipeline, program);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ActiveShaderProgram);
         context->gatherParams<EntryPoint::ActiveShaderProgram>(pipeline, program);
 
         if (context->skipValidation() || ValidateActiveShaderProgram(context, pipeline, program))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->activeShaderProgram(pipeline, program);
         }
     }
@@ -45,15 +48,18 @@ void GL_APIENTRY BindImageTexture(GLuint unit,
         "layer = %d, GLenum access = 0x%X, GLenum format = 0x%X)",
         unit, texture, level, layered, layer, access, format);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::BindImageTexture);
         context->gatherParams<EntryPoint::BindImageTexture>(unit, texture, level, layered, layer,
                                                             access, format);
 
         if (context->skipValidation() ||
             ValidateBindImageTexture(context, unit, texture, level, layered, layer, access, format))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->bindImageTexture(unit, texture, level, layered, layer, access, format);
         }
     }
@@ -63,13 +69,16 @@ void GL_APIENTRY BindProgramPipeline(GLuint pipeline)
 {
     EVENT("(GLuint pipeline = %u)", pipeline);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::BindProgramPipeline);
         context->gatherParams<EntryPoint::BindProgramPipeline>(pipeline);
 
         if (context->skipValidation() || ValidateBindProgramPipeline(context, pipeline))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->bindProgramPipeline(pipeline);
         }
     }
@@ -84,14 +93,17 @@ void GL_APIENTRY BindVertexBuffer(GLuint bindingindex,
         "(GLuint bindingindex = %u, GLuint buffer = %u, GLintptr offset = %d, GLsizei stride = %d)",
         bindingindex, buffer, offset, stride);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::BindVertexBuffer);
         context->gatherParams<EntryPoint::BindVertexBuffer>(bindingindex, buffer, offset, stride);
 
         if (context->skipValidation() ||
             ValidateBindVertexBuffer(context, bindingindex, buffer, offset, stride))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->bindVertexBuffer(bindingindex, buffer, offset, stride);
         }
     }
@@ -102,15 +114,18 @@ GLuint GL_APIENTRY CreateShaderProgramv(GLenum type, GLsizei count, const GLchar
     EVENT("(GLenum type = 0x%X, GLsizei count = %d, const GLchar *const*strings = 0x%0.8p)", type,
           count, strings);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::CreateShaderProgramv);
         ShaderType typePacked = FromGLenum<ShaderType>(type);
         context->gatherParams<EntryPoint::CreateShaderProgramv>(typePacked, count, strings);
 
         if (context->skipValidation() ||
             ValidateCreateShaderProgramv(context, typePacked, count, strings))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->createShaderProgramv(typePacked, count, strings);
         }
     }
@@ -122,13 +137,16 @@ void GL_APIENTRY DeleteProgramPipelines(GLsizei n, const GLuint *pipelines)
 {
     EVENT("(GLsizei n = %d, const GLuint *pipelines = 0x%0.8p)", n, pipelines);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DeleteProgramPipelines);
         context->gatherParams<EntryPoint::DeleteProgramPipelines>(n, pipelines);
 
         if (context->skipValidation() || ValidateDeleteProgramPipelines(context, n, pipelines))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->deleteProgramPipelines(n, pipelines);
         }
     }
@@ -139,15 +157,18 @@ void GL_APIENTRY DispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuin
     EVENT("(GLuint num_groups_x = %u, GLuint num_groups_y = %u, GLuint num_groups_z = %u)",
           num_groups_x, num_groups_y, num_groups_z);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DispatchCompute);
         context->gatherParams<EntryPoint::DispatchCompute>(num_groups_x, num_groups_y,
                                                            num_groups_z);
 
         if (context->skipValidation() ||
             ValidateDispatchCompute(context, num_groups_x, num_groups_y, num_groups_z))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->dispatchCompute(num_groups_x, num_groups_y, num_groups_z);
         }
     }
@@ -157,13 +178,16 @@ void GL_APIENTRY DispatchComputeIndirect(GLintptr indirect)
 {
     EVENT("(GLintptr indirect = %d)", indirect);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DispatchComputeIndirect);
         context->gatherParams<EntryPoint::DispatchComputeIndirect>(indirect);
 
         if (context->skipValidation() || ValidateDispatchComputeIndirect(context, indirect))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->dispatchComputeIndirect(indirect);
         }
     }
@@ -173,13 +197,16 @@ void GL_APIENTRY DrawArraysIndirect(GLenum mode, const void *indirect)
 {
     EVENT("(GLenum mode = 0x%X, const void *indirect = 0x%0.8p)", mode, indirect);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DrawArraysIndirect);
         context->gatherParams<EntryPoint::DrawArraysIndirect>(mode, indirect);
 
         if (context->skipValidation() || ValidateDrawArraysIndirect(context, mode, indirect))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->drawArraysIndirect(mode, indirect);
         }
     }
@@ -190,14 +217,17 @@ void GL_APIENTRY DrawElementsIndirect(GLenum mode, GLenum type, const void *indi
     EVENT("(GLenum mode = 0x%X, GLenum type = 0x%X, const void *indirect = 0x%0.8p)", mode, type,
           indirect);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DrawElementsIndirect);
         context->gatherParams<EntryPoint::DrawElementsIndirect>(mode, type, indirect);
 
         if (context->skipValidation() ||
             ValidateDrawElementsIndirect(context, mode, type, indirect))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->drawElementsIndirect(mode, type, indirect);
         }
     }
@@ -207,14 +237,17 @@ void GL_APIENTRY FramebufferParameteri(GLenum target, GLenum pname, GLint param)
 {
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLint param = %d)", target, pname, param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::FramebufferParameteri);
         context->gatherParams<EntryPoint::FramebufferParameteri>(target, pname, param);
 
         if (context->skipValidation() ||
             ValidateFramebufferParameteri(context, target, pname, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->framebufferParameteri(target, pname, param);
         }
     }
@@ -224,13 +257,16 @@ void GL_APIENTRY GenProgramPipelines(GLsizei n, GLuint *pipelines)
 {
     EVENT("(GLsizei n = %d, GLuint *pipelines = 0x%0.8p)", n, pipelines);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GenProgramPipelines);
         context->gatherParams<EntryPoint::GenProgramPipelines>(n, pipelines);
 
         if (context->skipValidation() || ValidateGenProgramPipelines(context, n, pipelines))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->genProgramPipelines(n, pipelines);
         }
     }
@@ -241,13 +277,16 @@ void GL_APIENTRY GetBooleani_v(GLenum target, GLuint index, GLboolean *data)
     EVENT("(GLenum target = 0x%X, GLuint index = %u, GLboolean *data = 0x%0.8p)", target, index,
           data);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetBooleani_v);
         context->gatherParams<EntryPoint::GetBooleani_v>(target, index, data);
 
         if (context->skipValidation() || ValidateGetBooleani_v(context, target, index, data))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getBooleani_v(target, index, data);
         }
     }
@@ -258,14 +297,17 @@ void GL_APIENTRY GetFramebufferParameteriv(GLenum target, GLenum pname, GLint *p
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", target, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetFramebufferParameteriv);
         context->gatherParams<EntryPoint::GetFramebufferParameteriv>(target, pname, params);
 
         if (context->skipValidation() ||
             ValidateGetFramebufferParameteriv(context, target, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getFramebufferParameteriv(target, pname, params);
         }
     }
@@ -275,13 +317,16 @@ void GL_APIENTRY GetMultisamplefv(GLenum pname, GLuint index, GLfloat *val)
 {
     EVENT("(GLenum pname = 0x%X, GLuint index = %u, GLfloat *val = 0x%0.8p)", pname, index, val);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetMultisamplefv);
         context->gatherParams<EntryPoint::GetMultisamplefv>(pname, index, val);
 
         if (context->skipValidation() || ValidateGetMultisamplefv(context, pname, index, val))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getMultisamplefv(pname, index, val);
         }
     }
@@ -297,15 +342,18 @@ void GL_APIENTRY GetProgramInterfaceiv(GLuint program,
         "= 0x%0.8p)",
         program, programInterface, pname, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetProgramInterfaceiv);
         context->gatherParams<EntryPoint::GetProgramInterfaceiv>(program, programInterface, pname,
                                                                  params);
 
         if (context->skipValidation() ||
             ValidateGetProgramInterfaceiv(context, program, programInterface, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getProgramInterfaceiv(program, programInterface, pname, params);
         }
     }
@@ -321,15 +369,18 @@ void GL_APIENTRY GetProgramPipelineInfoLog(GLuint pipeline,
         "0x%0.8p)",
         pipeline, bufSize, length, infoLog);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetProgramPipelineInfoLog);
         context->gatherParams<EntryPoint::GetProgramPipelineInfoLog>(pipeline, bufSize, length,
                                                                      infoLog);
 
         if (context->skipValidation() ||
             ValidateGetProgramPipelineInfoLog(context, pipeline, bufSize, length, infoLog))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
         }
     }
@@ -340,14 +391,17 @@ void GL_APIENTRY GetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *para
     EVENT("(GLuint pipeline = %u, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", pipeline, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetProgramPipelineiv);
         context->gatherParams<EntryPoint::GetProgramPipelineiv>(pipeline, pname, params);
 
         if (context->skipValidation() ||
             ValidateGetProgramPipelineiv(context, pipeline, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getProgramPipelineiv(pipeline, pname, params);
         }
     }
@@ -360,14 +414,17 @@ GLuint GL_APIENTRY GetProgramResourceIndex(GLuint program,
     EVENT("(GLuint program = %u, GLenum programInterface = 0x%X, const GLchar *name = 0x%0.8p)",
           program, programInterface, name);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetProgramResourceIndex);
         context->gatherParams<EntryPoint::GetProgramResourceIndex>(program, programInterface, name);
 
         if (context->skipValidation() ||
             ValidateGetProgramResourceIndex(context, program, programInterface, name))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->getProgramResourceIndex(program, programInterface, name);
         }
     }
@@ -382,15 +439,18 @@ GLint GL_APIENTRY GetProgramResourceLocation(GLuint program,
     EVENT("(GLuint program = %u, GLenum programInterface = 0x%X, const GLchar *name = 0x%0.8p)",
           program, programInterface, name);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetProgramResourceLocation);
         context->gatherParams<EntryPoint::GetProgramResourceLocation>(program, programInterface,
                                                                       name);
 
         if (context->skipValidation() ||
             ValidateGetProgramResourceLocation(context, program, programInterface, name))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->getProgramResourceLocation(program, programInterface, name);
         }
     }
@@ -410,9 +470,11 @@ void GL_APIENTRY GetProgramResourceName(GLuint program,
         "= %d, GLsizei *length = 0x%0.8p, GLchar *name = 0x%0.8p)",
         program, programInterface, index, bufSize, length, name);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetProgramResourceName);
         context->gatherParams<EntryPoint::GetProgramResourceName>(program, programInterface, index,
                                                                   bufSize, length, name);
 
@@ -420,6 +482,7 @@ void GL_APIENTRY GetProgramResourceName(GLuint program,
             ValidateGetProgramResourceName(context, program, programInterface, index, bufSize,
                                            length, name))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getProgramResourceName(program, programInterface, index, bufSize, length,
                                             name);
         }
@@ -441,9 +504,11 @@ void GL_APIENTRY GetProgramResourceiv(GLuint program,
         "0x%0.8p, GLint *params = 0x%0.8p)",
         program, programInterface, index, propCount, props, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetProgramResourceiv);
         context->gatherParams<EntryPoint::GetProgramResourceiv>(
             program, programInterface, index, propCount, props, bufSize, length, params);
 
@@ -451,6 +516,7 @@ void GL_APIENTRY GetProgramResourceiv(GLuint program,
             ValidateGetProgramResourceiv(context, program, programInterface, index, propCount,
                                          props, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getProgramResourceiv(program, programInterface, index, propCount, props,
                                           bufSize, length, params);
         }
@@ -463,9 +529,11 @@ void GL_APIENTRY GetTexLevelParameterfv(GLenum target, GLint level, GLenum pname
         "(GLenum target = 0x%X, GLint level = %d, GLenum pname = 0x%X, GLfloat *params = 0x%0.8p)",
         target, level, pname, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetTexLevelParameterfv);
         TextureTarget targetPacked = FromGLenum<TextureTarget>(target);
         context->gatherParams<EntryPoint::GetTexLevelParameterfv>(targetPacked, level, pname,
                                                                   params);
@@ -473,6 +541,7 @@ void GL_APIENTRY GetTexLevelParameterfv(GLenum target, GLint level, GLenum pname
         if (context->skipValidation() ||
             ValidateGetTexLevelParameterfv(context, targetPacked, level, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getTexLevelParameterfv(targetPacked, level, pname, params);
         }
     }
@@ -483,9 +552,11 @@ void GL_APIENTRY GetTexLevelParameteriv(GLenum target, GLint level, GLenum pname
     EVENT("(GLenum target = 0x%X, GLint level = %d, GLenum pname = 0x%X, GLint *params = 0x%0.8p)",
           target, level, pname, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetTexLevelParameteriv);
         TextureTarget targetPacked = FromGLenum<TextureTarget>(target);
         context->gatherParams<EntryPoint::GetTexLevelParameteriv>(targetPacked, level, pname,
                                                                   params);
@@ -493,6 +564,7 @@ void GL_APIENTRY GetTexLevelParameteriv(GLenum target, GLint level, GLenum pname
         if (context->skipValidation() ||
             ValidateGetTexLevelParameteriv(context, targetPacked, level, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getTexLevelParameteriv(targetPacked, level, pname, params);
         }
     }
@@ -502,13 +574,16 @@ GLboolean GL_APIENTRY IsProgramPipeline(GLuint pipeline)
 {
     EVENT("(GLuint pipeline = %u)", pipeline);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::IsProgramPipeline);
         context->gatherParams<EntryPoint::IsProgramPipeline>(pipeline);
 
         if (context->skipValidation() || ValidateIsProgramPipeline(context, pipeline))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->isProgramPipeline(pipeline);
         }
     }
@@ -520,13 +595,16 @@ void GL_APIENTRY MemoryBarrier(GLbitfield barriers)
 {
     EVENT("(GLbitfield barriers = 0x%X)", barriers);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::MemoryBarrier);
         context->gatherParams<EntryPoint::MemoryBarrier>(barriers);
 
         if (context->skipValidation() || ValidateMemoryBarrier(context, barriers))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->memoryBarrier(barriers);
         }
     }
@@ -536,13 +614,16 @@ void GL_APIENTRY MemoryBarrierByRegion(GLbitfield barriers)
 {
     EVENT("(GLbitfield barriers = 0x%X)", barriers);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::MemoryBarrierByRegion);
         context->gatherParams<EntryPoint::MemoryBarrierByRegion>(barriers);
 
         if (context->skipValidation() || ValidateMemoryBarrierByRegion(context, barriers))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->memoryBarrierByRegion(barriers);
         }
     }
@@ -552,13 +633,16 @@ void GL_APIENTRY ProgramUniform1f(GLuint program, GLint location, GLfloat v0)
 {
     EVENT("(GLuint program = %u, GLint location = %d, GLfloat v0 = %f)", program, location, v0);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniform1f);
         context->gatherParams<EntryPoint::ProgramUniform1f>(program, location, v0);
 
         if (context->skipValidation() || ValidateProgramUniform1f(context, program, location, v0))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniform1f(program, location, v0);
         }
     }
@@ -574,14 +658,17 @@ void GL_APIENTRY ProgramUniform1fv(GLuint program,
         "0x%0.8p)",
         program, location, count, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniform1fv);
         context->gatherParams<EntryPoint::ProgramUniform1fv>(program, location, count, value);
 
         if (context->skipValidation() ||
             ValidateProgramUniform1fv(context, program, location, count, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniform1fv(program, location, count, value);
         }
     }
@@ -591,13 +678,16 @@ void GL_APIENTRY ProgramUniform1i(GLuint program, GLint location, GLint v0)
 {
     EVENT("(GLuint program = %u, GLint location = %d, GLint v0 = %d)", program, location, v0);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniform1i);
         context->gatherParams<EntryPoint::ProgramUniform1i>(program, location, v0);
 
         if (context->skipValidation() || ValidateProgramUniform1i(context, program, location, v0))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniform1i(program, location, v0);
         }
     }
@@ -613,14 +703,17 @@ void GL_APIENTRY ProgramUniform1iv(GLuint program,
         "0x%0.8p)",
         program, location, count, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniform1iv);
         context->gatherParams<EntryPoint::ProgramUniform1iv>(program, location, count, value);
 
         if (context->skipValidation() ||
             ValidateProgramUniform1iv(context, program, location, count, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniform1iv(program, location, count, value);
         }
     }
@@ -630,13 +723,16 @@ void GL_APIENTRY ProgramUniform1ui(GLuint program, GLint location, GLuint v0)
 {
     EVENT("(GLuint program = %u, GLint location = %d, GLuint v0 = %u)", program, location, v0);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniform1ui);
         context->gatherParams<EntryPoint::ProgramUniform1ui>(program, location, v0);
 
         if (context->skipValidation() || ValidateProgramUniform1ui(context, program, location, v0))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniform1ui(program, location, v0);
         }
     }
@@ -652,14 +748,17 @@ void GL_APIENTRY ProgramUniform1uiv(GLuint program,
         "0x%0.8p)",
         program, location, count, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniform1uiv);
         context->gatherParams<EntryPoint::ProgramUniform1uiv>(program, location, count, value);
 
         if (context->skipValidation() ||
             ValidateProgramUniform1uiv(context, program, location, count, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniform1uiv(program, location, count, value);
         }
     }
@@ -670,14 +769,17 @@ void GL_APIENTRY ProgramUniform2f(GLuint program, GLint location, GLfloat v0, GL
     EVENT("(GLuint program = %u, GLint location = %d, GLfloat v0 = %f, GLfloat v1 = %f)", program,
           location, v0, v1);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniform2f);
         context->gatherParams<EntryPoint::ProgramUniform2f>(program, location, v0, v1);
 
         if (context->skipValidation() ||
             ValidateProgramUniform2f(context, program, location, v0, v1))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniform2f(program, location, v0, v1);
         }
     }
@@ -693,14 +795,17 @@ void GL_APIENTRY ProgramUniform2fv(GLuint program,
         "0x%0.8p)",
         program, location, count, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniform2fv);
         context->gatherParams<EntryPoint::ProgramUniform2fv>(program, location, count, value);
 
         if (context->skipValidation() ||
             ValidateProgramUniform2fv(context, program, location, count, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniform2fv(program, location, count, value);
         }
     }
@@ -711,14 +816,17 @@ void GL_APIENTRY ProgramUniform2i(GLuint program, GLint location, GLint v0, GLin
     EVENT("(GLuint program = %u, GLint location = %d, GLint v0 = %d, GLint v1 = %d)", program,
           location, v0, v1);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniform2i);
         context->gatherParams<EntryPoint::ProgramUniform2i>(program, location, v0, v1);
 
         if (context->skipValidation() ||
             ValidateProgramUniform2i(context, program, location, v0, v1))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniform2i(program, location, v0, v1);
         }
     }
@@ -734,14 +842,17 @@ void GL_APIENTRY ProgramUniform2iv(GLuint program,
         "0x%0.8p)",
         program, location, count, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniform2iv);
         context->gatherParams<EntryPoint::ProgramUniform2iv>(program, location, count, value);
 
         if (context->skipValidation() ||
             ValidateProgramUniform2iv(context, program, location, count, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniform2iv(program, location, count, value);
         }
     }
@@ -752,14 +863,17 @@ void GL_APIENTRY ProgramUniform2ui(GLuint program, GLint location, GLuint v0, GL
     EVENT("(GLuint program = %u, GLint location = %d, GLuint v0 = %u, GLuint v1 = %u)", program,
           location, v0, v1);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniform2ui);
         context->gatherParams<EntryPoint::ProgramUniform2ui>(program, location, v0, v1);
 
         if (context->skipValidation() ||
             ValidateProgramUniform2ui(context, program, location, v0, v1))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniform2ui(program, location, v0, v1);
         }
     }
@@ -775,14 +889,17 @@ void GL_APIENTRY ProgramUniform2uiv(GLuint program,
         "0x%0.8p)",
         program, location, count, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniform2uiv);
         context->gatherParams<EntryPoint::ProgramUniform2uiv>(program, location, count, value);
 
         if (context->skipValidation() ||
             ValidateProgramUniform2uiv(context, program, location, count, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniform2uiv(program, location, count, value);
         }
     }
@@ -796,14 +913,17 @@ ProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat
         "%f)",
         program, location, v0, v1, v2);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniform3f);
         context->gatherParams<EntryPoint::ProgramUniform3f>(program, location, v0, v1, v2);
 
         if (context->skipValidation() ||
             ValidateProgramUniform3f(context, program, location, v0, v1, v2))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniform3f(program, location, v0, v1, v2);
         }
     }
@@ -819,14 +939,17 @@ void GL_APIENTRY ProgramUniform3fv(GLuint program,
         "0x%0.8p)",
         program, location, count, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniform3fv);
         context->gatherParams<EntryPoint::ProgramUniform3fv>(program, location, count, value);
 
         if (context->skipValidation() ||
             ValidateProgramUniform3fv(context, program, location, count, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniform3fv(program, location, count, value);
         }
     }
@@ -837,14 +960,17 @@ void GL_APIENTRY ProgramUniform3i(GLuint program, GLint location, GLint v0, GLin
     EVENT("(GLuint program = %u, GLint location = %d, GLint v0 = %d, GLint v1 = %d, GLint v2 = %d)",
           program, location, v0, v1, v2);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniform3i);
         context->gatherParams<EntryPoint::ProgramUniform3i>(program, location, v0, v1, v2);
 
         if (context->skipValidation() ||
             ValidateProgramUniform3i(context, program, location, v0, v1, v2))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniform3i(program, location, v0, v1, v2);
         }
     }
@@ -860,14 +986,17 @@ void GL_APIENTRY ProgramUniform3iv(GLuint program,
         "0x%0.8p)",
         program, location, count, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniform3iv);
         context->gatherParams<EntryPoint::ProgramUniform3iv>(program, location, count, value);
 
         if (context->skipValidation() ||
             ValidateProgramUniform3iv(context, program, location, count, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniform3iv(program, location, count, value);
         }
     }
@@ -880,14 +1009,17 @@ void GL_APIENTRY ProgramUniform3ui(GLuint program, GLint location, GLuint v0, GL
         "%u)",
         program, location, v0, v1, v2);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniform3ui);
         context->gatherParams<EntryPoint::ProgramUniform3ui>(program, location, v0, v1, v2);
 
         if (context->skipValidation() ||
             ValidateProgramUniform3ui(context, program, location, v0, v1, v2))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniform3ui(program, location, v0, v1, v2);
         }
     }
@@ -903,14 +1035,17 @@ void GL_APIENTRY ProgramUniform3uiv(GLuint program,
         "0x%0.8p)",
         program, location, count, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniform3uiv);
         context->gatherParams<EntryPoint::ProgramUniform3uiv>(program, location, count, value);
 
         if (context->skipValidation() ||
             ValidateProgramUniform3uiv(context, program, location, count, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniform3uiv(program, location, count, value);
         }
     }
@@ -924,14 +1059,17 @@ ProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat
         "%f, GLfloat v3 = %f)",
         program, location, v0, v1, v2, v3);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniform4f);
         context->gatherParams<EntryPoint::ProgramUniform4f>(program, location, v0, v1, v2, v3);
 
         if (context->skipValidation() ||
             ValidateProgramUniform4f(context, program, location, v0, v1, v2, v3))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniform4f(program, location, v0, v1, v2, v3);
         }
     }
@@ -947,14 +1085,17 @@ void GL_APIENTRY ProgramUniform4fv(GLuint program,
         "0x%0.8p)",
         program, location, count, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniform4fv);
         context->gatherParams<EntryPoint::ProgramUniform4fv>(program, location, count, value);
 
         if (context->skipValidation() ||
             ValidateProgramUniform4fv(context, program, location, count, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniform4fv(program, location, count, value);
         }
     }
@@ -968,14 +1109,17 @@ ProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, G
         "GLint v3 = %d)",
         program, location, v0, v1, v2, v3);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniform4i);
         context->gatherParams<EntryPoint::ProgramUniform4i>(program, location, v0, v1, v2, v3);
 
         if (context->skipValidation() ||
             ValidateProgramUniform4i(context, program, location, v0, v1, v2, v3))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniform4i(program, location, v0, v1, v2, v3);
         }
     }
@@ -991,14 +1135,17 @@ void GL_APIENTRY ProgramUniform4iv(GLuint program,
         "0x%0.8p)",
         program, location, count, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniform4iv);
         context->gatherParams<EntryPoint::ProgramUniform4iv>(program, location, count, value);
 
         if (context->skipValidation() ||
             ValidateProgramUniform4iv(context, program, location, count, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniform4iv(program, location, count, value);
         }
     }
@@ -1012,14 +1159,17 @@ ProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v
         "%u, GLuint v3 = %u)",
         program, location, v0, v1, v2, v3);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniform4ui);
         context->gatherParams<EntryPoint::ProgramUniform4ui>(program, location, v0, v1, v2, v3);
 
         if (context->skipValidation() ||
             ValidateProgramUniform4ui(context, program, location, v0, v1, v2, v3))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniform4ui(program, location, v0, v1, v2, v3);
         }
     }
@@ -1035,14 +1185,17 @@ void GL_APIENTRY ProgramUniform4uiv(GLuint program,
         "0x%0.8p)",
         program, location, count, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniform4uiv);
         context->gatherParams<EntryPoint::ProgramUniform4uiv>(program, location, count, value);
 
         if (context->skipValidation() ||
             ValidateProgramUniform4uiv(context, program, location, count, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniform4uiv(program, location, count, value);
         }
     }
@@ -1059,15 +1212,18 @@ void GL_APIENTRY ProgramUniformMatrix2fv(GLuint program,
         "const GLfloat *value = 0x%0.8p)",
         program, location, count, transpose, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniformMatrix2fv);
         context->gatherParams<EntryPoint::ProgramUniformMatrix2fv>(program, location, count,
                                                                    transpose, value);
 
         if (context->skipValidation() ||
             ValidateProgramUniformMatrix2fv(context, program, location, count, transpose, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniformMatrix2fv(program, location, count, transpose, value);
         }
     }
@@ -1084,15 +1240,18 @@ void GL_APIENTRY ProgramUniformMatrix2x3fv(GLuint program,
         "const GLfloat *value = 0x%0.8p)",
         program, location, count, transpose, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniformMatrix2x3fv);
         context->gatherParams<EntryPoint::ProgramUniformMatrix2x3fv>(program, location, count,
                                                                      transpose, value);
 
         if (context->skipValidation() ||
             ValidateProgramUniformMatrix2x3fv(context, program, location, count, transpose, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniformMatrix2x3fv(program, location, count, transpose, value);
         }
     }
@@ -1109,15 +1268,18 @@ void GL_APIENTRY ProgramUniformMatrix2x4fv(GLuint program,
         "const GLfloat *value = 0x%0.8p)",
         program, location, count, transpose, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniformMatrix2x4fv);
         context->gatherParams<EntryPoint::ProgramUniformMatrix2x4fv>(program, location, count,
                                                                      transpose, value);
 
         if (context->skipValidation() ||
             ValidateProgramUniformMatrix2x4fv(context, program, location, count, transpose, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniformMatrix2x4fv(program, location, count, transpose, value);
         }
     }
@@ -1134,15 +1296,18 @@ void GL_APIENTRY ProgramUniformMatrix3fv(GLuint program,
         "const GLfloat *value = 0x%0.8p)",
         program, location, count, transpose, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniformMatrix3fv);
         context->gatherParams<EntryPoint::ProgramUniformMatrix3fv>(program, location, count,
                                                                    transpose, value);
 
         if (context->skipValidation() ||
             ValidateProgramUniformMatrix3fv(context, program, location, count, transpose, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniformMatrix3fv(program, location, count, transpose, value);
         }
     }
@@ -1159,15 +1324,18 @@ void GL_APIENTRY ProgramUniformMatrix3x2fv(GLuint program,
         "const GLfloat *value = 0x%0.8p)",
         program, location, count, transpose, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniformMatrix3x2fv);
         context->gatherParams<EntryPoint::ProgramUniformMatrix3x2fv>(program, location, count,
                                                                      transpose, value);
 
         if (context->skipValidation() ||
             ValidateProgramUniformMatrix3x2fv(context, program, location, count, transpose, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniformMatrix3x2fv(program, location, count, transpose, value);
         }
     }
@@ -1184,15 +1352,18 @@ void GL_APIENTRY ProgramUniformMatrix3x4fv(GLuint program,
         "const GLfloat *value = 0x%0.8p)",
         program, location, count, transpose, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniformMatrix3x4fv);
         context->gatherParams<EntryPoint::ProgramUniformMatrix3x4fv>(program, location, count,
                                                                      transpose, value);
 
         if (context->skipValidation() ||
             ValidateProgramUniformMatrix3x4fv(context, program, location, count, transpose, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniformMatrix3x4fv(program, location, count, transpose, value);
         }
     }
@@ -1209,15 +1380,18 @@ void GL_APIENTRY ProgramUniformMatrix4fv(GLuint program,
         "const GLfloat *value = 0x%0.8p)",
         program, location, count, transpose, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniformMatrix4fv);
         context->gatherParams<EntryPoint::ProgramUniformMatrix4fv>(program, location, count,
                                                                    transpose, value);
 
         if (context->skipValidation() ||
             ValidateProgramUniformMatrix4fv(context, program, location, count, transpose, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniformMatrix4fv(program, location, count, transpose, value);
         }
     }
@@ -1234,15 +1408,18 @@ void GL_APIENTRY ProgramUniformMatrix4x2fv(GLuint program,
         "const GLfloat *value = 0x%0.8p)",
         program, location, count, transpose, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniformMatrix4x2fv);
         context->gatherParams<EntryPoint::ProgramUniformMatrix4x2fv>(program, location, count,
                                                                      transpose, value);
 
         if (context->skipValidation() ||
             ValidateProgramUniformMatrix4x2fv(context, program, location, count, transpose, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniformMatrix4x2fv(program, location, count, transpose, value);
         }
     }
@@ -1259,15 +1436,18 @@ void GL_APIENTRY ProgramUniformMatrix4x3fv(GLuint program,
         "const GLfloat *value = 0x%0.8p)",
         program, location, count, transpose, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramUniformMatrix4x3fv);
         context->gatherParams<EntryPoint::ProgramUniformMatrix4x3fv>(program, location, count,
                                                                      transpose, value);
 
         if (context->skipValidation() ||
             ValidateProgramUniformMatrix4x3fv(context, program, location, count, transpose, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programUniformMatrix4x3fv(program, location, count, transpose, value);
         }
     }
@@ -1277,13 +1457,16 @@ void GL_APIENTRY SampleMaski(GLuint maskNumber, GLbitfield mask)
 {
     EVENT("(GLuint maskNumber = %u, GLbitfield mask = 0x%X)", maskNumber, mask);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::SampleMaski);
         context->gatherParams<EntryPoint::SampleMaski>(maskNumber, mask);
 
         if (context->skipValidation() || ValidateSampleMaski(context, maskNumber, mask))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->sampleMaski(maskNumber, mask);
         }
     }
@@ -1301,9 +1484,11 @@ void GL_APIENTRY TexStorage2DMultisample(GLenum target,
         "= %d, GLsizei height = %d, GLboolean fixedsamplelocations = %u)",
         target, samples, internalformat, width, height, fixedsamplelocations);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexStorage2DMultisample);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::TexStorage2DMultisample>(
             targetPacked, samples, internalformat, width, height, fixedsamplelocations);
@@ -1312,6 +1497,7 @@ void GL_APIENTRY TexStorage2DMultisample(GLenum target,
             ValidateTexStorage2DMultisample(context, targetPacked, samples, internalformat, width,
                                             height, fixedsamplelocations))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texStorage2DMultisample(targetPacked, samples, internalformat, width, height,
                                              fixedsamplelocations);
         }
@@ -1323,14 +1509,17 @@ void GL_APIENTRY UseProgramStages(GLuint pipeline, GLbitfield stages, GLuint pro
     EVENT("(GLuint pipeline = %u, GLbitfield stages = 0x%X, GLuint program = %u)", pipeline, stages,
           program);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::UseProgramStages);
         context->gatherParams<EntryPoint::UseProgramStages>(pipeline, stages, program);
 
         if (context->skipValidation() ||
             ValidateUseProgramStages(context, pipeline, stages, program))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->useProgramStages(pipeline, stages, program);
         }
     }
@@ -1340,13 +1529,16 @@ void GL_APIENTRY ValidateProgramPipeline(GLuint pipeline)
 {
     EVENT("(GLuint pipeline = %u)", pipeline);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ValidateProgramPipeline);
         context->gatherParams<EntryPoint::ValidateProgramPipeline>(pipeline);
 
         if (context->skipValidation() || ValidateValidateProgramPipeline(context, pipeline))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->validateProgramPipeline(pipeline);
         }
     }
@@ -1356,14 +1548,17 @@ void GL_APIENTRY VertexAttribBinding(GLuint attribindex, GLuint bindingindex)
 {
     EVENT("(GLuint attribindex = %u, GLuint bindingindex = %u)", attribindex, bindingindex);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::VertexAttribBinding);
         context->gatherParams<EntryPoint::VertexAttribBinding>(attribindex, bindingindex);
 
         if (context->skipValidation() ||
             ValidateVertexAttribBinding(context, attribindex, bindingindex))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->vertexAttribBinding(attribindex, bindingindex);
         }
     }
@@ -1380,9 +1575,11 @@ void GL_APIENTRY VertexAttribFormat(GLuint attribindex,
         "GLuint relativeoffset = %u)",
         attribindex, size, type, normalized, relativeoffset);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::VertexAttribFormat);
         context->gatherParams<EntryPoint::VertexAttribFormat>(attribindex, size, type, normalized,
                                                               relativeoffset);
 
@@ -1390,6 +1587,7 @@ void GL_APIENTRY VertexAttribFormat(GLuint attribindex,
             ValidateVertexAttribFormat(context, attribindex, size, type, normalized,
                                        relativeoffset))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->vertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
         }
     }
@@ -1405,15 +1603,18 @@ void GL_APIENTRY VertexAttribIFormat(GLuint attribindex,
         "%u)",
         attribindex, size, type, relativeoffset);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::VertexAttribIFormat);
         context->gatherParams<EntryPoint::VertexAttribIFormat>(attribindex, size, type,
                                                                relativeoffset);
 
         if (context->skipValidation() ||
             ValidateVertexAttribIFormat(context, attribindex, size, type, relativeoffset))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->vertexAttribIFormat(attribindex, size, type, relativeoffset);
         }
     }
@@ -1423,14 +1624,17 @@ void GL_APIENTRY VertexBindingDivisor(GLuint bindingindex, GLuint divisor)
 {
     EVENT("(GLuint bindingindex = %u, GLuint divisor = %u)", bindingindex, divisor);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::VertexBindingDivisor);
         context->gatherParams<EntryPoint::VertexBindingDivisor>(bindingindex, divisor);
 
         if (context->skipValidation() ||
             ValidateVertexBindingDivisor(context, bindingindex, divisor))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->vertexBindingDivisor(bindingindex, divisor);
         }
     }
@@ -40,9 +40,11 @@ void GL_APIENTRY BlitFramebufferANGLE(GLint srcX0,
         "filter = 0x%X)",
         srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::BlitFramebufferANGLE);
         context->gatherParams<EntryPoint::BlitFramebufferANGLE>(srcX0, srcY0, srcX1, srcY1, dstX0,
                                                                 dstY0, dstX1, dstY1, mask, filter);
 
@@ -50,6 +52,7 @@ void GL_APIENTRY BlitFramebufferANGLE(GLint srcX0,
             ValidateBlitFramebufferANGLE(context, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1,
                                          dstY1, mask, filter))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->blitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask,
                                      filter);
         }
@@ -68,9 +71,11 @@ void GL_APIENTRY RenderbufferStorageMultisampleANGLE(GLenum target,
         "= %d, GLsizei height = %d)",
         target, samples, internalformat, width, height);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::RenderbufferStorageMultisampleANGLE);
         context->gatherParams<EntryPoint::RenderbufferStorageMultisampleANGLE>(
             target, samples, internalformat, width, height);
 
@@ -78,6 +83,7 @@ void GL_APIENTRY RenderbufferStorageMultisampleANGLE(GLenum target,
             ValidateRenderbufferStorageMultisampleANGLE(context, target, samples, internalformat,
                                                         width, height))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->renderbufferStorageMultisample(target, samples, internalformat, width, height);
         }
     }
@@ -92,14 +98,17 @@ void GL_APIENTRY DrawArraysInstancedANGLE(GLenum mode,
     EVENT("(GLenum mode = 0x%X, GLint first = %d, GLsizei count = %d, GLsizei primcount = %d)",
           mode, first, count, primcount);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DrawArraysInstancedANGLE);
         context->gatherParams<EntryPoint::DrawArraysInstancedANGLE>(mode, first, count, primcount);
 
         if (context->skipValidation() ||
             ValidateDrawArraysInstancedANGLE(context, mode, first, count, primcount))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->drawArraysInstanced(mode, first, count, primcount);
         }
     }
@@ -116,15 +125,18 @@ void GL_APIENTRY DrawElementsInstancedANGLE(GLenum mode,
         "0x%0.8p, GLsizei primcount = %d)",
         mode, count, type, indices, primcount);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DrawElementsInstancedANGLE);
         context->gatherParams<EntryPoint::DrawElementsInstancedANGLE>(mode, count, type, indices,
                                                                       primcount);
 
         if (context->skipValidation() ||
             ValidateDrawElementsInstancedANGLE(context, mode, count, type, indices, primcount))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->drawElementsInstanced(mode, count, type, indices, primcount);
         }
     }
@@ -134,13 +146,16 @@ void GL_APIENTRY VertexAttribDivisorANGLE(GLuint index, GLuint divisor)
 {
     EVENT("(GLuint index = %u, GLuint divisor = %u)", index, divisor);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::VertexAttribDivisorANGLE);
         context->gatherParams<EntryPoint::VertexAttribDivisorANGLE>(index, divisor);
 
         if (context->skipValidation() || ValidateVertexAttribDivisorANGLE(context, index, divisor))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->vertexAttribDivisor(index, divisor);
         }
     }
@@ -159,9 +174,11 @@ void GL_APIENTRY FramebufferTextureMultiviewLayeredANGLE(GLenum target,
         "GLint baseViewIndex = %d, GLsizei numViews = %d)",
         target, attachment, texture, level, baseViewIndex, numViews);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::FramebufferTextureMultiviewLayeredANGLE);
         context->gatherParams<EntryPoint::FramebufferTextureMultiviewLayeredANGLE>(
             target, attachment, texture, level, baseViewIndex, numViews);
 
@@ -169,6 +186,7 @@ void GL_APIENTRY FramebufferTextureMultiviewLayeredANGLE(GLenum target,
             ValidateFramebufferTextureMultiviewLayeredANGLE(context, target, attachment, texture,
                                                             level, baseViewIndex, numViews))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->framebufferTextureMultiviewLayered(target, attachment, texture, level,
                                                         baseViewIndex, numViews);
         }
@@ -187,9 +205,11 @@ void GL_APIENTRY FramebufferTextureMultiviewSideBySideANGLE(GLenum target,
         "GLsizei numViews = %d, const GLint * viewportOffsets = 0x%0.8p)",
         target, attachment, texture, level, numViews, viewportOffsets);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::FramebufferTextureMultiviewSideBySideANGLE);
         context->gatherParams<EntryPoint::FramebufferTextureMultiviewSideBySideANGLE>(
             target, attachment, texture, level, numViews, viewportOffsets);
 
@@ -197,6 +217,7 @@ void GL_APIENTRY FramebufferTextureMultiviewSideBySideANGLE(GLenum target,
             ValidateFramebufferTextureMultiviewSideBySideANGLE(context, target, attachment, texture,
                                                                level, numViews, viewportOffsets))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->framebufferTextureMultiviewSideBySide(target, attachment, texture, level,
                                                            numViews, viewportOffsets);
         }
@@ -208,13 +229,16 @@ void GL_APIENTRY RequestExtensionANGLE(const GLchar *name)
 {
     EVENT("(const GLchar * name = 0x%0.8p)", name);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::RequestExtensionANGLE);
         context->gatherParams<EntryPoint::RequestExtensionANGLE>(name);
 
         if (context->skipValidation() || ValidateRequestExtensionANGLE(context, name))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->requestExtension(name);
         }
     }
@@ -231,14 +255,17 @@ void GL_APIENTRY GetBooleanvRobustANGLE(GLenum pname,
         "params = 0x%0.8p)",
         pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetBooleanvRobustANGLE);
         context->gatherParams<EntryPoint::GetBooleanvRobustANGLE>(pname, bufSize, length, params);
 
         if (context->skipValidation() ||
             ValidateGetBooleanvRobustANGLE(context, pname, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getBooleanvRobust(pname, bufSize, length, params);
         }
     }
@@ -255,9 +282,11 @@ void GL_APIENTRY GetBufferParameterivRobustANGLE(GLenum target,
         "0x%0.8p, GLint * params = 0x%0.8p)",
         target, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetBufferParameterivRobustANGLE);
         BufferBinding targetPacked = FromGLenum<BufferBinding>(target);
         context->gatherParams<EntryPoint::GetBufferParameterivRobustANGLE>(targetPacked, pname,
                                                                            bufSize, length, params);
@@ -265,6 +294,7 @@ void GL_APIENTRY GetBufferParameterivRobustANGLE(GLenum target,
         if (context->skipValidation() || ValidateGetBufferParameterivRobustANGLE(
                                              context, targetPacked, pname, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getBufferParameterivRobust(targetPacked, pname, bufSize, length, params);
         }
     }
@@ -280,14 +310,17 @@ void GL_APIENTRY GetFloatvRobustANGLE(GLenum pname,
         "= 0x%0.8p)",
         pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetFloatvRobustANGLE);
         context->gatherParams<EntryPoint::GetFloatvRobustANGLE>(pname, bufSize, length, params);
 
         if (context->skipValidation() ||
             ValidateGetFloatvRobustANGLE(context, pname, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getFloatvRobust(pname, bufSize, length, params);
         }
     }
@@ -305,9 +338,11 @@ void GL_APIENTRY GetFramebufferAttachmentParameterivRobustANGLE(GLenum target,
         "%d, GLsizei * length = 0x%0.8p, GLint * params = 0x%0.8p)",
         target, attachment, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetFramebufferAttachmentParameterivRobustANGLE);
         context->gatherParams<EntryPoint::GetFramebufferAttachmentParameterivRobustANGLE>(
             target, attachment, pname, bufSize, length, params);
 
@@ -315,6 +350,7 @@ void GL_APIENTRY GetFramebufferAttachmentParameterivRobustANGLE(GLenum target,
             ValidateGetFramebufferAttachmentParameterivRobustANGLE(context, target, attachment,
                                                                    pname, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getFramebufferAttachmentParameterivRobust(target, attachment, pname, bufSize,
                                                                length, params);
         }
@@ -328,14 +364,17 @@ void GL_APIENTRY GetIntegervRobustANGLE(GLenum pname, GLsizei bufSize, GLsizei *
         "0x%0.8p)",
         pname, bufSize, length, data);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetIntegervRobustANGLE);
         context->gatherParams<EntryPoint::GetIntegervRobustANGLE>(pname, bufSize, length, data);
 
         if (context->skipValidation() ||
             ValidateGetIntegervRobustANGLE(context, pname, bufSize, length, data))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getIntegervRobust(pname, bufSize, length, data);
         }
     }
@@ -352,15 +391,18 @@ void GL_APIENTRY GetProgramivRobustANGLE(GLuint program,
         "0x%0.8p, GLint * params = 0x%0.8p)",
         program, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetProgramivRobustANGLE);
         context->gatherParams<EntryPoint::GetProgramivRobustANGLE>(program, pname, bufSize, length,
                                                                    params);
 
         if (context->skipValidation() ||
             ValidateGetProgramivRobustANGLE(context, program, pname, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getProgramivRobust(program, pname, bufSize, length, params);
         }
     }
@@ -377,15 +419,18 @@ void GL_APIENTRY GetRenderbufferParameterivRobustANGLE(GLenum target,
         "0x%0.8p, GLint * params = 0x%0.8p)",
         target, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetRenderbufferParameterivRobustANGLE);
         context->gatherParams<EntryPoint::GetRenderbufferParameterivRobustANGLE>(
             target, pname, bufSize, length, params);
 
         if (context->skipValidation() || ValidateGetRenderbufferParameterivRobustANGLE(
                                              context, target, pname, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getRenderbufferParameterivRobust(target, pname, bufSize, length, params);
         }
     }
@@ -399,15 +444,18 @@ GetShaderivRobustANGLE(GLuint shader, GLenum pname, GLsizei bufSize, GLsizei *le
         "0x%0.8p, GLint * params = 0x%0.8p)",
         shader, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetShaderivRobustANGLE);
         context->gatherParams<EntryPoint::GetShaderivRobustANGLE>(shader, pname, bufSize, length,
                                                                   params);
 
         if (context->skipValidation() ||
             ValidateGetShaderivRobustANGLE(context, shader, pname, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getShaderivRobust(shader, pname, bufSize, length, params);
         }
     }
@@ -424,9 +472,11 @@ void GL_APIENTRY GetTexParameterfvRobustANGLE(GLenum target,
         "0x%0.8p, GLfloat * params = 0x%0.8p)",
         target, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetTexParameterfvRobustANGLE);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::GetTexParameterfvRobustANGLE>(targetPacked, pname,
                                                                         bufSize, length, params);
@@ -434,6 +484,7 @@ void GL_APIENTRY GetTexParameterfvRobustANGLE(GLenum target,
         if (context->skipValidation() || ValidateGetTexParameterfvRobustANGLE(
                                              context, targetPacked, pname, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getTexParameterfvRobust(targetPacked, pname, bufSize, length, params);
         }
     }
@@ -450,9 +501,11 @@ void GL_APIENTRY GetTexParameterivRobustANGLE(GLenum target,
         "0x%0.8p, GLint * params = 0x%0.8p)",
         target, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetTexParameterivRobustANGLE);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::GetTexParameterivRobustANGLE>(targetPacked, pname,
                                                                         bufSize, length, params);
@@ -460,6 +513,7 @@ void GL_APIENTRY GetTexParameterivRobustANGLE(GLenum target,
         if (context->skipValidation() || ValidateGetTexParameterivRobustANGLE(
                                              context, targetPacked, pname, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getTexParameterivRobust(targetPacked, pname, bufSize, length, params);
         }
     }
@@ -476,15 +530,18 @@ void GL_APIENTRY GetUniformfvRobustANGLE(GLuint program,
         "0x%0.8p, GLfloat * params = 0x%0.8p)",
         program, location, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetUniformfvRobustANGLE);
         context->gatherParams<EntryPoint::GetUniformfvRobustANGLE>(program, location, bufSize,
                                                                    length, params);
 
         if (context->skipValidation() ||
             ValidateGetUniformfvRobustANGLE(context, program, location, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getUniformfvRobust(program, location, bufSize, length, params);
         }
     }
@@ -501,15 +558,18 @@ void GL_APIENTRY GetUniformivRobustANGLE(GLuint program,
         "0x%0.8p, GLint * params = 0x%0.8p)",
         program, location, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetUniformivRobustANGLE);
         context->gatherParams<EntryPoint::GetUniformivRobustANGLE>(program, location, bufSize,
                                                                    length, params);
 
         if (context->skipValidation() ||
             ValidateGetUniformivRobustANGLE(context, program, location, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getUniformivRobust(program, location, bufSize, length, params);
         }
     }
@@ -526,15 +586,18 @@ void GL_APIENTRY GetVertexAttribfvRobustANGLE(GLuint index,
         "0x%0.8p, GLfloat * params = 0x%0.8p)",
         index, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetVertexAttribfvRobustANGLE);
         context->gatherParams<EntryPoint::GetVertexAttribfvRobustANGLE>(index, pname, bufSize,
                                                                         length, params);
 
         if (context->skipValidation() ||
             ValidateGetVertexAttribfvRobustANGLE(context, index, pname, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getVertexAttribfvRobust(index, pname, bufSize, length, params);
         }
     }
@@ -551,15 +614,18 @@ void GL_APIENTRY GetVertexAttribivRobustANGLE(GLuint index,
         "0x%0.8p, GLint * params = 0x%0.8p)",
         index, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetVertexAttribivRobustANGLE);
         context->gatherParams<EntryPoint::GetVertexAttribivRobustANGLE>(index, pname, bufSize,
                                                                         length, params);
 
         if (context->skipValidation() ||
             ValidateGetVertexAttribivRobustANGLE(context, index, pname, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getVertexAttribivRobust(index, pname, bufSize, length, params);
         }
     }
@@ -576,15 +642,18 @@ void GL_APIENTRY GetVertexAttribPointervRobustANGLE(GLuint index,
         "0x%0.8p, void ** pointer = 0x%0.8p)",
         index, pname, bufSize, length, pointer);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetVertexAttribPointervRobustANGLE);
         context->gatherParams<EntryPoint::GetVertexAttribPointervRobustANGLE>(index, pname, bufSize,
                                                                               length, pointer);
 
         if (context->skipValidation() || ValidateGetVertexAttribPointervRobustANGLE(
                                              context, index, pname, bufSize, length, pointer))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getVertexAttribPointervRobust(index, pname, bufSize, length, pointer);
         }
     }
@@ -608,9 +677,11 @@ void GL_APIENTRY ReadPixelsRobustANGLE(GLint x,
         "columns = 0x%0.8p, GLsizei * rows = 0x%0.8p, void * pixels = 0x%0.8p)",
         x, y, width, height, format, type, bufSize, length, columns, rows, pixels);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ReadPixelsRobustANGLE);
         context->gatherParams<EntryPoint::ReadPixelsRobustANGLE>(
             x, y, width, height, format, type, bufSize, length, columns, rows, pixels);
 
@@ -618,6 +689,7 @@ void GL_APIENTRY ReadPixelsRobustANGLE(GLint x,
             ValidateReadPixelsRobustANGLE(context, x, y, width, height, format, type, bufSize,
                                           length, columns, rows, pixels))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->readPixelsRobust(x, y, width, height, format, type, bufSize, length, columns,
                                       rows, pixels);
         }
@@ -641,9 +713,11 @@ void GL_APIENTRY TexImage2DRobustANGLE(GLenum target,
         "bufSize = %d, const void * pixels = 0x%0.8p)",
         target, level, internalformat, width, height, border, format, type, bufSize, pixels);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexImage2DRobustANGLE);
         TextureTarget targetPacked = FromGLenum<TextureTarget>(target);
         context->gatherParams<EntryPoint::TexImage2DRobustANGLE>(
             targetPacked, level, internalformat, width, height, border, format, type, bufSize,
@@ -653,6 +727,7 @@ void GL_APIENTRY TexImage2DRobustANGLE(GLenum target,
             ValidateTexImage2DRobustANGLE(context, targetPacked, level, internalformat, width,
                                           height, border, format, type, bufSize, pixels))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texImage2DRobust(targetPacked, level, internalformat, width, height, border,
                                       format, type, bufSize, pixels);
         }
@@ -669,9 +744,11 @@ void GL_APIENTRY TexParameterfvRobustANGLE(GLenum target,
         "= 0x%0.8p)",
         target, pname, bufSize, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexParameterfvRobustANGLE);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::TexParameterfvRobustANGLE>(targetPacked, pname, bufSize,
                                                                      params);
@@ -679,6 +756,7 @@ void GL_APIENTRY TexParameterfvRobustANGLE(GLenum target,
         if (context->skipValidation() ||
             ValidateTexParameterfvRobustANGLE(context, targetPacked, pname, bufSize, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texParameterfvRobust(targetPacked, pname, bufSize, params);
         }
     }
@@ -694,9 +772,11 @@ void GL_APIENTRY TexParameterivRobustANGLE(GLenum target,
         "0x%0.8p)",
         target, pname, bufSize, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexParameterivRobustANGLE);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::TexParameterivRobustANGLE>(targetPacked, pname, bufSize,
                                                                      params);
@@ -704,6 +784,7 @@ void GL_APIENTRY TexParameterivRobustANGLE(GLenum target,
         if (context->skipValidation() ||
             ValidateTexParameterivRobustANGLE(context, targetPacked, pname, bufSize, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texParameterivRobust(targetPacked, pname, bufSize, params);
         }
     }
@@ -726,9 +807,11 @@ void GL_APIENTRY TexSubImage2DRobustANGLE(GLenum target,
         "bufSize = %d, const void * pixels = 0x%0.8p)",
         target, level, xoffset, yoffset, width, height, format, type, bufSize, pixels);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexSubImage2DRobustANGLE);
         TextureTarget targetPacked = FromGLenum<TextureTarget>(target);
         context->gatherParams<EntryPoint::TexSubImage2DRobustANGLE>(
             targetPacked, level, xoffset, yoffset, width, height, format, type, bufSize, pixels);
@@ -737,6 +820,7 @@ void GL_APIENTRY TexSubImage2DRobustANGLE(GLenum target,
             ValidateTexSubImage2DRobustANGLE(context, targetPacked, level, xoffset, yoffset, width,
                                              height, format, type, bufSize, pixels))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texSubImage2DRobust(targetPacked, level, xoffset, yoffset, width, height,
                                          format, type, bufSize, pixels);
         }
@@ -761,9 +845,11 @@ void GL_APIENTRY TexImage3DRobustANGLE(GLenum target,
         "type = 0x%X, GLsizei bufSize = %d, const void * pixels = 0x%0.8p)",
         target, level, internalformat, width, height, depth, border, format, type, bufSize, pixels);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexImage3DRobustANGLE);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::TexImage3DRobustANGLE>(
             targetPacked, level, internalformat, width, height, depth, border, format, type,
@@ -773,6 +859,7 @@ void GL_APIENTRY TexImage3DRobustANGLE(GLenum target,
             ValidateTexImage3DRobustANGLE(context, targetPacked, level, internalformat, width,
                                           height, depth, border, format, type, bufSize, pixels))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texImage3DRobust(targetPacked, level, internalformat, width, height, depth,
                                       border, format, type, bufSize, pixels);
         }
@@ -799,9 +886,11 @@ void GL_APIENTRY TexSubImage3DRobustANGLE(GLenum target,
         target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize,
         pixels);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexSubImage3DRobustANGLE);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::TexSubImage3DRobustANGLE>(
             targetPacked, level, xoffset, yoffset, zoffset, width, height, depth, format, type,
@@ -812,6 +901,7 @@ void GL_APIENTRY TexSubImage3DRobustANGLE(GLenum target,
                                              zoffset, width, height, depth, format, type, bufSize,
                                              pixels))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texSubImage3DRobust(targetPacked, level, xoffset, yoffset, zoffset, width,
                                          height, depth, format, type, bufSize, pixels);
         }
@@ -834,9 +924,11 @@ void GL_APIENTRY CompressedTexImage2DRobustANGLE(GLenum target,
         "%d, const GLvoid * data = 0x%0.8p)",
         target, level, internalformat, width, height, border, imageSize, dataSize, data);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::CompressedTexImage2DRobustANGLE);
         TextureTarget targetPacked = FromGLenum<TextureTarget>(target);
         context->gatherParams<EntryPoint::CompressedTexImage2DRobustANGLE>(
             targetPacked, level, internalformat, width, height, border, imageSize, dataSize, data);
@@ -845,6 +937,7 @@ void GL_APIENTRY CompressedTexImage2DRobustANGLE(GLenum target,
                                              context, targetPacked, level, internalformat, width,
                                              height, border, imageSize, dataSize, data))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->compressedTexImage2DRobust(targetPacked, level, internalformat, width, height,
                                                 border, imageSize, dataSize, data);
         }
@@ -868,9 +961,11 @@ void GL_APIENTRY CompressedTexSubImage2DRobustANGLE(GLenum target,
         "GLsizei dataSize = %d, const GLvoid * data = 0x%0.8p)",
         target, level, xoffset, yoffset, width, height, format, imageSize, dataSize, data);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::CompressedTexSubImage2DRobustANGLE);
         TextureTarget targetPacked = FromGLenum<TextureTarget>(target);
         context->gatherParams<EntryPoint::CompressedTexSubImage2DRobustANGLE>(
             targetPacked, level, xoffset, yoffset, width, height, format, imageSize, dataSize,
@@ -880,6 +975,7 @@ void GL_APIENTRY CompressedTexSubImage2DRobustANGLE(GLenum target,
                                              context, targetPacked, level, xoffset, yoffset, width,
                                              height, format, imageSize, dataSize, data))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->compressedTexSubImage2DRobust(targetPacked, level, xoffset, yoffset, width,
                                                    height, format, imageSize, dataSize, data);
         }
@@ -903,9 +999,11 @@ void GL_APIENTRY CompressedTexImage3DRobustANGLE(GLenum target,
         "GLsizei dataSize = %d, const GLvoid * data = 0x%0.8p)",
         target, level, internalformat, width, height, depth, border, imageSize, dataSize, data);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::CompressedTexImage3DRobustANGLE);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::CompressedTexImage3DRobustANGLE>(
             targetPacked, level, internalformat, width, height, depth, border, imageSize, dataSize,
@@ -915,6 +1013,7 @@ void GL_APIENTRY CompressedTexImage3DRobustANGLE(GLenum target,
                                              context, targetPacked, level, internalformat, width,
                                              height, depth, border, imageSize, dataSize, data))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->compressedTexImage3DRobust(targetPacked, level, internalformat, width, height,
                                                 depth, border, imageSize, dataSize, data);
         }
@@ -941,9 +1040,11 @@ void GL_APIENTRY CompressedTexSubImage3DRobustANGLE(GLenum target,
         target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, dataSize,
         data);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::CompressedTexSubImage3DRobustANGLE);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::CompressedTexSubImage3DRobustANGLE>(
             targetPacked, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize,
@@ -954,6 +1055,7 @@ void GL_APIENTRY CompressedTexSubImage3DRobustANGLE(GLenum target,
                                                        yoffset, zoffset, width, height, depth,
                                                        format, imageSize, dataSize, data))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->compressedTexSubImage3DRobust(targetPacked, level, xoffset, yoffset, zoffset,
                                                    width, height, depth, format, imageSize,
                                                    dataSize, data);
@@ -969,9 +1071,11 @@ GetQueryivRobustANGLE(GLenum target, GLenum pname, GLsizei bufSize, GLsizei *len
         "0x%0.8p, GLint * params = 0x%0.8p)",
         target, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetQueryivRobustANGLE);
         QueryType targetPacked = FromGLenum<QueryType>(target);
         context->gatherParams<EntryPoint::GetQueryivRobustANGLE>(targetPacked, pname, bufSize,
                                                                  length, params);
@@ -979,6 +1083,7 @@ GetQueryivRobustANGLE(GLenum target, GLenum pname, GLsizei bufSize, GLsizei *len
         if (context->skipValidation() ||
             ValidateGetQueryivRobustANGLE(context, targetPacked, pname, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getQueryivRobust(targetPacked, pname, bufSize, length, params);
         }
     }
@@ -995,15 +1100,18 @@ void GL_APIENTRY GetQueryObjectuivRobustANGLE(GLuint id,
         "GLuint * params = 0x%0.8p)",
         id, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetQueryObjectuivRobustANGLE);
         context->gatherParams<EntryPoint::GetQueryObjectuivRobustANGLE>(id, pname, bufSize, length,
                                                                         params);
 
         if (context->skipValidation() ||
             ValidateGetQueryObjectuivRobustANGLE(context, id, pname, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getQueryObjectuivRobust(id, pname, bufSize, length, params);
         }
     }
@@ -1020,9 +1128,11 @@ void GL_APIENTRY GetBufferPointervRobustANGLE(GLenum target,
         "0x%0.8p, void ** params = 0x%0.8p)",
         target, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetBufferPointervRobustANGLE);
         BufferBinding targetPacked = FromGLenum<BufferBinding>(target);
         context->gatherParams<EntryPoint::GetBufferPointervRobustANGLE>(targetPacked, pname,
                                                                         bufSize, length, params);
@@ -1030,6 +1140,7 @@ void GL_APIENTRY GetBufferPointervRobustANGLE(GLenum target,
         if (context->skipValidation() || ValidateGetBufferPointervRobustANGLE(
                                              context, targetPacked, pname, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getBufferPointervRobust(targetPacked, pname, bufSize, length, params);
         }
     }
@@ -1043,15 +1154,18 @@ GetIntegeri_vRobustANGLE(GLenum target, GLuint index, GLsizei bufSize, GLsizei *
         "0x%0.8p, GLint * data = 0x%0.8p)",
         target, index, bufSize, length, data);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetIntegeri_vRobustANGLE);
         context->gatherParams<EntryPoint::GetIntegeri_vRobustANGLE>(target, index, bufSize, length,
                                                                     data);
 
         if (context->skipValidation() ||
             ValidateGetIntegeri_vRobustANGLE(context, target, index, bufSize, length, data))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getIntegeri_vRobust(target, index, bufSize, length, data);
         }
     }
@@ -1069,9 +1183,11 @@ void GL_APIENTRY GetInternalformativRobustANGLE(GLenum target,
         "= %d, GLsizei * length = 0x%0.8p, GLint * params = 0x%0.8p)",
         target, internalformat, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetInternalformativRobustANGLE);
         context->gatherParams<EntryPoint::GetInternalformativRobustANGLE>(
             target, internalformat, pname, bufSize, length, params);
 
@@ -1079,6 +1195,7 @@ void GL_APIENTRY GetInternalformativRobustANGLE(GLenum target,
             ValidateGetInternalformativRobustANGLE(context, target, internalformat, pname, bufSize,
                                                    length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getInternalformativRobust(target, internalformat, pname, bufSize, length,
                                                params);
         }
@@ -1096,15 +1213,18 @@ void GL_APIENTRY GetVertexAttribIivRobustANGLE(GLuint index,
         "0x%0.8p, GLint * params = 0x%0.8p)",
         index, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetVertexAttribIivRobustANGLE);
         context->gatherParams<EntryPoint::GetVertexAttribIivRobustANGLE>(index, pname, bufSize,
                                                                          length, params);
 
         if (context->skipValidation() ||
             ValidateGetVertexAttribIivRobustANGLE(context, index, pname, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getVertexAttribIivRobust(index, pname, bufSize, length, params);
         }
     }
@@ -1121,15 +1241,18 @@ void GL_APIENTRY GetVertexAttribIuivRobustANGLE(GLuint index,
         "0x%0.8p, GLuint * params = 0x%0.8p)",
         index, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetVertexAttribIuivRobustANGLE);
         context->gatherParams<EntryPoint::GetVertexAttribIuivRobustANGLE>(index, pname, bufSize,
                                                                           length, params);
 
         if (context->skipValidation() ||
             ValidateGetVertexAttribIuivRobustANGLE(context, index, pname, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getVertexAttribIuivRobust(index, pname, bufSize, length, params);
         }
     }
@@ -1146,15 +1269,18 @@ void GL_APIENTRY GetUniformuivRobustANGLE(GLuint program,
         "0x%0.8p, GLuint * params = 0x%0.8p)",
         program, location, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetUniformuivRobustANGLE);
         context->gatherParams<EntryPoint::GetUniformuivRobustANGLE>(program, location, bufSize,
                                                                     length, params);
 
         if (context->skipValidation() ||
             ValidateGetUniformuivRobustANGLE(context, program, location, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getUniformuivRobust(program, location, bufSize, length, params);
         }
     }
@@ -1172,9 +1298,11 @@ void GL_APIENTRY GetActiveUniformBlockivRobustANGLE(GLuint program,
         "= %d, GLsizei * length = 0x%0.8p, GLint * params = 0x%0.8p)",
         program, uniformBlockIndex, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetActiveUniformBlockivRobustANGLE);
         context->gatherParams<EntryPoint::GetActiveUniformBlockivRobustANGLE>(
             program, uniformBlockIndex, pname, bufSize, length, params);
 
@@ -1182,6 +1310,7 @@ void GL_APIENTRY GetActiveUniformBlockivRobustANGLE(GLuint program,
             ValidateGetActiveUniformBlockivRobustANGLE(context, program, uniformBlockIndex, pname,
                                                        bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getActiveUniformBlockivRobust(program, uniformBlockIndex, pname, bufSize,
                                                    length, params);
         }
@@ -1198,14 +1327,17 @@ void GL_APIENTRY GetInteger64vRobustANGLE(GLenum pname,
         "0x%0.8p)",
         pname, bufSize, length, data);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetInteger64vRobustANGLE);
         context->gatherParams<EntryPoint::GetInteger64vRobustANGLE>(pname, bufSize, length, data);
 
         if (context->skipValidation() ||
             ValidateGetInteger64vRobustANGLE(context, pname, bufSize, length, data))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getInteger64vRobust(pname, bufSize, length, data);
         }
     }
@@ -1222,15 +1354,18 @@ void GL_APIENTRY GetInteger64i_vRobustANGLE(GLenum target,
         "0x%0.8p, GLint64 * data = 0x%0.8p)",
         target, index, bufSize, length, data);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetInteger64i_vRobustANGLE);
         context->gatherParams<EntryPoint::GetInteger64i_vRobustANGLE>(target, index, bufSize,
                                                                       length, data);
 
         if (context->skipValidation() ||
             ValidateGetInteger64i_vRobustANGLE(context, target, index, bufSize, length, data))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getInteger64i_vRobust(target, index, bufSize, length, data);
         }
     }
@@ -1247,9 +1382,11 @@ void GL_APIENTRY GetBufferParameteri64vRobustANGLE(GLenum target,
         "0x%0.8p, GLint64 * params = 0x%0.8p)",
         target, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetBufferParameteri64vRobustANGLE);
         BufferBinding targetPacked = FromGLenum<BufferBinding>(target);
         context->gatherParams<EntryPoint::GetBufferParameteri64vRobustANGLE>(
             targetPacked, pname, bufSize, length, params);
@@ -1257,6 +1394,7 @@ void GL_APIENTRY GetBufferParameteri64vRobustANGLE(GLenum target,
         if (context->skipValidation() || ValidateGetBufferParameteri64vRobustANGLE(
                                              context, targetPacked, pname, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getBufferParameteri64vRobust(targetPacked, pname, bufSize, length, params);
         }
     }
@@ -1272,15 +1410,18 @@ void GL_APIENTRY SamplerParameterivRobustANGLE(GLuint sampler,
         "0x%0.8p)",
         sampler, pname, bufSize, param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::SamplerParameterivRobustANGLE);
         context->gatherParams<EntryPoint::SamplerParameterivRobustANGLE>(sampler, pname, bufSize,
                                                                          param);
 
         if (context->skipValidation() ||
             ValidateSamplerParameterivRobustANGLE(context, sampler, pname, bufSize, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->samplerParameterivRobust(sampler, pname, bufSize, param);
         }
     }
@@ -1296,15 +1437,18 @@ void GL_APIENTRY SamplerParameterfvRobustANGLE(GLuint sampler,
         "0x%0.8p)",
         sampler, pname, bufSize, param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::SamplerParameterfvRobustANGLE);
         context->gatherParams<EntryPoint::SamplerParameterfvRobustANGLE>(sampler, pname, bufSize,
                                                                          param);
 
         if (context->skipValidation() ||
             ValidateSamplerParameterfvRobustANGLE(context, sampler, pname, bufSize, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->samplerParameterfvRobust(sampler, pname, bufSize, param);
         }
     }
@@ -1321,15 +1465,18 @@ void GL_APIENTRY GetSamplerParameterivRobustANGLE(GLuint sampler,
         "0x%0.8p, GLint * params = 0x%0.8p)",
         sampler, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetSamplerParameterivRobustANGLE);
         context->gatherParams<EntryPoint::GetSamplerParameterivRobustANGLE>(sampler, pname, bufSize,
                                                                             length, params);
 
         if (context->skipValidation() || ValidateGetSamplerParameterivRobustANGLE(
                                              context, sampler, pname, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getSamplerParameterivRobust(sampler, pname, bufSize, length, params);
         }
     }
@@ -1346,15 +1493,18 @@ void GL_APIENTRY GetSamplerParameterfvRobustANGLE(GLuint sampler,
         "0x%0.8p, GLfloat * params = 0x%0.8p)",
         sampler, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetSamplerParameterfvRobustANGLE);
         context->gatherParams<EntryPoint::GetSamplerParameterfvRobustANGLE>(sampler, pname, bufSize,
                                                                             length, params);
 
         if (context->skipValidation() || ValidateGetSamplerParameterfvRobustANGLE(
                                              context, sampler, pname, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getSamplerParameterfvRobust(sampler, pname, bufSize, length, params);
         }
     }
@@ -1371,15 +1521,18 @@ void GL_APIENTRY GetFramebufferParameterivRobustANGLE(GLuint sampler,
         "0x%0.8p, GLint * params = 0x%0.8p)",
         sampler, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetFramebufferParameterivRobustANGLE);
         context->gatherParams<EntryPoint::GetFramebufferParameterivRobustANGLE>(
             sampler, pname, bufSize, length, params);
 
         if (context->skipValidation() || ValidateGetFramebufferParameterivRobustANGLE(
                                              context, sampler, pname, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getFramebufferParameterivRobust(sampler, pname, bufSize, length, params);
         }
     }
@@ -1397,9 +1550,11 @@ void GL_APIENTRY GetProgramInterfaceivRobustANGLE(GLuint program,
         "bufSize = %d, GLsizei * length = 0x%0.8p, GLint * params = 0x%0.8p)",
         program, programInterface, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetProgramInterfaceivRobustANGLE);
         context->gatherParams<EntryPoint::GetProgramInterfaceivRobustANGLE>(
             program, programInterface, pname, bufSize, length, params);
 
@@ -1407,6 +1562,7 @@ void GL_APIENTRY GetProgramInterfaceivRobustANGLE(GLuint program,
             ValidateGetProgramInterfaceivRobustANGLE(context, program, programInterface, pname,
                                                      bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getProgramInterfaceivRobust(program, programInterface, pname, bufSize, length,
                                                  params);
         }
@@ -1424,15 +1580,18 @@ void GL_APIENTRY GetBooleani_vRobustANGLE(GLenum target,
         "0x%0.8p, GLboolean * data = 0x%0.8p)",
         target, index, bufSize, length, data);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetBooleani_vRobustANGLE);
         context->gatherParams<EntryPoint::GetBooleani_vRobustANGLE>(target, index, bufSize, length,
                                                                     data);
 
         if (context->skipValidation() ||
             ValidateGetBooleani_vRobustANGLE(context, target, index, bufSize, length, data))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getBooleani_vRobust(target, index, bufSize, length, data);
         }
     }
@@ -1449,15 +1608,18 @@ void GL_APIENTRY GetMultisamplefvRobustANGLE(GLenum pname,
         "0x%0.8p, GLfloat * val = 0x%0.8p)",
         pname, index, bufSize, length, val);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetMultisamplefvRobustANGLE);
         context->gatherParams<EntryPoint::GetMultisamplefvRobustANGLE>(pname, index, bufSize,
                                                                        length, val);
 
         if (context->skipValidation() ||
             ValidateGetMultisamplefvRobustANGLE(context, pname, index, bufSize, length, val))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getMultisamplefvRobust(pname, index, bufSize, length, val);
         }
     }
@@ -1475,9 +1637,11 @@ void GL_APIENTRY GetTexLevelParameterivRobustANGLE(GLenum target,
         "GLsizei * length = 0x%0.8p, GLint * params = 0x%0.8p)",
         target, level, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetTexLevelParameterivRobustANGLE);
         TextureTarget targetPacked = FromGLenum<TextureTarget>(target);
         context->gatherParams<EntryPoint::GetTexLevelParameterivRobustANGLE>(
             targetPacked, level, pname, bufSize, length, params);
@@ -1486,6 +1650,7 @@ void GL_APIENTRY GetTexLevelParameterivRobustANGLE(GLenum target,
             ValidateGetTexLevelParameterivRobustANGLE(context, targetPacked, level, pname, bufSize,
                                                       length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getTexLevelParameterivRobust(targetPacked, level, pname, bufSize, length,
                                                   params);
         }
@@ -1504,9 +1669,11 @@ void GL_APIENTRY GetTexLevelParameterfvRobustANGLE(GLenum target,
         "GLsizei * length = 0x%0.8p, GLfloat * params = 0x%0.8p)",
         target, level, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetTexLevelParameterfvRobustANGLE);
         TextureTarget targetPacked = FromGLenum<TextureTarget>(target);
         context->gatherParams<EntryPoint::GetTexLevelParameterfvRobustANGLE>(
             targetPacked, level, pname, bufSize, length, params);
@@ -1515,6 +1682,7 @@ void GL_APIENTRY GetTexLevelParameterfvRobustANGLE(GLenum target,
             ValidateGetTexLevelParameterfvRobustANGLE(context, targetPacked, level, pname, bufSize,
                                                       length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getTexLevelParameterfvRobust(targetPacked, level, pname, bufSize, length,
                                                   params);
         }
@@ -1531,15 +1699,18 @@ void GL_APIENTRY GetPointervRobustANGLERobustANGLE(GLenum pname,
         "0x%0.8p)",
         pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetPointervRobustANGLERobustANGLE);
         context->gatherParams<EntryPoint::GetPointervRobustANGLERobustANGLE>(pname, bufSize, length,
                                                                              params);
 
         if (context->skipValidation() ||
             ValidateGetPointervRobustANGLERobustANGLE(context, pname, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getPointervRobustANGLERobust(pname, bufSize, length, params);
         }
     }
@@ -1563,9 +1734,11 @@ void GL_APIENTRY ReadnPixelsRobustANGLE(GLint x,
         "columns = 0x%0.8p, GLsizei * rows = 0x%0.8p, void * data = 0x%0.8p)",
         x, y, width, height, format, type, bufSize, length, columns, rows, data);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ReadnPixelsRobustANGLE);
         context->gatherParams<EntryPoint::ReadnPixelsRobustANGLE>(
             x, y, width, height, format, type, bufSize, length, columns, rows, data);
 
@@ -1573,6 +1746,7 @@ void GL_APIENTRY ReadnPixelsRobustANGLE(GLint x,
             ValidateReadnPixelsRobustANGLE(context, x, y, width, height, format, type, bufSize,
                                            length, columns, rows, data))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->readnPixelsRobust(x, y, width, height, format, type, bufSize, length, columns,
                                        rows, data);
         }
@@ -1590,15 +1764,18 @@ void GL_APIENTRY GetnUniformfvRobustANGLE(GLuint program,
         "0x%0.8p, GLfloat * params = 0x%0.8p)",
         program, location, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetnUniformfvRobustANGLE);
         context->gatherParams<EntryPoint::GetnUniformfvRobustANGLE>(program, location, bufSize,
                                                                     length, params);
 
         if (context->skipValidation() ||
             ValidateGetnUniformfvRobustANGLE(context, program, location, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getnUniformfvRobust(program, location, bufSize, length, params);
         }
     }
@@ -1615,15 +1792,18 @@ void GL_APIENTRY GetnUniformivRobustANGLE(GLuint program,
         "0x%0.8p, GLint * params = 0x%0.8p)",
         program, location, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetnUniformivRobustANGLE);
         context->gatherParams<EntryPoint::GetnUniformivRobustANGLE>(program, location, bufSize,
                                                                     length, params);
 
         if (context->skipValidation() ||
             ValidateGetnUniformivRobustANGLE(context, program, location, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getnUniformivRobust(program, location, bufSize, length, params);
         }
     }
@@ -1640,15 +1820,18 @@ void GL_APIENTRY GetnUniformuivRobustANGLE(GLuint program,
         "0x%0.8p, GLuint * params = 0x%0.8p)",
         program, location, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetnUniformuivRobustANGLE);
         context->gatherParams<EntryPoint::GetnUniformuivRobustANGLE>(program, location, bufSize,
                                                                      length, params);
 
         if (context->skipValidation() ||
             ValidateGetnUniformuivRobustANGLE(context, program, location, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getnUniformuivRobust(program, location, bufSize, length, params);
         }
     }
@@ -1664,9 +1847,11 @@ void GL_APIENTRY TexParameterIivRobustANGLE(GLenum target,
         "0x%0.8p)",
         target, pname, bufSize, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexParameterIivRobustANGLE);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::TexParameterIivRobustANGLE>(targetPacked, pname, bufSize,
                                                                       params);
@@ -1674,6 +1859,7 @@ void GL_APIENTRY TexParameterIivRobustANGLE(GLenum target,
         if (context->skipValidation() ||
             ValidateTexParameterIivRobustANGLE(context, targetPacked, pname, bufSize, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texParameterIivRobust(targetPacked, pname, bufSize, params);
         }
     }
@@ -1689,9 +1875,11 @@ void GL_APIENTRY TexParameterIuivRobustANGLE(GLenum target,
         "0x%0.8p)",
         target, pname, bufSize, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexParameterIuivRobustANGLE);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::TexParameterIuivRobustANGLE>(targetPacked, pname, bufSize,
                                                                        params);
@@ -1699,6 +1887,7 @@ void GL_APIENTRY TexParameterIuivRobustANGLE(GLenum target,
         if (context->skipValidation() ||
             ValidateTexParameterIuivRobustANGLE(context, targetPacked, pname, bufSize, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texParameterIuivRobust(targetPacked, pname, bufSize, params);
         }
     }
@@ -1715,9 +1904,11 @@ void GL_APIENTRY GetTexParameterIivRobustANGLE(GLenum target,
         "0x%0.8p, GLint * params = 0x%0.8p)",
         target, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetTexParameterIivRobustANGLE);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::GetTexParameterIivRobustANGLE>(targetPacked, pname,
                                                                          bufSize, length, params);
@@ -1725,6 +1916,7 @@ void GL_APIENTRY GetTexParameterIivRobustANGLE(GLenum target,
         if (context->skipValidation() || ValidateGetTexParameterIivRobustANGLE(
                                              context, targetPacked, pname, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getTexParameterIivRobust(targetPacked, pname, bufSize, length, params);
         }
     }
@@ -1741,9 +1933,11 @@ void GL_APIENTRY GetTexParameterIuivRobustANGLE(GLenum target,
         "0x%0.8p, GLuint * params = 0x%0.8p)",
         target, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetTexParameterIuivRobustANGLE);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::GetTexParameterIuivRobustANGLE>(targetPacked, pname,
                                                                           bufSize, length, params);
@@ -1751,6 +1945,7 @@ void GL_APIENTRY GetTexParameterIuivRobustANGLE(GLenum target,
         if (context->skipValidation() || ValidateGetTexParameterIuivRobustANGLE(
                                              context, targetPacked, pname, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getTexParameterIuivRobust(targetPacked, pname, bufSize, length, params);
         }
     }
@@ -1766,15 +1961,18 @@ void GL_APIENTRY SamplerParameterIivRobustANGLE(GLuint sampler,
         "0x%0.8p)",
         sampler, pname, bufSize, param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::SamplerParameterIivRobustANGLE);
         context->gatherParams<EntryPoint::SamplerParameterIivRobustANGLE>(sampler, pname, bufSize,
                                                                           param);
 
         if (context->skipValidation() ||
             ValidateSamplerParameterIivRobustANGLE(context, sampler, pname, bufSize, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->samplerParameterIivRobust(sampler, pname, bufSize, param);
         }
     }
@@ -1790,15 +1988,18 @@ void GL_APIENTRY SamplerParameterIuivRobustANGLE(GLuint sampler,
         "0x%0.8p)",
         sampler, pname, bufSize, param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::SamplerParameterIuivRobustANGLE);
         context->gatherParams<EntryPoint::SamplerParameterIuivRobustANGLE>(sampler, pname, bufSize,
                                                                            param);
 
         if (context->skipValidation() ||
             ValidateSamplerParameterIuivRobustANGLE(context, sampler, pname, bufSize, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->samplerParameterIuivRobust(sampler, pname, bufSize, param);
         }
     }
@@ -1815,15 +2016,18 @@ void GL_APIENTRY GetSamplerParameterIivRobustANGLE(GLuint sampler,
         "0x%0.8p, GLint * params = 0x%0.8p)",
         sampler, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetSamplerParameterIivRobustANGLE);
         context->gatherParams<EntryPoint::GetSamplerParameterIivRobustANGLE>(
             sampler, pname, bufSize, length, params);
 
         if (context->skipValidation() || ValidateGetSamplerParameterIivRobustANGLE(
                                              context, sampler, pname, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getSamplerParameterIivRobust(sampler, pname, bufSize, length, params);
         }
     }
@@ -1840,15 +2044,18 @@ void GL_APIENTRY GetSamplerParameterIuivRobustANGLE(GLuint sampler,
         "0x%0.8p, GLuint * params = 0x%0.8p)",
         sampler, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetSamplerParameterIuivRobustANGLE);
         context->gatherParams<EntryPoint::GetSamplerParameterIuivRobustANGLE>(
             sampler, pname, bufSize, length, params);
 
         if (context->skipValidation() || ValidateGetSamplerParameterIuivRobustANGLE(
                                              context, sampler, pname, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getSamplerParameterIuivRobust(sampler, pname, bufSize, length, params);
         }
     }
@@ -1865,15 +2072,18 @@ void GL_APIENTRY GetQueryObjectivRobustANGLE(GLuint id,
         "GLint * params = 0x%0.8p)",
         id, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetQueryObjectivRobustANGLE);
         context->gatherParams<EntryPoint::GetQueryObjectivRobustANGLE>(id, pname, bufSize, length,
                                                                        params);
 
         if (context->skipValidation() ||
             ValidateGetQueryObjectivRobustANGLE(context, id, pname, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getQueryObjectivRobust(id, pname, bufSize, length, params);
         }
     }
@@ -1890,15 +2100,18 @@ void GL_APIENTRY GetQueryObjecti64vRobustANGLE(GLuint id,
         "GLint64 * params = 0x%0.8p)",
         id, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetQueryObjecti64vRobustANGLE);
         context->gatherParams<EntryPoint::GetQueryObjecti64vRobustANGLE>(id, pname, bufSize, length,
                                                                          params);
 
         if (context->skipValidation() ||
             ValidateGetQueryObjecti64vRobustANGLE(context, id, pname, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getQueryObjecti64vRobust(id, pname, bufSize, length, params);
         }
     }
@@ -1915,15 +2128,18 @@ void GL_APIENTRY GetQueryObjectui64vRobustANGLE(GLuint id,
         "GLuint64 * params = 0x%0.8p)",
         id, pname, bufSize, length, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetQueryObjectui64vRobustANGLE);
         context->gatherParams<EntryPoint::GetQueryObjectui64vRobustANGLE>(id, pname, bufSize,
                                                                           length, params);
 
         if (context->skipValidation() ||
             ValidateGetQueryObjectui64vRobustANGLE(context, id, pname, bufSize, length, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getQueryObjectui64vRobust(id, pname, bufSize, length, params);
         }
     }
@@ -1940,15 +2156,18 @@ void GL_APIENTRY GetTranslatedShaderSourceANGLE(GLuint shader,
         "0x%0.8p)",
         shader, bufsize, length, source);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetTranslatedShaderSourceANGLE);
         context->gatherParams<EntryPoint::GetTranslatedShaderSourceANGLE>(shader, bufsize, length,
                                                                           source);
 
         if (context->skipValidation() ||
             ValidateGetTranslatedShaderSourceANGLE(context, shader, bufsize, length, source))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getTranslatedShaderSource(shader, bufsize, length, source);
         }
     }
@@ -1960,14 +2179,17 @@ void GL_APIENTRY BindUniformLocationCHROMIUM(GLuint program, GLint location, con
     EVENT("(GLuint program = %u, GLint location = %d, const GLchar* name = 0x%0.8p)", program,
           location, name);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::BindUniformLocationCHROMIUM);
         context->gatherParams<EntryPoint::BindUniformLocationCHROMIUM>(program, location, name);
 
         if (context->skipValidation() ||
             ValidateBindUniformLocationCHROMIUM(context, program, location, name))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->bindUniformLocation(program, location, name);
         }
     }
@@ -1978,14 +2200,17 @@ void GL_APIENTRY CompressedCopyTextureCHROMIUM(GLuint sourceId, GLuint destId)
 {
     EVENT("(GLuint sourceId = %u, GLuint destId = %u)", sourceId, destId);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::CompressedCopyTextureCHROMIUM);
         context->gatherParams<EntryPoint::CompressedCopyTextureCHROMIUM>(sourceId, destId);
 
         if (context->skipValidation() ||
             ValidateCompressedCopyTextureCHROMIUM(context, sourceId, destId))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->compressedCopyTexture(sourceId, destId);
         }
     }
@@ -2011,9 +2236,11 @@ void GL_APIENTRY CopyTextureCHROMIUM(GLuint sourceId,
         sourceId, sourceLevel, destTarget, destId, destLevel, internalFormat, destType, unpackFlipY,
         unpackPremultiplyAlpha, unpackUnmultiplyAlpha);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::CopyTextureCHROMIUM);
         TextureTarget destTargetPacked = FromGLenum<TextureTarget>(destTarget);
         context->gatherParams<EntryPoint::CopyTextureCHROMIUM>(
             sourceId, sourceLevel, destTargetPacked, destId, destLevel, internalFormat, destType,
@@ -2024,6 +2251,7 @@ void GL_APIENTRY CopyTextureCHROMIUM(GLuint sourceId,
                                         destLevel, internalFormat, destType, unpackFlipY,
                                         unpackPremultiplyAlpha, unpackUnmultiplyAlpha))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->copyTexture(sourceId, sourceLevel, destTargetPacked, destId, destLevel,
                                  internalFormat, destType, unpackFlipY, unpackPremultiplyAlpha,
                                  unpackUnmultiplyAlpha);
@@ -2054,9 +2282,11 @@ void GL_APIENTRY CopySubTextureCHROMIUM(GLuint sourceId,
         sourceId, sourceLevel, destTarget, destId, destLevel, xoffset, yoffset, x, y, width, height,
         unpackFlipY, unpackPremultiplyAlpha, unpackUnmultiplyAlpha);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::CopySubTextureCHROMIUM);
         TextureTarget destTargetPacked = FromGLenum<TextureTarget>(destTarget);
         context->gatherParams<EntryPoint::CopySubTextureCHROMIUM>(
             sourceId, sourceLevel, destTargetPacked, destId, destLevel, xoffset, yoffset, x, y,
@@ -2068,6 +2298,7 @@ void GL_APIENTRY CopySubTextureCHROMIUM(GLuint sourceId,
                                            unpackFlipY, unpackPremultiplyAlpha,
                                            unpackUnmultiplyAlpha))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->copySubTexture(sourceId, sourceLevel, destTargetPacked, destId, destLevel,
                                     xoffset, yoffset, x, y, width, height, unpackFlipY,
                                     unpackPremultiplyAlpha, unpackUnmultiplyAlpha);
@@ -2080,13 +2311,16 @@ void GL_APIENTRY CoverageModulationCHROMIUM(GLenum components)
 {
     EVENT("(GLenum components = 0x%X)", components);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::CoverageModulationCHROMIUM);
         context->gatherParams<EntryPoint::CoverageModulationCHROMIUM>(components);
 
         if (context->skipValidation() || ValidateCoverageModulationCHROMIUM(context, components))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->coverageModulation(components);
         }
     }
@@ -2096,13 +2330,16 @@ void GL_APIENTRY MatrixLoadfCHROMIUM(GLenum matrixMode, const GLfloat *matrix)
 {
     EVENT("(GLenum matrixMode = 0x%X, const GLfloat * matrix = 0x%0.8p)", matrixMode, matrix);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::MatrixLoadfCHROMIUM);
         context->gatherParams<EntryPoint::MatrixLoadfCHROMIUM>(matrixMode, matrix);
 
         if (context->skipValidation() || ValidateMatrixLoadfCHROMIUM(context, matrixMode, matrix))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->matrixLoadf(matrixMode, matrix);
         }
     }
@@ -2112,13 +2349,16 @@ void GL_APIENTRY MatrixLoadIdentityCHROMIUM(GLenum matrixMode)
 {
     EVENT("(GLenum matrixMode = 0x%X)", matrixMode);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::MatrixLoadIdentityCHROMIUM);
         context->gatherParams<EntryPoint::MatrixLoadIdentityCHROMIUM>(matrixMode);
 
         if (context->skipValidation() || ValidateMatrixLoadIdentityCHROMIUM(context, matrixMode))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->matrixLoadIdentity(matrixMode);
         }
     }
@@ -2129,13 +2369,16 @@ GLuint GL_APIENTRY GenPathsCHROMIUM(GLsizei range)
 {
     EVENT("(GLsizei range = %d)", range);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GenPathsCHROMIUM);
         context->gatherParams<EntryPoint::GenPathsCHROMIUM>(range);
 
         if (context->skipValidation() || ValidateGenPathsCHROMIUM(context, range))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->genPaths(range);
         }
     }
@@ -2147,13 +2390,16 @@ void GL_APIENTRY DeletePathsCHROMIUM(GLuint first, GLsizei range)
 {
     EVENT("(GLuint first = %u, GLsizei range = %d)", first, range);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DeletePathsCHROMIUM);
         context->gatherParams<EntryPoint::DeletePathsCHROMIUM>(first, range);
 
         if (context->skipValidation() || ValidateDeletePathsCHROMIUM(context, first, range))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->deletePaths(first, range);
         }
     }
@@ -2163,13 +2409,16 @@ GLboolean GL_APIENTRY IsPathCHROMIUM(GLuint path)
 {
     EVENT("(GLuint path = %u)", path);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::IsPathCHROMIUM);
         context->gatherParams<EntryPoint::IsPathCHROMIUM>(path);
 
         if (context->skipValidation() || ValidateIsPathCHROMIUM(context, path))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->isPath(path);
         }
     }
@@ -2189,9 +2438,11 @@ void GL_APIENTRY PathCommandsCHROMIUM(GLuint path,
         "numCoords = %d, GLenum coordType = 0x%X, const void* coords = 0x%0.8p)",
         path, numCommands, commands, numCoords, coordType, coords);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::PathCommandsCHROMIUM);
         context->gatherParams<EntryPoint::PathCommandsCHROMIUM>(path, numCommands, commands,
                                                                 numCoords, coordType, coords);
 
@@ -2199,6 +2450,7 @@ void GL_APIENTRY PathCommandsCHROMIUM(GLuint path,
             ValidatePathCommandsCHROMIUM(context, path, numCommands, commands, numCoords, coordType,
                                          coords))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->pathCommands(path, numCommands, commands, numCoords, coordType, coords);
         }
     }
@@ -2208,14 +2460,17 @@ void GL_APIENTRY PathParameterfCHROMIUM(GLuint path, GLenum pname, GLfloat value
 {
     EVENT("(GLuint path = %u, GLenum pname = 0x%X, GLfloat value = %f)", path, pname, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::PathParameterfCHROMIUM);
         context->gatherParams<EntryPoint::PathParameterfCHROMIUM>(path, pname, value);
 
         if (context->skipValidation() ||
             ValidatePathParameterfCHROMIUM(context, path, pname, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->pathParameterf(path, pname, value);
         }
     }
@@ -2225,14 +2480,17 @@ void GL_APIENTRY PathParameteriCHROMIUM(GLuint path, GLenum pname, GLint value)
 {
     EVENT("(GLuint path = %u, GLenum pname = 0x%X, GLint value = %d)", path, pname, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::PathParameteriCHROMIUM);
         context->gatherParams<EntryPoint::PathParameteriCHROMIUM>(path, pname, value);
 
         if (context->skipValidation() ||
             ValidatePathParameteriCHROMIUM(context, path, pname, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->pathParameteri(path, pname, value);
         }
     }
@@ -2242,14 +2500,17 @@ void GL_APIENTRY GetPathParameterfvCHROMIUM(GLuint path, GLenum pname, GLfloat *
 {
     EVENT("(GLuint path = %u, GLenum pname = 0x%X, GLfloat * value = 0x%0.8p)", path, pname, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetPathParameterfvCHROMIUM);
         context->gatherParams<EntryPoint::GetPathParameterfvCHROMIUM>(path, pname, value);
 
         if (context->skipValidation() ||
             ValidateGetPathParameterfvCHROMIUM(context, path, pname, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getPathParameterfv(path, pname, value);
         }
     }
@@ -2259,14 +2520,17 @@ void GL_APIENTRY GetPathParameterivCHROMIUM(GLuint path, GLenum pname, GLint *va
 {
     EVENT("(GLuint path = %u, GLenum pname = 0x%X, GLint * value = 0x%0.8p)", path, pname, value);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetPathParameterivCHROMIUM);
         context->gatherParams<EntryPoint::GetPathParameterivCHROMIUM>(path, pname, value);
 
         if (context->skipValidation() ||
             ValidateGetPathParameterivCHROMIUM(context, path, pname, value))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getPathParameteriv(path, pname, value);
         }
     }
@@ -2276,13 +2540,16 @@ void GL_APIENTRY PathStencilFuncCHROMIUM(GLenum func, GLint ref, GLuint mask)
 {
     EVENT("(GLenum func = 0x%X, GLint ref = %d, GLuint mask = %u)", func, ref, mask);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::PathStencilFuncCHROMIUM);
         context->gatherParams<EntryPoint::PathStencilFuncCHROMIUM>(func, ref, mask);
 
         if (context->skipValidation() || ValidatePathStencilFuncCHROMIUM(context, func, ref, mask))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->pathStencilFunc(func, ref, mask);
         }
     }
@@ -2292,14 +2559,17 @@ void GL_APIENTRY StencilFillPathCHROMIUM(GLuint path, GLenum fillMode, GLuint ma
 {
     EVENT("(GLuint path = %u, GLenum fillMode = 0x%X, GLuint mask = %u)", path, fillMode, mask);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::StencilFillPathCHROMIUM);
         context->gatherParams<EntryPoint::StencilFillPathCHROMIUM>(path, fillMode, mask);
 
         if (context->skipValidation() ||
             ValidateStencilFillPathCHROMIUM(context, path, fillMode, mask))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->stencilFillPath(path, fillMode, mask);
         }
     }
@@ -2309,14 +2579,17 @@ void GL_APIENTRY StencilStrokePathCHROMIUM(GLuint path, GLint reference, GLuint
 {
     EVENT("(GLuint path = %u, GLint reference = %d, GLuint mask = %u)", path, reference, mask);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::StencilStrokePathCHROMIUM);
         context->gatherParams<EntryPoint::StencilStrokePathCHROMIUM>(path, reference, mask);
 
         if (context->skipValidation() ||
             ValidateStencilStrokePathCHROMIUM(context, path, reference, mask))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->stencilStrokePath(path, reference, mask);
         }
     }
@@ -2326,13 +2599,16 @@ void GL_APIENTRY CoverFillPathCHROMIUM(GLuint path, GLenum coverMode)
 {
     EVENT("(GLuint path = %u, GLenum coverMode = 0x%X)", path, coverMode);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::CoverFillPathCHROMIUM);
         context->gatherParams<EntryPoint::CoverFillPathCHROMIUM>(path, coverMode);
 
         if (context->skipValidation() || ValidateCoverFillPathCHROMIUM(context, path, coverMode))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->coverFillPath(path, coverMode);
         }
     }
@@ -2342,13 +2618,16 @@ void GL_APIENTRY CoverStrokePathCHROMIUM(GLuint path, GLenum coverMode)
 {
     EVENT("(GLuint path = %u, GLenum coverMode = 0x%X)", path, coverMode);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::CoverStrokePathCHROMIUM);
         context->gatherParams<EntryPoint::CoverStrokePathCHROMIUM>(path, coverMode);
 
         if (context->skipValidation() || ValidateCoverStrokePathCHROMIUM(context, path, coverMode))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->coverStrokePath(path, coverMode);
         }
     }
@@ -2362,15 +2641,18 @@ void GL_APIENTRY StencilThenCoverFillPathCHROMIUM(GLuint path,
     EVENT("(GLuint path = %u, GLenum fillMode = 0x%X, GLuint mask = %u, GLenum coverMode = 0x%X)",
           path, fillMode, mask, coverMode);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::StencilThenCoverFillPathCHROMIUM);
         context->gatherParams<EntryPoint::StencilThenCoverFillPathCHROMIUM>(path, fillMode, mask,
                                                                             coverMode);
 
         if (context->skipValidation() ||
             ValidateStencilThenCoverFillPathCHROMIUM(context, path, fillMode, mask, coverMode))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->stencilThenCoverFillPath(path, fillMode, mask, coverMode);
         }
     }
@@ -2384,15 +2666,18 @@ void GL_APIENTRY StencilThenCoverStrokePathCHROMIUM(GLuint path,
     EVENT("(GLuint path = %u, GLint reference = %d, GLuint mask = %u, GLenum coverMode = 0x%X)",
           path, reference, mask, coverMode);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::StencilThenCoverStrokePathCHROMIUM);
         context->gatherParams<EntryPoint::StencilThenCoverStrokePathCHROMIUM>(path, reference, mask,
                                                                               coverMode);
 
         if (context->skipValidation() ||
             ValidateStencilThenCoverStrokePathCHROMIUM(context, path, reference, mask, coverMode))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->stencilThenCoverStrokePath(path, reference, mask, coverMode);
         }
     }
@@ -2412,9 +2697,11 @@ void GL_APIENTRY CoverFillPathInstancedCHROMIUM(GLsizei numPath,
         "transformValues = 0x%0.8p)",
         numPath, pathNameType, paths, pathBase, coverMode, transformType, transformValues);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::CoverFillPathInstancedCHROMIUM);
         context->gatherParams<EntryPoint::CoverFillPathInstancedCHROMIUM>(
             numPath, pathNameType, paths, pathBase, coverMode, transformType, transformValues);
 
@@ -2422,6 +2709,7 @@ void GL_APIENTRY CoverFillPathInstancedCHROMIUM(GLsizei numPath,
             ValidateCoverFillPathInstancedCHROMIUM(context, numPath, pathNameType, paths, pathBase,
                                                    coverMode, transformType, transformValues))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->coverFillPathInstanced(numPath, pathNameType, paths, pathBase, coverMode,
                                             transformType, transformValues);
         }
@@ -2442,9 +2730,11 @@ void GL_APIENTRY CoverStrokePathInstancedCHROMIUM(GLsizei numPath,
         "transformValues = 0x%0.8p)",
         numPath, pathNameType, paths, pathBase, coverMode, transformType, transformValues);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::CoverStrokePathInstancedCHROMIUM);
         context->gatherParams<EntryPoint::CoverStrokePathInstancedCHROMIUM>(
             numPath, pathNameType, paths, pathBase, coverMode, transformType, transformValues);
 
@@ -2452,6 +2742,7 @@ void GL_APIENTRY CoverStrokePathInstancedCHROMIUM(GLsizei numPath,
                                              context, numPath, pathNameType, paths, pathBase,
                                              coverMode, transformType, transformValues))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->coverStrokePathInstanced(numPath, pathNameType, paths, pathBase, coverMode,
                                               transformType, transformValues);
         }
@@ -2473,9 +2764,11 @@ void GL_APIENTRY StencilStrokePathInstancedCHROMIUM(GLsizei numPath,
         "GLfloat * transformValues = 0x%0.8p)",
         numPath, pathNameType, paths, pathBase, reference, mask, transformType, transformValues);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::StencilStrokePathInstancedCHROMIUM);
         context->gatherParams<EntryPoint::StencilStrokePathInstancedCHROMIUM>(
             numPath, pathNameType, paths, pathBase, reference, mask, transformType,
             transformValues);
@@ -2484,6 +2777,7 @@ void GL_APIENTRY StencilStrokePathInstancedCHROMIUM(GLsizei numPath,
                                              context, numPath, pathNameType, paths, pathBase,
                                              reference, mask, transformType, transformValues))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->stencilStrokePathInstanced(numPath, pathNameType, paths, pathBase, reference,
                                                 mask, transformType, transformValues);
         }
@@ -2505,9 +2799,11 @@ void GL_APIENTRY StencilFillPathInstancedCHROMIUM(GLsizei numPaths,
         "const GLfloat * transformValues = 0x%0.8p)",
         numPaths, pathNameType, paths, pathBase, fillMode, mask, transformType, transformValues);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::StencilFillPathInstancedCHROMIUM);
         context->gatherParams<EntryPoint::StencilFillPathInstancedCHROMIUM>(
             numPaths, pathNameType, paths, pathBase, fillMode, mask, transformType,
             transformValues);
@@ -2516,6 +2812,7 @@ void GL_APIENTRY StencilFillPathInstancedCHROMIUM(GLsizei numPaths,
                                              context, numPaths, pathNameType, paths, pathBase,
                                              fillMode, mask, transformType, transformValues))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->stencilFillPathInstanced(numPaths, pathNameType, paths, pathBase, fillMode,
                                               mask, transformType, transformValues);
         }
@@ -2539,9 +2836,11 @@ void GL_APIENTRY StencilThenCoverFillPathInstancedCHROMIUM(GLsizei numPaths,
         numPaths, pathNameType, paths, pathBase, fillMode, mask, coverMode, transformType,
         transformValues);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::StencilThenCoverFillPathInstancedCHROMIUM);
         context->gatherParams<EntryPoint::StencilThenCoverFillPathInstancedCHROMIUM>(
             numPaths, pathNameType, paths, pathBase, fillMode, mask, coverMode, transformType,
             transformValues);
@@ -2551,6 +2850,7 @@ void GL_APIENTRY StencilThenCoverFillPathInstancedCHROMIUM(GLsizei numPaths,
                 context, numPaths, pathNameType, paths, pathBase, fillMode, mask, coverMode,
                 transformType, transformValues))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->stencilThenCoverFillPathInstanced(numPaths, pathNameType, paths, pathBase,
                                                        fillMode, mask, coverMode, transformType,
                                                        transformValues);
@@ -2575,9 +2875,11 @@ void GL_APIENTRY StencilThenCoverStrokePathInstancedCHROMIUM(GLsizei numPaths,
         numPaths, pathNameType, paths, pathBase, reference, mask, coverMode, transformType,
         transformValues);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::StencilThenCoverStrokePathInstancedCHROMIUM);
         context->gatherParams<EntryPoint::StencilThenCoverStrokePathInstancedCHROMIUM>(
             numPaths, pathNameType, paths, pathBase, reference, mask, coverMode, transformType,
             transformValues);
@@ -2587,6 +2889,7 @@ void GL_APIENTRY StencilThenCoverStrokePathInstancedCHROMIUM(GLsizei numPaths,
                 context, numPaths, pathNameType, paths, pathBase, reference, mask, coverMode,
                 transformType, transformValues))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->stencilThenCoverStrokePathInstanced(numPaths, pathNameType, paths, pathBase,
                                                          reference, mask, coverMode, transformType,
                                                          transformValues);
@@ -2601,15 +2904,18 @@ void GL_APIENTRY BindFragmentInputLocationCHROMIUM(GLuint programs,
     EVENT("(GLuint programs = %u, GLint location = %d, const GLchar * name = 0x%0.8p)", programs,
           location, name);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::BindFragmentInputLocationCHROMIUM);
         context->gatherParams<EntryPoint::BindFragmentInputLocationCHROMIUM>(programs, location,
                                                                              name);
 
         if (context->skipValidation() ||
             ValidateBindFragmentInputLocationCHROMIUM(context, programs, location, name))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->bindFragmentInputLocation(programs, location, name);
         }
     }
@@ -2626,9 +2932,11 @@ void GL_APIENTRY ProgramPathFragmentInputGenCHROMIUM(GLuint program,
         "const GLfloat * coeffs = 0x%0.8p)",
         program, location, genMode, components, coeffs);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramPathFragmentInputGenCHROMIUM);
         context->gatherParams<EntryPoint::ProgramPathFragmentInputGenCHROMIUM>(
             program, location, genMode, components, coeffs);
 
@@ -2636,6 +2944,7 @@ void GL_APIENTRY ProgramPathFragmentInputGenCHROMIUM(GLuint program,
             ValidateProgramPathFragmentInputGenCHROMIUM(context, program, location, genMode,
                                                         components, coeffs))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programPathFragmentInputGen(program, location, genMode, components, coeffs);
         }
     }
@@ -2648,13 +2957,16 @@ void GL_APIENTRY InsertEventMarkerEXT(GLsizei length, const GLchar *marker)
     // It can interfere with the debug events being set by the caller.
     // EVENT("(GLsizei length = %d, const GLchar *marker = 0x%0.8p)", length, marker);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::InsertEventMarkerEXT);
         context->gatherParams<EntryPoint::InsertEventMarkerEXT>(length, marker);
 
         if (context->skipValidation() || ValidateInsertEventMarkerEXT(context, length, marker))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->insertEventMarker(length, marker);
         }
     }
@@ -2666,13 +2978,16 @@ void GL_APIENTRY PopGroupMarkerEXT()
     // It can interfere with the debug events being set by the caller.
     // EVENT("()");
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::PopGroupMarkerEXT);
         context->gatherParams<EntryPoint::PopGroupMarkerEXT>();
 
         if (context->skipValidation() || ValidatePopGroupMarkerEXT(context))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->popGroupMarker();
         }
     }
@@ -2684,13 +2999,16 @@ void GL_APIENTRY PushGroupMarkerEXT(GLsizei length, const GLchar *marker)
     // It can interfere with the debug events being set by the caller.
     // EVENT("(GLsizei length = %d, const GLchar *marker = 0x%0.8p)", length, marker);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::PushGroupMarkerEXT);
         context->gatherParams<EntryPoint::PushGroupMarkerEXT>(length, marker);
 
         if (context->skipValidation() || ValidatePushGroupMarkerEXT(context, length, marker))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->pushGroupMarker(length, marker);
         }
     }
@@ -2705,15 +3023,18 @@ void GL_APIENTRY DiscardFramebufferEXT(GLenum target,
         "(GLenum target = 0x%X, GLsizei numAttachments = %d, const GLenum *attachments = 0x%0.8p)",
         target, numAttachments, attachments);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DiscardFramebufferEXT);
         context->gatherParams<EntryPoint::DiscardFramebufferEXT>(target, numAttachments,
                                                                  attachments);
 
         if (context->skipValidation() ||
             ValidateDiscardFramebufferEXT(context, target, numAttachments, attachments))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->discardFramebuffer(target, numAttachments, attachments);
         }
     }
@@ -2724,14 +3045,17 @@ void GL_APIENTRY BeginQueryEXT(GLenum target, GLuint id)
 {
     EVENT("(GLenum target = 0x%X, GLuint id = %u)", target, id);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::BeginQueryEXT);
         QueryType targetPacked = FromGLenum<QueryType>(target);
         context->gatherParams<EntryPoint::BeginQueryEXT>(targetPacked, id);
 
         if (context->skipValidation() || ValidateBeginQueryEXT(context, targetPacked, id))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->beginQuery(targetPacked, id);
         }
     }
@@ -2741,13 +3065,16 @@ void GL_APIENTRY DeleteQueriesEXT(GLsizei n, const GLuint *ids)
 {
     EVENT("(GLsizei n = %d, const GLuint *ids = 0x%0.8p)", n, ids);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DeleteQueriesEXT);
         context->gatherParams<EntryPoint::DeleteQueriesEXT>(n, ids);
 
         if (context->skipValidation() || ValidateDeleteQueriesEXT(context, n, ids))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->deleteQueries(n, ids);
         }
     }
@@ -2757,14 +3084,17 @@ void GL_APIENTRY EndQueryEXT(GLenum target)
 {
     EVENT("(GLenum target = 0x%X)", target);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::EndQueryEXT);
         QueryType targetPacked = FromGLenum<QueryType>(target);
         context->gatherParams<EntryPoint::EndQueryEXT>(targetPacked);
 
         if (context->skipValidation() || ValidateEndQueryEXT(context, targetPacked))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->endQuery(targetPacked);
         }
     }
@@ -2774,13 +3104,16 @@ void GL_APIENTRY GenQueriesEXT(GLsizei n, GLuint *ids)
 {
     EVENT("(GLsizei n = %d, GLuint *ids = 0x%0.8p)", n, ids);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GenQueriesEXT);
         context->gatherParams<EntryPoint::GenQueriesEXT>(n, ids);
 
         if (context->skipValidation() || ValidateGenQueriesEXT(context, n, ids))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->genQueries(n, ids);
         }
     }
@@ -2790,13 +3123,16 @@ void GL_APIENTRY GetQueryObjecti64vEXT(GLuint id, GLenum pname, GLint64 *params)
 {
     EVENT("(GLuint id = %u, GLenum pname = 0x%X, GLint64 *params = 0x%0.8p)", id, pname, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetQueryObjecti64vEXT);
         context->gatherParams<EntryPoint::GetQueryObjecti64vEXT>(id, pname, params);
 
         if (context->skipValidation() || ValidateGetQueryObjecti64vEXT(context, id, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getQueryObjecti64v(id, pname, params);
         }
     }
@@ -2806,13 +3142,16 @@ void GL_APIENTRY GetQueryObjectivEXT(GLuint id, GLenum pname, GLint *params)
 {
     EVENT("(GLuint id = %u, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", id, pname, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetQueryObjectivEXT);
         context->gatherParams<EntryPoint::GetQueryObjectivEXT>(id, pname, params);
 
         if (context->skipValidation() || ValidateGetQueryObjectivEXT(context, id, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getQueryObjectiv(id, pname, params);
         }
     }
@@ -2822,13 +3161,16 @@ void GL_APIENTRY GetQueryObjectui64vEXT(GLuint id, GLenum pname, GLuint64 *param
 {
     EVENT("(GLuint id = %u, GLenum pname = 0x%X, GLuint64 *params = 0x%0.8p)", id, pname, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetQueryObjectui64vEXT);
         context->gatherParams<EntryPoint::GetQueryObjectui64vEXT>(id, pname, params);
 
         if (context->skipValidation() || ValidateGetQueryObjectui64vEXT(context, id, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getQueryObjectui64v(id, pname, params);
         }
     }
@@ -2838,13 +3180,16 @@ void GL_APIENTRY GetQueryObjectuivEXT(GLuint id, GLenum pname, GLuint *params)
 {
     EVENT("(GLuint id = %u, GLenum pname = 0x%X, GLuint *params = 0x%0.8p)", id, pname, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetQueryObjectuivEXT);
         context->gatherParams<EntryPoint::GetQueryObjectuivEXT>(id, pname, params);
 
         if (context->skipValidation() || ValidateGetQueryObjectuivEXT(context, id, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getQueryObjectuiv(id, pname, params);
         }
     }
@@ -2855,15 +3200,18 @@ void GL_APIENTRY GetQueryivEXT(GLenum target, GLenum pname, GLint *params)
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", target, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetQueryivEXT);
         QueryType targetPacked = FromGLenum<QueryType>(target);
         context->gatherParams<EntryPoint::GetQueryivEXT>(targetPacked, pname, params);
 
         if (context->skipValidation() ||
             ValidateGetQueryivEXT(context, targetPacked, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getQueryiv(targetPacked, pname, params);
         }
     }
@@ -2873,13 +3221,16 @@ GLboolean GL_APIENTRY IsQueryEXT(GLuint id)
 {
     EVENT("(GLuint id = %u)", id);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::IsQueryEXT);
         context->gatherParams<EntryPoint::IsQueryEXT>(id);
 
         if (context->skipValidation() || ValidateIsQueryEXT(context, id))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->isQuery(id);
         }
     }
@@ -2891,14 +3242,17 @@ void GL_APIENTRY QueryCounterEXT(GLuint id, GLenum target)
 {
     EVENT("(GLuint id = %u, GLenum target = 0x%X)", id, target);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::QueryCounterEXT);
         QueryType targetPacked = FromGLenum<QueryType>(target);
         context->gatherParams<EntryPoint::QueryCounterEXT>(id, targetPacked);
 
         if (context->skipValidation() || ValidateQueryCounterEXT(context, id, targetPacked))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->queryCounter(id, targetPacked);
         }
     }
@@ -2909,13 +3263,16 @@ void GL_APIENTRY DrawBuffersEXT(GLsizei n, const GLenum *bufs)
 {
     EVENT("(GLsizei n = %d, const GLenum *bufs = 0x%0.8p)", n, bufs);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DrawBuffersEXT);
         context->gatherParams<EntryPoint::DrawBuffersEXT>(n, bufs);
 
         if (context->skipValidation() || ValidateDrawBuffersEXT(context, n, bufs))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->drawBuffers(n, bufs);
         }
     }
@@ -2927,15 +3284,18 @@ void GL_APIENTRY FlushMappedBufferRangeEXT(GLenum target, GLintptr offset, GLsiz
     EVENT("(GLenum target = 0x%X, GLintptr offset = %d, GLsizeiptr length = %d)", target, offset,
           length);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::FlushMappedBufferRangeEXT);
         BufferBinding targetPacked = FromGLenum<BufferBinding>(target);
         context->gatherParams<EntryPoint::FlushMappedBufferRangeEXT>(targetPacked, offset, length);
 
         if (context->skipValidation() ||
             ValidateFlushMappedBufferRangeEXT(context, targetPacked, offset, length))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->flushMappedBufferRange(targetPacked, offset, length);
         }
     }
@@ -2951,15 +3311,18 @@ void *GL_APIENTRY MapBufferRangeEXT(GLenum target,
         "0x%X)",
         target, offset, length, access);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::MapBufferRangeEXT);
         BufferBinding targetPacked = FromGLenum<BufferBinding>(target);
         context->gatherParams<EntryPoint::MapBufferRangeEXT>(targetPacked, offset, length, access);
 
         if (context->skipValidation() ||
             ValidateMapBufferRangeEXT(context, targetPacked, offset, length, access))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->mapBufferRange(targetPacked, offset, length, access);
         }
     }
@@ -2987,13 +3350,16 @@ GLenum GL_APIENTRY GetGraphicsResetStatusEXT()
 {
     EVENT("()");
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetGraphicsResetStatusEXT);
         context->gatherParams<EntryPoint::GetGraphicsResetStatusEXT>();
 
         if (context->skipValidation() || ValidateGetGraphicsResetStatusEXT(context))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->getGraphicsResetStatus();
         }
     }
@@ -3008,14 +3374,17 @@ void GL_APIENTRY GetnUniformfvEXT(GLuint program, GLint location, GLsizei bufSiz
         "0x%0.8p)",
         program, location, bufSize, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetnUniformfvEXT);
         context->gatherParams<EntryPoint::GetnUniformfvEXT>(program, location, bufSize, params);
 
         if (context->skipValidation() ||
             ValidateGetnUniformfvEXT(context, program, location, bufSize, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getnUniformfv(program, location, bufSize, params);
         }
     }
@@ -3027,14 +3396,17 @@ void GL_APIENTRY GetnUniformivEXT(GLuint program, GLint location, GLsizei bufSiz
         "(GLuint program = %u, GLint location = %d, GLsizei bufSize = %d, GLint *params = 0x%0.8p)",
         program, location, bufSize, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetnUniformivEXT);
         context->gatherParams<EntryPoint::GetnUniformivEXT>(program, location, bufSize, params);
 
         if (context->skipValidation() ||
             ValidateGetnUniformivEXT(context, program, location, bufSize, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getnUniformiv(program, location, bufSize, params);
         }
     }
@@ -3054,15 +3426,18 @@ void GL_APIENTRY ReadnPixelsEXT(GLint x,
         "0x%X, GLenum type = 0x%X, GLsizei bufSize = %d, void *data = 0x%0.8p)",
         x, y, width, height, format, type, bufSize, data);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ReadnPixelsEXT);
         context->gatherParams<EntryPoint::ReadnPixelsEXT>(x, y, width, height, format, type,
                                                           bufSize, data);
 
         if (context->skipValidation() ||
             ValidateReadnPixelsEXT(context, x, y, width, height, format, type, bufSize, data))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->readnPixels(x, y, width, height, format, type, bufSize, data);
         }
     }
@@ -3079,14 +3454,17 @@ void GL_APIENTRY TexStorage1DEXT(GLenum target,
         "%d)",
         target, levels, internalformat, width);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexStorage1DEXT);
         context->gatherParams<EntryPoint::TexStorage1DEXT>(target, levels, internalformat, width);
 
         if (context->skipValidation() ||
             ValidateTexStorage1DEXT(context, target, levels, internalformat, width))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texStorage1D(target, levels, internalformat, width);
         }
     }
@@ -3100,9 +3478,11 @@ TexStorage2DEXT(GLenum target, GLsizei levels, GLenum internalformat, GLsizei wi
         "%d, GLsizei height = %d)",
         target, levels, internalformat, width, height);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexStorage2DEXT);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::TexStorage2DEXT>(targetPacked, levels, internalformat,
                                                            width, height);
@@ -3110,6 +3490,7 @@ TexStorage2DEXT(GLenum target, GLsizei levels, GLenum internalformat, GLsizei wi
         if (context->skipValidation() ||
             ValidateTexStorage2DEXT(context, targetPacked, levels, internalformat, width, height))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texStorage2D(targetPacked, levels, internalformat, width, height);
         }
     }
@@ -3127,9 +3508,11 @@ void GL_APIENTRY TexStorage3DEXT(GLenum target,
         "%d, GLsizei height = %d, GLsizei depth = %d)",
         target, levels, internalformat, width, height, depth);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexStorage3DEXT);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::TexStorage3DEXT>(targetPacked, levels, internalformat,
                                                            width, height, depth);
@@ -3138,6 +3521,7 @@ void GL_APIENTRY TexStorage3DEXT(GLenum target,
             ValidateTexStorage3DEXT(context, targetPacked, levels, internalformat, width, height,
                                     depth))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texStorage3D(targetPacked, levels, internalformat, width, height, depth);
         }
     }
@@ -3149,14 +3533,17 @@ void GL_APIENTRY DebugMessageCallbackKHR(GLDEBUGPROCKHR callback, const void *us
     EVENT("(GLDEBUGPROCKHR callback = 0x%0.8p, const void *userParam = 0x%0.8p)", callback,
           userParam);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DebugMessageCallbackKHR);
         context->gatherParams<EntryPoint::DebugMessageCallbackKHR>(callback, userParam);
 
         if (context->skipValidation() ||
             ValidateDebugMessageCallbackKHR(context, callback, userParam))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->debugMessageCallback(callback, userParam);
         }
     }
@@ -3174,15 +3561,18 @@ void GL_APIENTRY DebugMessageControlKHR(GLenum source,
         "const GLuint *ids = 0x%0.8p, GLboolean enabled = %u)",
         source, type, severity, count, ids, enabled);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DebugMessageControlKHR);
         context->gatherParams<EntryPoint::DebugMessageControlKHR>(source, type, severity, count,
                                                                   ids, enabled);
 
         if (context->skipValidation() ||
             ValidateDebugMessageControlKHR(context, source, type, severity, count, ids, enabled))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->debugMessageControl(source, type, severity, count, ids, enabled);
         }
     }
@@ -3200,15 +3590,18 @@ void GL_APIENTRY DebugMessageInsertKHR(GLenum source,
         "GLsizei length = %d, const GLchar *buf = 0x%0.8p)",
         source, type, id, severity, length, buf);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DebugMessageInsertKHR);
         context->gatherParams<EntryPoint::DebugMessageInsertKHR>(source, type, id, severity, length,
                                                                  buf);
 
         if (context->skipValidation() ||
             ValidateDebugMessageInsertKHR(context, source, type, id, severity, length, buf))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->debugMessageInsert(source, type, id, severity, length, buf);
         }
     }
@@ -3229,9 +3622,11 @@ GLuint GL_APIENTRY GetDebugMessageLogKHR(GLuint count,
         "GLchar *messageLog = 0x%0.8p)",
         count, bufSize, sources, types, ids, severities, lengths, messageLog);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetDebugMessageLogKHR);
         context->gatherParams<EntryPoint::GetDebugMessageLogKHR>(
             count, bufSize, sources, types, ids, severities, lengths, messageLog);
 
@@ -3239,6 +3634,7 @@ GLuint GL_APIENTRY GetDebugMessageLogKHR(GLuint count,
             ValidateGetDebugMessageLogKHR(context, count, bufSize, sources, types, ids, severities,
                                           lengths, messageLog))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->getDebugMessageLog(count, bufSize, sources, types, ids, severities,
                                                lengths, messageLog);
         }
@@ -3255,15 +3651,18 @@ GetObjectLabelKHR(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *leng
         "0x%0.8p, GLchar *label = 0x%0.8p)",
         identifier, name, bufSize, length, label);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetObjectLabelKHR);
         context->gatherParams<EntryPoint::GetObjectLabelKHR>(identifier, name, bufSize, length,
                                                              label);
 
         if (context->skipValidation() ||
             ValidateGetObjectLabelKHR(context, identifier, name, bufSize, length, label))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getObjectLabel(identifier, name, bufSize, length, label);
         }
     }
@@ -3279,14 +3678,17 @@ void GL_APIENTRY GetObjectPtrLabelKHR(const void *ptr,
         "*label = 0x%0.8p)",
         ptr, bufSize, length, label);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetObjectPtrLabelKHR);
         context->gatherParams<EntryPoint::GetObjectPtrLabelKHR>(ptr, bufSize, length, label);
 
         if (context->skipValidation() ||
             ValidateGetObjectPtrLabelKHR(context, ptr, bufSize, length, label))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getObjectPtrLabel(ptr, bufSize, length, label);
         }
     }
@@ -3296,13 +3698,16 @@ void GL_APIENTRY GetPointervKHR(GLenum pname, void **params)
 {
     EVENT("(GLenum pname = 0x%X, void **params = 0x%0.8p)", pname, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetPointervKHR);
         context->gatherParams<EntryPoint::GetPointervKHR>(pname, params);
 
         if (context->skipValidation() || ValidateGetPointervKHR(context, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getPointerv(pname, params);
         }
     }
@@ -3315,14 +3720,17 @@ void GL_APIENTRY ObjectLabelKHR(GLenum identifier, GLuint name, GLsizei length,
         "0x%0.8p)",
         identifier, name, length, label);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ObjectLabelKHR);
         context->gatherParams<EntryPoint::ObjectLabelKHR>(identifier, name, length, label);
 
         if (context->skipValidation() ||
             ValidateObjectLabelKHR(context, identifier, name, length, label))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->objectLabel(identifier, name, length, label);
         }
     }
@@ -3333,13 +3741,16 @@ void GL_APIENTRY ObjectPtrLabelKHR(const void *ptr, GLsizei length, const GLchar
     EVENT("(const void *ptr = 0x%0.8p, GLsizei length = %d, const GLchar *label = 0x%0.8p)", ptr,
           length, label);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ObjectPtrLabelKHR);
         context->gatherParams<EntryPoint::ObjectPtrLabelKHR>(ptr, length, label);
 
         if (context->skipValidation() || ValidateObjectPtrLabelKHR(context, ptr, length, label))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->objectPtrLabel(ptr, length, label);
         }
     }
@@ -3349,13 +3760,16 @@ void GL_APIENTRY PopDebugGroupKHR()
 {
     EVENT("()");
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::PopDebugGroupKHR);
         context->gatherParams<EntryPoint::PopDebugGroupKHR>();
 
         if (context->skipValidation() || ValidatePopDebugGroupKHR(context))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->popDebugGroup();
         }
     }
@@ -3368,14 +3782,17 @@ void GL_APIENTRY PushDebugGroupKHR(GLenum source, GLuint id, GLsizei length, con
         "0x%0.8p)",
         source, id, length, message);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::PushDebugGroupKHR);
         context->gatherParams<EntryPoint::PushDebugGroupKHR>(source, id, length, message);
 
         if (context->skipValidation() ||
             ValidatePushDebugGroupKHR(context, source, id, length, message))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->pushDebugGroup(source, id, length, message);
         }
     }
@@ -3386,13 +3803,16 @@ void GL_APIENTRY DeleteFencesNV(GLsizei n, const GLuint *fences)
 {
     EVENT("(GLsizei n = %d, const GLuint *fences = 0x%0.8p)", n, fences);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DeleteFencesNV);
         context->gatherParams<EntryPoint::DeleteFencesNV>(n, fences);
 
         if (context->skipValidation() || ValidateDeleteFencesNV(context, n, fences))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->deleteFencesNV(n, fences);
         }
     }
@@ -3402,13 +3822,16 @@ void GL_APIENTRY FinishFenceNV(GLuint fence)
 {
     EVENT("(GLuint fence = %u)", fence);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::FinishFenceNV);
         context->gatherParams<EntryPoint::FinishFenceNV>(fence);
 
         if (context->skipValidation() || ValidateFinishFenceNV(context, fence))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->finishFenceNV(fence);
         }
     }
@@ -3418,13 +3841,16 @@ void GL_APIENTRY GenFencesNV(GLsizei n, GLuint *fences)
 {
     EVENT("(GLsizei n = %d, GLuint *fences = 0x%0.8p)", n, fences);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GenFencesNV);
         context->gatherParams<EntryPoint::GenFencesNV>(n, fences);
 
         if (context->skipValidation() || ValidateGenFencesNV(context, n, fences))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->genFencesNV(n, fences);
         }
     }
@@ -3435,13 +3861,16 @@ void GL_APIENTRY GetFenceivNV(GLuint fence, GLenum pname, GLint *params)
     EVENT("(GLuint fence = %u, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", fence, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetFenceivNV);
         context->gatherParams<EntryPoint::GetFenceivNV>(fence, pname, params);
 
         if (context->skipValidation() || ValidateGetFenceivNV(context, fence, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getFenceivNV(fence, pname, params);
         }
     }
@@ -3451,13 +3880,16 @@ GLboolean GL_APIENTRY IsFenceNV(GLuint fence)
 {
     EVENT("(GLuint fence = %u)", fence);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::IsFenceNV);
         context->gatherParams<EntryPoint::IsFenceNV>(fence);
 
         if (context->skipValidation() || ValidateIsFenceNV(context, fence))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->isFenceNV(fence);
         }
     }
@@ -3469,13 +3901,16 @@ void GL_APIENTRY SetFenceNV(GLuint fence, GLenum condition)
 {
     EVENT("(GLuint fence = %u, GLenum condition = 0x%X)", fence, condition);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::SetFenceNV);
         context->gatherParams<EntryPoint::SetFenceNV>(fence, condition);
 
         if (context->skipValidation() || ValidateSetFenceNV(context, fence, condition))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->setFenceNV(fence, condition);
         }
     }
@@ -3485,13 +3920,16 @@ GLboolean GL_APIENTRY TestFenceNV(GLuint fence)
 {
     EVENT("(GLuint fence = %u)", fence);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TestFenceNV);
         context->gatherParams<EntryPoint::TestFenceNV>(fence);
 
         if (context->skipValidation() || ValidateTestFenceNV(context, fence))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->testFenceNV(fence);
         }
     }
@@ -3504,14 +3942,17 @@ void GL_APIENTRY EGLImageTargetRenderbufferStorageOES(GLenum target, GLeglImageO
 {
     EVENT("(GLenum target = 0x%X, GLeglImageOES image = 0x%0.8p)", target, image);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::EGLImageTargetRenderbufferStorageOES);
         context->gatherParams<EntryPoint::EGLImageTargetRenderbufferStorageOES>(target, image);
 
         if (context->skipValidation() ||
             ValidateEGLImageTargetRenderbufferStorageOES(context, target, image))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->eGLImageTargetRenderbufferStorage(target, image);
         }
     }
@@ -3521,15 +3962,18 @@ void GL_APIENTRY EGLImageTargetTexture2DOES(GLenum target, GLeglImageOES image)
 {
     EVENT("(GLenum target = 0x%X, GLeglImageOES image = 0x%0.8p)", target, image);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::EGLImageTargetTexture2DOES);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::EGLImageTargetTexture2DOES>(targetPacked, image);
 
         if (context->skipValidation() ||
             ValidateEGLImageTargetTexture2DOES(context, targetPacked, image))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->eGLImageTargetTexture2D(targetPacked, image);
         }
     }
@@ -3542,13 +3986,16 @@ void GL_APIENTRY DrawTexfOES(GLfloat x, GLfloat y, GLfloat z, GLfloat width, GLf
         "(GLfloat x = %f, GLfloat y = %f, GLfloat z = %f, GLfloat width = %f, GLfloat height = %f)",
         x, y, z, width, height);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DrawTexfOES);
         context->gatherParams<EntryPoint::DrawTexfOES>(x, y, z, width, height);
 
         if (context->skipValidation() || ValidateDrawTexfOES(context, x, y, z, width, height))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->drawTexf(x, y, z, width, height);
         }
     }
@@ -3558,13 +4005,16 @@ void GL_APIENTRY DrawTexfvOES(const GLfloat *coords)
 {
     EVENT("(const GLfloat *coords = 0x%0.8p)", coords);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DrawTexfvOES);
         context->gatherParams<EntryPoint::DrawTexfvOES>(coords);
 
         if (context->skipValidation() || ValidateDrawTexfvOES(context, coords))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->drawTexfv(coords);
         }
     }
@@ -3575,13 +4025,16 @@ void GL_APIENTRY DrawTexiOES(GLint x, GLint y, GLint z, GLint width, GLint heigh
     EVENT("(GLint x = %d, GLint y = %d, GLint z = %d, GLint width = %d, GLint height = %d)", x, y,
           z, width, height);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DrawTexiOES);
         context->gatherParams<EntryPoint::DrawTexiOES>(x, y, z, width, height);
 
         if (context->skipValidation() || ValidateDrawTexiOES(context, x, y, z, width, height))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->drawTexi(x, y, z, width, height);
         }
     }
@@ -3591,13 +4044,16 @@ void GL_APIENTRY DrawTexivOES(const GLint *coords)
 {
     EVENT("(const GLint *coords = 0x%0.8p)", coords);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DrawTexivOES);
         context->gatherParams<EntryPoint::DrawTexivOES>(coords);
 
         if (context->skipValidation() || ValidateDrawTexivOES(context, coords))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->drawTexiv(coords);
         }
     }
@@ -3609,13 +4065,16 @@ void GL_APIENTRY DrawTexsOES(GLshort x, GLshort y, GLshort z, GLshort width, GLs
         "(GLshort x = %d, GLshort y = %d, GLshort z = %d, GLshort width = %d, GLshort height = %d)",
         x, y, z, width, height);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DrawTexsOES);
         context->gatherParams<EntryPoint::DrawTexsOES>(x, y, z, width, height);
 
         if (context->skipValidation() || ValidateDrawTexsOES(context, x, y, z, width, height))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->drawTexs(x, y, z, width, height);
         }
     }
@@ -3625,13 +4084,16 @@ void GL_APIENTRY DrawTexsvOES(const GLshort *coords)
 {
     EVENT("(const GLshort *coords = 0x%0.8p)", coords);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DrawTexsvOES);
         context->gatherParams<EntryPoint::DrawTexsvOES>(coords);
 
         if (context->skipValidation() || ValidateDrawTexsvOES(context, coords))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->drawTexsv(coords);
         }
     }
@@ -3644,13 +4106,16 @@ void GL_APIENTRY DrawTexxOES(GLfixed x, GLfixed y, GLfixed z, GLfixed width, GLf
         "height = 0x%X)",
         x, y, z, width, height);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DrawTexxOES);
         context->gatherParams<EntryPoint::DrawTexxOES>(x, y, z, width, height);
 
         if (context->skipValidation() || ValidateDrawTexxOES(context, x, y, z, width, height))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->drawTexx(x, y, z, width, height);
         }
     }
@@ -3660,13 +4125,16 @@ void GL_APIENTRY DrawTexxvOES(const GLfixed *coords)
 {
     EVENT("(const GLfixed *coords = 0x%0.8p)", coords);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DrawTexxvOES);
         context->gatherParams<EntryPoint::DrawTexxvOES>(coords);
 
         if (context->skipValidation() || ValidateDrawTexxvOES(context, coords))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->drawTexxv(coords);
         }
     }
@@ -3677,13 +4145,16 @@ void GL_APIENTRY BindFramebufferOES(GLenum target, GLuint framebuffer)
 {
     EVENT("(GLenum target = 0x%X, GLuint framebuffer = %u)", target, framebuffer);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::BindFramebufferOES);
         context->gatherParams<EntryPoint::BindFramebufferOES>(target, framebuffer);
 
         if (context->skipValidation() || ValidateBindFramebufferOES(context, target, framebuffer))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->bindFramebuffer(target, framebuffer);
         }
     }
@@ -3693,13 +4164,16 @@ void GL_APIENTRY BindRenderbufferOES(GLenum target, GLuint renderbuffer)
 {
     EVENT("(GLenum target = 0x%X, GLuint renderbuffer = %u)", target, renderbuffer);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::BindRenderbufferOES);
         context->gatherParams<EntryPoint::BindRenderbufferOES>(target, renderbuffer);
 
         if (context->skipValidation() || ValidateBindRenderbufferOES(context, target, renderbuffer))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->bindRenderbuffer(target, renderbuffer);
         }
     }
@@ -3709,13 +4183,16 @@ GLenum GL_APIENTRY CheckFramebufferStatusOES(GLenum target)
 {
     EVENT("(GLenum target = 0x%X)", target);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::CheckFramebufferStatusOES);
         context->gatherParams<EntryPoint::CheckFramebufferStatusOES>(target);
 
         if (context->skipValidation() || ValidateCheckFramebufferStatusOES(context, target))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->checkFramebufferStatus(target);
         }
     }
@@ -3727,13 +4204,16 @@ void GL_APIENTRY DeleteFramebuffersOES(GLsizei n, const GLuint *framebuffers)
 {
     EVENT("(GLsizei n = %d, const GLuint *framebuffers = 0x%0.8p)", n, framebuffers);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DeleteFramebuffersOES);
         context->gatherParams<EntryPoint::DeleteFramebuffersOES>(n, framebuffers);
 
         if (context->skipValidation() || ValidateDeleteFramebuffersOES(context, n, framebuffers))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->deleteFramebuffers(n, framebuffers);
         }
     }
@@ -3743,13 +4223,16 @@ void GL_APIENTRY DeleteRenderbuffersOES(GLsizei n, const GLuint *renderbuffers)
 {
     EVENT("(GLsizei n = %d, const GLuint *renderbuffers = 0x%0.8p)", n, renderbuffers);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DeleteRenderbuffersOES);
         context->gatherParams<EntryPoint::DeleteRenderbuffersOES>(n, renderbuffers);
 
         if (context->skipValidation() || ValidateDeleteRenderbuffersOES(context, n, renderbuffers))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->deleteRenderbuffers(n, renderbuffers);
         }
     }
@@ -3765,9 +4248,11 @@ void GL_APIENTRY FramebufferRenderbufferOES(GLenum target,
         "renderbuffer = %u)",
         target, attachment, renderbuffertarget, renderbuffer);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::FramebufferRenderbufferOES);
         context->gatherParams<EntryPoint::FramebufferRenderbufferOES>(
             target, attachment, renderbuffertarget, renderbuffer);
 
@@ -3775,6 +4260,7 @@ void GL_APIENTRY FramebufferRenderbufferOES(GLenum target,
             ValidateFramebufferRenderbufferOES(context, target, attachment, renderbuffertarget,
                                                renderbuffer))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->framebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
         }
     }
@@ -3791,9 +4277,11 @@ void GL_APIENTRY FramebufferTexture2DOES(GLenum target,
         "= %u, GLint level = %d)",
         target, attachment, textarget, texture, level);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::FramebufferTexture2DOES);
         TextureTarget textargetPacked = FromGLenum<TextureTarget>(textarget);
         context->gatherParams<EntryPoint::FramebufferTexture2DOES>(target, attachment,
                                                                    textargetPacked, texture, level);
@@ -3802,6 +4290,7 @@ void GL_APIENTRY FramebufferTexture2DOES(GLenum target,
             ValidateFramebufferTexture2DOES(context, target, attachment, textargetPacked, texture,
                                             level))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->framebufferTexture2D(target, attachment, textargetPacked, texture, level);
         }
     }
@@ -3811,13 +4300,16 @@ void GL_APIENTRY GenFramebuffersOES(GLsizei n, GLuint *framebuffers)
 {
     EVENT("(GLsizei n = %d, GLuint *framebuffers = 0x%0.8p)", n, framebuffers);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GenFramebuffersOES);
         context->gatherParams<EntryPoint::GenFramebuffersOES>(n, framebuffers);
 
         if (context->skipValidation() || ValidateGenFramebuffersOES(context, n, framebuffers))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->genFramebuffers(n, framebuffers);
         }
     }
@@ -3827,13 +4319,16 @@ void GL_APIENTRY GenRenderbuffersOES(GLsizei n, GLuint *renderbuffers)
 {
     EVENT("(GLsizei n = %d, GLuint *renderbuffers = 0x%0.8p)", n, renderbuffers);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GenRenderbuffersOES);
         context->gatherParams<EntryPoint::GenRenderbuffersOES>(n, renderbuffers);
 
         if (context->skipValidation() || ValidateGenRenderbuffersOES(context, n, renderbuffers))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->genRenderbuffers(n, renderbuffers);
         }
     }
@@ -3843,14 +4338,17 @@ void GL_APIENTRY GenerateMipmapOES(GLenum target)
 {
     EVENT("(GLenum target = 0x%X)", target);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GenerateMipmapOES);
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::GenerateMipmapOES>(targetPacked);
 
         if (context->skipValidation() || ValidateGenerateMipmapOES(context, targetPacked))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->generateMipmap(targetPacked);
         }
     }
@@ -3866,15 +4364,18 @@ void GL_APIENTRY GetFramebufferAttachmentParameterivOES(GLenum target,
         "0x%0.8p)",
         target, attachment, pname, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetFramebufferAttachmentParameterivOES);
         context->gatherParams<EntryPoint::GetFramebufferAttachmentParameterivOES>(
             target, attachment, pname, params);
 
         if (context->skipValidation() || ValidateGetFramebufferAttachmentParameterivOES(
                                              context, target, attachment, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getFramebufferAttachmentParameteriv(target, attachment, pname, params);
         }
     }
@@ -3885,14 +4386,17 @@ void GL_APIENTRY GetRenderbufferParameterivOES(GLenum target, GLenum pname, GLin
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", target, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetRenderbufferParameterivOES);
         context->gatherParams<EntryPoint::GetRenderbufferParameterivOES>(target, pname, params);
 
         if (context->skipValidation() ||
             ValidateGetRenderbufferParameterivOES(context, target, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getRenderbufferParameteriv(target, pname, params);
         }
     }
@@ -3902,13 +4406,16 @@ GLboolean GL_APIENTRY IsFramebufferOES(GLuint framebuffer)
 {
     EVENT("(GLuint framebuffer = %u)", framebuffer);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::IsFramebufferOES);
         context->gatherParams<EntryPoint::IsFramebufferOES>(framebuffer);
 
         if (context->skipValidation() || ValidateIsFramebufferOES(context, framebuffer))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->isFramebuffer(framebuffer);
         }
     }
@@ -3920,13 +4427,16 @@ GLboolean GL_APIENTRY IsRenderbufferOES(GLuint renderbuffer)
 {
     EVENT("(GLuint renderbuffer = %u)", renderbuffer);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::IsRenderbufferOES);
         context->gatherParams<EntryPoint::IsRenderbufferOES>(renderbuffer);
 
         if (context->skipValidation() || ValidateIsRenderbufferOES(context, renderbuffer))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->isRenderbuffer(renderbuffer);
         }
     }
@@ -3944,15 +4454,18 @@ void GL_APIENTRY RenderbufferStorageOES(GLenum target,
         "%d)",
         target, internalformat, width, height);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::RenderbufferStorageOES);
         context->gatherParams<EntryPoint::RenderbufferStorageOES>(target, internalformat, width,
                                                                   height);
 
         if (context->skipValidation() ||
             ValidateRenderbufferStorageOES(context, target, internalformat, width, height))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->renderbufferStorage(target, internalformat, width, height);
         }
     }
@@ -3970,15 +4483,18 @@ void GL_APIENTRY GetProgramBinaryOES(GLuint program,
         "*binaryFormat = 0x%0.8p, void *binary = 0x%0.8p)",
         program, bufSize, length, binaryFormat, binary);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetProgramBinaryOES);
         context->gatherParams<EntryPoint::GetProgramBinaryOES>(program, bufSize, length,
                                                                binaryFormat, binary);
 
         if (context->skipValidation() ||
             ValidateGetProgramBinaryOES(context, program, bufSize, length, binaryFormat, binary))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getProgramBinary(program, bufSize, length, binaryFormat, binary);
         }
     }
@@ -3994,14 +4510,17 @@ void GL_APIENTRY ProgramBinaryOES(GLuint program,
         "length = %d)",
         program, binaryFormat, binary, length);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::ProgramBinaryOES);
         context->gatherParams<EntryPoint::ProgramBinaryOES>(program, binaryFormat, binary, length);
 
         if (context->skipValidation() ||
             ValidateProgramBinaryOES(context, program, binaryFormat, binary, length))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->programBinary(program, binaryFormat, binary, length);
         }
     }
@@ -4013,15 +4532,18 @@ void GL_APIENTRY GetBufferPointervOES(GLenum target, GLenum pname, void **params
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, void **params = 0x%0.8p)", target, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetBufferPointervOES);
         BufferBinding targetPacked = FromGLenum<BufferBinding>(target);
         context->gatherParams<EntryPoint::GetBufferPointervOES>(targetPacked, pname, params);
 
         if (context->skipValidation() ||
             ValidateGetBufferPointervOES(context, targetPacked, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getBufferPointerv(targetPacked, pname, params);
         }
     }
@@ -4031,14 +4553,17 @@ void *GL_APIENTRY MapBufferOES(GLenum target, GLenum access)
 {
     EVENT("(GLenum target = 0x%X, GLenum access = 0x%X)", target, access);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::MapBufferOES);
         BufferBinding targetPacked = FromGLenum<BufferBinding>(target);
         context->gatherParams<EntryPoint::MapBufferOES>(targetPacked, access);
 
         if (context->skipValidation() || ValidateMapBufferOES(context, targetPacked, access))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->mapBuffer(targetPacked, access);
         }
     }
@@ -4050,14 +4575,17 @@ GLboolean GL_APIENTRY UnmapBufferOES(GLenum target)
 {
     EVENT("(GLenum target = 0x%X)", target);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::UnmapBufferOES);
         BufferBinding targetPacked = FromGLenum<BufferBinding>(target);
         context->gatherParams<EntryPoint::UnmapBufferOES>(targetPacked);
 
         if (context->skipValidation() || ValidateUnmapBufferOES(context, targetPacked))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->unmapBuffer(targetPacked);
         }
     }
@@ -4070,14 +4598,17 @@ void GL_APIENTRY CurrentPaletteMatrixOES(GLuint matrixpaletteindex)
 {
     EVENT("(GLuint matrixpaletteindex = %u)", matrixpaletteindex);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::CurrentPaletteMatrixOES);
         context->gatherParams<EntryPoint::CurrentPaletteMatrixOES>(matrixpaletteindex);
 
         if (context->skipValidation() ||
             ValidateCurrentPaletteMatrixOES(context, matrixpaletteindex))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->currentPaletteMatrix(matrixpaletteindex);
         }
     }
@@ -4087,13 +4618,16 @@ void GL_APIENTRY LoadPaletteFromModelViewMatrixOES()
 {
     EVENT("()");
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::LoadPaletteFromModelViewMatrixOES);
         context->gatherParams<EntryPoint::LoadPaletteFromModelViewMatrixOES>();
 
         if (context->skipValidation() || ValidateLoadPaletteFromModelViewMatrixOES(context))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->loadPaletteFromModelViewMatrix();
         }
     }
@@ -4105,14 +4639,17 @@ void GL_APIENTRY MatrixIndexPointerOES(GLint size, GLenum type, GLsizei stride,
         "(GLint size = %d, GLenum type = 0x%X, GLsizei stride = %d, const void *pointer = 0x%0.8p)",
         size, type, stride, pointer);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::MatrixIndexPointerOES);
         context->gatherParams<EntryPoint::MatrixIndexPointerOES>(size, type, stride, pointer);
 
         if (context->skipValidation() ||
             ValidateMatrixIndexPointerOES(context, size, type, stride, pointer))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->matrixIndexPointer(size, type, stride, pointer);
         }
     }
@@ -4124,14 +4661,17 @@ void GL_APIENTRY WeightPointerOES(GLint size, GLenum type, GLsizei stride, const
         "(GLint size = %d, GLenum type = 0x%X, GLsizei stride = %d, const void *pointer = 0x%0.8p)",
         size, type, stride, pointer);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::WeightPointerOES);
         context->gatherParams<EntryPoint::WeightPointerOES>(size, type, stride, pointer);
 
         if (context->skipValidation() ||
             ValidateWeightPointerOES(context, size, type, stride, pointer))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->weightPointer(size, type, stride, pointer);
         }
     }
@@ -4143,14 +4683,17 @@ void GL_APIENTRY PointSizePointerOES(GLenum type, GLsizei stride, const void *po
     EVENT("(GLenum type = 0x%X, GLsizei stride = %d, const void *pointer = 0x%0.8p)", type, stride,
           pointer);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::PointSizePointerOES);
         context->gatherParams<EntryPoint::PointSizePointerOES>(type, stride, pointer);
 
         if (context->skipValidation() ||
             ValidatePointSizePointerOES(context, type, stride, pointer))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->pointSizePointer(type, stride, pointer);
         }
     }
@@ -4161,13 +4704,16 @@ GLbitfield GL_APIENTRY QueryMatrixxOES(GLfixed *mantissa, GLint *exponent)
 {
     EVENT("(GLfixed *mantissa = 0x%0.8p, GLint *exponent = 0x%0.8p)", mantissa, exponent);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::QueryMatrixxOES);
         context->gatherParams<EntryPoint::QueryMatrixxOES>(mantissa, exponent);
 
         if (context->skipValidation() || ValidateQueryMatrixxOES(context, mantissa, exponent))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->queryMatrixx(mantissa, exponent);
         }
     }
@@ -4181,13 +4727,16 @@ void GL_APIENTRY GetTexGenfvOES(GLenum coord, GLenum pname, GLfloat *params)
     EVENT("(GLenum coord = 0x%X, GLenum pname = 0x%X, GLfloat *params = 0x%0.8p)", coord, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetTexGenfvOES);
         context->gatherParams<EntryPoint::GetTexGenfvOES>(coord, pname, params);
 
         if (context->skipValidation() || ValidateGetTexGenfvOES(context, coord, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getTexGenfv(coord, pname, params);
         }
     }
@@ -4198,13 +4747,16 @@ void GL_APIENTRY GetTexGenivOES(GLenum coord, GLenum pname, GLint *params)
     EVENT("(GLenum coord = 0x%X, GLenum pname = 0x%X, GLint *params = 0x%0.8p)", coord, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetTexGenivOES);
         context->gatherParams<EntryPoint::GetTexGenivOES>(coord, pname, params);
 
         if (context->skipValidation() || ValidateGetTexGenivOES(context, coord, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getTexGeniv(coord, pname, params);
         }
     }
@@ -4215,13 +4767,16 @@ void GL_APIENTRY GetTexGenxvOES(GLenum coord, GLenum pname, GLfixed *params)
     EVENT("(GLenum coord = 0x%X, GLenum pname = 0x%X, GLfixed *params = 0x%0.8p)", coord, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GetTexGenxvOES);
         context->gatherParams<EntryPoint::GetTexGenxvOES>(coord, pname, params);
 
         if (context->skipValidation() || ValidateGetTexGenxvOES(context, coord, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->getTexGenxv(coord, pname, params);
         }
     }
@@ -4231,13 +4786,16 @@ void GL_APIENTRY TexGenfOES(GLenum coord, GLenum pname, GLfloat param)
 {
     EVENT("(GLenum coord = 0x%X, GLenum pname = 0x%X, GLfloat param = %f)", coord, pname, param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexGenfOES);
         context->gatherParams<EntryPoint::TexGenfOES>(coord, pname, param);
 
         if (context->skipValidation() || ValidateTexGenfOES(context, coord, pname, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texGenf(coord, pname, param);
         }
     }
@@ -4248,13 +4806,16 @@ void GL_APIENTRY TexGenfvOES(GLenum coord, GLenum pname, const GLfloat *params)
     EVENT("(GLenum coord = 0x%X, GLenum pname = 0x%X, const GLfloat *params = 0x%0.8p)", coord,
           pname, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexGenfvOES);
         context->gatherParams<EntryPoint::TexGenfvOES>(coord, pname, params);
 
         if (context->skipValidation() || ValidateTexGenfvOES(context, coord, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texGenfv(coord, pname, params);
         }
     }
@@ -4264,13 +4825,16 @@ void GL_APIENTRY TexGeniOES(GLenum coord, GLenum pname, GLint param)
 {
     EVENT("(GLenum coord = 0x%X, GLenum pname = 0x%X, GLint param = %d)", coord, pname, param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexGeniOES);
         context->gatherParams<EntryPoint::TexGeniOES>(coord, pname, param);
 
         if (context->skipValidation() || ValidateTexGeniOES(context, coord, pname, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texGeni(coord, pname, param);
         }
     }
@@ -4281,13 +4845,16 @@ void GL_APIENTRY TexGenivOES(GLenum coord, GLenum pname, const GLint *params)
     EVENT("(GLenum coord = 0x%X, GLenum pname = 0x%X, const GLint *params = 0x%0.8p)", coord, pname,
           params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexGenivOES);
         context->gatherParams<EntryPoint::TexGenivOES>(coord, pname, params);
 
         if (context->skipValidation() || ValidateTexGenivOES(context, coord, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texGeniv(coord, pname, params);
         }
     }
@@ -4297,13 +4864,16 @@ void GL_APIENTRY TexGenxOES(GLenum coord, GLenum pname, GLfixed param)
 {
     EVENT("(GLenum coord = 0x%X, GLenum pname = 0x%X, GLfixed param = 0x%X)", coord, pname, param);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexGenxOES);
         context->gatherParams<EntryPoint::TexGenxOES>(coord, pname, param);
 
         if (context->skipValidation() || ValidateTexGenxOES(context, coord, pname, param))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texGenx(coord, pname, param);
         }
     }
@@ -4314,13 +4884,16 @@ void GL_APIENTRY TexGenxvOES(GLenum coord, GLenum pname, const GLfixed *params)
     EVENT("(GLenum coord = 0x%X, GLenum pname = 0x%X, const GLfixed *params = 0x%0.8p)", coord,
           pname, params);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::TexGenxvOES);
         context->gatherParams<EntryPoint::TexGenxvOES>(coord, pname, params);
 
         if (context->skipValidation() || ValidateTexGenxvOES(context, coord, pname, params))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->texGenxv(coord, pname, params);
         }
     }
@@ -4331,13 +4904,16 @@ void GL_APIENTRY BindVertexArrayOES(GLuint array)
 {
     EVENT("(GLuint array = %u)", array);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::BindVertexArrayOES);
         context->gatherParams<EntryPoint::BindVertexArrayOES>(array);
 
         if (context->skipValidation() || ValidateBindVertexArrayOES(context, array))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->bindVertexArray(array);
         }
     }
@@ -4347,13 +4923,16 @@ void GL_APIENTRY DeleteVertexArraysOES(GLsizei n, const GLuint *arrays)
 {
     EVENT("(GLsizei n = %d, const GLuint *arrays = 0x%0.8p)", n, arrays);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::DeleteVertexArraysOES);
         context->gatherParams<EntryPoint::DeleteVertexArraysOES>(n, arrays);
 
         if (context->skipValidation() || ValidateDeleteVertexArraysOES(context, n, arrays))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->deleteVertexArrays(n, arrays);
         }
     }
@@ -4363,13 +4942,16 @@ void GL_APIENTRY GenVertexArraysOES(GLsizei n, GLuint *arrays)
 {
     EVENT("(GLsizei n = %d, GLuint *arrays = 0x%0.8p)", n, arrays);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::GenVertexArraysOES);
         context->gatherParams<EntryPoint::GenVertexArraysOES>(n, arrays);
 
         if (context->skipValidation() || ValidateGenVertexArraysOES(context, n, arrays))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             context->genVertexArrays(n, arrays);
         }
     }
@@ -4379,13 +4961,16 @@ GLboolean GL_APIENTRY IsVertexArrayOES(GLuint array)
 {
     EVENT("(GLuint array = %u)", array);
 
+    ANGLE_SCOPED_CONTEXT_LOCK();
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_SCOPED_CALL_PROFILE(context, EntryPoint::IsVertexArrayOES);
         context->gatherParams<EntryPoint::IsVertexArrayOES>(array);
 
         if (context->skipValidation() || ValidateIsVertexArrayOES(context, array))
         {
+            ANGLE_CALL_PROFILE_EXECUTE();
             return context->isVertexArray(array);
         }
     }
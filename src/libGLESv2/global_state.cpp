@@ -12,6 +12,7 @@
 #include "common/platform.h"
 #include "common/tls.h"
 
+#include "libANGLE/Display.h"
 #include "libANGLE/Thread.h"
 
 namespace gl
@@ -59,13 +60,40 @@ Thread *AllocateCurrentThread()
 
 }  // anonymous namespace
 
-Thread *GetCurrentThread()
+DisplayMutex *GetCurrentContextDisplayMutex()
 {
-    // Create a TLS index if one has not been created for this DLL
-    if (threadTLS == TLS_INVALID_INDEX)
+    Display *display = GetCurrentThread()->getCurrentDisplay();
+    return display ? display->getMutex() : nullptr;
+}
+
+DisplayMutex *GetDisplayMutex(EGLDisplay dpy)
+{
+    // Displays are never deleted, so a valid display can be locked without holding any other lock.
+    Display *display = static_cast<Display *>(dpy);
+    if (dpy == EGL_NO_DISPLAY || !Display::isValidDisplay(display))
     {
-        threadTLS = CreateTLSIndex();
+        return nullptr;
     }
+    return display->getMutex();
+}
+
+std::recursive_mutex &GetGlobalMutex()
+{
+    static std::recursive_mutex globalMutex;
+    return globalMutex;
+}
+
+Thread *GetCurrentThread()
+{
+    // Create a TLS index if one has not been created for this DLL. Entry points running on
+    // different displays can get here at the same time.
+    static std::once_flag threadTLSOnce;
+    std::call_once(threadTLSOnce, []() {
+        if (threadTLS == TLS_INVALID_INDEX)
+        {
+            threadTLS = CreateTLSIndex();
+        }
+    });
 
     Thread *current = static_cast<Thread *>(GetTLSValue(threadTLS));
 
@@ -9,6 +9,12 @@
 #ifndef LIBGLESV2_GLOBALSTATE_H_
 #define LIBGLESV2_GLOBALSTATE_H_
 
+#include <mutex>
+
+#include <EGL/egl.h>
+
+#include "libANGLE/DisplayMutex.h"
+
 namespace gl
 {
 class Context;
@@ -24,6 +30,30 @@ class Thread;
 
 Thread *GetCurrentThread();
 
+// Returns the mutex of the display of the context current on the calling thread, or null if no
+// context is current.
+DisplayMutex *GetCurrentContextDisplayMutex();
+
+// Returns the mutex of |dpy|, or null if |dpy| isn't a display.
+DisplayMutex *GetDisplayMutex(EGLDisplay dpy);
+
+// Serializes the EGL entry points that change state shared by every display: getting displays,
+// initializing and terminating them, and creating and querying devices. The mutex is recursive
+// since entry points may call each other.
+std::recursive_mutex &GetGlobalMutex();
+
 }  // namespace egl
 
+#define ANGLE_SCOPED_GLOBAL_LOCK() \
+    std::lock_guard<std::recursive_mutex> globalMutexLock(egl::GetGlobalMutex())
+
+// Serializes a GL or EGL entry point with the other calls made on the display of the context
+// current on the calling thread.
+#define ANGLE_SCOPED_CONTEXT_LOCK() \
+    egl::ScopedDisplayLock contextDisplayLock(egl::GetCurrentContextDisplayMutex())
+
+// Serializes an EGL entry point with the other calls made on |dpy|.
+#define ANGLE_SCOPED_DISPLAY_LOCK(dpy) \
+    egl::ScopedDisplayLock displayLock(egl::GetDisplayMutex(dpy))
+
 #endif // LIBGLESV2_GLOBALSTATE_H_
@@ -0,0 +1,102 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// AsyncShaderTranslateTest:
+//   Tests that shaders are translated on a worker thread after glCompileShader returns, and that
+//   querying the result of the compile waits for the translation.
+//
+
+#include "test_utils/ANGLETest.h"
+#include "test_utils/angle_test_instantiate.h"
+// 'None' is defined as 'struct None {};' in
+// third_party/googletest/src/googletest/include/gtest/internal/gtest-type-util.h.
+// But 'None' is also defined as a numeric constant 0L in <X11/X.h>.
+// So we need to include ANGLETest.h first to avoid this conflict.
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "libANGLE/Compiler.h"
+#include "libANGLE/Context.h"
+
+using namespace angle;
+
+namespace
+{
+
+class AsyncShaderTranslateTest : public ANGLETest
+{
+  protected:
+    gl::Context *hackContext()
+    {
+        // Hack the angle!
+        return reinterpret_cast<gl::Context *>(getEGLWindow()->getContext());
+    }
+};
+
+// Hold the fragment shader compiler on another thread while a fragment shader is compiled. The
+// compile call must return without translating, and the compile status must only be available
+// once the compiler has been let go and the translation has finished.
+TEST_P(AsyncShaderTranslateTest, CompileReturnsBeforeTranslationAndStatusWaits)
+{
+    std::mutex &compilerMutex =
+        hackContext()->getCompiler()->getCompilerMutex(gl::ShaderType::Fragment);
+
+    std::mutex stateMutex;
+    std::condition_variable stateCondition;
+    bool compilerHeld    = false;
+    bool compileReturned = false;
+    std::atomic<bool> compilerReleased(false);
+
+    std::thread holder([&]() {
+        std::lock_guard<std::mutex> compilerLock(compilerMutex);
+        {
+            std::lock_guard<std::mutex> lock(stateMutex);
+            compilerHeld = true;
+        }
+        stateCondition.notify_one();
+
+        // Time out instead of deadlocking if the translation runs inside glCompileShader.
+        {
+            std::unique_lock<std::mutex> lock(stateMutex);
+            stateCondition.wait_for(lock, std::chrono::seconds(10),
+                                    [&]() { return compileReturned; });
+        }
+        compilerReleased = true;
+    });
+
+    {
+        std::unique_lock<std::mutex> lock(stateMutex);
+        stateCondition.wait(lock, [&]() { return compilerHeld; });
+    }
+
+    const char *source = essl1_shaders::fs::Red();
+    GLuint shader      = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(shader, 1, &source, nullptr);
+    glCompileShader(shader);
+    EXPECT_FALSE(compilerReleased);
+
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        compileReturned = true;
+    }
+    stateCondition.notify_one();
+
+    GLint compileStatus = GL_FALSE;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &compileStatus);
+    EXPECT_TRUE(compilerReleased);
+    EXPECT_GL_TRUE(compileStatus);
+
+    holder.join();
+    glDeleteShader(shader);
+    ASSERT_GL_NO_ERROR();
+}
+
+// D3D translates when the compile is resolved, since it reads back state from the compiler.
+ANGLE_INSTANTIATE_TEST(AsyncShaderTranslateTest, ES2_OPENGL(), ES2_OPENGLES(), ES2_VULKAN());
+
+}  // anonymous namespace
@@ -1591,7 +1591,7 @@ TEST_P(CopyTextureTestES3, ES3UintFormats)
 // tests should be run against.
 ANGLE_INSTANTIATE_TEST(CopyTextureTest, ES2_D3D9(), ES2_D3D11(), ES2_OPENGL(), ES2_OPENGLES());
 ANGLE_INSTANTIATE_TEST(CopyTextureTestWebGL, ES2_D3D9(), ES2_D3D11(), ES2_OPENGL(), ES2_OPENGLES());
-ANGLE_INSTANTIATE_TEST(CopyTextureTestDest, ES2_D3D11());
+ANGLE_INSTANTIATE_TEST(CopyTextureTestDest, ES2_D3D11(), ES2_OPENGL(), ES2_OPENGLES());
 ANGLE_INSTANTIATE_TEST(CopyTextureTestES3, ES3_D3D11(), ES3_OPENGL(), ES3_OPENGLES());
 
 }  // namespace angle
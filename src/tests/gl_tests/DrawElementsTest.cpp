@@ -58,6 +58,36 @@ class DrawElementsTest : public ANGLETest
         }
     }
 
+    // Draws a quad covering the viewport with client memory indices and attributes. The other
+    // vertices and indices only form degenerate triangles, they make the draw stream more data.
+    void drawClientMemoryQuad(GLint positionLocation,
+                              GLint colorLocation,
+                              GLuint vertexCount,
+                              GLsizei indexCount,
+                              const GLColor &color)
+    {
+        std::vector<GLfloat> positions(vertexCount * 2, 0.0f);
+        const std::array<GLfloat, 8> quadPositions = {
+            {-1.0f, 1.0f, -1.0f, -1.0f, 1.0f, -1.0f, 1.0f, 1.0f}};
+        std::copy(quadPositions.begin(), quadPositions.end(), positions.end() - 8);
+
+        std::vector<GLColor> colors(vertexCount, color);
+
+        // Index 0 is used by the degenerate triangles, so all the vertices are streamed.
+        std::vector<GLuint> indices(indexCount, 0);
+        const GLuint quadStart                  = vertexCount - 4;
+        const std::array<GLuint, 6> quadIndices = {
+            {quadStart, quadStart + 1, quadStart + 2, quadStart + 2, quadStart + 3, quadStart}};
+        std::copy(quadIndices.begin(), quadIndices.end(), indices.end() - 6);
+
+        glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, positions.data());
+        glEnableVertexAttribArray(positionLocation);
+        glVertexAttribPointer(colorLocation, 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, colors.data());
+        glEnableVertexAttribArray(colorLocation);
+
+        glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, indices.data());
+    }
+
     std::vector<GLuint> mIndexBuffers;
     std::vector<GLuint> mVertexArrays;
     std::vector<GLuint> mVertexBuffers;
@@ -305,5 +335,70 @@ TEST_P(DrawElementsTest, DrawElementsTypeAlignment)
     EXPECT_GL_ERROR(GL_INVALID_OPERATION);
 }
 
+constexpr char kColorAttributeVS[] =
+    "attribute vec2 position;\n"
+    "attribute vec4 color;\n"
+    "varying vec4 v_color;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_Position = vec4(position, 0, 1);\n"
+    "    v_color = color;\n"
+    "}\n";
+
+constexpr char kColorAttributeFS[] =
+    "precision mediump float;\n"
+    "varying vec4 v_color;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_FragColor = v_color;\n"
+    "}\n";
+
+// Test a draw whose client memory indices and attributes are too large for the buffer they are
+// streamed to, so that the buffer must grow.
+TEST_P(DrawElementsTest, ClientMemoryIndicesAndAttributesGrowStreamingBuffer)
+{
+    ANGLE_GL_PROGRAM(program, kColorAttributeVS, kColorAttributeFS);
+    glUseProgram(program);
+
+    GLint positionLocation = glGetAttribLocation(program, "position");
+    ASSERT_NE(-1, positionLocation);
+    GLint colorLocation = glGetAttribLocation(program, "color");
+    ASSERT_NE(-1, colorLocation);
+
+    // A small draw first so that the streaming buffer already exists.
+    drawClientMemoryQuad(positionLocation, colorLocation, 4, 6, GLColor::red);
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 2, getWindowHeight() / 2, GLColor::red);
+
+    // Several megabytes of indices and attributes.
+    drawClientMemoryQuad(positionLocation, colorLocation, 1 << 18, 3 << 16, GLColor::green);
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 2, getWindowHeight() / 2, GLColor::green);
+
+    ASSERT_GL_NO_ERROR();
+}
+
+// Test many draws with client memory indices and attributes of varying sizes, so that the buffer
+// they are streamed to wraps around at different points of a draw's data.
+TEST_P(DrawElementsTest, ClientMemoryIndicesAndAttributesWrapStreamingBuffer)
+{
+    ANGLE_GL_PROGRAM(program, kColorAttributeVS, kColorAttributeFS);
+    glUseProgram(program);
+
+    GLint positionLocation = glGetAttribLocation(program, "position");
+    ASSERT_NE(-1, positionLocation);
+    GLint colorLocation = glGetAttribLocation(program, "color");
+    ASSERT_NE(-1, colorLocation);
+
+    const std::array<GLColor, 3> colors = {{GLColor::red, GLColor::green, GLColor::blue}};
+    for (GLuint drawIndex = 0; drawIndex < 32; ++drawIndex)
+    {
+        const GLColor &color = colors[drawIndex % colors.size()];
+        drawClientMemoryQuad(positionLocation, colorLocation, 4096 + 1531 * drawIndex,
+                             3 * (1000 + 311 * drawIndex), color);
+        EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 2, getWindowHeight() / 2, color);
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
 ANGLE_INSTANTIATE_TEST(DrawElementsTest, ES3_OPENGL(), ES3_OPENGLES());
 }
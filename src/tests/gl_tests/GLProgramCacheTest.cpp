@@ -0,0 +1,177 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// GLProgramCacheTest:
+//   Tests that programs loaded from the program cache by the GL back-end skip the native work of
+//   a link from source, and that native binaries are only reused by the driver that created them.
+//
+
+#include "test_utils/ANGLETest.h"
+#include "test_utils/angle_test_instantiate.h"
+// 'None' is defined as 'struct None {};' in
+// third_party/googletest/src/googletest/include/gtest/internal/gtest-type-util.h.
+// But 'None' is also defined as a numeric constant 0L in <X11/X.h>.
+// So we need to include ANGLETest.h first to avoid this conflict.
+
+#include "libANGLE/BinaryStream.h"
+#include "libANGLE/Context.h"
+#include "libANGLE/Program.h"
+#include "libANGLE/Shader.h"
+#include "libANGLE/renderer/gl/ProgramGL.h"
+#include "libANGLE/renderer/gl/ShaderGL.h"
+#include "test_utils/gl_raii.h"
+
+using namespace angle;
+
+namespace
+{
+
+class GLProgramCacheTest : public ANGLETest
+{
+  protected:
+    GLProgramCacheTest()
+    {
+        setWindowWidth(128);
+        setWindowHeight(128);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+
+    gl::Context *hackContext()
+    {
+        // Hack the angle!
+        return reinterpret_cast<gl::Context *>(getEGLWindow()->getContext());
+    }
+
+    rx::ShaderGL *getShaderGL(GLuint shader)
+    {
+        return rx::GetImplAs<rx::ShaderGL>(hackContext()->getShader(shader));
+    }
+
+    // Compiles without querying the compile status, which could compile the native shader.
+    GLuint compileShaderUnchecked(GLenum type, const char *source)
+    {
+        GLuint shader = glCreateShader(type);
+        glShaderSource(shader, 1, &source, nullptr);
+        glCompileShader(shader);
+        return shader;
+    }
+
+    // Loads a saved native binary through the GL back-end of a new program object.
+    gl::LinkResult loadIntoNewProgram(gl::BinaryInputStream *stream, gl::InfoLog *infoLog)
+    {
+        GLuint program = glCreateProgram();
+        rx::ProgramGL *programGL =
+            rx::GetImplAs<rx::ProgramGL>(hackContext()->getProgram(program));
+        gl::LinkResult result = programGL->load(hackContext(), *infoLog, stream);
+        glDeleteProgram(program);
+        return result;
+    }
+
+    void linkAndExpectSuccess(GLuint program, GLuint vertexShader, GLuint fragmentShader)
+    {
+        glAttachShader(program, vertexShader);
+        glAttachShader(program, fragmentShader);
+        glLinkProgram(program);
+
+        GLint linkStatus = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+        EXPECT_GL_TRUE(linkStatus);
+    }
+};
+
+// Linking a program that is already in the program cache must not compile its shaders natively.
+TEST_P(GLProgramCacheTest, CacheHitSkipsNativeCompile)
+{
+    ANGLE_SKIP_TEST_IF(!extensionEnabled("GL_OES_get_program_binary"));
+
+    // The first link is from source, so it compiles the shaders natively and fills the cache.
+    GLuint firstVertexShader =
+        compileShaderUnchecked(GL_VERTEX_SHADER, essl1_shaders::vs::Simple());
+    GLuint firstFragmentShader =
+        compileShaderUnchecked(GL_FRAGMENT_SHADER, essl1_shaders::fs::Red());
+
+    GLuint firstProgram = glCreateProgram();
+    linkAndExpectSuccess(firstProgram, firstVertexShader, firstFragmentShader);
+    EXPECT_FALSE(getShaderGL(firstVertexShader)->isNativeCompileRequiredForTesting());
+    EXPECT_FALSE(getShaderGL(firstFragmentShader)->isNativeCompileRequiredForTesting());
+
+    // The same sources in new shader objects hit the cache, so the native compile never happens.
+    GLuint secondVertexShader =
+        compileShaderUnchecked(GL_VERTEX_SHADER, essl1_shaders::vs::Simple());
+    GLuint secondFragmentShader =
+        compileShaderUnchecked(GL_FRAGMENT_SHADER, essl1_shaders::fs::Red());
+
+    GLuint secondProgram = glCreateProgram();
+    linkAndExpectSuccess(secondProgram, secondVertexShader, secondFragmentShader);
+    EXPECT_TRUE(getShaderGL(secondVertexShader)->isNativeCompileRequiredForTesting());
+    EXPECT_TRUE(getShaderGL(secondFragmentShader)->isNativeCompileRequiredForTesting());
+
+    // The program loaded from the native binary still renders.
+    drawQuad(secondProgram, essl1_shaders::PositionAttrib(), 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    glDeleteProgram(firstProgram);
+    glDeleteProgram(secondProgram);
+    glDeleteShader(firstVertexShader);
+    glDeleteShader(firstFragmentShader);
+    glDeleteShader(secondVertexShader);
+    glDeleteShader(secondFragmentShader);
+    ASSERT_GL_NO_ERROR();
+}
+
+// A native binary saved by a different driver must be rejected before it reaches the driver.
+TEST_P(GLProgramCacheTest, BinaryFromDifferentDriverIsRejected)
+{
+    ANGLE_SKIP_TEST_IF(!extensionEnabled("GL_OES_get_program_binary"));
+
+    // Save the native binary of a program linked by this driver.
+    ANGLE_GL_PROGRAM(sourceProgram, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    rx::ProgramGL *sourceProgramGL =
+        rx::GetImplAs<rx::ProgramGL>(hackContext()->getProgram(sourceProgram));
+
+    gl::BinaryOutputStream savedStream;
+    sourceProgramGL->save(hackContext(), &savedStream);
+
+    // The binary loads back as long as the driver string matches.
+    {
+        gl::BinaryInputStream stream(savedStream.data(), savedStream.length());
+        gl::InfoLog infoLog;
+        gl::LinkResult result = loadIntoNewProgram(&stream, &infoLog);
+        ASSERT_FALSE(result.isError());
+        EXPECT_TRUE(result.getResult());
+    }
+
+    // Replace the driver string the binary starts with, and keep the native binary itself.
+    gl::BinaryInputStream savedInput(savedStream.data(), savedStream.length());
+    savedInput.readString();
+    const uint8_t *nativeBinary = savedInput.data() + savedInput.offset();
+    size_t nativeBinarySize     = savedStream.length() - savedInput.offset();
+
+    gl::BinaryOutputStream otherDriverStream;
+    otherDriverStream.writeString("Some other vendor Some other renderer 1.0");
+    otherDriverStream.writeBytes(nativeBinary, nativeBinarySize);
+
+    {
+        gl::BinaryInputStream stream(otherDriverStream.data(), otherDriverStream.length());
+        gl::InfoLog infoLog;
+        gl::LinkResult result = loadIntoNewProgram(&stream, &infoLog);
+        ASSERT_FALSE(result.isError());
+        EXPECT_FALSE(result.getResult());
+        EXPECT_NE(0u, infoLog.getLength());
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+ANGLE_INSTANTIATE_TEST(GLProgramCacheTest,
+                       ES2_OPENGL(),
+                       ES3_OPENGL(),
+                       ES2_OPENGLES(),
+                       ES3_OPENGLES());
+
+}  // anonymous namespace
@@ -0,0 +1,112 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// GLShaderCompileTest:
+//   Tests that the GL back-end reports the result of native shader compiles, which it doesn't
+//   wait for when the shader is compiled, through the shader's compile status and info log.
+//
+
+#include "test_utils/ANGLETest.h"
+#include "test_utils/angle_test_instantiate.h"
+// 'None' is defined as 'struct None {};' in
+// third_party/googletest/src/googletest/include/gtest/internal/gtest-type-util.h.
+// But 'None' is also defined as a numeric constant 0L in <X11/X.h>.
+// So we need to include ANGLETest.h first to avoid this conflict.
+
+#include "libANGLE/Context.h"
+#include "libANGLE/Shader.h"
+#include "libANGLE/renderer/gl/ContextGL.h"
+#include "libANGLE/renderer/gl/FunctionsGL.h"
+#include "libANGLE/renderer/gl/ShaderGL.h"
+
+using namespace angle;
+
+namespace
+{
+
+class GLShaderCompileTest : public ANGLETest
+{
+  protected:
+    gl::Context *hackContext()
+    {
+        // Hack the angle!
+        return reinterpret_cast<gl::Context *>(getEGLWindow()->getContext());
+    }
+
+    // Compiles and translates a shader without querying its compile status.
+    GLuint compileShaderUnchecked(GLenum type, const char *source)
+    {
+        GLuint shader = glCreateShader(type);
+        glShaderSource(shader, 1, &source, nullptr);
+        glCompileShader(shader);
+        EXPECT_TRUE(hackContext()->getShader(shader)->isCompiled(hackContext()));
+        return shader;
+    }
+};
+
+// Querying the compile status compiles the shader natively, so a later link doesn't have to.
+TEST_P(GLShaderCompileTest, CompileStatusQueryCompilesNatively)
+{
+    GLuint shader = compileShaderUnchecked(GL_FRAGMENT_SHADER, essl1_shaders::fs::Red());
+    rx::ShaderGL *shaderGL = rx::GetImplAs<rx::ShaderGL>(hackContext()->getShader(shader));
+    EXPECT_TRUE(shaderGL->isNativeCompileRequiredForTesting());
+
+    GLint compileStatus = GL_FALSE;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &compileStatus);
+    EXPECT_GL_TRUE(compileStatus);
+    EXPECT_FALSE(shaderGL->isNativeCompileRequiredForTesting());
+
+    glDeleteShader(shader);
+    ASSERT_GL_NO_ERROR();
+}
+
+// A shader the translator accepts but the driver rejects must report a failed compile.
+TEST_P(GLShaderCompileTest, DriverRejectedShaderFailsCompile)
+{
+    GLuint shader = compileShaderUnchecked(GL_FRAGMENT_SHADER, essl1_shaders::fs::Red());
+    rx::ShaderGL *shaderGL = rx::GetImplAs<rx::ShaderGL>(hackContext()->getShader(shader));
+
+    // Issue the native compile, then replace it with one the driver rejects, as if the driver had
+    // failed to compile the translated source.
+    const rx::FunctionsGL *functions =
+        rx::GetImplAs<rx::ContextGL>(hackContext())->getFunctions();
+    shaderGL->compileNativeIfRequired(functions);
+
+    const char *invalidSource = "this is not a shader";
+    functions->shaderSource(shaderGL->getShaderID(), 1, &invalidSource, nullptr);
+    functions->compileShader(shaderGL->getShaderID());
+
+    GLint compileStatus = GL_TRUE;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &compileStatus);
+    EXPECT_GL_FALSE(compileStatus);
+
+    GLint infoLogLength = 0;
+    glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &infoLogLength);
+    EXPECT_GT(infoLogLength, 1);
+
+    // Programs can't be linked with a shader that failed to compile.
+    GLuint vertexShader = compileShaderUnchecked(GL_VERTEX_SHADER, essl1_shaders::vs::Simple());
+    GLuint program      = glCreateProgram();
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, shader);
+    glLinkProgram(program);
+
+    GLint linkStatus = GL_TRUE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+    EXPECT_GL_FALSE(linkStatus);
+
+    glDeleteProgram(program);
+    glDeleteShader(vertexShader);
+    glDeleteShader(shader);
+    ASSERT_GL_NO_ERROR();
+}
+
+ANGLE_INSTANTIATE_TEST(GLShaderCompileTest,
+                       ES2_OPENGL(),
+                       ES3_OPENGL(),
+                       ES2_OPENGLES(),
+                       ES3_OPENGLES());
+
+}  // anonymous namespace
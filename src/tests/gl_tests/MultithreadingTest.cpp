@@ -154,7 +154,171 @@ TEST_P(MultithreadingTest, MakeCurrentMultiContext)
     }
 }
 
-// TODO(geofflang): Test sharing a program between multiple shared contexts on multiple threads
+// Test that shared contexts can sample the same program and texture on many threads at once,
+// without the application serializing the calls.
+TEST_P(MultithreadingTest, SharedObjectsMultiContext)
+{
+    ANGLE_SKIP_TEST_IF(!platformSupportsMultithreading());
+
+    EGLWindow *window = getEGLWindow();
+    EGLDisplay dpy    = window->getDisplay();
+    EGLConfig config  = window->getConfig();
+
+    const std::string &vs =
+        "attribute vec2 position;\n"
+        "varying vec2 texCoord;\n"
+        "void main()\n"
+        "{\n"
+        "    gl_Position = vec4(position, 0, 1);\n"
+        "    texCoord = position * 0.5 + vec2(0.5);\n"
+        "}\n";
+
+    const std::string &fs =
+        "precision mediump float;\n"
+        "uniform sampler2D tex;\n"
+        "varying vec2 texCoord;\n"
+        "void main()\n"
+        "{\n"
+        "    gl_FragColor = texture2D(tex, texCoord);\n"
+        "}\n";
+
+    // Objects created by the main context are shared with every worker context.
+    ANGLE_GL_PROGRAM(program, vs, fs);
+
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &GLColor::green);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glFinish();
+    ASSERT_GL_NO_ERROR();
+
+    EGLContext sharedContext = window->getContext();
+
+    constexpr size_t kThreadCount         = 16;
+    constexpr size_t kIterationsPerThread = 32;
+
+    constexpr EGLint kPBufferSize = 32;
+
+    std::array<std::thread, kThreadCount> threads;
+    for (std::thread &thread : threads)
+    {
+        thread = std::thread([&]() {
+            EGLint pbufferAttributes[] = {
+                EGL_WIDTH, kPBufferSize, EGL_HEIGHT, kPBufferSize, EGL_NONE, EGL_NONE,
+            };
+            EGLSurface pbuffer = eglCreatePbufferSurface(dpy, config, pbufferAttributes);
+            EXPECT_EGL_SUCCESS();
+
+            EGLContext ctx = window->createContext(sharedContext);
+            EXPECT_NE(EGL_NO_CONTEXT, ctx);
+
+            EXPECT_EGL_TRUE(eglMakeCurrent(dpy, pbuffer, pbuffer, ctx));
+            EXPECT_EGL_SUCCESS();
+
+            for (size_t iteration = 0; iteration < kIterationsPerThread; iteration++)
+            {
+                // Creating and deleting objects changes the shared resource managers while other
+                // threads are looking up the shared program and texture.
+                GLBuffer buffer;
+                glBindBuffer(GL_ARRAY_BUFFER, buffer);
+                glBufferData(GL_ARRAY_BUFFER, 16, nullptr, GL_STATIC_DRAW);
+
+                glClearColor(1.0f, 0.0f, 0.0f, 1.0f);
+                glClear(GL_COLOR_BUFFER_BIT);
+
+                glBindTexture(GL_TEXTURE_2D, texture);
+                drawQuad(program, "position", 0.5f);
+                EXPECT_GL_NO_ERROR();
+
+                EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+            }
+
+            EXPECT_EGL_TRUE(eglMakeCurrent(dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+            EXPECT_EGL_SUCCESS();
+
+            eglDestroySurface(dpy, pbuffer);
+            eglDestroyContext(dpy, ctx);
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+}
+
+// Test that threads waiting on the GPU through glClientWaitSync and glFinish don't block the
+// threads rendering with other contexts of the display.
+TEST_P(MultithreadingTest, WaitWhileOtherContextsRender)
+{
+    ANGLE_SKIP_TEST_IF(!platformSupportsMultithreading());
+    ANGLE_SKIP_TEST_IF(getClientMajorVersion() < 3);
+
+    EGLWindow *window = getEGLWindow();
+    EGLDisplay dpy    = window->getDisplay();
+    EGLConfig config  = window->getConfig();
+
+    constexpr size_t kThreadCount         = 8;
+    constexpr size_t kIterationsPerThread = 64;
+
+    constexpr EGLint kPBufferSize = 32;
+
+    std::array<std::thread, kThreadCount> threads;
+    for (size_t threadIndex = 0; threadIndex < kThreadCount; threadIndex++)
+    {
+        threads[threadIndex] = std::thread([&, threadIndex]() {
+            EGLint pbufferAttributes[] = {
+                EGL_WIDTH, kPBufferSize, EGL_HEIGHT, kPBufferSize, EGL_NONE, EGL_NONE,
+            };
+            EGLSurface pbuffer = eglCreatePbufferSurface(dpy, config, pbufferAttributes);
+            EXPECT_EGL_SUCCESS();
+
+            EGLContext ctx = window->createContext(EGL_NO_CONTEXT);
+            EXPECT_NE(EGL_NO_CONTEXT, ctx);
+
+            EXPECT_EGL_TRUE(eglMakeCurrent(dpy, pbuffer, pbuffer, ctx));
+            EXPECT_EGL_SUCCESS();
+
+            for (size_t iteration = 0; iteration < kIterationsPerThread; iteration++)
+            {
+                const GLColor color = (iteration + threadIndex) % 2 == 0 ? GLColor::red
+                                                                         : GLColor::green;
+                glClearColor(color.R / 255.0f, color.G / 255.0f, color.B / 255.0f, 1.0f);
+                glClear(GL_COLOR_BUFFER_BIT);
+
+                // Half of the threads wait on a fence, the other half finish.
+                if (threadIndex % 2 == 0)
+                {
+                    GLsync sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+                    GLenum result =
+                        glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+                    EXPECT_TRUE(result == GL_CONDITION_SATISFIED ||
+                                result == GL_ALREADY_SIGNALED);
+                    glDeleteSync(sync);
+                }
+                else
+                {
+                    glFinish();
+                }
+                EXPECT_GL_NO_ERROR();
+
+                EXPECT_PIXEL_COLOR_EQ(0, 0, color);
+            }
+
+            EXPECT_EGL_TRUE(eglMakeCurrent(dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+            EXPECT_EGL_SUCCESS();
+
+            eglDestroySurface(dpy, pbuffer);
+            eglDestroyContext(dpy, ctx);
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+}
 
 ANGLE_INSTANTIATE_TEST(MultithreadingTest,
                        ES2_OPENGL(),
@@ -8,6 +8,7 @@
 //
 
 #include "test_utils/ANGLETest.h"
+#include "test_utils/gl_raii.h"
 
 #include <array>
 
@@ -61,6 +62,40 @@ TEST_P(ReadPixelsTest, OutOfBounds)
     }
 }
 
+// Test reading back into a pixel pack buffer in ES2 and mapping the result after more work was
+// queued, without stalling at glReadPixels.
+TEST_P(ReadPixelsTest, PixelBufferObjectDeferredMap)
+{
+    ANGLE_SKIP_TEST_IF(!extensionEnabled("GL_NV_pixel_buffer_object") ||
+                       !extensionEnabled("GL_EXT_map_buffer_range") ||
+                       !extensionEnabled("GL_OES_mapbuffer"));
+
+    glClearColor(1.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    GLBuffer pixelBuffer;
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, pixelBuffer);
+    glBufferData(GL_PIXEL_PACK_BUFFER, 4 * getWindowWidth() * getWindowHeight(), nullptr,
+                 GL_STREAM_READ);
+    glReadPixels(0, 0, getWindowWidth(), getWindowHeight(), GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    ASSERT_GL_NO_ERROR();
+
+    // Queue more rendering before looking at the result.
+    glClearColor(0.0f, 1.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    const GLColor *pixels = static_cast<const GLColor *>(glMapBufferRangeEXT(
+        GL_PIXEL_PACK_BUFFER, 0, 4 * getWindowWidth() * getWindowHeight(), GL_MAP_READ_BIT_EXT));
+    ASSERT_NE(nullptr, pixels);
+    EXPECT_EQ(GLColor::red, pixels[0]);
+    EXPECT_EQ(GLColor::red, pixels[getWindowWidth() * getWindowHeight() - 1]);
+    glUnmapBufferOES(GL_PIXEL_PACK_BUFFER);
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    ASSERT_GL_NO_ERROR();
+}
+
 class ReadPixelsPBOTest : public ReadPixelsTest
 {
   protected:
@@ -741,6 +741,69 @@ TEST_P(RobustResourceInitTest, ReadingPartiallyInitializedTexture)
     EXPECT_GL_NO_ERROR();
 }
 
+// Writing a texture in several sub image pieces should keep every piece and only initialize the
+// parts that were not written.
+TEST_P(RobustResourceInitTest, TexSubImageInPieces)
+{
+    ANGLE_SKIP_TEST_IF(!hasGLExtension());
+
+    // http://anglebug.com/2407
+    ANGLE_SKIP_TEST_IF(IsAndroid());
+
+    GLTexture tex;
+    setupTexture(&tex);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, kWidth, kHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+    std::vector<GLColor> data(kWidth * kHeight, GLColor::white);
+
+    // Fill the left half in two quarters, leaving the right half uninitialized.
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, kHeight / 2, kWidth / 2, kHeight / 2, GL_RGBA,
+                    GL_UNSIGNED_BYTE, data.data());
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, kWidth / 2, kHeight / 2, GL_RGBA, GL_UNSIGNED_BYTE,
+                    data.data());
+    checkNonZeroPixels(&tex, 0, 0, kWidth / 2, kHeight, GLColor::white);
+
+    // Filling the rest completes the texture.
+    glBindTexture(GL_TEXTURE_2D, tex);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, kWidth / 2, 0, kWidth / 2, kHeight, GL_RGBA,
+                    GL_UNSIGNED_BYTE, data.data());
+    checkNonZeroPixels(&tex, 0, 0, kWidth, kHeight, GLColor::white);
+    EXPECT_GL_NO_ERROR();
+}
+
+// Many small sub image writes should still leave the unwritten parts of the texture at 0.
+TEST_P(RobustResourceInitTest, TexSubImageManyPieces)
+{
+    ANGLE_SKIP_TEST_IF(!hasGLExtension());
+
+    // http://anglebug.com/2407
+    ANGLE_SKIP_TEST_IF(IsAndroid());
+
+    GLTexture tex;
+    setupTexture(&tex);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, kWidth, kHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+    // Write a diagonal of pixels that can't be merged into larger areas.
+    GLColor data(108, 72, 36, 9);
+    for (int i = 0; i < 32; ++i)
+    {
+        glTexSubImage2D(GL_TEXTURE_2D, 0, i * 2, i * 2, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, &data.R);
+    }
+
+    GLFramebuffer fb;
+    glBindFramebuffer(GL_FRAMEBUFFER, fb);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, tex, 0);
+    ASSERT_GLENUM_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_FRAMEBUFFER));
+
+    for (int i = 0; i < 32; ++i)
+    {
+        EXPECT_PIXEL_COLOR_EQ(i * 2, i * 2, data);
+        EXPECT_PIXEL_COLOR_EQ(i * 2 + 1, i * 2, GLColor::transparentBlack);
+    }
+    EXPECT_PIXEL_COLOR_EQ(kWidth - 1, kHeight - 1, GLColor::transparentBlack);
+    EXPECT_GL_NO_ERROR();
+}
+
 // Uninitialized parts of textures initialized via copyTexImage2D should have all bytes set to 0.
 TEST_P(RobustResourceInitTest, UninitializedPartsOfCopied2DTexturesAreBlack)
 {
@@ -1535,6 +1598,29 @@ TEST_P(RobustResourceInitTestES3, Texture2DArray)
     }
 }
 
+// Tests that the unwritten parts of a texture are initialized to 0 even if a pixel unpack buffer
+// is bound when the texture is first used.
+TEST_P(RobustResourceInitTestES3, TexSubImageThenUseWithUnpackBuffer)
+{
+    ANGLE_SKIP_TEST_IF(!hasGLExtension());
+
+    GLTexture tex;
+    setupTexture(&tex);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, kWidth, kHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+    std::vector<GLColor> data(kWidth * kHeight, GLColor::white);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, kWidth / 2, kHeight / 2, GL_RGBA, GL_UNSIGNED_BYTE,
+                    data.data());
+
+    GLBuffer unpackBuffer;
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, unpackBuffer);
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, data.size() * sizeof(GLColor), data.data(),
+                 GL_STATIC_DRAW);
+
+    checkNonZeroPixels(&tex, 0, 0, kWidth / 2, kHeight / 2, GLColor::white);
+    EXPECT_GL_NO_ERROR();
+}
+
 // Test that using TexStorage2D followed by CompressedSubImage works with robust init.
 // Taken from WebGL test conformance/extensions/webgl-compressed-texture-s3tc.
 TEST_P(RobustResourceInitTestES3, CompressedSubImage)
@@ -1645,6 +1731,35 @@ TEST_P(RobustResourceInitTest, ClearWithScissor)
     EXPECT_PIXEL_COLOR_EQ(kSize - 1, 0, GLColor::transparentBlack);
 }
 
+// Tests that a scissor covering the whole framebuffer doesn't lose the clear.
+TEST_P(RobustResourceInitTest, ClearWithFullScissor)
+{
+    ANGLE_SKIP_TEST_IF(!hasGLExtension());
+
+    constexpr int kSize = 16;
+
+    GLRenderbuffer colorbuffer;
+    glBindRenderbuffer(GL_RENDERBUFFER, colorbuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, kSize, kSize);
+
+    GLFramebuffer framebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorbuffer);
+
+    ASSERT_GL_NO_ERROR();
+    ASSERT_GLENUM_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_FRAMEBUFFER));
+
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(-1, -1, kSize + 2, kSize + 2);
+
+    glClearColor(1.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    EXPECT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    EXPECT_PIXEL_COLOR_EQ(kSize - 1, kSize - 1, GLColor::red);
+}
+
 // Tests that surfaces are initialized when they are created
 TEST_P(RobustResourceInitTest, SurfaceInitialized)
 {
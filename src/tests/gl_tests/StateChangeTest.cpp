@@ -692,6 +692,53 @@ TEST_P(StateChangeTest, VertexBufferUpdatedAfterDraw)
     ASSERT_GL_NO_ERROR();
 }
 
+// Tests that switching between contexts restores the state that differs between them.
+TEST_P(StateChangeTest, StateRestoredAfterContextSwitch)
+{
+    EGLWindow *window  = getEGLWindow();
+    EGLDisplay display = window->getDisplay();
+    EGLSurface surface = window->getSurface();
+
+    EGLint contextAttributes[] = {
+        EGL_CONTEXT_MAJOR_VERSION_KHR, GetParam().majorVersion, EGL_CONTEXT_MINOR_VERSION_KHR,
+        GetParam().minorVersion, EGL_NONE,
+    };
+    EGLContext otherContext =
+        eglCreateContext(display, window->getConfig(), EGL_NO_CONTEXT, contextAttributes);
+    ASSERT_NE(EGL_NO_CONTEXT, otherContext);
+
+    const int halfWidth = getWindowWidth() / 2;
+
+    // Only clear the left half to red in the test's context.
+    glClearColor(1.0f, 0.0f, 0.0f, 1.0f);
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(0, 0, halfWidth, getWindowHeight());
+
+    // Clear everything to green in the other context.
+    eglMakeCurrent(display, surface, surface, otherContext);
+    glClearColor(0.0f, 1.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    ASSERT_GL_NO_ERROR();
+
+    for (int iteration = 0; iteration < 2; ++iteration)
+    {
+        eglMakeCurrent(display, surface, surface, window->getContext());
+        glClear(GL_COLOR_BUFFER_BIT);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+        EXPECT_PIXEL_COLOR_EQ(getWindowWidth() - 1, 0, GLColor::green);
+
+        // The other context doesn't use the scissor test, so this clears everything again.
+        eglMakeCurrent(display, surface, surface, otherContext);
+        glClear(GL_COLOR_BUFFER_BIT);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+        EXPECT_PIXEL_COLOR_EQ(getWindowWidth() - 1, 0, GLColor::green);
+    }
+
+    eglMakeCurrent(display, surface, surface, window->getContext());
+    eglDestroyContext(display, otherContext);
+    ASSERT_GL_NO_ERROR();
+}
+
 // Test that switching VAOs keeps the disabled "current value" attributes up-to-date.
 TEST_P(StateChangeTestES3, VertexArrayObjectAndDisabledAttributes)
 {
@@ -1395,6 +1442,65 @@ TEST_P(SimpleStateChangeTest, DrawWithTextureTexSubImageThenDrawAgain)
     EXPECT_PIXEL_COLOR_EQ(0, getWindowHeight() / 4 * 3, GLColor::red);
 }
 
+// Test that updating a texture sampled by a draw into a framebuffer texture, and then the
+// framebuffer texture itself, leaves both with the expected contents.
+TEST_P(SimpleStateChangeTest, DrawToTextureThenTexSubImageSampledAndRenderTarget)
+{
+    GLuint program = get2DTexturedQuadProgram();
+    ASSERT_NE(0u, program);
+    glUseProgram(program);
+
+    std::array<GLColor, 4> colors    = {{GLColor::red, GLColor::red, GLColor::red, GLColor::red}};
+    std::array<GLColor, 4> subColors = {
+        {GLColor::green, GLColor::green, GLColor::green, GLColor::green}};
+
+    // The texture that is sampled.
+    GLTexture source;
+    glBindTexture(GL_TEXTURE_2D, source);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 2, 2, 0, GL_RGBA, GL_UNSIGNED_BYTE, colors.data());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+    // The texture that is rendered to.
+    GLTexture target;
+    glBindTexture(GL_TEXTURE_2D, target);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 2, 2, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+    GLFramebuffer framebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, target, 0);
+    ASSERT_GLENUM_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_FRAMEBUFFER));
+
+    GLint positionLocation = glGetAttribLocation(program, "position");
+    setupQuadVertexBuffer(1.0f, 1.0f);
+    glVertexAttribPointer(positionLocation, 3, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(positionLocation);
+
+    // Draw the red source into the target.
+    glViewport(0, 0, 2, 2);
+    glBindTexture(GL_TEXTURE_2D, source);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    ASSERT_GL_NO_ERROR();
+
+    // Update the source after it was sampled, and the bottom row of the target right after it
+    // was rendered to.
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 2, 2, GL_RGBA, GL_UNSIGNED_BYTE, subColors.data());
+    glBindTexture(GL_TEXTURE_2D, target);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 2, 1, GL_RGBA, GL_UNSIGNED_BYTE, subColors.data());
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    EXPECT_PIXEL_COLOR_EQ(0, 1, GLColor::red);
+
+    // Draw the updated source into the target again.
+    glBindTexture(GL_TEXTURE_2D, source);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    EXPECT_PIXEL_COLOR_EQ(0, 1, GLColor::green);
+}
+
 // Test that we can alternate between textures between different draws.
 TEST_P(SimpleStateChangeTest, DrawTextureAThenTextureBThenTextureA)
 {
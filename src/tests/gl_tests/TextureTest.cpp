@@ -3283,6 +3283,76 @@ TEST_P(Texture2DTestES3, UnpackOverlappingRowsFromUnpackBuffer)
     EXPECT_EQ(expected, actual);
 }
 
+// Test that updating part of a texture from rows that overlap in a pixel unpack buffer works as
+// expected.
+TEST_P(Texture2DTestES3, UnpackOverlappingRowsFromUnpackBufferSubImage)
+{
+    ANGLE_SKIP_TEST_IF(IsD3D11());
+
+    // Incorrect rendering results seen on OSX AMD.
+    ANGLE_SKIP_TEST_IF(IsOSX() && IsAMD());
+
+    const GLuint width            = 8u;
+    const GLuint height           = 8u;
+    const GLuint subImageOffset   = 2u;
+    const GLuint subImageSize     = 4u;
+    const GLuint unpackRowLength  = 3u;
+    const GLuint unpackSkipPixels = 1u;
+
+    setWindowWidth(width);
+    setWindowHeight(height);
+
+    glBindTexture(GL_TEXTURE_2D, mTexture2D);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+
+    std::vector<GLColor> pixelsRed(width * height, GLColor::red);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                 pixelsRed.data());
+    ASSERT_GL_NO_ERROR();
+
+    GLBuffer buf;
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buf.get());
+    std::vector<GLColor> pixelsGreen(
+        (subImageSize - 1u) * unpackRowLength + subImageSize + unpackSkipPixels, GLColor::green);
+
+    for (GLuint skippedPixel = 0u; skippedPixel < unpackSkipPixels; ++skippedPixel)
+    {
+        pixelsGreen[skippedPixel] = GLColor(255, 0, 0, 255);
+    }
+
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, pixelsGreen.size() * 4u, pixelsGreen.data(),
+                 GL_DYNAMIC_COPY);
+    ASSERT_GL_NO_ERROR();
+
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, unpackRowLength);
+    glPixelStorei(GL_UNPACK_SKIP_PIXELS, unpackSkipPixels);
+    ASSERT_GL_NO_ERROR();
+
+    glTexSubImage2D(GL_TEXTURE_2D, 0, subImageOffset, subImageOffset, subImageSize, subImageSize,
+                    GL_RGBA, GL_UNSIGNED_BYTE, 0);
+    ASSERT_GL_NO_ERROR();
+
+    glUseProgram(mProgram);
+    drawQuad(mProgram, "position", 0.5f);
+    ASSERT_GL_NO_ERROR();
+
+    GLuint windowPixelCount = getWindowWidth() * getWindowHeight();
+    std::vector<GLColor> actual(windowPixelCount, GLColor::black);
+    glReadPixels(0, 0, getWindowWidth(), getWindowHeight(), GL_RGBA, GL_UNSIGNED_BYTE,
+                 actual.data());
+
+    std::vector<GLColor> expected(windowPixelCount, GLColor::red);
+    for (GLuint y = subImageOffset; y < subImageOffset + subImageSize; ++y)
+    {
+        for (GLuint x = subImageOffset; x < subImageOffset + subImageSize; ++x)
+        {
+            expected[y * width + x] = GLColor::green;
+        }
+    }
+    EXPECT_EQ(expected, actual);
+}
+
 template <typename T>
 T UNorm(double value)
 {
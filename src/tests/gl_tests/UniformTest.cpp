@@ -249,6 +249,61 @@ void main() {
     }
 }
 
+// Test that setting the same values again, or an array update overlapping an earlier update of
+// one of its elements, leaves the uniform with the values last set.
+TEST_P(SimpleUniformTest, RepeatedAndOverlappingArrayUpdates)
+{
+    constexpr char kFragShader[] = R"(
+precision mediump float;
+uniform float ufloats[4];
+void main() {
+    gl_FragColor = vec4(ufloats[0], ufloats[1], ufloats[2], ufloats[3]);
+})";
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Zero(), kFragShader);
+    glUseProgram(program);
+
+    GLint firstLocation  = glGetUniformLocation(program, "ufloats");
+    GLint secondLocation = glGetUniformLocation(program, "ufloats[1]");
+    ASSERT_NE(-1, firstLocation);
+    ASSERT_NE(-1, secondLocation);
+
+    const GLfloat values[4] = {0.1f, 0.2f, 0.3f, 0.4f};
+    glUniform1fv(firstLocation, 4, values);
+    glUniform1fv(firstLocation, 4, values);
+    ASSERT_GL_NO_ERROR();
+
+    // Change one element through its own location, then set the whole array back.
+    glUniform1f(secondLocation, 0.5f);
+    GLfloat result = 0;
+    glGetUniformfv(program, secondLocation, &result);
+    EXPECT_EQ(0.5f, result);
+
+    glUniform1fv(firstLocation, 4, values);
+    ASSERT_GL_NO_ERROR();
+
+    for (int i = 0; i < 4; i++)
+    {
+        std::string locationName = "ufloats[" + std::to_string(i) + "]";
+        GLint location           = glGetUniformLocation(program, locationName.c_str());
+        glGetUniformfv(program, location, &result);
+        EXPECT_EQ(values[i], result) << " with i=" << i;
+    }
+
+    // Change only the last two elements.
+    const GLfloat newValues[4] = {0.1f, 0.2f, 0.7f, 0.8f};
+    glUniform1fv(firstLocation, 4, newValues);
+    ASSERT_GL_NO_ERROR();
+
+    for (int i = 0; i < 4; i++)
+    {
+        std::string locationName = "ufloats[" + std::to_string(i) + "]";
+        GLint location           = glGetUniformLocation(program, locationName.c_str());
+        glGetUniformfv(program, location, &result);
+        EXPECT_EQ(newValues[i], result) << " with i=" << i;
+    }
+}
+
 // Test that we can get and set an int array of uniforms.
 TEST_P(SimpleUniformTest, FloatIntUniformStateQuery)
 {
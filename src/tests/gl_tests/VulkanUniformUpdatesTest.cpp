@@ -43,11 +43,14 @@ TEST_P(VulkanUniformUpdatesTest, UpdateUntilNewBufferIsAllocated)
 {
     ASSERT_TRUE(IsVulkan());
 
+    // The padding makes the default uniform block too large for push constants, so that it is
+    // kept in the dynamic uniform buffer.
     constexpr char kPositionUniformVertexShader[] = R"(attribute vec2 position;
 uniform vec2 uniPosModifier;
+uniform vec4 uniPadding[16];
 void main()
 {
-    gl_Position = vec4(position + uniPosModifier, 0, 1);
+    gl_Position = vec4(position + uniPosModifier + uniPadding[0].xy + uniPadding[15].xy, 0, 1);
 })";
 
     constexpr char kColorUniformFragmentShader[] = R"(precision mediump float;
@@ -62,6 +65,7 @@ void main()
 
     const gl::State &state   = hackANGLE()->getGLState();
     rx::ProgramVk *programVk = rx::vk::GetImpl(state.getProgram());
+    ASSERT_FALSE(programVk->usesDefaultUniformsPushConstants());
 
     // Set a really small min size so that uniform updates often allocates a new buffer.
     programVk->setDefaultUniformBlocksMinSizeForTesting(128);
@@ -110,9 +114,12 @@ TEST_P(VulkanUniformUpdatesTest, DescriptorPoolUpdates)
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
     ASSERT_GL_NO_ERROR();
 
-    // Draw multiple times, each iteration will create a new descriptor set.
+    // Draw multiple times, each iteration will create a new descriptor set. Changing the sampler
+    // state recreates the sampler, so the texture descriptor set cache can't be hit.
     for (uint32_t iteration = 0; iteration < kMaxSetsForTesting * 8; ++iteration)
     {
+        GLint magFilter = (iteration % 2 == 0) ? GL_LINEAR : GL_NEAREST;
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, magFilter);
         glUniform1i(texLoc, 0);
         drawQuad(program, "position", 0.5f, 1.0f, true);
         swapBuffers();
@@ -120,6 +127,80 @@ TEST_P(VulkanUniformUpdatesTest, DescriptorPoolUpdates)
     }
 }
 
+// Switch back and forth between two textures so that the texture descriptor sets are served from
+// the cache, and make sure the right texture is sampled each time.
+TEST_P(VulkanUniformUpdatesTest, CachedTextureDescriptorSets)
+{
+    ASSERT_TRUE(IsVulkan());
+
+    GLuint program = get2DTexturedQuadProgram();
+    ASSERT_NE(0u, program);
+    glUseProgram(program);
+
+    GLint texLoc = glGetUniformLocation(program, "tex");
+    ASSERT_NE(-1, texLoc);
+    glUniform1i(texLoc, 0);
+
+    const std::vector<GLColor> redColors(4, GLColor::red);
+    const std::vector<GLColor> greenColors(4, GLColor::green);
+
+    GLTexture redTexture;
+    glBindTexture(GL_TEXTURE_2D, redTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 2, 2, 0, GL_RGBA, GL_UNSIGNED_BYTE, redColors.data());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+    GLTexture greenTexture;
+    glBindTexture(GL_TEXTURE_2D, greenTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 2, 2, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                 greenColors.data());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    ASSERT_GL_NO_ERROR();
+
+    for (uint32_t iteration = 0; iteration < 16; ++iteration)
+    {
+        bool useRed = (iteration % 2 == 0);
+        glBindTexture(GL_TEXTURE_2D, useRed ? redTexture : greenTexture);
+        drawQuad(program, "position", 0.5f, 1.0f, true);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, useRed ? GLColor::red : GLColor::green);
+        ASSERT_GL_NO_ERROR();
+    }
+}
+
+// Small default uniform blocks are kept in push constants. Switch between programs within one
+// render pass and make sure each draw sees its own program's uniforms.
+TEST_P(VulkanUniformUpdatesTest, PushConstantUniformsAcrossPrograms)
+{
+    ASSERT_TRUE(IsVulkan());
+
+    ANGLE_GL_PROGRAM(redProgram, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+    ANGLE_GL_PROGRAM(greenProgram, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+
+    glUseProgram(redProgram);
+    rx::ProgramVk *redProgramVk = rx::vk::GetImpl(hackANGLE()->getGLState().getProgram());
+    ASSERT_TRUE(redProgramVk->usesDefaultUniformsPushConstants());
+    glUniform4f(glGetUniformLocation(redProgram, essl1_shaders::ColorUniform()), 1.0f, 0.0f, 0.0f,
+                1.0f);
+
+    glUseProgram(greenProgram);
+    glUniform4f(glGetUniformLocation(greenProgram, essl1_shaders::ColorUniform()), 0.0f, 1.0f,
+                0.0f, 1.0f);
+
+    // The last draw reuses the red program without any uniform update, so its uniforms must be
+    // pushed again after the green program's.
+    drawQuad(redProgram, essl1_shaders::PositionAttrib(), 0.5f, 1.0f);
+    drawQuad(greenProgram, essl1_shaders::PositionAttrib(), 0.5f, 0.5f);
+    drawQuad(redProgram, essl1_shaders::PositionAttrib(), 0.5f, 0.25f);
+    ASSERT_GL_NO_ERROR();
+
+    const int w = getWindowWidth();
+    const int h = getWindowHeight();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    EXPECT_PIXEL_COLOR_EQ(w / 2 - w / 6, h / 2, GLColor::green);
+    EXPECT_PIXEL_COLOR_EQ(w / 2, h / 2, GLColor::red);
+}
+
 ANGLE_INSTANTIATE_TEST(VulkanUniformUpdatesTest, ES2_VULKAN());
 
 }  // anonymous namespace
@@ -1246,6 +1246,31 @@ TEST_P(WebGLCompatibilityTest, ForbidsClientSideElementBuffer)
     EXPECT_GL_ERROR(GL_INVALID_OPERATION);
 }
 
+// Test that buffers can't be bound to both GL_ELEMENT_ARRAY_BUFFER and GL_ARRAY_BUFFER
+TEST_P(WebGLCompatibilityTest, ForbidsBindingElementArrayBufferToOtherTargets)
+{
+    GLBuffer indexBuffer;
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer.get());
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    EXPECT_GL_NO_ERROR();
+
+    glBindBuffer(GL_ARRAY_BUFFER, indexBuffer.get());
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    GLBuffer vertexBuffer;
+    glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer.get());
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    EXPECT_GL_NO_ERROR();
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, vertexBuffer.get());
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    // Rebinding to the original target is still allowed.
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer.get());
+    glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer.get());
+    EXPECT_GL_NO_ERROR();
+}
+
 // Test that client-side array buffers are forbidden even if the program doesn't use the attribute
 TEST_P(WebGLCompatibilityTest, ForbidsClientSideArrayBufferEvenNotUsedOnes)
 {
@@ -1532,6 +1557,64 @@ TEST_P(WebGL2CompatibilityTest, DrawArraysBufferOutOfBoundsInstanced)
     ASSERT_GL_NO_ERROR();
 }
 
+// Test the checks for OOB reads in the vertex buffers follow divisor and buffer size changes
+TEST_P(WebGL2CompatibilityTest, DrawArraysBufferOutOfBoundsAfterStateChanges)
+{
+    const std::string &vert =
+        "attribute float a_pos;\n"
+        "attribute float a_w;\n"
+        "void main()\n"
+        "{\n"
+        "    gl_Position = vec4(a_pos, a_pos, a_pos, a_w);\n"
+        "}\n";
+
+    ANGLE_GL_PROGRAM(program, vert, essl1_shaders::fs::Red());
+    GLint posLocation = glGetAttribLocation(program.get(), "a_pos");
+    GLint wLocation = glGetAttribLocation(program.get(), "a_w");
+    ASSERT_NE(-1, posLocation);
+    ASSERT_NE(-1, wLocation);
+    glUseProgram(program.get());
+
+    GLBuffer buffer;
+    glBindBuffer(GL_ARRAY_BUFFER, buffer.get());
+    glBufferData(GL_ARRAY_BUFFER, 16, nullptr, GL_STATIC_DRAW);
+
+    glEnableVertexAttribArray(posLocation);
+    glVertexAttribPointer(posLocation, 1, GL_UNSIGNED_BYTE, GL_FALSE, 0, 0);
+
+    glEnableVertexAttribArray(wLocation);
+    glVertexAttribPointer(wLocation, 1, GL_UNSIGNED_BYTE, GL_FALSE, 0, 0);
+    glVertexAttribDivisor(wLocation, 4);
+
+    // With a divisor of 4, the 16 bytes are enough for 64 instances.
+    glDrawArraysInstanced(GL_POINTS, 0, 16, 64);
+    ASSERT_GL_NO_ERROR();
+
+    glDrawArraysInstanced(GL_POINTS, 0, 16, 65);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    // Without a divisor, the attribute limits the vertex count instead.
+    glVertexAttribDivisor(wLocation, 0);
+    glDrawArraysInstanced(GL_POINTS, 0, 16, 65);
+    ASSERT_GL_NO_ERROR();
+
+    glDrawArraysInstanced(GL_POINTS, 0, 17, 1);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    // Shrinking the buffer shrinks the limits of all the attributes using it.
+    glBufferData(GL_ARRAY_BUFFER, 8, nullptr, GL_STATIC_DRAW);
+    glDrawArrays(GL_POINTS, 0, 8);
+    ASSERT_GL_NO_ERROR();
+
+    glDrawArrays(GL_POINTS, 0, 9);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    // And growing it grows them.
+    glBufferData(GL_ARRAY_BUFFER, 32, nullptr, GL_STATIC_DRAW);
+    glDrawArrays(GL_POINTS, 0, 32);
+    ASSERT_GL_NO_ERROR();
+}
+
 // Test the checks for OOB reads in the vertex buffers, ANGLE_instanced_arrays version
 TEST_P(WebGLCompatibilityTest, DrawArraysBufferOutOfBoundsInstancedANGLE)
 {
@@ -1867,6 +1950,33 @@ TEST_P(WebGLCompatibilityTest, ShaderSourceLineContinuation)
     glDeleteShader(shader);
 }
 
+// Test that the indexed buffer bindings also forbid binding element array buffers, and that they
+// give buffers the type of other data buffers.
+TEST_P(WebGL2CompatibilityTest, ForbidsBindingElementArrayBufferToIndexedTargets)
+{
+    GLBuffer indexBuffer;
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer.get());
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, 16, nullptr, GL_STATIC_DRAW);
+    EXPECT_GL_NO_ERROR();
+
+    glBindBufferBase(GL_UNIFORM_BUFFER, 0, indexBuffer.get());
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glBindBufferRange(GL_TRANSFORM_FEEDBACK_BUFFER, 0, indexBuffer.get(), 0, 16);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    GLBuffer uniformBuffer;
+    glBindBufferBase(GL_UNIFORM_BUFFER, 0, uniformBuffer.get());
+    EXPECT_GL_NO_ERROR();
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, uniformBuffer.get());
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    // Unbinding the indexed targets is always allowed.
+    glBindBufferBase(GL_UNIFORM_BUFFER, 0, 0);
+    EXPECT_GL_NO_ERROR();
+}
+
 // Test that line continuation is handled correctly when valdiating shader source
 TEST_P(WebGL2CompatibilityTest, ShaderSourceLineContinuation)
 {
@@ -76,4 +76,65 @@ TEST_P(BasicDrawTest, EnableDisableTexture)
     EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
 }
 
+// Checks that switching back and forth between texturing states draws with the right state.
+TEST_P(BasicDrawTest, ToggleTextureBetweenDraws)
+{
+    GLTexture tex;
+    glBindTexture(GL_TEXTURE_2D, tex);
+
+    // Green
+    GLubyte texture[] = {
+        0x00, 0xff, 0x00,
+    };
+
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, 1, 1, 0, GL_RGB, GL_UNSIGNED_BYTE, texture);
+
+    for (int i = 0; i < 3; i++)
+    {
+        glDisable(GL_TEXTURE_2D);
+        drawRedQuad();
+
+        glEnable(GL_TEXTURE_2D);
+        glDrawArrays(GL_TRIANGLES, 0, 6);
+        EXPECT_GL_NO_ERROR();
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    }
+}
+
+// Checks that a matrix change made while drawing with one texturing state applies to the draws
+// made with another.
+TEST_P(BasicDrawTest, MatrixChangeAcrossTextureStates)
+{
+    GLTexture tex;
+    glBindTexture(GL_TEXTURE_2D, tex);
+
+    // Green
+    GLubyte texture[] = {
+        0x00, 0xff, 0x00,
+    };
+
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, 1, 1, 0, GL_RGB, GL_UNSIGNED_BYTE, texture);
+
+    drawRedQuad();
+
+    glEnable(GL_TEXTURE_2D);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+
+    // Move the quad away from the bottom left corner.
+    glMatrixMode(GL_MODELVIEW);
+    glTranslatef(2.0f, 0.0f, 0.0f);
+
+    glClearColor(0.0f, 0.0f, 1.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::blue);
+
+    glDisable(GL_TEXTURE_2D);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::blue);
+}
+
 ANGLE_INSTANTIATE_TEST(BasicDrawTest, ES1_D3D11(), ES1_OPENGL(), ES1_OPENGLES());
@@ -0,0 +1,74 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// GenerateMipPerf:
+//   Performance test for generating full mip chains on the CPU.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <gmock/gmock.h>
+
+#include <vector>
+
+#include "image_util/generatemip.h"
+
+using namespace testing;
+
+namespace
+{
+constexpr size_t kBaseSize = 1024;
+
+template <typename T>
+class GenerateMipPerfTest : public ANGLEPerfTest
+{
+  public:
+    GenerateMipPerfTest();
+
+    void step() override;
+
+  private:
+    // Each level is filtered from the previous one, like the back-ends do.
+    std::vector<std::vector<uint8_t>> mLevels;
+};
+
+template <typename T>
+GenerateMipPerfTest<T>::GenerateMipPerfTest() : ANGLEPerfTest("GenerateMipPerf", "_run")
+{
+    for (size_t size = kBaseSize; size > 0; size /= 2)
+    {
+        mLevels.emplace_back(size * size * sizeof(T), static_cast<uint8_t>(size));
+    }
+}
+
+template <typename T>
+void GenerateMipPerfTest<T>::step()
+{
+    for (size_t level = 1, size = kBaseSize; level < mLevels.size(); level++, size /= 2)
+    {
+        size_t sourceRowPitch = size * sizeof(T);
+        size_t destRowPitch   = sourceRowPitch / 2;
+        angle::GenerateMip<T>(size, size, 1, mLevels[level - 1].data(), sourceRowPitch,
+                              mLevels[level - 1].size(), mLevels[level].data(), destRowPitch,
+                              mLevels[level].size());
+    }
+}
+
+// These type names unfortunately don't get printed correctly in Gtest.
+using TestTypes = Types<angle::R8,
+                        angle::R8G8,
+                        angle::R8G8B8A8,
+                        angle::B8G8R8A8,
+                        angle::R8G8B8A8SRGB,
+                        angle::R16G16B16A16F,
+                        angle::R32G32B32A32F>;
+TYPED_TEST_CASE(GenerateMipPerfTest, TestTypes);
+
+TYPED_TEST(GenerateMipPerfTest, Run)
+{
+    this->run();
+}
+
+}  // anonymous namespace
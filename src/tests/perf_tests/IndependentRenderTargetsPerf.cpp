@@ -0,0 +1,160 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// IndependentRenderTargetsPerf:
+//   Performance test for rendering to many framebuffers that have no dependencies between them.
+//   On the Vulkan back-end each framebuffer ends up in its own command graph node, so this
+//   measures the cost of scheduling and submitting independent nodes.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+#include "test_utils/draw_call_perf_utils.h"
+
+namespace
+{
+
+struct IndependentRenderTargetsParams final : public RenderTestParams
+{
+    IndependentRenderTargetsParams()
+    {
+        majorVersion = 2;
+        minorVersion = 0;
+        windowWidth  = 256;
+        windowHeight = 256;
+    }
+
+    std::string suffix() const override
+    {
+        std::stringstream strstr;
+        strstr << RenderTestParams::suffix();
+        strstr << "_" << numRenderTargets << "_targets";
+
+        if (eglParameters.deviceType == EGL_PLATFORM_ANGLE_DEVICE_TYPE_NULL_ANGLE)
+        {
+            strstr << "_null";
+        }
+
+        return strstr.str();
+    }
+
+    unsigned int numRenderTargets = 16;
+    unsigned int drawsPerTarget   = 4;
+    GLsizei renderTargetSize      = 128;
+};
+
+std::ostream &operator<<(std::ostream &os, const IndependentRenderTargetsParams &params)
+{
+    os << params.suffix().substr(1);
+    return os;
+}
+
+class IndependentRenderTargetsBenchmark
+    : public ANGLERenderTest,
+      public ::testing::WithParamInterface<IndependentRenderTargetsParams>
+{
+  public:
+    IndependentRenderTargetsBenchmark()
+        : ANGLERenderTest("IndependentRenderTargets", GetParam())
+    {
+    }
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mProgram = 0;
+    GLuint mBuffer  = 0;
+    std::vector<GLuint> mFramebuffers;
+    std::vector<GLuint> mTextures;
+};
+
+void IndependentRenderTargetsBenchmark::initializeBenchmark()
+{
+    const auto &params = GetParam();
+
+    ASSERT_LT(0u, params.numRenderTargets);
+
+    mProgram = SetupSimpleDrawProgram();
+    ASSERT_NE(0u, mProgram);
+
+    mBuffer = Create2DTriangleBuffer(1, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(0);
+
+    mFramebuffers.resize(params.numRenderTargets, 0);
+    mTextures.resize(params.numRenderTargets, 0);
+    for (unsigned int index = 0; index < params.numRenderTargets; ++index)
+    {
+        CreateColorFBO(params.renderTargetSize, params.renderTargetSize, &mFramebuffers[index],
+                       &mTextures[index]);
+        ASSERT_GLENUM_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_FRAMEBUFFER));
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glViewport(0, 0, params.renderTargetSize, params.renderTargetSize);
+    glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void IndependentRenderTargetsBenchmark::destroyBenchmark()
+{
+    glDeleteProgram(mProgram);
+    glDeleteBuffers(1, &mBuffer);
+    glDeleteFramebuffers(static_cast<GLsizei>(mFramebuffers.size()), mFramebuffers.data());
+    glDeleteTextures(static_cast<GLsizei>(mTextures.size()), mTextures.data());
+}
+
+void IndependentRenderTargetsBenchmark::drawBenchmark()
+{
+    const auto &params = GetParam();
+
+    // None of the render targets are sampled in the frame, so the work on each is independent.
+    for (GLuint framebuffer : mFramebuffers)
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        for (unsigned int draw = 0; draw < params.drawsPerTarget; ++draw)
+        {
+            glDrawArrays(GL_TRIANGLES, 0, 3);
+        }
+    }
+
+    // Force a submit of the whole frame so the flush cost is part of the measurement.
+    glFlush();
+
+    ASSERT_GL_NO_ERROR();
+}
+
+TEST_P(IndependentRenderTargetsBenchmark, Run)
+{
+    run();
+}
+
+using namespace angle::egl_platform;
+
+IndependentRenderTargetsParams IndependentRenderTargets(const EGLPlatformParameters &eglParams,
+                                                        unsigned int numRenderTargets)
+{
+    IndependentRenderTargetsParams params;
+    params.eglParameters    = eglParams;
+    params.numRenderTargets = numRenderTargets;
+    return params;
+}
+
+}  // anonymous namespace
+
+ANGLE_INSTANTIATE_TEST(IndependentRenderTargetsBenchmark,
+                       IndependentRenderTargets(D3D11(), 16),
+                       IndependentRenderTargets(OPENGL_OR_GLES(false), 16),
+                       IndependentRenderTargets(VULKAN(), 4),
+                       IndependentRenderTargets(VULKAN(), 16),
+                       IndependentRenderTargets(VULKAN(), 64),
+                       IndependentRenderTargets(VULKAN_NULL(), 16));
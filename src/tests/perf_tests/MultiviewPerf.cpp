@@ -8,6 +8,8 @@
 //   - MultiviewCPUBoundBenchmark issues many draw calls and state changes to stress the CPU.
 //   - MultiviewGPUBoundBenchmark draws half a million quads with multiple attributes per vertex in
 //   order to stress the GPU's memory system.
+//   - MultiviewLayeredClearBenchmark clears layered multiview framebuffers which either cover the
+//   whole texture array or only some of its layers.
 //
 
 #include "ANGLEPerfTest.h"
@@ -476,6 +478,111 @@ void MultiviewGPUBoundBenchmark::renderScene()
     glDrawArrays(GL_TRIANGLES, 0, viewWidth * viewHeight * 6);
 }
 
+struct MultiviewLayeredClearParams final : public RenderTestParams
+{
+    MultiviewLayeredClearParams(const EGLPlatformParameters &platformParametersIn,
+                                int numLayersIn,
+                                bool scissorTestIn)
+    {
+        majorVersion  = 3;
+        minorVersion  = 0;
+        eglParameters = platformParametersIn;
+        windowWidth   = 1024;
+        windowHeight  = 768;
+        numViews      = 2;
+        numLayers     = numLayersIn;
+        scissorTest   = scissorTestIn;
+    }
+
+    std::string suffix() const override
+    {
+        std::string name = RenderTestParams::suffix();
+        name += "_" + ToString(numViews) + "_views_" + ToString(numLayers) + "_layers";
+        if (scissorTest)
+        {
+            name += "_scissored";
+        }
+        return name;
+    }
+
+    int numViews;
+    int numLayers;
+    bool scissorTest;
+};
+
+std::ostream &operator<<(std::ostream &os, const MultiviewLayeredClearParams &params)
+{
+    os << params.suffix().substr(1);
+    return os;
+}
+
+// Clearing some of the layers of a texture array can't be done with a single glClear on a layered
+// native framebuffer, so it is the case where the per-view overhead of clears shows.
+class MultiviewLayeredClearBenchmark
+    : public ANGLERenderTest,
+      public ::testing::WithParamInterface<MultiviewLayeredClearParams>
+{
+  public:
+    MultiviewLayeredClearBenchmark()
+        : ANGLERenderTest("MultiviewLayeredClearBenchmark", GetParam(), {"GL_ANGLE_multiview"})
+    {
+    }
+
+    void initializeBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLFramebuffer mFramebuffer;
+    GLTexture mColorTexture;
+    GLTexture mDepthTexture;
+};
+
+void MultiviewLayeredClearBenchmark::initializeBenchmark()
+{
+    const auto &params = GetParam();
+    ASSERT(params.numLayers >= params.numViews);
+
+    glBindTexture(GL_TEXTURE_2D_ARRAY, mColorTexture);
+    glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, params.windowWidth, params.windowHeight,
+                 params.numLayers, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+    glBindTexture(GL_TEXTURE_2D_ARRAY, mDepthTexture);
+    glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_DEPTH_COMPONENT32F, params.windowWidth,
+                 params.windowHeight, params.numLayers, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+
+    // Use the last layers so partial attachments don't start at the first layer either.
+    const int baseViewIndex = params.numLayers - params.numViews;
+
+    glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+    glFramebufferTextureMultiviewLayeredANGLE(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, mColorTexture,
+                                              0, baseViewIndex, params.numViews);
+    glFramebufferTextureMultiviewLayeredANGLE(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, mDepthTexture, 0,
+                                              baseViewIndex, params.numViews);
+    ASSERT_GLENUM_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_FRAMEBUFFER));
+
+    if (params.scissorTest)
+    {
+        glEnable(GL_SCISSOR_TEST);
+        glScissor(0, 0, params.windowWidth / 2, params.windowHeight / 2);
+    }
+
+    glClearColor(0, 0, 0, 0);
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void MultiviewLayeredClearBenchmark::drawBenchmark()
+{
+    const GLfloat kClearColor[4] = {0.0f, 1.0f, 0.0f, 1.0f};
+    const GLfloat kClearDepth    = 0.5f;
+
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    glClearBufferfv(GL_COLOR, 0, kClearColor);
+    glClearBufferfv(GL_DEPTH, 0, &kClearDepth);
+
+    ASSERT_GL_NO_ERROR();
+}
+
 namespace
 {
 MultiviewPerfWorkload SmallWorkload()
@@ -533,4 +640,15 @@ ANGLE_INSTANTIATE_TEST(MultiviewGPUBoundBenchmark,
                        SelectViewInVertexShader(egl_platform::OPENGL_OR_GLES(false), BigWorkload()),
                        SelectViewInVertexShader(egl_platform::D3D11(), BigWorkload()));
 
+TEST_P(MultiviewLayeredClearBenchmark, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(
+    MultiviewLayeredClearBenchmark,
+    MultiviewLayeredClearParams(egl_platform::OPENGL_OR_GLES(false), 2, false),
+    MultiviewLayeredClearParams(egl_platform::OPENGL_OR_GLES(false), 4, false),
+    MultiviewLayeredClearParams(egl_platform::OPENGL_OR_GLES(false), 4, true));
+
 }  // anonymous namespace
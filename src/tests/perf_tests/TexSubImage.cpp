@@ -32,6 +32,7 @@ struct TexSubImageParams final : public RenderTestParams
         subImageWidth  = 64;
         subImageHeight = 64;
         iterations     = 9;
+        uploadsPerDraw = 1;
     }
 
     std::string suffix() const override;
@@ -42,6 +43,9 @@ struct TexSubImageParams final : public RenderTestParams
     int subImageWidth;
     int subImageHeight;
     unsigned int iterations;
+
+    // Number of consecutive sub-image uploads between draws, as in texture atlas streaming.
+    unsigned int uploadsPerDraw;
 };
 
 std::ostream &operator<<(std::ostream &os, const TexSubImageParams &params)
@@ -85,8 +89,15 @@ class TexSubImageBenchmark : public ANGLERenderTest,
 
 std::string TexSubImageParams::suffix() const
 {
-    // TODO(jmadill)
-    return RenderTestParams::suffix();
+    std::stringstream strstr;
+    strstr << RenderTestParams::suffix();
+
+    if (uploadsPerDraw > 1)
+    {
+        strstr << "_" << uploadsPerDraw << "_uploads_per_draw";
+    }
+
+    return strstr.str();
 }
 
 TexSubImageBenchmark::TexSubImageBenchmark()
@@ -250,9 +261,13 @@ void TexSubImageBenchmark::drawBenchmark()
 
     for (unsigned int iteration = 0; iteration < params.iterations; ++iteration)
     {
-        glTexSubImage2D(GL_TEXTURE_2D, 0, rand() % (params.imageWidth - params.subImageWidth),
-                        rand() % (params.imageHeight - params.subImageHeight), params.subImageWidth,
-                        params.subImageHeight, GL_RGBA, GL_UNSIGNED_BYTE, mPixels);
+        for (unsigned int upload = 0; upload < params.uploadsPerDraw; ++upload)
+        {
+            glTexSubImage2D(GL_TEXTURE_2D, 0, rand() % (params.imageWidth - params.subImageWidth),
+                            rand() % (params.imageHeight - params.subImageHeight),
+                            params.subImageWidth, params.subImageHeight, GL_RGBA,
+                            GL_UNSIGNED_BYTE, mPixels);
+        }
 
         glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, 0);
     }
@@ -281,6 +296,23 @@ TexSubImageParams OpenGLOrGLESParams()
     return params;
 }
 
+TexSubImageParams VulkanParams()
+{
+    TexSubImageParams params;
+    params.eglParameters = egl_platform::VULKAN();
+    return params;
+}
+
+TexSubImageParams AtlasParams(const EGLPlatformParameters &eglParameters)
+{
+    TexSubImageParams params;
+    params.eglParameters  = eglParameters;
+    params.subImageWidth  = 16;
+    params.subImageHeight = 16;
+    params.uploadsPerDraw = 64;
+    return params;
+}
+
 }  // namespace
 
 TEST_P(TexSubImageBenchmark, Run)
@@ -288,4 +320,11 @@ TEST_P(TexSubImageBenchmark, Run)
     run();
 }
 
-ANGLE_INSTANTIATE_TEST(TexSubImageBenchmark, D3D11Params(), D3D9Params(), OpenGLOrGLESParams());
+ANGLE_INSTANTIATE_TEST(TexSubImageBenchmark,
+                       D3D11Params(),
+                       D3D9Params(),
+                       OpenGLOrGLESParams(),
+                       VulkanParams(),
+                       AtlasParams(egl_platform::D3D11()),
+                       AtlasParams(egl_platform::OPENGL_OR_GLES(false)),
+                       AtlasParams(egl_platform::VULKAN()));
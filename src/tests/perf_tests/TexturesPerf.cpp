@@ -32,6 +32,7 @@ struct TexturesParams final : public RenderTestParams
         numTextures                 = 8;
         textureRebindFrequency      = 5;
         textureStateUpdateFrequency = 3;
+        textureUploadFrequency      = 0;
         textureMipCount             = 8;
 
         webgl = false;
@@ -41,6 +42,9 @@ struct TexturesParams final : public RenderTestParams
     size_t numTextures;
     size_t textureRebindFrequency;
     size_t textureStateUpdateFrequency;
+
+    // Zero disables the texel uploads to textures that are bound for drawing.
+    size_t textureUploadFrequency;
     size_t textureMipCount;
 
     bool webgl;
@@ -63,6 +67,10 @@ std::string TexturesParams::suffix() const
     strstr << "_" << numTextures << "_textures";
     strstr << "_" << textureRebindFrequency << "_rebind";
     strstr << "_" << textureStateUpdateFrequency << "_state";
+    if (textureUploadFrequency > 0)
+    {
+        strstr << "_" << textureUploadFrequency << "_upload";
+    }
     strstr << "_" << textureMipCount << "_mips";
 
     if (webgl)
@@ -267,6 +275,17 @@ void TexturesBenchmark::drawBenchmark()
             }
         }
 
+        if (params.textureUploadFrequency > 0 && it % params.textureUploadFrequency == 0)
+        {
+            // Update one texel of a texture that the next draw samples from
+            size_t uploadCount   = it / params.textureUploadFrequency;
+            size_t uploadTexture = uploadCount % (params.numTextures - 1);
+            GLubyte texel[4]     = {static_cast<GLubyte>(uploadCount), 0u, 0u, 255u};
+
+            glActiveTexture(static_cast<GLenum>(GL_TEXTURE0 + uploadTexture));
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, texel);
+        }
+
         glDrawArrays(GL_TRIANGLES, 0, 3);
     }
 
@@ -297,6 +316,13 @@ TexturesParams OpenGLOrGLESParams(bool webglCompat)
     return params;
 }
 
+TexturesParams OpenGLOrGLESUploadParams()
+{
+    TexturesParams params         = OpenGLOrGLESParams(false);
+    params.textureUploadFrequency = 2;
+    return params;
+}
+
 TEST_P(TexturesBenchmark, Run)
 {
     run();
@@ -307,6 +333,7 @@ ANGLE_INSTANTIATE_TEST(TexturesBenchmark,
                        D3D11Params(true),
                        D3D9Params(true),
                        OpenGLOrGLESParams(false),
-                       OpenGLOrGLESParams(true));
+                       OpenGLOrGLESParams(true),
+                       OpenGLOrGLESUploadParams());
 
 }  // namespace angle
@@ -145,6 +145,7 @@
 #include <string>
 
 #include "common/event_tracer.h"
+#include "common/trace_recorder.h"
 
 // By default, const char* argument values are assumed to have long-lived scope
 // and will not be copied. Use this macro to force a const char* to be copied.
@@ -487,19 +488,29 @@
 #define INTERNALTRACEEVENTUID(name_prefix) \
     INTERNAL_TRACE_EVENT_UID2(name_prefix, __LINE__)
 
-// Implementation detail: internal macro to create static category.
+// Implementation detail: internal macro to create static category. Categories
+// left out of ANGLE_TRACE_EVENT_CATEGORIES are never looked up, and the
+// events using them are removed at compile time.
 #define INTERNAL_TRACE_EVENT_GET_CATEGORY_INFO(category) \
+    constexpr bool INTERNALTRACEEVENTUID(catcompiled) = \
+        angle::IsTraceCategoryCompiledIn(category); \
     static const unsigned char* INTERNALTRACEEVENTUID(catstatic) = 0; \
-    if (!INTERNALTRACEEVENTUID(catstatic)) \
+    if (INTERNALTRACEEVENTUID(catcompiled) && \
+        !INTERNALTRACEEVENTUID(catstatic)) \
       INTERNALTRACEEVENTUID(catstatic) = \
           TRACE_EVENT_API_GET_CATEGORY_ENABLED(category);
 
+// Implementation detail: whether the category of the last
+// INTERNAL_TRACE_EVENT_GET_CATEGORY_INFO is enabled.
+#define INTERNAL_TRACE_EVENT_CATEGORY_ENABLED() \
+    (INTERNALTRACEEVENTUID(catcompiled) && *INTERNALTRACEEVENTUID(catstatic))
+
 // Implementation detail: internal macro to create static category and add
 // event if the category is enabled.
 #define INTERNAL_TRACE_EVENT_ADD(phase, category, name, flags, ...) \
     do { \
         INTERNAL_TRACE_EVENT_GET_CATEGORY_INFO(category); \
-        if (*INTERNALTRACEEVENTUID(catstatic)) { \
+        if (INTERNAL_TRACE_EVENT_CATEGORY_ENABLED()) { \
             gl::TraceEvent::addTraceEvent( \
                 phase, INTERNALTRACEEVENTUID(catstatic), name, \
                 gl::TraceEvent::noEventId, flags, ##__VA_ARGS__); \
@@ -513,7 +524,7 @@
     INTERNAL_TRACE_EVENT_GET_CATEGORY_INFO(category); \
     gl::TraceEvent::TraceEndOnScopeClose \
         INTERNALTRACEEVENTUID(profileScope); \
-    if (*INTERNALTRACEEVENTUID(catstatic)) { \
+    if (INTERNAL_TRACE_EVENT_CATEGORY_ENABLED()) { \
       gl::TraceEvent::addTraceEvent( \
           TRACE_EVENT_PHASE_BEGIN, \
           INTERNALTRACEEVENTUID(catstatic), \
@@ -529,7 +540,7 @@
                                          ...) \
     do { \
         INTERNAL_TRACE_EVENT_GET_CATEGORY_INFO(category); \
-        if (*INTERNALTRACEEVENTUID(catstatic)) { \
+        if (INTERNAL_TRACE_EVENT_CATEGORY_ENABLED()) { \
             unsigned char traceEventFlags = flags | TRACE_EVENT_FLAG_HAS_ID; \
             gl::TraceEvent::TraceID traceEventTraceID( \
                 id, &traceEventFlags); \